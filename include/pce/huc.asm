@@ -1072,66 +1072,89 @@ umod:
 ; IN :  primary register (A:X) contain the discriminant value
 ;       i.e. the one that will be checked against those indicated in the
 ;       various case instructions
-;       On the stack, a pointer is passed
-;       This is a pointer toward an array
-;       Each item of this array is a 4 bytes long structure
-;       The structure is the following :
+;       __ptr points to the case table, Y holds the index of its last
+;       entry
+;       The table starts with the default label, followed by 4 bytes
+;       long structures sorted on their (unsigned) value :
 ;         WORD value_to_check
 ;         WORD label_to_jump_to
-;       We have to parse the whole array in order to compare the primary
-;       register with all the 'value_to_check' field. If we ever find that
-;       the primary register is egal to such a value, we must jump to the
-;       corresponding 'label_to_jump_to'.
-;       The default value (which also means that we reached the end of the
-;       array) can be recognized with its 'label_to_jump_to' field set to 0.
-;       Then the 'value_to_check' field become the default label we have to
-;       use for the rest of the execution.
+;       The table is binary searched for the primary register; if it
+;       is found we jump to the corresponding 'label_to_jump_to',
+;       otherwise to the default label.
+;       Small and dense switches are dispatched inline by the compiler
+;       and do not come here.
 ; ----
 ; OUT : The execution goes to another place
 ; ----
 ; REMARK : Also use remain variable as a temporary value
+;          __temp+2 and __temp+3 hold the search bounds
 ; ----
 
 ___case:
-	__stw	<remain		; store the value to check to
-	__ldwp	__stack
-	__stw	<__ptr		; __ptr contain the address of the array
-
-	__addmi	2,__stack
+	stx	<remain		; store the value to check to
+	sta	<remain+1
+	stz	<__temp+2
+	sty	<__temp+3
 
 .begin_case:
-	addw	#2,<__ptr
-	__ldwp	__ptr
-	__tstw
-	__lbeq	.end_case_default
-
-	addw	#-2,<__ptr
-	__ldwp	__ptr
-
-	__addmi	-2,__stack
-	__stwp	__stack
-
-	addw	#4,<__ptr
-
-	__ldw	<remain
-
-	jsr	eq
-	__tstw
-	__lbeq	.begin_case
+	lda	<__temp+2	; X = (low + high) / 2
+	clc
+	adc	<__temp+3
+	ror	a
+	tax
 
-	addw	#-2,<__ptr
-	__ldwp	__ptr
-	__stw	<__temp
+	stz	<__temp+1	; __temp = __ptr + X * 4
+	asl	a
+	rol	<__temp+1
+	asl	a
+	rol	<__temp+1
+	adc	<__ptr
+	sta	<__temp
+	lda	<__temp+1
+	adc	<__ptr+1
+	sta	<__temp+1
 
+	ldy	#3		; compare against the entry, high byte first
+	lda	<remain+1
+	cmp	[__temp],Y
+	bne	.not_equal
+	dey
+	lda	<remain
+	cmp	[__temp],Y
+	beq	.end_case
+
+.not_equal:
+	bcc	.lower
+	cpx	<__temp+3	; value is above the entry
+	beq	.end_case_default
+	inx
+	stx	<__temp+2
+	bra	.begin_case
+
+.lower:
+	cpx	<__temp+2	; value is below the entry
+	beq	.end_case_default
+	dex
+	stx	<__temp+3
+	bra	.begin_case
+
+.end_case:
+	ldy	#4
+	lda	[__temp],Y
+	tax
+	iny
+	lda	[__temp],Y
+	stx	<__temp
+	sta	<__temp+1
 	jmp	[__temp]
 
 .end_case_default:	; if we haven't found any corresponding value
 			; then we jump to the default supplied label
-
-	addw	#-2,<__ptr
-	__ldwp	__ptr
-	__stw	<__temp
-
+	lda	[__ptr]
+	sta	<__temp
+	ldy	#1
+	lda	[__ptr],Y
+	sta	<__temp+1
 	jmp	[__temp]
 
 
@@ -58,6 +58,7 @@ void header (void)
 	outstr("\n");
 	outstr("HUC\t= 1\n");
 	/* Reserve space for further global definitions. */
+	outflush();
 	output_globdef = ftell(output);
 	outstr("                                                                           ");
 	nl();
@@ -234,7 +234,8 @@ long get_raw_value (char sep)
 		/* parse */
 		if (an(c)) {
 			flag = 1;
-			*ptr++ = c;
+			if (ptr < tmp + LINESIZE)
+				*ptr++ = c;
 		}
 		else {
 			/* add buffer */
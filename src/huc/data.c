@@ -21,8 +21,7 @@ long const_nb;
 
 /* storage words */
 
-SYMBOL symtab[SYMTBSZ];
-SYMBOL *glbptr, *rglbptr, *locptr;
+long glbptr, rglbptr, locptr;
 long ws[WSTABSZ];
 long *wsptr;
 long swstcase[SWSTSZ];
@@ -31,10 +30,12 @@ long swstp;
 char litq[LITABSZ];
 char litq2[LITABSZ];
 long litptr;
-struct macro macq[MACQSIZE];
+struct macro *macq;
 long macptr;
-char line[LINESIZE];
-char mline[LINESIZE];
+long maclookups, machits;
+char *line;
+char *mline;
+long linesize, mlinesize;
 long lptr, mptr;
 
 TAG_SYMBOL tag_table[NUMTAG];	// start of structure tag table
@@ -65,8 +66,9 @@ long nxtlab,
 
 long top_level_stkp;
 
-FILE *input, *input2, *output;
-FILE *inclstk[INCLSIZ];
+INFILE *input, *input2;
+FILE *output;
+INFILE *inclstk[INCLSIZ];
 
 char inclstk_name[INCLSIZ][FILENAMESIZE];
 char fname_copy[FILENAMESIZE];
@@ -84,6 +86,9 @@ long fexitlab;
 long iflevel, skiplevel;
 long errfile;
 long sflag;
+long keepflag;
+char *asmbuf;
+size_t asmbuflen;
 long cdflag;
 long verboseflag;
 long startup_incl;
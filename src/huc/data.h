@@ -19,8 +19,7 @@ extern long const_nb;
 
 /* storage words */
 
-extern SYMBOL symtab[];
-extern SYMBOL *glbptr, *rglbptr, *locptr;
+extern long glbptr, rglbptr, locptr;
 extern long ws[];
 extern long *wsptr;
 extern long swstcase[];
@@ -29,10 +28,12 @@ extern long swstp;
 extern char litq[];
 extern char litq2[];
 extern long litptr;
-extern struct macro macq[];
+extern struct macro *macq;
 extern long macptr;
-extern char line[];
-extern char mline[];
+extern long maclookups, machits;
+extern char *line;
+extern char *mline;
+extern long linesize, mlinesize;
 extern long lptr, mptr;
 
 extern TAG_SYMBOL tag_table[NUMTAG];	// start of structure tag table
@@ -61,8 +62,9 @@ extern long nxtlab,
 	    optimize,
 	    globals_h_in_process;
 
-extern FILE *input, *input2, *output;
-extern FILE *inclstk[];
+extern INFILE *input, *input2;
+extern FILE *output;
+extern INFILE *inclstk[];
 
 extern char inclstk_name[INCLSIZ][FILENAMESIZE];
 extern long inclstk_line[];
@@ -80,6 +82,9 @@ extern long fexitlab;
 extern long iflevel, skiplevel;
 extern long errfile;
 extern long sflag;
+extern long keepflag;
+extern char *asmbuf;
+extern size_t asmbuflen;
 extern long cdflag;
 extern long verboseflag;
 extern long startup_incl;
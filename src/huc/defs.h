@@ -177,14 +177,14 @@
  * #define	SYMTBSZ	32768
  * #define	NUMGLBS	1500
  */
-#define SYMTBSZ 4096
+/* Global and local symbols are allocated from arenas that grow in
+   chunks of SYMCHUNK entries, so symbol pointers stay valid as the
+   tables grow.  Lookups go through hash tables with SYMHASHSZ buckets
+   (must be a power of two). */
+#define SYMCHUNK        1024
+#define SYMHASHSZ       1024
 #define NUMGLBS 2048
 
-#define STARTGLB        symtab
-#define ENDGLB  (STARTGLB + NUMGLBS)
-#define STARTLOC        (ENDGLB + 1)
-#define ENDLOC  (symtab + SYMTBSZ - 1)
-
 /* symbol table entry format */
 
 #define NAMESIZE        26
@@ -200,10 +200,26 @@ struct symbol {
 	short tagidx;
 	int size;
 	int ptr_order;
+	struct symbol *hnext;	/* next symbol in hash chain */
 };
 
 typedef struct symbol SYMBOL;
 
+/* source file contents, read once per run (see inopen()) */
+struct srcfile {
+	char *name;
+	char *data;		/* whole file, NUL-terminated */
+	long size;
+	struct srcfile *next;	/* next file in the cache */
+};
+
+/* an open source file */
+typedef struct infile {
+	struct srcfile *src;
+	long pos;		/* offset of the next line */
+	int eof;		/* a read hit the end of the file */
+} INFILE;
+
 #define NUMTAG  10
 
 struct tag_symbol {
@@ -281,6 +297,14 @@ struct tag_symbol {
 
 #define SWSTSZ  256
 
+/* switch lowering: up to SWCHAIN cases use a compare chain, a jump
+   table is used for at most SWTABMAX values with no more than one
+   case in SWHOLES filled, a binary search otherwise */
+
+#define SWCHAIN         4
+#define SWTABMAX        128
+#define SWHOLES         3
+
 /* literal pool */
 
 #define LITABSZ 8192
@@ -290,16 +314,19 @@ struct tag_symbol {
 
 #define LITMAX2 LITABSZ - 1
 
-/* input line */
+/* output buffer (see outbyte()) */
+
+#define OBUFSIZE        65536
+
+/* input line (initial size, line[] and mline[] grow as needed) */
 
 #define LINESIZE        384
 #define LINEMAX (LINESIZE - 1)
-#define MPMAX   LINEMAX
 
 /* macro (define) pool */
 
-#define MACQSIZE        16384
-#define MACMAX  (MACQSIZE - 1)
+/* initial size of the macro hash index; must be a power of two */
+#define MACHASHSZ       512
 
 struct macro {
 	char *name;
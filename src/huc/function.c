@@ -118,7 +118,7 @@ void newfunc (const char *sname, int ret_ptr_order, int ret_type, int ret_otag,
 			strcpy(fc->fname, n);
 	}
 
-	locptr = STARTLOC;
+	locptr = 0;
 	argstk = 0;
 	argtop = 0;
 	nbarg = 0;
@@ -431,7 +431,7 @@ void newfunc (const char *sname, int ret_ptr_order, int ret_type, int ret_otag,
 
 	nl();
 	stkp = 0;
-	locptr = STARTLOC;
+	locptr = 0;
 	norecurse = save_norecurse;
 }
 
@@ -354,14 +354,6 @@ void gasrint (void)
 	out_ins(I_ASRW, (long)NULL, (long)NULL);
 }
 
-/*
- *	Case jump instruction
- */
-void gjcase (void)
-{
-	out_ins(I_JMP, T_SYMBOL, (long)"__case");
-}
-
 /*
  *	add the primary and secondary registers
  *	if lval2 is int pointer and lval is int, scale lval
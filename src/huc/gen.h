@@ -27,7 +27,6 @@ void testjump (long label, long ft);
 long modstk (long newstkp);
 void gaslint (void);
 void gasrint (void);
-void gjcase (void);
 void gadd (LVALUE *lval, LVALUE *lval2);
 void gsub (void);
 void gmult (int is_unsigned);
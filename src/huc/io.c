@@ -4,6 +4,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "defs.h"
 #include "data.h"
@@ -12,6 +13,87 @@
 #include "preproc.h"
 #include "main.h"
 #include "code.h"
+#include "pch.h"
+
+/* every source file read during this run, by path */
+static struct srcfile *srccache;
+
+/*
+ *	open a source file
+ * Input : char* name
+ * Output : INFILE*, NULL if the file can't be opened
+ *
+ * The whole file is read into memory the first time it is opened and
+ * kept for the rest of the run, so headers included by several files
+ * are read from disk only once.
+ *
+ */
+INFILE *inopen (char *name)
+{
+	struct srcfile *src;
+	INFILE *f;
+	FILE *fp;
+	long n, max;
+
+	for (src = srccache; src; src = src->next)
+		if (!strcmp(src->name, name))
+			break;
+	if (!src) {
+		if ((fp = fopen(name, "r")) == NULL)
+			return (NULL);
+
+		/* text mode may translate line ends, so don't go by the
+		   size of the file */
+		src = malloc(sizeof(*src));
+		src->data = NULL;
+		src->size = max = 0;
+		do {
+			if (src->size == max) {
+				max += 65536;
+				src->data = realloc(src->data, max + 1);
+			}
+			n = fread(src->data + src->size, 1, max - src->size, fp);
+			src->size += n;
+		} while (n > 0);
+		fclose(fp);
+		src->data[src->size] = 0;
+		src->name = strdup(name);
+		src->next = srccache;
+		srccache = src;
+	}
+	f = malloc(sizeof(*f));
+	f->src = src;
+	f->pos = 0;
+	f->eof = 0;
+	return (f);
+}
+
+/*
+ *	close a source file; its contents stay cached
+ */
+void inclose (INFILE *f)
+{
+	free(f);
+}
+
+/*
+ *	end of file test, same as feof()
+ */
+long infeof (INFILE *f)
+{
+	return (!f || f->eof);
+}
+
+/*
+ *	make room for a line of n characters in line[]
+ */
+void growline (long n)
+{
+	if (n >= linesize) {
+		linesize = n + LINESIZE;
+		line = realloc(line, linesize);
+	}
+}
 
 /*
  *	open input file
@@ -32,7 +114,7 @@ long openin (char *p)
 		fprintf(stderr, "%s: unknown file type\n", fname);
 		return (NO);
 	}
-	if ((input = fopen(fname, "r")) == NULL) {
+	if ((input = inopen(fname)) == NULL) {
 		perror(fname);
 		return (NO);
 	}
@@ -52,6 +134,13 @@ long openin (char *p)
  */
 long openout (void)
 {
+	/* the in-process assembler is fed from memory unless the .s
+	   file is wanted or another assembler has to read it */
+	if (!sflag && !keepflag && !getenv("PCE_PCEAS")) {
+		output = open_memstream(&asmbuf, &asmbuflen);
+		kill();
+		return (YES);
+	}
 	if (user_outfile[0])
 		output = fopen(user_outfile, "w");
 	else {
@@ -159,7 +248,8 @@ void unget_line (void)
 
 	i = strlen(line);
 	if (i > 0) {
-		fseek(input, 0 - i - CR_LEN, SEEK_CUR);
+		input->pos -= i + 1;
+		input->eof = 0;
 		line_number--;
 	}
 
@@ -178,24 +268,36 @@ void unget_line (void)
  */
 void readline (void)
 {
-	long k;
-	FILE *unit;
+	INFILE *unit;
+	char *p, *start, *end;
 
 	FOREVER {
-		if (!input || feof(input))
+		if (infeof(input))
 			return;
 
-		if ((unit = input2) == NULL)
+		if ((unit = input2) == NULL) {
 			unit = input;
+			if (pch_recording)
+				pch_reached();
+		}
 		kill();
-		while ((k = fgetc(unit)) != EOF) {
-			if ((k == '\r') | (k == EOL) | (lptr >= LINEMAX))
-				break;
-			line[lptr++] = k;
+		/* lines are copied out of the file buffer in one go; they
+		   have no length limit */
+		start = unit->src->data + unit->pos;
+		end = unit->src->data + unit->src->size;
+		for (p = start; p < end && *p != '\r' && *p != EOL; p++) ;
+		lptr = p - start;
+		growline(lptr);
+		memcpy(line, start, lptr);
+		if (p < end)
+			unit->pos += lptr + 1;
+		else {
+			unit->pos += lptr;
+			unit->eof = 1;
 		}
 		line_number++;
 		line[lptr] = 0;
-		if (k <= 0)
+		if (unit->eof)
 			if (input2 != NULL) {
 				if (globals_h_in_process) {
 					/* Add special treatment to ensure globals.h stuff appears at the beginning */
@@ -205,7 +307,7 @@ void readline (void)
 				}
 				input2 = inclstk[--inclsp];
 				line_number = inclstk_line[inclsp];
-				fclose(unit);
+				inclose(unit);
 			}
 		if (lptr) {
 			if ((ctext) & (cmode)) {
@@ -232,7 +334,7 @@ void readline (void)
 long inbyte (void)
 {
 	while (ch() == 0) {
-		if (feof(input))
+		if (infeof(input))
 			return (0);
 
 		preprocess();
@@ -253,7 +355,7 @@ long inchar (void)
 {
 	if (ch() == 0)
 		readline();
-	if (feof(input))
+	if (infeof(input))
 		return (0);
 
 	return (gch());
@@ -499,12 +601,18 @@ void outlabel (long label)
 void outdec (long number)
 {
 	char s[21];
-	int i = 0;
-
-	sprintf(s, "%ld", number);
-
-	while (s[i])
-		outbyte(s[i++]);
+	char *p = s + sizeof(s);
+	unsigned long n = number;
+
+	if (number < 0)
+		n = -n;
+	do {
+		*--p = '0' + n % 10;
+		n /= 10;
+	} while (n);
+	if (number < 0)
+		*--p = '-';
+	outmem(p, s + sizeof(s) - p);
 }
 
 /*
@@ -540,15 +648,7 @@ void outdec (long number)
 /* Newer version, shorter and certainly faster */
 void outhex (long number)
 {
-	int i = 0;
-	char s[10];
-
-	outbyte('$');
-
-	sprintf(s, "%0X", (int)number);
-
-	while (s[i])
-		outbyte(s[i++]);
+	outhexfix(number, 1);
 }
 
 /*
@@ -556,20 +656,70 @@ void outhex (long number)
  */
 void outhexfix (long number, long length)
 {
-	int i = 0;
-	char s[10];
-	char format[10];
-
-	outbyte('$');
+	static const char digits[] = "0123456789ABCDEF";
+	char s[12];
+	char *p = s + sizeof(s);
+	unsigned int n = number;
+
+	do {
+		*--p = digits[n & 15];
+		n >>= 4;
+	} while (n || s + sizeof(s) - p < length);
+	*--p = '$';
+	outmem(p, s + sizeof(s) - p);
+}
 
-	sprintf(format, "%%0%dX", (int)length);
 
-	sprintf(s, format, number);
+/*
+ *	generated code is collected in obuf and written out in blocks;
+ *	the pending bytes belong to obuf_fp, which is flushed whenever the
+ *	code generator switches output to another file
+ */
+static char obuf[OBUFSIZE];
+static long obuf_len;
+static FILE *obuf_fp;
 
-	while (s[i])
-		outbyte(s[i++]);
+/*
+ *             outflush
+ * Input : nothing
+ * Output : nothing
+ *
+ * Write the pending output to its file; must be called before output
+ * is closed or repositioned
+ *
+ */
+void outflush (void)
+{
+	if (obuf_len) {
+		fwrite(obuf, 1, obuf_len, obuf_fp);
+		obuf_len = 0;
+	}
 }
 
+/*
+ *             outmem
+ * Input : char* ptr, long len
+ * Output : nothing
+ *
+ * Append len bytes to the assembler file
+ *
+ */
+void outmem (const char *ptr, long len)
+{
+	if (output != obuf_fp) {
+		outflush();
+		obuf_fp = output;
+	}
+	if (obuf_len + len > OBUFSIZE) {
+		outflush();
+		if (len > OBUFSIZE) {
+			fwrite(ptr, 1, len, output);
+			return;
+		}
+	}
+	memcpy(obuf + obuf_len, ptr, len);
+	obuf_len += len;
+}
 
 /*
  *             outbyte
@@ -584,7 +734,11 @@ char outbyte (char c)
 	if (c == 0)
 		return (0);
 
-	fputc(c, output);
+	if (output != obuf_fp || obuf_len == OBUFSIZE) {
+		outflush();
+		obuf_fp = output;
+	}
+	obuf[obuf_len++] = c;
 	return (c);
 }
 
@@ -599,8 +753,5 @@ char outbyte (char c)
 void outstr (char *ptr)
 /*char	ptr[];*/
 {
-	long k;
-
-	k = 0;
-	while (outbyte(ptr[k++])) ;
+	outmem(ptr, strlen(ptr));
 }
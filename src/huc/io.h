@@ -6,13 +6,10 @@
 #ifndef _IO_H
 #define _IO_H
 
-#if defined(DJGPP) || defined(MSDOS) || defined(WIN32)
-#define CR_LEN  2
-#else
-#define CR_LEN  1
-#endif
-
-
+INFILE *inopen (char *name);
+void inclose (INFILE *f);
+long infeof (INFILE *f);
+void growline (long n);
 long openin (char *p);
 long openout (void);
 void outfname (char *s);
@@ -50,6 +47,8 @@ void outlabel (long label);
 void outdec (long number);
 void outhex (long number);
 void outhexfix (long number, long length);
+void outflush (void);
+void outmem (const char *ptr, long len);
 char outbyte (char c);
 void outstr (char *ptr);
 
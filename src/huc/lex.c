@@ -161,7 +161,7 @@ void blanks (void)
 	FOREVER {
 		while (ch() == 0 && !lex_stop_at_eol) {
 			preprocess();
-			if (!input || feof(input))
+			if (!input || infeof(input))
 				break;
 		}
 		if (ch() == ' ')
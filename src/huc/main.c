@@ -31,12 +31,14 @@
 #include "lex.h"
 #include "main.h"
 #include "optimize.h"
+#include "pch.h"
 #include "pragma.h"
 #include "preproc.h"
 #include "primary.h"
 #include "pseudo.h"
 #include "sym.h"
 #include "struct.h"
+#include "../mkit/as/pceas.h"
 
 static char **link_libs = 0;
 static int link_lib_ptr;
@@ -70,11 +72,13 @@ int main (int argc, char *argv[])
 	int first = 1;
 	char *asmdefs_global_end;
 
+	growline(LINEMAX);
 	macptr = 0;
 	ctext = 0;
 	argc--; argv++;
 	errs = 0;
 	sflag = 0;
+	keepflag = 0;
 	cdflag = 0;
 	verboseflag = 0;
 	startup_incl = 0;
@@ -112,6 +116,11 @@ int main (int argc, char *argv[])
 						p += 2;
 						break;
 					}
+					else if (strncmp(p, "save-temps", 10) == 0) {
+						keepflag = 1;	/* keep the .s file */
+						p += 9;
+						break;
+					}
 				/* fallthrough */
 				case 'S':
 					sflag = 1;
@@ -251,6 +260,8 @@ unknown_option:
 	printf(HUC_VERSION);
 	printf("\n");
 	init_path();
+	/* error exits must not lose buffered output */
+	atexit(outflush);
 	/* Remember the first file, it will be used as the base for the
 	   output file name unless there is a user-specified outfile. */
 	p = pp = infiles[0];
@@ -271,8 +282,8 @@ unknown_option:
 		   defines end. */
 		asmdefs_global_end[0] = 0;
 		if (extension(p) == 'c' || extension(p) == 'C') {
-			glbptr = STARTGLB;
-			locptr = STARTLOC;
+			glbptr = 0;
+			locptr = 0;
 			wsptr = ws;
 			inclsp =
 			iflevel =
@@ -287,6 +298,7 @@ unknown_option:
 			const_nb =
 			line_number = 0;
 			macptr = smacptr;
+			maclookups = machits = 0;
 			input2 = NULL;
 			quote[0] = '"';
 			cmode = 1;
@@ -300,41 +312,46 @@ unknown_option:
 			enum_ptr = 0;
 			enum_type_ptr = 0;
 			memset(fastcall_tbl, 0, sizeof(fastcall_tbl));
-			defpragma();
-
-			/* Macros and globals have to be reset for each
-			   file, so we have to define the defaults all over
-			   each time. */
-			defmac("__end\t__memory");
-			addglb("__memory", ARRAY, CCHAR, 0, EXTERN, 0);
-			addglb("stack", ARRAY, CCHAR, 0, EXTERN, 0);
-			rglbptr = glbptr;
-			addglb("etext", ARRAY, CCHAR, 0, EXTERN, 0);
-			addglb("edata", ARRAY, CCHAR, 0, EXTERN, 0);
-			/* PCE specific externs */
-			addglb("font_base", VARIABLE, CINT, 0, EXTERN, 0);
-			addglb_far("vdc", CINT);
-			addglb_far("vram", CCHAR);
-			/* end specific externs */
-			defmac("huc6280\t1");
-			defmac("huc\t1");
-
-			if (cdflag == 1)
-				defmac("_CD\t1");
-			else if (cdflag == 2)
-				defmac("_SCD\t1");
-			else
-				defmac("_ROM\t1");
+			if (!openin(p))
+				exit(1);
 
-			if (overlayflag == 1)
-				defmac("_OVERLAY\t1");
+			/* The precompiled header cache restores everything
+			   up to the end of the leading #includes at once. */
+			if (!pch_load()) {
+				defpragma();
+
+				/* Macros and globals have to be reset for each
+				   file, so we have to define the defaults all over
+				   each time. */
+				defmac("__end\t__memory");
+				addglb("__memory", ARRAY, CCHAR, 0, EXTERN, 0);
+				addglb("stack", ARRAY, CCHAR, 0, EXTERN, 0);
+				rglbptr = glbptr;
+				addglb("etext", ARRAY, CCHAR, 0, EXTERN, 0);
+				addglb("edata", ARRAY, CCHAR, 0, EXTERN, 0);
+				/* PCE specific externs */
+				addglb("font_base", VARIABLE, CINT, 0, EXTERN, 0);
+				addglb_far("vdc", CINT);
+				addglb_far("vram", CCHAR);
+				/* end specific externs */
+				defmac("huc6280\t1");
+				defmac("huc\t1");
+
+				if (cdflag == 1)
+					defmac("_CD\t1");
+				else if (cdflag == 2)
+					defmac("_SCD\t1");
+				else
+					defmac("_ROM\t1");
+
+				if (overlayflag == 1)
+					defmac("_OVERLAY\t1");
+			}
 
 //			initmac();
 			/*
 			 *	compiler body
 			 */
-			if (!openin(p))
-				exit(1);
 			if (first && !openout())
 				exit(1);
 			if (first)
@@ -342,7 +359,8 @@ unknown_option:
 			asmdefines();
 //			gtext ();
 			parse();
-			fclose(input);
+			inclose(input);
+			input = NULL;
 //			gdata ();
 			dumplits();
 			dumpglbs();
@@ -373,6 +391,7 @@ unknown_option:
 		first = 0;
 	}
 	dumpfinal();
+	outflush();
 	fclose(output);
 	if (!errs && !sflag) {
 		if (user_outfile[0])
@@ -401,6 +420,7 @@ void usage (char *exename)
 	fprintf(stderr, "-msmall           use single-byte stack pointer\n");
 	fprintf(stderr, "\nOutput options:\n");
 	fprintf(stderr, "-s/-S             create asm output only (do not invoke assembler)\n");
+	fprintf(stderr, "-save-temps       keep the asm output file after assembling\n");
 	fprintf(stderr, "\nLinker options:\n");
 	fprintf(stderr, "-lname            add library 'name.c' from include path\n");
 	fprintf(stderr, "-cd               create CD-ROM output\n");
@@ -432,7 +452,7 @@ void parse (void)
 
 	while (1) {
 		blanks();
-		if (feof(input))
+		if (infeof(input))
 			break;
 // Note:
 // At beginning of 'parse' call, the header has been output to '.s'
@@ -633,6 +653,7 @@ char rodata_buf[DATABUFSIZE];
 void dumpglbs (void)
 {
 	long i = 1;
+	long g;
 	int dim, list_size, line_count;
 	int j;
 	FILE *save = output;
@@ -651,7 +672,8 @@ void dumpglbs (void)
 		int pass = 0;
 next:
 		i = 1;
-		for (cptr = rglbptr; cptr < glbptr; cptr++) {
+		for (g = rglbptr; g < glbptr; g++) {
+			cptr = glbsym(g);
 			if (cptr->ident != FUNCTION) {
 //				ppubext(cptr);
 				if ((cptr->storage & WRITTEN) == 0 &&	/* Not yet written to file */
@@ -759,6 +781,7 @@ next:
 static void dumpfinal (void)
 {
 	int i;
+	long end;
 
 	if (leaf_cnt) {
 		outstr("leaf_loc: .ds ");
@@ -770,6 +793,7 @@ static void dumpfinal (void)
 			outstr("_lend:\n");
 		}
 	}
+	outflush();
 	if (data) {
 		fclose(data);
 		outstr("huc_data:\n");
@@ -790,6 +814,8 @@ static void dumpfinal (void)
 		outstr("huc_rodata_end:\n");
 		outstr("___huc_rodata_end:\n");
 	}
+	outflush();
+	end = ftell(output);
 	fseek(output, output_globdef, SEEK_SET);
 	if (have_irq_handler || have_sirq_handler)
 		outstr("HAVE_IRQ = 1\n");
@@ -797,6 +823,9 @@ static void dumpfinal (void)
 		outstr("HAVE_SIRQ = 1\n");
 	if (have_init_data)
 		outstr("HAVE_INIT = 1\n");
+	outflush();
+	/* an in-memory output would end at the current position */
+	fseek(output, end, SEEK_SET);
 }
 
 /*
@@ -828,6 +857,15 @@ void errorsummary (void)
 	ot("Macro pool:");
 	outdec(macptr);
 	nl();
+	if (verboseflag) {
+		comment();
+		ot("Macro lookups:");
+		outdec(maclookups);
+		outstr(", hits: ");
+		outdec(machits);
+		nl();
+		dump_peep_stats();
+	}
 	pl(errcnt ? "Error(s)" : "No errors");
 }
 
@@ -847,22 +885,10 @@ long assemble (char *s)
 	char *opts[10];
 	long i;
 
-//	long j;
-
 	i = 0;
 
-
 	exe = getenv("PCE_PCEAS");
-	if (!exe) {
-#if defined(DJGPP) || defined(WIN32)
-		exe = "pceas.exe";
-#elif defined(linux) || defined(unix) || defined(osx)
-		exe = "pceas";
-#else
-#error Add calling sequence depending on your OS
-#endif
-	}
-	opts[i++] = exe;
+	opts[i++] = exe ? exe : "pceas";
 	switch (cdflag) {
 	case 1:
 		opts[i++] = "-cd";
@@ -895,15 +921,17 @@ long assemble (char *s)
 	buf[strlen(buf) - 1] = 's';
 	opts[i++] = buf;
 
-	opts[i++] = 0;
+	opts[i] = 0;
 
-// Comment this out later...
+	/* unless told otherwise, use the assembler linked into huc; it
+	   reads the code from memory if the .s file was not kept */
+	if (!exe) {
+		fflush(stdout);
+		if (asmbuf)
+			return (pceas_assemble(i, opts, asmbuf, asmbuflen));
+		return (pceas_main(i, opts));
+	}
 
-//	printf("invoking pceas:\n");
-//	for (j = 0; j < i; j++) {
-//		printf("arg[%d] = %s\n", j, opts[j]);
-//	}
-// .....
 #if defined(WIN32)
 	return (execvp(exe, (const char *const *)opts));
 
@@ -22,13 +22,37 @@
 #include "error.h"
 
 /* defines */
-#define Q_SIZE          16
+#define Q_CHUNK         256
+#define Q_LOOKBACK      64	/* level 2 re-scheduler search depth */
+
+#define PEEP_MAXLEN     6	/* longest pattern */
+#define PEEP_HASH       64	/* first opcode dispatch buckets */
+#define PEEP_NOMATCH    -1
+
+#define peep_hash(code) (((code) ^ ((code) >> 12)) & (PEEP_HASH - 1))
+
+/* peephole rule: 'ops[i]' lists the codes allowed for p[i], p[0]
+ * being the most recent instruction; 'apply' checks the operands and
+ * rewrites the window, returning the number of instructions to drop
+ * from its top, or PEEP_NOMATCH
+ */
+typedef struct {
+	char *name;
+	long *ops[PEEP_MAXLEN + 1];
+	int (*apply)(INS **p);
+	long hits;
+	int len;
+} PEEP_RULE;
+
+#define OPS(...)        ((long []){ __VA_ARGS__, -1 })
+#define ANY             (any_ins)
 
 /* locals */
-static INS q_ins[Q_SIZE];
-static long q_rd;
-static long q_wr;
+static INS *q_ins;	/* instructions since the last flush */
 static long q_nb;
+static long q_max;
+static long any_ins[] = { -1 };
+static short *peep_index[PEEP_HASH];
 
 /* externs */
 extern long arg_stack_flag;
@@ -96,1504 +120,1175 @@ static int is_sprel (INS *i)
 		i->code == X_STWI_S);
 }
 
-/* ----
- * push_ins()
- * ----
- *
- */
-void push_ins (INS *ins)
+/* library comparison helpers and their zero-page operand versions */
+static char *cmp_funcs[] = {
+	"eq", "eqb", "ne", "neb", "lt", "ltb", "ult", "ublt",
+	"gt", "gtb", "ugt", "ubgt", "ge", "geb", "uge", "ubge",
+	"le", "leb", "ule", "uble", NULL
+};
+static char *cmp_zp_funcs[] = {
+	"eqzp", "eqbzp", "nezp", "nebzp", "ltzp", "ltbzp", "ultzp", "ubltzp",
+	"gtzp", "gtbzp", "ugtzp", "ubgtzp", "gezp", "gebzp", "ugezp", "ubgezp",
+	"lezp", "lebzp", "ulezp", "ublezp", NULL
+};
+
+static int find_func (char **tab, INS *i)
 {
-#ifdef DEBUG_OPTIMIZER
-	printf("push "); dump_ins(ins);
-#endif
-	/* check queue size */
-	if (q_nb == Q_SIZE) {
-		/* queue is full - flush the last instruction */
-		if (arg_stack_flag)
-			arg_push_ins(&q_ins[q_rd]);
-		else
-			gen_code(&q_ins[q_rd]);
-
-		/* advance queue read pointer */
-		q_rd++;
-		q_nb--;
-
-		if (q_rd == Q_SIZE)
-			q_rd = 0;
-	}
+	int n;
 
-	/* push new instruction */
-	q_wr++;
-	q_nb++;
-
-	if (q_wr == Q_SIZE)
-		q_wr = 0;
-
-	q_ins[q_wr] = *ins;
-
-	/* optimization level 1 - simple peephole optimizer,
-	 * replace known instruction patterns by highly
-	 * optimized asm code
-	 */
-	if (optimize >= 1) {
-		INS *p[Q_SIZE];
-		int i, j;
-		long nb;
-
-lv1_loop:
-		/* precalculate pointers to instructions */
-		if (q_nb > 10)
-			nb = 10;
-		else
-			nb = q_nb;
-		for (i = 0, j = q_wr; i < nb; i++) {
-			/* save pointer */
-			p[i] = &q_ins[j];
-#ifdef DEBUG_OPTIMIZER
-			printf("%d ", i); dump_ins(p[i]);
-#endif
-
-			/* next */
-			j -= 1;
-			if (j < 0)
-				j += Q_SIZE;
-		}
-
-		/* Convert long branches to near ones.
-		   This currently assumes that no ten macroinsns in a row
-		   will be larger than 128 bytes. */
-		/* XXX: This is something the assembler should do, but
-		   is currently incapable of. */
-		{
-			int j;
-			for (j = 0; j < nb; j++) {
-				if (p[j]->code == I_LBNE || p[j]->code == I_LBEQ ||
-				    p[j]->code == I_LBRA) {
-					int i;
-					for (i = 0; i < nb; i++) {
-						if (p[i]->code == I_LABEL &&
-						    p[i]->data == p[j]->data) {
-							switch (p[j]->code) {
-							case I_LBNE:
-								p[j]->code = I_LBNEN;
-								break;
-							case I_LBEQ:
-								p[j]->code = I_LBEQN;
-								break;
-							case I_LBRA:
-								p[j]->code = I_LBRAN;
-								break;
-							}
-							break;
-						}
-					}
-				}
-			}
-		}
-
-		/* LEVEL 1 - FUN STUFF STARTS HERE */
-		nb = 0;
-
-		/* 6-instruction patterns */
-		if (q_nb >= 6) {
-			/*
-			 *  __ldwi  p              --> __ldw p
-			 *  __pushw                    __addwi i
-			 *  __stw __ptr                __stw p
-			 *  __ldwp __ptr
-			 *  __addwi i
-			 *  __stwps
-			 *
-			 */
-			if (p[0]->code == I_STWPS &&
-			    (p[1]->code == I_ADDWI || p[1]->code == I_SUBWI) &&
-			    p[2]->code == I_LDWP && p[2]->type == T_PTR &&
-			    p[3]->code == I_STW && p[3]->type == T_PTR &&
-			    p[4]->code == I_PUSHW &&
-			    p[5]->code == I_LDWI) {
-				*p[3] = *p[5];
-				p[3]->code = I_STW;
-				*p[4] = *p[1];
-				p[5]->code = I_LDW;
-				nb = 3;
-			}
-
-			/* flush queue */
-			if (nb) {
-				q_wr -= nb;
-				q_nb -= nb;
-				nb = 0;
+	for (n = 0; tab[n]; n++)
+		if (strcmp((char *)i->data, tab[n]) == 0)
+			return (n);
+	return (-1);
+}
 
-				if (q_wr < 0)
-					q_wr += Q_SIZE;
+static int is_jsr (INS *i, char *name)
+{
+	return (i->code == I_JSR && strcmp((char *)i->data, name) == 0);
+}
 
-				/* loop */
-				goto lv1_loop;
-			}
-		}
 
-		/* 5-instruction patterns */
-		if (q_nb >= 5) {
-			/*  Classical Base-offset array access:
-			 *
-			 *  __ldwi  label              --> @_ldw_s  n-2
-			 *  __pushw                        __aslw
-			 *  @_ldw_s n                      __addwi  label
-			 *  __aslw
-			 *  __addws
-			 *
-			 *  ====
-			 *  bytes  :  4+23+ 8+ 4+24 = 63  -->  8+ 4+ 7 = 19
-			 *  cycles :  4+49+20+ 8+41 =122  --> 20+ 8+10 = 38
-			 *
-			 */
-			if ((p[0]->code == I_ADDWS) &&
-			    (p[1]->code == I_ASLW) &&
-			    (p[2]->code == X_LDW_S) &&
-			    (p[3]->code == I_PUSHW) &&
-			    (p[4]->code == I_LDWI)) {
-				long tempdata;
-
-				tempdata = p[2]->data;
-
-				/* replace code */
-				p[2]->code = I_ADDWI;
-				p[2]->type = p[4]->type;
-				p[2]->data = p[4]->data;
-				p[2]->sym = p[4]->sym;
-				p[3]->code = I_ASLW;
-				p[4]->code = X_LDW_S;
-				p[4]->data = tempdata - 2;
-
-				nb = 2;
-			}
+/* ----
+ * peephole rules
+ * ----
+ * the patterns are shown oldest instruction first, the code reads
+ * them newest first
+ *
+ */
 
-			/*  Classical Base-offset array access:
-			 *
-			 *  __ldwi  label1             --> __ldw    label2
-			 *  __pushw                        __aslw
-			 *  __ldw   label2                 __addwi  label1
-			 *  __aslw
-			 *  __addws
-			 *
-			 *  ====
-			 *  bytes  :  4+23+ 6+ 4+24 = 61  -->  6+ 4+ 7 = 17
-			 *  cycles :  4+49+10+ 8+41 =112  --> 10+ 8+10 = 28
-			 *
-			 */
-			else
-			if ((p[0]->code == I_ADDWS) &&
-			    (p[1]->code == I_ASLW) &&
-			    (p[2]->code == I_LDW) &&
-			    (p[3]->code == I_PUSHW) &&
-			    (p[4]->code == I_LDWI)) {
-				long tempdata, temptype;
-				SYMBOL *tempsym;
-
-				tempdata = p[2]->data;
-				tempsym = p[2]->sym;
-				temptype = p[2]->type;
-
-				/* replace code */
-				p[2]->code = I_ADDWI;
-				p[2]->type = p[4]->type;
-				p[2]->data = p[4]->data;
-				p[2]->sym = p[4]->sym;
-				p[3]->code = I_ASLW;
-				p[4]->code = I_LDW;
-				p[4]->data = tempdata;
-				p[4]->sym = tempsym;
-				p[4]->type = temptype;
-
-				nb = 2;
-			}
+/*  __ldwi  p              --> __ldw p
+ *  __pushw                    __addwi i
+ *  __stw __ptr                __stw p
+ *  __ldwp __ptr
+ *  __addwi i
+ *  __stwps
+ *
+ */
+static int peep_ldwp_addwi_stwps (INS **p)
+{
+	if (p[2]->type != T_PTR || p[3]->type != T_PTR)
+		return (PEEP_NOMATCH);
+	*p[3] = *p[5];
+	p[3]->code = I_STW;
+	*p[4] = *p[1];
+	p[5]->code = I_LDW;
+	return (3);
+}
 
-			/* __ldwi a	--> __ldyb i
-			 * __pushw	    __ldby a
-			 * __ldub i
-			 * __addws
-			 * __ldb_p
-			 */
-			else if (p[0]->code == X_LDB_P &&
-				 p[1]->code == I_ADDWS &&
-				 p[2]->code == I_LDUB &&
-				 p[3]->code == I_PUSHW &&
-				 p[4]->code == I_LDWI) {
-				*p[3] = *p[4];
-				p[3]->code = I_LDBY;
-				*p[4] = *p[2];
-				p[4]->code = I_LDYB;
-				nb = 3;
-			}
+/*  Classical Base-offset array access:
+ *
+ *  __ldwi  label              --> @_ldw_s  n-2
+ *  __pushw                        __aslw
+ *  @_ldw_s n                      __addwi  label
+ *  __aslw
+ *  __addws
+ *
+ *  ====
+ *  bytes  :  4+23+ 8+ 4+24 = 63  -->  8+ 4+ 7 = 19
+ *  cycles :  4+49+20+ 8+41 =122  --> 20+ 8+10 = 38
+ *
+ */
+static int peep_index_ldw_s (INS **p)
+{
+	long tempdata;
+
+	tempdata = p[2]->data;
+
+	/* replace code */
+	p[2]->code = I_ADDWI;
+	p[2]->type = p[4]->type;
+	p[2]->data = p[4]->data;
+	p[2]->sym = p[4]->sym;
+	p[3]->code = I_ASLW;
+	p[4]->code = X_LDW_S;
+	p[4]->data = tempdata - 2;
+	return (2);
+}
 
-			/* flush queue */
-			if (nb) {
-				q_wr -= nb;
-				q_nb -= nb;
-				nb = 0;
+/*  Classical Base-offset array access:
+ *
+ *  __ldwi  label1             --> __ldw    label2
+ *  __pushw                        __aslw
+ *  __ldw   label2                 __addwi  label1
+ *  __aslw
+ *  __addws
+ *
+ *  ====
+ *  bytes  :  4+23+ 6+ 4+24 = 61  -->  6+ 4+ 7 = 17
+ *  cycles :  4+49+10+ 8+41 =112  --> 10+ 8+10 = 28
+ *
+ */
+static int peep_index_ldw (INS **p)
+{
+	long tempdata, temptype;
+	SYMBOL *tempsym;
+
+	tempdata = p[2]->data;
+	tempsym = p[2]->sym;
+	temptype = p[2]->type;
+
+	/* replace code */
+	p[2]->code = I_ADDWI;
+	p[2]->type = p[4]->type;
+	p[2]->data = p[4]->data;
+	p[2]->sym = p[4]->sym;
+	p[3]->code = I_ASLW;
+	p[4]->code = I_LDW;
+	p[4]->data = tempdata;
+	p[4]->sym = tempsym;
+	p[4]->type = temptype;
+	return (2);
+}
 
-				if (q_wr < 0)
-					q_wr += Q_SIZE;
+/* __ldwi a	--> __ldyb i
+ * __pushw	    __ldby a
+ * __ldub i
+ * __addws
+ * __ldb_p
+ */
+static int peep_index_ldb_p (INS **p)
+{
+	*p[3] = *p[4];
+	p[3]->code = I_LDBY;
+	*p[4] = *p[2];
+	p[4]->code = I_LDYB;
+	return (3);
+}
 
-				/* loop */
-				goto lv1_loop;
-			}
-		}
+/*  @_ldw/b/ub_s i             --> @_ldw/b/ub_s  i
+ *  __addwi 1                      @_incw/b_s i
+ *  @_stw_s i
+ *  __subwi 1
+ *
+ */
+static int peep_postinc_s (INS **p)
+{
+	if (p[0]->data != 1 ||
+	    p[2]->data != 1 ||
+	    p[1]->data != p[3]->data ||
+	    p[1]->data >= 255)
+		return (PEEP_NOMATCH);
+	if (p[1]->code == X_STW_S && p[3]->code != X_LDW_S)
+		return (PEEP_NOMATCH);
+	if (p[1]->code == X_STB_S && p[3]->code == X_LDW_S)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	p[2]->code = (p[1]->code == X_STW_S) ? X_INCW_S : X_INCB_S;
+	p[2]->data = p[3]->data;
+	p[2]->sym = p[3]->sym;
+	return (2);
+}
 
-		/* 4-instruction patterns */
-		if (q_nb >= 4) {
-			/*  @_ldw/b/ub_s i             --> @_ldw/b/ub_s  i
-			 *  __addwi 1                      @_incw/b_s i
-			 *  @_stw_s i
-			 *  __subwi 1
-			 *
-			 */
-			if ((p[0]->code == I_SUBWI) &&
-			    (p[1]->code == X_STW_S) &&
-			    (p[2]->code == I_ADDWI) &&
-			    (p[3]->code == X_LDW_S) &&
-
-			    (p[0]->data == 1) &&
-			    (p[2]->data == 1) &&
-			    (p[1]->data == p[3]->data) &&
-			    (p[1]->data < 255)) {
-				/* replace code */
-				p[2]->code = X_INCW_S;
-				p[2]->data = p[3]->data;
-				p[2]->sym = p[3]->sym;
-				nb = 2;
-			}
-			else if ((p[0]->code == I_SUBWI) &&
-				 (p[1]->code == X_STB_S) &&
-				 (p[2]->code == I_ADDWI) &&
-				 (p[3]->code == X_LDB_S || p[3]->code == X_LDUB_S) &&
-				 (p[0]->data == 1) &&
-				 (p[2]->data == 1) &&
-				 (p[1]->data == p[3]->data) &&
-				 (p[1]->data < 255)) {
-				/* replace code */
-				p[2]->code = X_INCB_S;
-				p[2]->data = p[3]->data;
-				p[2]->sym = p[3]->sym;
-				nb = 2;
-			}
+/*  @_ldwi  i                  --> @_ldwi   i * j
+ *  __pushw
+ *  __ldwi  j
+ *  jsr     umul
+ */
+static int peep_umul_const (INS **p)
+{
+	if (p[0]->type != T_LIB || strcmp((char *)p[0]->data, "umul") ||
+	    p[1]->type != T_VALUE || p[3]->type != T_VALUE)
+		return (PEEP_NOMATCH);
+	p[3]->data *= p[1]->data;
+	return (3);
+}
 
-			/*  @_ldwi  i                  --> @_ldwi   i * j
-			 *  __pushw
-			 *  __ldwi  j
-			 *  jsr     umul
-			 */
-			else if ((p[0]->code == I_JSR && p[0]->type == T_LIB && !strcmp((char *)p[0]->data, "umul")) &&
-				 (p[1]->code == I_LDWI && p[1]->type == T_VALUE) &&
-				 (p[2]->code == I_PUSHW) &&
-				 (p[3]->code == I_LDWI && p[3]->type == T_VALUE)) {
-				p[3]->data *= p[1]->data;
-				nb = 3;
-			}
+/*  @_ldwi p                  --> __stwi p, i
+ *  __pushw
+ *  __ldwi  i
+ *  __st{b|w}ps
+ *
+ */
+static int peep_stwi (INS **p)
+{
+	/* replace code */
+	p[3]->code = p[0]->code == I_STWPS ? I_STWI : I_STBI;
+	p[3]->imm = p[1]->data;
+	p[3]->imm_type = p[1]->type;
+	return (3);
+}
 
-			/*  @_ldwi p                  --> __stwi p, i
-			 *  __pushw
-			 *  __ldwi  i
-			 *  __st{b|w}ps
-			 *
-			 */
-			else if ((p[0]->code == I_STWPS || p[0]->code == I_STBPS) &&
-				 (p[1]->code == I_LDWI) &&
-				 (p[2]->code == I_PUSHW) &&
-				 (p[3]->code == I_LDWI)) {
-				/* replace code */
-				p[3]->code = p[0]->code == I_STWPS ? I_STWI : I_STBI;
-				p[3]->imm = p[1]->data;
-				p[3]->imm_type = p[1]->type;
-				nb = 3;
-			}
+/* __pushw		--> addbi_p i
+ * __ldb_p
+ * __addwi i
+ * __stbps
+ */
+static int peep_addbi_p (INS **p)
+{
+	*p[3] = *p[1];
+	p[3]->code = I_ADDBI_P;
+	return (3);
+}
 
-			/* __pushw		--> addbi_p i
-			 * __ldb_p
-			 * __addwi i
-			 * __stbps
-			 */
-			else if (p[0]->code == I_STBPS &&
-				 p[1]->code == I_ADDWI &&
-				 p[2]->code == X_LDB_P &&
-				 p[3]->code == I_PUSHW) {
-				*p[3] = *p[1];
-				p[3]->code = I_ADDBI_P;
-				nb = 3;
-			}
+/*  __pushw                     --> __add[bw]i i
+ *  __ldwi  i
+ *  __add[bw]s
+ *
+ *  ====
+ *  bytes  : 23+4+24 = 51      -->  7
+ *  cycles : 49+4+43 = 96      --> 12
+ *
+ */
+static int peep_addi (INS **p)
+{
+	if (p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	p[2]->code = (p[0]->code == I_ADDWS) ? I_ADDWI : I_ADDBI;
+	p[2]->data = p[1]->data;
+	p[2]->type = T_VALUE;
+	return (2);
+}
 
-			/* flush queue */
-			if (nb) {
-				q_wr -= nb;
-				q_nb -= nb;
-				nb = 0;
+/*  __pushw                     --> __subwi i
+ *  __ldwi  i
+ *  __subws
+ *
+ *  ====
+ *  bytes  : 23+4+31 = 58      -->  7
+ *  cycles : 49+4+65 =118      --> 12
+ *
+ *  __pushw                     --> __andwi i
+ *  __ldwi  i
+ *  __andws
+ *
+ *  ====
+ *  bytes  : 23+4+23 = 50      -->  6
+ *  cycles : 49+4+51 =104      --> 10
+ *
+ *  __pushw                     --> __orwi i
+ *  __ldwi  i
+ *  __orws
+ *
+ *  ====
+ *  bytes  : 23+4+23 = 50      -->  6
+ *  cycles : 49+4+51 =104      --> 10
+ *
+ */
+static int peep_subi_andi_ori (INS **p)
+{
+	if (p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	switch (p[0]->code) {
+	case I_SUBWS: p[2]->code = I_SUBWI; break;
+	case I_ANDWS: p[2]->code = I_ANDWI; break;
+	default: p[2]->code = I_ORWI; break;
+	}
+	p[2]->data = p[1]->data;
+	return (2);
+}
 
-				if (q_wr < 0)
-					q_wr += Q_SIZE;
+/*  __pushw                     --> __st{b|w}ip i
+ *  __ldwi  i
+ *  __st{b|w}ps
+ *
+ */
+static int peep_stip (INS **p)
+{
+	if (p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
 
-				/* loop */
-				goto lv1_loop;
-			}
-		}
+	/* replace code */
+	p[2]->code = p[0]->code == I_STWPS ? I_STWIP : I_STBIP;
+	p[2]->data = p[1]->data;
+	return (2);
+}
 
-		/* 3-instruction patterns */
-		if (q_nb >= 3) {
-			/*  __pushw                     --> __add[bw]i i
-			 *  __ldwi  i
-			 *  __add[bw]s
-			 *
-			 *  ====
-			 *  bytes  : 23+4+24 = 51      -->  7
-			 *  cycles : 49+4+43 = 96      --> 12
-			 *
-			 */
-			if ((p[0]->code == I_ADDWS || p[0]->code == I_ADDBS) &&
-			    (p[1]->code == I_LDWI) &&
-			    (p[2]->code == I_PUSHW) &&
-
-			    (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = (p[0]->code == I_ADDWS) ? I_ADDWI : I_ADDBI;
-				p[2]->data = p[1]->data;
-				p[2]->type = T_VALUE;
-				nb = 2;
-			}
+/*  __pushw                      --> __asl/lsr/asrwi i
+ *  __ldwi i
+ *  jsr asl/lsr/asr
+ *
+ */
+static int peep_shifti (INS **p)
+{
+	/* replace code */
+	if (!strcmp((char *)p[0]->data, "asl"))
+		p[2]->code = I_ASLWI;
+	else if (!strcmp((char *)p[0]->data, "lsr"))
+		p[2]->code = I_LSRWI;
+	else if (!strcmp((char *)p[0]->data, "asr"))
+		p[2]->code = I_ASRWI;
+	else
+		return (PEEP_NOMATCH);
+	p[2]->type = p[1]->type;
+	p[2]->data = p[1]->data;
+	return (2);
+}
 
-			/*  __pushw                     --> __subwi i
-			 *  __ldwi  i
-			 *  __subws
-			 *
-			 *  ====
-			 *  bytes  : 23+4+31 = 58      -->  7
-			 *  cycles : 49+4+65 =118      --> 12
-			 *
-			 */
-			else if ((p[0]->code == I_SUBWS) &&
-				 (p[1]->code == I_LDWI) &&
-				 (p[2]->code == I_PUSHW) &&
-
-				 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = I_SUBWI;
-				p[2]->data = p[1]->data;
-				nb = 2;
-			}
+/*  __pushw                     --> __aslwi log2(i)
+ *  __ldwi i                     or __mulwi i
+ *  jsr {u|s}mul
+ *
+ */
+static int peep_muli (INS **p)
+{
+	if ((strcmp((char *)p[0]->data, "umul") &&
+	     strcmp((char *)p[0]->data, "smul")) ||
+	    p[1]->type != T_VALUE ||
+	    p[1]->data <= 0 || p[1]->data >= 0x8000)
+		return (PEEP_NOMATCH);
+
+	p[2]->type = T_VALUE;
+	if (__builtin_popcount(p[1]->data) == 1) {
+		p[2]->code = I_ASLWI;
+		p[2]->data = __builtin_ctz(p[1]->data);
+	}
+	else {
+		p[2]->code = I_MULWI;
+		p[2]->data = p[1]->data;
+	}
+	return (2);
+}
 
-			/*  __pushw                     --> __andwi i
-			 *  __ldwi  i
-			 *  __andws
-			 *
-			 *  ====
-			 *  bytes  : 23+4+23 = 50      -->  6
-			 *  cycles : 49+4+51 =104      --> 10
-			 *
-			 */
-			else if ((p[0]->code == I_ANDWS) &&
-				 (p[1]->code == I_LDWI) &&
-				 (p[2]->code == I_PUSHW) &&
-
-				 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = I_ANDWI;
-				p[2]->data = p[1]->data;
-				nb = 2;
-			}
+/*  __pushw                     --> __addb/w/ub/b_s/ub_s/w_s  nnn
+ *  __ldb/w/ub/b_s/ub_s/w_s  nnn
+ *  __addws
+ *
+ *  ====
+ *  bytes  : 23+ 6+24 = 53      -->  9
+ *  cycles : 49+10+43 =102      --> 18
+ *
+ *  (for @_ldw_s: 55 --> 10 bytes, 112 --> 24 cycles)
+ *
+ */
+static int peep_addws_load (INS **p)
+{
+	/* replace code */
+	switch (p[1]->code) {
+	case I_LDW: p[2]->code = I_ADDW; break;
+	case I_LDB: p[2]->code = I_ADDB; break;
+	case I_LDUB: p[2]->code = I_ADDUB; break;
+	case X_LDB_S: p[2]->code = X_ADDB_S; p[1]->data -= 2; break;
+	case X_LDUB_S: p[2]->code = X_ADDUB_S; p[1]->data -= 2; break;
+	case X_LDW_S: p[2]->code = X_ADDW_S; p[1]->data -= 2; break;
+	default: abort();
+	}
+	p[2]->data = p[1]->data;
+	p[2]->type = p[1]->type;
+	return (2);
+}
 
-			/*  __pushw                     --> __orwi i
-			 *  __ldwi  i
-			 *  __orws
-			 *
-			 *  ====
-			 *  bytes  : 23+4+23 = 50      -->  6
-			 *  cycles : 49+4+51 =104      --> 10
-			 *
-			 */
-			else if ((p[0]->code == I_ORWS) &&
-				 (p[1]->code == I_LDWI) &&
-				 (p[2]->code == I_PUSHW) &&
-
-				 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = I_ORWI;
-				p[2]->data = p[1]->data;
-				nb = 2;
-			}
+/*  __pushw                     --> __subw  nnn
+ *  __ldw  nnn
+ *  __subws
+ *
+ *  ====
+ *  bytes  : 23+ 6+31 = 60      -->  9
+ *  cycles : 49+10+65 =124      --> 18
+ *
+ */
+static int peep_subw (INS **p)
+{
+	/* replace code */
+	p[2]->code = I_SUBW;
+	p[2]->data = p[1]->data;
+	p[2]->type = p[1]->type;
+	return (2);
+}
 
-			/*  __pushw                     --> __st{b|w}ip i
-			 *  __ldwi  i
-			 *  __st{b|w}ps
-			 *
-			 */
-			else if ((p[0]->code == I_STWPS || p[0]->code == I_STBPS) &&
-				 (p[1]->code == I_LDWI) &&
-				 (p[2]->code == I_PUSHW) &&
-
-				 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = p[0]->code == I_STWPS ? I_STWIP : I_STBIP;
-				p[2]->data = p[1]->data;
-				nb = 2;
-			}
+/*  @_pea_s j                   --> @_stbi_s i,j
+ *  __ldwi  i
+ *  __stbps
+ *
+ *  ====
+ *  bytes  : 25+4+38 =  67      -->  9
+ *  cycles : 44+4+82 = 130      --> 15
+ *
+ *  @_pea_s j                   --> @_stwi_s i,j
+ *  __ldwi  i
+ *  __stwps
+ *
+ *  ====
+ *  bytes  : 25+4+42 =  71      --> 12
+ *  cycles : 44+4+91 = 139      --> 24
+ *
+ */
+static int peep_sti_s (INS **p)
+{
+	if (p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
 
-			/*  __pushw                      --> __asl/lsr/asrwi i
-			 *  __ldwi i
-			 *  jsr asl/lsr/asr
-			 *
-			 */
-			else if (p[0]->code == I_JSR &&
-				 (!strcmp((char *)p[0]->data, "asl") ||
-				  !strcmp((char *)p[0]->data, "lsr") ||
-				  !strcmp((char *)p[0]->data, "asr")) &&
-				 (p[1]->code == I_LDWI) &&
-				 p[2]->code == I_PUSHW) {
-				/* replace code */
-				if (!strcmp((char *)p[0]->data, "asl"))
-					p[2]->code = I_ASLWI;
-				else if (!strcmp((char *)p[0]->data, "lsr"))
-					p[2]->code = I_LSRWI;
-				else
-					p[2]->code = I_ASRWI;
-				p[2]->type = p[1]->type;
-				p[2]->data = p[1]->data;
-				nb = 2;
-			}
+	/* replace code */
+	p[2]->code = (p[0]->code == I_STBPS) ? X_STBI_S : X_STWI_S;
+	p[2]->imm = p[1]->data;
+	return (2);
+}
 
-			/*  __pushw                     --> __aslwi log2(i)
-			 *  __ldwi i                     or __mulwi i
-			 *  jsr {u|s}mul
-			 *
-			 */
-			else if
-			(p[0]->code == I_JSR &&
-			 (!strcmp((char *)p[0]->data, "umul") ||
-			  !strcmp((char *)p[0]->data, "smul")) &&
-			 (p[1]->code == I_LDWI) &&
-			 (p[1]->type == T_VALUE) &&
-			 p[1]->data > 0 && p[1]->data < 0x8000 &&
-			 p[2]->code == I_PUSHW) {
-				p[2]->type = T_VALUE;
-				if (__builtin_popcount(p[1]->data) == 1) {
-					p[2]->code = I_ASLWI;
-					p[2]->data = __builtin_ctz(p[1]->data);
-				}
-				else {
-					p[2]->code = I_MULWI;
-					p[2]->data = p[1]->data;
-				}
-				nb = 2;
-			}
+/*  @_pea_s i                   --> @_lea_s i+j
+ *  __ldwi  j
+ *  __addws
+ *
+ *  ====
+ *  bytes  : 25+4+24 = 53       --> 10
+ *  cycles : 44+4+41 = 89       --> 16
+ *
+ */
+static int peep_lea_s (INS **p)
+{
+	if (p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
 
-			/*  __pushw                     --> __addb/w/ub/b_s/ub_s/w_s  nnn
-			 *  __ldb/w/ub/b_s/ub_s/w_s  nnn
-			 *  __addws
-			 *
-			 *  ====
-			 *  bytes  : 23+ 6+24 = 53      -->  9
-			 *  cycles : 49+10+43 =102      --> 18
-			 *
-			 */
-			else if ((p[0]->code == I_ADDWS) &&
-				 (p[1]->code == I_LDW ||
-				  p[1]->code == I_LDB ||
-				  p[1]->code == I_LDUB ||
-				  p[1]->code == X_LDB_S ||
-				  p[1]->code == X_LDUB_S ||
-				  p[1]->code == X_LDW_S) &&
-				 (p[2]->code == I_PUSHW)) {
-				/* replace code */
-				switch (p[1]->code) {
-				case I_LDW: p[2]->code = I_ADDW; break;
-				case I_LDB: p[2]->code = I_ADDB; break;
-				case I_LDUB: p[2]->code = I_ADDUB; break;
-				case X_LDB_S: p[2]->code = X_ADDB_S; p[1]->data -= 2; break;
-				case X_LDUB_S: p[2]->code = X_ADDUB_S; p[1]->data -= 2; break;
-				case X_LDW_S: p[2]->code = X_ADDW_S; p[1]->data -= 2; break;
-				default: abort();
-				}
-				p[2]->data = p[1]->data;
-				p[2]->type = p[1]->type;
-				nb = 2;
-			}
+	/* replace code */
+	p[2]->code = X_LEA_S;
+	p[2]->data += p[1]->data;
+	return (2);
+}
 
-			/*  __pushw                     --> __subw  nnn
-			 *  __ldw  nnn
-			 *  __subws
-			 *
-			 *  ====
-			 *  bytes  : 23+ 6+31 = 60      -->  9
-			 *  cycles : 49+10+65 =124      --> 18
-			 *
-			 */
-			else if ((p[0]->code == I_SUBWS) &&
-				 (p[1]->code == I_LDW) &&
-				 (p[2]->code == I_PUSHW)) {
-				/* replace code */
-				p[2]->code = I_SUBW;
-				p[2]->data = p[1]->data;
-				p[2]->type = p[1]->type;
-				nb = 2;
-			}
+/*  @_lea_s i                   --> @_ldw_s i
+ *  __stw   __ptr
+ *  __ldwp  __ptr
+ *
+ *  ====
+ *  bytes  : 10+4+ 7 = 21       -->  8
+ *  cycles : 16+8+18 = 42       --> 20
+ *
+ */
+static int peep_lea_s_ldwp (INS **p)
+{
+	if (p[0]->type != T_PTR || p[1]->type != T_PTR)
+		return (PEEP_NOMATCH);
 
-			/*  __pushw                   --> @_addw_s i-2
-			 *  @_ldw_s i
-			 *  __addws
-			 *
-			 *  ====
-			 *  bytes  : 23+ 8+24 =  55   --> 10
-			 *  cycles : 49+20+43 = 112   --> 24
-			 *
-			 */
-			else if
-			((p[0]->code == I_ADDWS) &&
-			 (p[1]->code == X_LDW_S) &&
-			 (p[2]->code == I_PUSHW)) {
-				/* replace code */
-				p[2]->code = X_ADDW_S;
-				p[2]->data = p[1]->data - 2;
-				p[2]->sym = p[1]->sym;
-				nb = 2;
-			}
+	/* replace code */
+	p[2]->code = X_LDW_S;
+	return (2);
+}
 
-			/*  @_pea_s j                   --> @_stbi_s i,j
-			 *  __ldwi  i
-			 *  __stbps
-			 *
-			 *  ====
-			 *  bytes  : 25+4+38 =  67      -->  9
-			 *  cycles : 44+4+82 = 130      --> 15
-			 *
-			 */
-			else if
-			((p[0]->code == I_STBPS) &&
-			 (p[1]->code == I_LDWI) &&
-			 (p[2]->code == X_PEA_S) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = X_STBI_S;
-				p[2]->imm = p[1]->data;
-				nb = 2;
-			}
+/*  @_ldwi i                   --> @_ldw/_ldub i
+ *  __stw   __ptr
+ *  __ldwp/__ldubp  __ptr
+ */
+static int peep_ldwi_ldwp (INS **p)
+{
+	if (p[0]->type != T_PTR || p[1]->type != T_PTR)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	if (p[0]->code == I_LDWP)
+		p[2]->code = I_LDW;
+	else
+		p[2]->code = I_LDUB;
+	return (2);
+}
 
-			/*  @_pea_s j                   --> @_stwi_s i,j
-			 *  __ldwi  i
-			 *  __stwps
-			 *
-			 *  ====
-			 *  bytes  : 25+4+42 =  71      --> 12
-			 *  cycles : 44+4+91 = 139      --> 24
-			 *
-			 */
-			else if
-			((p[0]->code == I_STWPS) &&
-			 (p[1]->code == I_LDWI) &&
-			 (p[2]->code == X_PEA_S) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = X_STWI_S;
-				p[2]->imm = p[1]->data;
-				nb = 2;
-			}
+/*  @_pea_s i                   --> @_pea_s i
+ *  __stw   __ptr                   @_ldw_s i+2
+ *  __ldwp  __ptr
+ *
+ *  ====
+ *  bytes  : 25+4+ 7 = 36       --> 25+ 8 = 33
+ *  cycles : 44+8+18 = 70       --> 44+20 = 64
+ *
+ */
+static int peep_pea_s_ldwp (INS **p)
+{
+	if (p[0]->type != T_PTR || p[1]->type != T_PTR || optimize < 2)
+		return (PEEP_NOMATCH);
 
-			/*  @_pea_s i                   --> @_lea_s i+j
-			 *  __ldwi  j
-			 *  __addws
-			 *
-			 *  ====
-			 *  bytes  : 25+4+24 = 53       --> 10
-			 *  cycles : 44+4+41 = 89       --> 16
-			 *
-			 */
-			else if
-			((p[0]->code == I_ADDWS) &&
-			 (p[1]->code == I_LDWI) &&
-			 (p[2]->code == X_PEA_S) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[2]->code = X_LEA_S;
-				p[2]->data += p[1]->data;
-				nb = 2;
-			}
+	/* replace code */
+	p[1]->code = X_LDW_S;
+	p[1]->data = p[2]->data + 2;
+	p[1]->sym = p[2]->sym;
+	return (1);
+}
 
-			/*  @_lea_s i                   --> @_ldw_s i
-			 *  __stw   __ptr
-			 *  __ldwp  __ptr
-			 *
-			 *  ====
-			 *  bytes  : 10+4+ 7 = 21       -->  8
-			 *  cycles : 16+8+18 = 42       --> 20
-			 *
-			 */
-			else if
-			((p[0]->code == I_LDWP) &&
-			 (p[1]->code == I_STW) &&
-			 (p[2]->code == X_LEA_S) &&
-
-			 (p[0]->type == T_PTR) &&
-			 (p[1]->type == T_PTR)) {
-				/* replace code */
-				p[2]->code = X_LDW_S;
-				nb = 2;
-			}
+/*  __pushw                    --> __stw  <__temp
+ *  __ldw(i)  n / __ldw_s n          __ldw(i) n / __ldw_s n-2
+ *  jsr  eq/ne (etc.)                jsr eqzp/nezp (etc.)
+ *
+ *  ====
+ *  bytes  :  ? -->  ?
+ *  cycles :  ? -->  ?
+ *
+ */
+static int peep_cmp_zp (INS **p)
+{
+	int n;
+
+	if ((n = find_func(cmp_funcs, p[0])) < 0)
+		return (PEEP_NOMATCH);
+
+	if (p[1]->code == X_LDW_S || p[1]->code == X_LDB_S)
+		p[1]->data -= 2;
+	/* replace code */
+	p[2]->code = I_STW;
+	p[2]->type = T_SYMBOL;
+	p[2]->data = (long)"_temp";
+	p[0]->data = (long)cmp_zp_funcs[n];
+	return (0);
+}
 
-			/*  @_ldwi i                   --> @_ldw/_ldub i
-			 *  __stw   __ptr
-			 *  __ldwp/__ldubp  __ptr
-			 */
-			else if
-			((p[0]->code == I_LDWP || p[0]->code == I_LDUBP) &&
-			 (p[1]->code == I_STW) &&
-			 (p[2]->code == I_LDWI) &&
-
-			 (p[0]->type == T_PTR) &&
-			 (p[1]->type == T_PTR)) {
-				/* replace code */
-				if (p[0]->code == I_LDWP)
-					p[2]->code = I_LDW;
-				else
-					p[2]->code = I_LDUB;
-				nb = 2;
-			}
+/*  __stw  <__temp              --> __cmpwi_eq/ne i
+ *  __ldwi i
+ *  jsr eqzp/nezp
+ *
+ */
+static int peep_cmpwi (INS **p)
+{
+	if ((!is_jsr(p[0], "eqzp") && !is_jsr(p[0], "nezp")) ||
+	    p[2]->type != T_SYMBOL ||
+	    strcmp((char *)p[2]->data, "_temp"))
+		return (PEEP_NOMATCH);
+
+	*p[2] = *p[1];
+	if (!strcmp((char *)p[0]->data, "eqzp"))
+		p[2]->code = I_CMPWI_EQ;
+	else
+		p[2]->code = I_CMPWI_NE;
+	return (2);
+}
 
-			/*  @_pea_s i                   --> @_pea_s i
-			 *  __stw   __ptr                   @_ldw_s i+2
-			 *  __ldwp  __ptr
-			 *
-			 *  ====
-			 *  bytes  : 25+4+ 7 = 36       --> 25+ 8 = 33
-			 *  cycles : 44+8+18 = 70       --> 44+20 = 64
-			 *
-			 */
-			else if
-			((p[0]->code == I_LDWP) &&
-			 (p[1]->code == I_STW) &&
-			 (p[2]->code == X_PEA_S) &&
-
-			 (p[0]->type == T_PTR) &&
-			 (p[1]->type == T_PTR) &&
-
-			 (optimize >= 2)) {
-				/* replace code */
-				p[1]->code = X_LDW_S;
-				p[1]->data = p[2]->data + 2;
-				p[1]->sym = p[2]->sym;
-				nb = 1;
-			}
+/*  __ldw/b/ub   n                    -->   incw/b  n
+ *  __addwi 1                        __ldw/b/ub   n
+ *  __stw/b/ub   n
+ *
+ *  ====
+ *  bytes  :  6+ 7+ 6=19 -->       8 + 6=14
+ *  cycles : 10+12+10=32 --> (11->16)+10=(21->26)
+ *
+ */
+static int peep_preinc (INS **p)
+{
+	if (p[1]->type != T_VALUE ||
+	    p[1]->data != 1 ||
+	    cmp_operands(p[0], p[2]) != 1)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	p[1]->code = p[2]->code;
+	p[1]->type = p[2]->type;
+	p[1]->data = p[2]->data;
+	p[2]->code = (p[0]->code == I_STW) ? I_INCW : I_INCB;
+	return (1);
+}
 
-			/*  __pushw                    --> __stw  <__temp
-			 *  __ldw(i)  n / __ldw_s n          __ldw(i) n / __ldw_s n-2
-			 *  jsr  eq/ne (etc.)                jsr eqzp/nezp (etc.)
-			 *
-			 *  ====
-			 *  bytes  :  ? -->  ?
-			 *  cycles :  ? -->  ?
-			 *
-			 */
-			else if
-			((p[0]->code == I_JSR) &&
-			 (p[1]->code == I_LDWI ||
-			  p[1]->code == I_LDW ||
-			  p[1]->code == X_LDW_S ||
-			  p[1]->code == I_LDB ||
-			  p[1]->code == X_LDB_S) &&
-			 (p[2]->code == I_PUSHW) &&
-			 ((strcmp((char *)p[0]->data, "eq") == 0) ||
-			  (strcmp((char *)p[0]->data, "eqb") == 0) ||
-			  (strcmp((char *)p[0]->data, "ne") == 0) ||
-			  (strcmp((char *)p[0]->data, "neb") == 0) ||
-			  (strcmp((char *)p[0]->data, "lt") == 0) ||
-			  (strcmp((char *)p[0]->data, "ltb") == 0) ||
-			  (strcmp((char *)p[0]->data, "ult") == 0) ||
-			  (strcmp((char *)p[0]->data, "ublt") == 0) ||
-			  (strcmp((char *)p[0]->data, "gt") == 0) ||
-			  (strcmp((char *)p[0]->data, "gtb") == 0) ||
-			  (strcmp((char *)p[0]->data, "ugt") == 0) ||
-			  (strcmp((char *)p[0]->data, "ubgt") == 0) ||
-			  (strcmp((char *)p[0]->data, "ge") == 0) ||
-			  (strcmp((char *)p[0]->data, "geb") == 0) ||
-			  (strcmp((char *)p[0]->data, "uge") == 0) ||
-			  (strcmp((char *)p[0]->data, "ubge") == 0) ||
-			  (strcmp((char *)p[0]->data, "le") == 0) ||
-			  (strcmp((char *)p[0]->data, "leb") == 0) ||
-			  (strcmp((char *)p[0]->data, "ule") == 0) ||
-			  (strcmp((char *)p[0]->data, "uble") == 0))) {
-				if (p[1]->code == X_LDW_S || p[1]->code == X_LDB_S)
-					p[1]->data -= 2;
-				/* replace code */
-				p[2]->code = I_STW;
-				p[2]->type = T_SYMBOL;
-				p[2]->data = (long)"_temp";
-				if (strcmp((char *)p[0]->data, "eq") == 0)
-					p[0]->data = (long)"eqzp";
-				else if (strcmp((char *)p[0]->data, "eqb") == 0)
-					p[0]->data = (long)"eqbzp";
-				else if (strcmp((char *)p[0]->data, "ne") == 0)
-					p[0]->data = (long)"nezp";
-				else if (strcmp((char *)p[0]->data, "neb") == 0)
-					p[0]->data = (long)"nebzp";
-				else if (strcmp((char *)p[0]->data, "lt") == 0)
-					p[0]->data = (long)"ltzp";
-				else if (strcmp((char *)p[0]->data, "ltb") == 0)
-					p[0]->data = (long)"ltbzp";
-				else if (strcmp((char *)p[0]->data, "ult") == 0)
-					p[0]->data = (long)"ultzp";
-				else if (strcmp((char *)p[0]->data, "ublt") == 0)
-					p[0]->data = (long)"ubltzp";
-				else if (strcmp((char *)p[0]->data, "gt") == 0)
-					p[0]->data = (long)"gtzp";
-				else if (strcmp((char *)p[0]->data, "gtb") == 0)
-					p[0]->data = (long)"gtbzp";
-				else if (strcmp((char *)p[0]->data, "ugt") == 0)
-					p[0]->data = (long)"ugtzp";
-				else if (strcmp((char *)p[0]->data, "ubgt") == 0)
-					p[0]->data = (long)"ubgtzp";
-				else if (strcmp((char *)p[0]->data, "le") == 0)
-					p[0]->data = (long)"lezp";
-				else if (strcmp((char *)p[0]->data, "leb") == 0)
-					p[0]->data = (long)"lebzp";
-				else if (strcmp((char *)p[0]->data, "ule") == 0)
-					p[0]->data = (long)"ulezp";
-				else if (strcmp((char *)p[0]->data, "uble") == 0)
-					p[0]->data = (long)"ublezp";
-				else if (strcmp((char *)p[0]->data, "ge") == 0)
-					p[0]->data = (long)"gezp";
-				else if (strcmp((char *)p[0]->data, "geb") == 0)
-					p[0]->data = (long)"gebzp";
-				else if (strcmp((char *)p[0]->data, "uge") == 0)
-					p[0]->data = (long)"ugezp";
-				else if (strcmp((char *)p[0]->data, "ubge") == 0)
-					p[0]->data = (long)"ubgezp";
-				/* loop */
-				goto lv1_loop;
-			}
+/*  incw/b     n                  -->  __ldw/b/ub   n
+ *  __ldw/b/ub    n                         incw/b  n
+ *  __subwi  1
+ *
+ */
+static int peep_postinc (INS **p)
+{
+	if (p[0]->type != T_VALUE ||
+	    p[0]->data != 1 ||
+	    (p[2]->code == I_INCW) != (p[1]->code == I_LDW) ||
+	    cmp_operands(p[1], p[2]) != 1)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	p[2]->code = p[1]->code;
+	p[2]->type = p[1]->type;
+	p[2]->data = p[1]->data;
+	p[1]->code = (p[1]->code == I_LDW) ? I_INCW : I_INCB;
+	return (1);
+}
 
-			else if (p[0]->code == I_JSR &&
-				 (!strcmp((char *)p[0]->data, "eqzp") ||
-				  !strcmp((char *)p[0]->data, "nezp")) &&
-				 p[1]->code == I_LDWI &&
-				 p[2]->code == I_STW &&
-				 p[2]->type == T_SYMBOL &&
-				 !strcmp((char *)p[2]->data, "_temp")) {
-				*p[2] = *p[1];
-				if (!strcmp((char *)p[0]->data, "eqzp"))
-					p[2]->code = I_CMPWI_EQ;
-				else
-					p[2]->code = I_CMPWI_NE;
-				nb = 2;
-			}
+/*  __lbra  LLn                 --> LLn:
+ *  LLn:
+ *
+ */
+static int peep_lbra_next (INS **p)
+{
+	if (p[1]->type != T_LABEL || p[0]->data != p[1]->data)
+		return (PEEP_NOMATCH);
+	*p[1] = *p[0];
+	return (1);
+}
 
-			/*  __ldw/b/ub   n                    -->   incw/b  n
-			 *  __addwi 1                        __ldw/b/ub   n
-			 *  __stw/b/ub   n
-			 *
-			 *  ====
-			 *  bytes  :  6+ 7+ 6=19 -->       8 + 6=14
-			 *  cycles : 10+12+10=32 --> (11->16)+10=(21->26)
-			 *
-			 */
-			else if
-			((p[0]->code == I_STW || p[0]->code == I_STB) &&
-			 (p[2]->code == I_LDW || p[2]->code == I_LDUB || p[2]->code == I_LDB) &&
-			 ((p[1]->code == I_ADDWI) &&
-			  (p[1]->type == T_VALUE) &&
-			  (p[1]->data == 1)) &&
-			 (cmp_operands(p[0], p[2]) == 1)) {
-				/* replace code */
-				p[1]->code = p[2]->code;
-				p[1]->type = p[2]->type;
-				p[1]->data = p[2]->data;
-				p[2]->code = (p[0]->code == I_STW) ? I_INCW : I_INCB;
-				nb = 1;
-			}
+/*  __addmi i,__stack           --> __addmi i+j,__stack
+ *  __addmi j,__stack
+ *
+ *  ====
+ *  bytes  : 15+15 = 30         --> 15
+ *  cycles : 29+29 = 58         --> 29
+ *
+ */
+static int peep_addmi (INS **p)
+{
+	if (p[0]->type != T_STACK || p[1]->type != T_STACK)
+		return (PEEP_NOMATCH);
 
-			/*  incw/b     n                  -->  __ldw/b/ub   n
-			 *  __ldw/b/ub    n                         incw/b  n
-			 *  __subwi  1
-			 *
-			 */
-			else if
-			(((p[0]->code == I_SUBWI) &&
-			  (p[0]->type == T_VALUE) &&
-			  (p[0]->data == 1)) &&
-
-			 (p[1]->code == I_LDW) &&
-			 (p[2]->code == I_INCW) &&
-			 (cmp_operands(p[1], p[2]) == 1)) {
-				/* replace code */
-				p[2]->code = p[1]->code;
-				p[2]->type = p[1]->type;
-				p[2]->data = p[1]->data;
-				p[1]->code = I_INCW;
-				nb = 1;
-			}
-			else if
-			(((p[0]->code == I_SUBWI) &&
-			  (p[0]->type == T_VALUE) &&
-			  (p[0]->data == 1)) &&
-
-			 (p[1]->code == I_LDB || p[1]->code == I_LDUB) &&
-			 (p[2]->code == I_INCB) &&
-			 (cmp_operands(p[1], p[2]) == 1)) {
-				/* replace code */
-				p[2]->code = p[1]->code;
-				p[2]->type = p[1]->type;
-				p[2]->data = p[1]->data;
-				p[1]->code = I_INCB;
-				nb = 1;
-			}
+	/* replace code */
+	p[1]->data += p[0]->data;
+	return (1);
+}
 
-			/* flush queue */
-			if (nb) {
-				q_wr -= nb;
-				q_nb -= nb;
-				nb = 0;
+/*  __addwi i                   --> __addwi i+j
+ *  __addwi j
+ *
+ *  ====
+ *  bytes  :  7+ 7 = 14         -->  7
+ *  cycles : 12+12 = 24         --> 12
+ *
+ */
+static int peep_addwi_addwi (INS **p)
+{
+	if (p[0]->type != T_VALUE || p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
 
-				if (q_wr < 0)
-					q_wr += Q_SIZE;
+	/* replace code */
+	p[1]->data += p[0]->data;
+	return (1);
+}
 
-				/* loop */
-				goto lv1_loop;
-			}
+/*  __ldwi  i                   --> __ldwi i+j
+ *  __add[bw]i j
+ *
+ *  ====
+ *  bytes  : 4+ 7 = 11          --> 4
+ *  cycles : 4+12 = 16          --> 4
+ *
+ *  __ldwi  sym                   --> __ldwi sym+j
+ *  __add[bw]i j
+ *
+ */
+static int peep_ldwi_addi (INS **p)
+{
+	if (p[1]->type == T_VALUE) {
+		/* replace code */
+		p[1]->data += p[0]->data;
+		return (1);
+	}
+	if (p[1]->type == T_SYMBOL) {
+		/* replace code */
+		if (p[0]->data != 0) {
+			char *newsym = (char *)malloc(strlen((char *)p[1]->data) + 12);
+			sprintf(newsym, "%s+%ld", (char *)p[1]->data, p[0]->data);
+			p[1]->data = (long)newsym;
 		}
+		return (1);
+	}
+	return (PEEP_NOMATCH);
+}
 
-		/* 2-instruction patterns */
-		if (q_nb >= 2) {
-			if (p[0]->code == I_LABEL &&
-			    (p[1]->code == I_LBRA || p[1]->code == I_LBRAN) &&
-			    p[1]->type == T_LABEL &&
-			    p[0]->data == p[1]->data) {
-				*p[1] = *p[0];
-				nb = 1;
-			}
+/*  __ldwi  i                   --> __ldwi (i op j)
+ *  __subwi/andwi/orwi/mulwi j
+ *
+ *  ====
+ *  bytes  : 4+ 7 = 11          --> 4
+ *  cycles : 4+12 = 16          --> 4
+ *
+ */
+static int peep_ldwi_fold (INS **p)
+{
+	if (p[1]->type != T_VALUE)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	switch (p[0]->code) {
+	case I_SUBWI: p[1]->data -= p[0]->data; break;
+	case I_ANDWI: p[1]->data &= p[0]->data; break;
+	case I_ORWI: p[1]->data |= p[0]->data; break;
+	case I_MULWI: p[1]->data *= p[0]->data; break;
+	case I_ASLW: p[1]->data += p[1]->data; break;
+	case I_COMW: p[1]->data = p[1]->data ^ 0xffff; break;
+	case I_NEGW: p[1]->data = -p[1]->data; break;
+	default: abort();
+	}
+	return (1);
+}
 
-			/*  __addmi i,__stack           --> __addmi i+j,__stack
-			 *  __addmi j,__stack
-			 *
-			 *  ====
-			 *  bytes  : 15+15 = 30         --> 15
-			 *  cycles : 29+29 = 58         --> 29
-			 *
-			 */
-			else if ((p[0]->code == I_ADDMI) &&
-				 (p[1]->code == I_ADDMI) &&
-
-				 (p[0]->type == T_STACK) &&
-				 (p[1]->type == T_STACK)) {
-				/* replace code */
-				p[1]->data += p[0]->data;
-				nb = 1;
-			}
+/*  __ldwi <power of two>       --> __ldwi <log2>
+ *  jsr {u|s}mul		--> jsr asl
+ *
+ */
+static int peep_mul_pow2 (INS **p)
+{
+	if ((strcmp((char *)p[0]->data, "umul") &&
+	     strcmp((char *)p[0]->data, "smul")) ||
+	    p[1]->type != T_VALUE ||
+	    __builtin_popcount(p[1]->data) != 1 ||
+	    p[1]->data <= 0 || p[1]->data >= 0x8000)
+		return (PEEP_NOMATCH);
+
+	p[0]->data = (long)"asl";
+	p[1]->data = __builtin_ctz(p[1]->data);
+	return (0);
+}
 
-			/*  __addwi i                   --> __addwi i+j
-			 *  __addwi j
-			 *
-			 *  ====
-			 *  bytes  :  7+ 7 = 14         -->  7
-			 *  cycles : 12+12 = 24         --> 12
-			 *
-			 */
-			else if
-			((p[0]->code == I_ADDWI && p[0]->type == T_VALUE) &&
-			 (p[1]->code == I_ADDWI && p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data += p[0]->data;
-				nb = 1;
-			}
+/*  __stw a                  --> __stw a
+ *  __ldw a
+ *
+ */
+static int peep_stw_ldw (INS **p)
+{
+	if (cmp_operands(p[0], p[1]) != 1)
+		return (PEEP_NOMATCH);
 
-			/*  __ldwi  i                   --> __ldwi i+j
-			 *  __add[bw]i j
-			 *
-			 *  ====
-			 *  bytes  : 4+ 7 = 11          --> 4
-			 *  cycles : 4+12 = 16          --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_ADDWI || p[0]->code == I_ADDBI) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data += p[0]->data;
-				nb = 1;
-			}
+	/* remove code */
+	return (1);
+}
 
-			/*  __ldwi  sym                   --> __ldwi sym+j
-			 *  __add[bw]i j
-			 *
-			 */
-			else if
-			((p[0]->code == I_ADDWI || p[0]->code == I_ADDBI) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_SYMBOL)) {
-				/* replace code */
-				if (p[0]->data != 0) {
-					char *newsym = (char *)malloc(strlen((char *)p[1]->data) + 12);
-					sprintf(newsym, "%s+%ld", (char *)p[1]->data, p[0]->data);
-					p[1]->data = (long)newsym;
-				}
-				nb = 1;
-			}
+/*  __ldw a (or __ldwi a)       --> __ldw b (or __ldwi b)
+ *  __ldw b (or __ldwi b)
+ *
+ */
+static int peep_load_load (INS **p)
+{
+	/* remove code */
+	*p[1] = *p[0];
+	return (1);
+}
 
-			/*  __ldwi  i                   --> __ldwi (i-j)
-			 *  __subwi j
-			 *
-			 *  ====
-			 *  bytes  : 4+ 7 = 11          --> 4
-			 *  cycles : 4+12 = 16          --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_SUBWI) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data -= p[0]->data;
-				nb = 1;
-			}
+/*  ...                         --> ...
+ *  __addwi etc. 0
+ *
+ *  ====
+ *  bytes  : x+ 7               --> x
+ *  cycles : y+12               --> y
+ *
+ */
+static int peep_nop_imm (INS **p)
+{
+	if (p[0]->data != 0 || p[0]->type != T_VALUE)
+		return (PEEP_NOMATCH);
 
-			/*  __ldwi  i                   --> __ldwi (i&j)
-			 *  __andwi j
-			 *
-			 *  ====
-			 *  bytes  : 4+ 6 = 10          --> 4
-			 *  cycles : 4+10 = 14          --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_ANDWI) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data &= p[0]->data;
-				nb = 1;
-			}
+	/* remove code */
+	return (1);
+}
 
-			/*  __ldwi  i                   --> __ldwi (i|j)
-			 *  __orwi j
-			 *
-			 *  ====
-			 *  bytes  : 4+ 6 = 10          --> 4
-			 *  cycles : 4+10 = 14          --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_ORWI) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data |= p[0]->data;
-				nb = 1;
-			}
+/*  @_stw_s i                   --> @_stw_s i
+ *  @_ldw_s i
+ *
+ *  ====
+ *  bytes  :  9+ 8 = 17         -->  9
+ *  cycles : 22+20 = 42         --> 22
+ *
+ */
+static int peep_stw_s_ldw_s (INS **p)
+{
+	if (p[0]->data != p[1]->data)
+		return (PEEP_NOMATCH);
 
-			/*  __ldwi  i                   --> __ldwi (i*j)
-			 *  __mulwi j
-			 *
-			 */
-			else if
-			((p[0]->code == I_MULWI) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data *= p[0]->data;
-				nb = 1;
-			}
+	/* remove code */
+	return (1);
+}
 
-			/*  __ldwi i                    --> __ldwi i+i
-			 *  __aslw
-			 *
-			 *  ====
-			 *  bytes  : 4+4 = 8            --> 4
-			 *  cycles : 4+8 = 12           --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_ASLW) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data += p[1]->data;
-				nb = 1;
-			}
+/*  @_stb_s i                   --> @_stb_s i
+ *  @_ldb_s i                       __extw
+ *
+ *  ====
+ *  bytes  :  6+ 9 = 15         -->  6+?
+ *  cycles : 13+17 = 30         --> 13+?
+ *
+ */
+static int peep_stb_s_ldb_s (INS **p)
+{
+	if (p[0]->data != p[1]->data)
+		return (PEEP_NOMATCH);
+
+	if (p[0]->code == X_LDB_S)
+		p[0]->code = I_EXTW;
+	else
+		p[0]->code = I_EXTUW;
+	p[0]->type = p[0]->data = 0;
+	return (0);
+}
 
-			/*  __ldwi i                    --> __ldwi i ^ 0xffff
-			 *  __comw
-			 *
-			 *  ====
-			 *  bytes  : 4+4 = 8            --> 4
-			 *  cycles : 4+8 = 12           --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_COMW) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data = p[1]->data ^ 0xffff;
-				nb = 1;
-			}
+/*  @_lea_s i                   --> @_pea_s i
+ *  __pushw
+ *
+ *  ====
+ *  bytes  : 10+23 = 33         --> 25
+ *  cycles : 16+49 = 65         --> 44
+ *
+ */
+static int peep_pea_s (INS **p)
+{
+	/* replace code */
+	p[1]->code = X_PEA_S;
+	return (1);
+}
 
-			/*  __ldwi i                    --> __ldwi i ^ 0xffff
-			 *  __negw
-			 *
-			 *  ====
-			 *  bytes  : 4+4 = 8            --> 4
-			 *  cycles : 4+8 = 12           --> 4
-			 *
-			 */
-			else if
-			((p[0]->code == I_NEGW) &&
-			 (p[1]->code == I_LDWI) &&
-
-			 (p[1]->type == T_VALUE)) {
-				/* replace code */
-				p[1]->data = -p[1]->data;
-				nb = 1;
-			}
+/*  __stw   __ptr               --> @_ld(u)b_p
+ *  __ld(u)bp  __ptr
+ *
+ *  ====
+ *  bytes  : 4+10 = 14          --> 11
+ *  cycles : 8+19 = 27          --> 23
+ *
+ */
+static int peep_ldb_p (INS **p)
+{
+	if (p[1]->type != T_PTR)
+		return (PEEP_NOMATCH);
 
-			/*  __ldwi <power of two>       --> __ldwi <log2>
-			 *  jsr {u|s}mul		--> jsr asl
-			 *
-			 */
-			else if
-			(p[0]->code == I_JSR &&
-			 (!strcmp((char *)p[0]->data, "umul") ||
-			  !strcmp((char *)p[0]->data, "smul")) &&
-			 (p[1]->code == I_LDWI) &&
-			 (p[1]->type == T_VALUE) &&
-			 __builtin_popcount(p[1]->data) == 1 &&
-			 p[1]->data > 0 && p[1]->data < 0x8000) {
-				p[0]->data = (long)"asl";
-				p[1]->data = __builtin_ctz(p[1]->data);
-				nb = 0;
-			}
+	/* replace code */
+	p[1]->code = (p[0]->code == I_LDBP) ? X_LDB_P : X_LDUB_P;
+	return (1);
+}
 
-			/*  __ldw   __stack             --> @_pea_s 0
-			 *  __pushw
-			 *
-			 *  ====
-			 *  bytes  : 4+23 = 27          --> 25
-			 *  cycles : 8+49 = 57          --> 44
-			 *
-			 */
-//			else if
-//			   ((p[0]->code == I_PUSHW) &&
-//				(p[1]->code == I_LDW) &&
-//
-//				(p[1]->type == T_STACK))
-//			{
-//				/* replace code */
-//				p[1]->code = X_PEA_S;
-//				p[1]->data = 0;
-//				nb = 1;
-//			}
-
-			/*  __ldw   __stack             --> @_lea_s i
-			 *  __addwi i
-			 *
-			 *  ====
-			 *  bytes  : 4+ 7 = 11          --> 10
-			 *  cycles : 8+12 = 20          --> 16
-			 *
-			 */
-//			else if
-//			   ((p[0]->code == I_ADDWI) &&
-//				(p[1]->code == I_LDW) &&
-//
-//				(p[1]->type == T_STACK))
-//			{
-//				/* replace code */
-//				p[1]->code = X_LEA_S;
-//				p[1]->data = p[0]->data;
-//				nb = 1;
-//			}
-
-			/*  __stw a                  --> __stw a
-			 *  __ldw a
-			 *
-			 */
-			else if
-			((p[0]->code == I_LDW) &&
-			 (p[1]->code == I_STW) &&
-			 (cmp_operands(p[0], p[1]) == 1)) {
-				/* remove code */
-				nb = 1;
-			}
+/*  @_lea_s i                   --> @_ld(u)b_s i
+ *  @_ld(u)b_p
+ *
+ *  ====
+ *  bytes  : 10+11 = 21         -->  9
+ *  cycles : 16+23 = 39         --> 17
+ *
+ *  @_ldwi i                   --> @_ld(u)b i
+ *  @_ld(u)b_p
+ *
+ */
+static int peep_ldb_p_direct (INS **p)
+{
+	/* replace code */
+	if (p[1]->code == X_LEA_S)
+		p[1]->code = (p[0]->code == X_LDB_P) ? X_LDB_S : X_LDUB_S;
+	else
+		p[1]->code = (p[0]->code == X_LDB_P) ? I_LDB : I_LDUB;
+	return (1);
+}
 
-			/*  __ldw a (or __ldwi a)       --> __ldw b (or __ldwi b)
-			 *  __ldw b (or __ldwi b)
-			 *
-			 *  ====
-			 *  bytes  : ?               --> ?
-			 *  cycles : ?               --> ?
-			 *
-			 */
-			else if
-			((p[0]->code == I_LDW ||
-			  p[0]->code == I_LDWI ||
-			  p[0]->code == X_LDW_S ||
-			  p[0]->code == X_LEA_S ||
-			  p[0]->code == I_LDB ||
-			  p[0]->code == I_LDBP ||
-			  p[0]->code == I_LDBY ||
-			  p[0]->code == X_LDB ||
-			  p[0]->code == X_LDB_S ||
-			  p[0]->code == I_LDUB ||
-			  p[0]->code == I_LDUBP ||
-			  p[0]->code == X_LDUB ||
-			  p[0]->code == X_LDUB_S) &&
-			 (p[1]->code == I_LDW ||
-			  p[1]->code == I_LDWI ||
-			  p[1]->code == X_LDW_S ||
-			  p[1]->code == X_LEA_S ||
-			  p[1]->code == I_LDB ||
-			  p[1]->code == I_LDBP ||
-			  p[1]->code == I_LDBY ||
-			  p[1]->code == X_LDB ||
-			  p[1]->code == X_LDB_S ||
-			  p[1]->code == I_LDUB ||
-			  p[1]->code == I_LDUBP ||
-			  p[1]->code == X_LDUB ||
-			  p[1]->code == X_LDUB_S)
-			) {
-				/* remove code */
-				*p[1] = *p[0];
-				nb = 1;
-			}
+/*  @_pea_s i                   --> @_pea_s i
+ *  @_ld(u)b_p                      @_ld(u)b_s i+2
+ *
+ *  ====
+ *  bytes  : 25+11 = 36         --> 25+ 9 = 34
+ *  cycles : 44+23 = 67         --> 44+17 = 61
+ *
+ */
+static int peep_pea_s_ldb_p (INS **p)
+{
+	if (optimize < 2)
+		return (PEEP_NOMATCH);
+
+	/* replace code */
+	p[0]->code = (p[0]->code == X_LDB_P) ? X_LDB_S : X_LDUB_S;
+	p[0]->data = p[1]->data + 2;
+	p[0]->sym = p[1]->sym;
+	return (0);
+}
 
-			/*  ...                         --> ...
-			 *  __addwi etc. 0
-			 *
-			 *  ====
-			 *  bytes  : x+ 7               --> x
-			 *  cycles : y+12               --> y
-			 *
-			 */
-			else if
-			((p[0]->code == I_ADDWI || p[0]->code == I_ASLWI ||
-			  p[0]->code == I_LSRWI || p[0]->code == I_ASRWI ||
-			  p[0]->code == I_SUBWI) &&
-			 p[0]->data == 0 && p[0]->type == T_VALUE) {
-				/* remove code */
-				nb = 1;
-			}
+/* ldwi i; st{b|w}ip j	--> st{b|w}i i, j */
+static int peep_stip_ldwi (INS **p)
+{
+	p[1]->code = (p[0]->code == I_STWIP) ? I_STWI : I_STBI;
+	p[1]->imm = p[0]->data;
+	return (1);
+}
 
-			/*  @_stw_s i                   --> @_stw_s i
-			 *  @_ldw_s i
-			 *
-			 *  ====
-			 *  bytes  :  9+ 8 = 17         -->  9
-			 *  cycles : 22+20 = 42         --> 22
-			 *
-			 */
-			else if
-			((p[0]->code == X_LDW_S) &&
-			 (p[1]->code == X_STW_S) &&
+/* ldwi i; stw const	--> stwi const, i */
+/* XXX: This doesn't really do anything... */
+static int peep_ldwi_st_const (INS **p)
+{
+	if (p[0]->type != T_VALUE)
+		return (PEEP_NOMATCH);
+
+	p[1]->code = (p[0]->code == I_STW) ? I_STWI : I_STBI;
+	p[1]->imm = p[1]->data;
+	p[1]->imm_type = p[1]->type;
+	p[1]->data = p[0]->data;
+	p[1]->type = p[0]->type;
+	return (1);
+}
 
-			 (p[0]->data == p[1]->data)) {
-				/* remove code */
-				nb = 1;
-			}
+/* subwi/addwi i; ldw j --> ldw j
+   This is a frequent case in which the result
+   of a post-increment or decrement is not used. */
+static int peep_unused_addwi (INS **p)
+{
+	*p[1] = *p[0];
+	return (1);
+}
 
-			/*  @_stb_s i                   --> @_stb_s i
-			 *  @_ldb_s i
-			 *
-			 *  ====
-			 *  bytes  :  6+ 9 = 15         -->  6
-			 *  cycles : 13+17 = 30         --> 13
-			 *
-			 */
-			else if
-			((p[0]->code == X_LDB_S || p[0]->code == X_LDUB_S) &&
-			 (p[1]->code == X_STB_S) &&
+/*  jsr eq/ne/eqzp/nezp         --> jsr eq/ne/eqzp/nezp
+ *  __tstw
+ *
+ *  ====
+ *  bytes  : x+4         --> x
+ *  cycles : y+8         --> y
+ *
+ */
+static int peep_cmp_tstw (INS **p)
+{
+	if (find_func(cmp_funcs, p[1]) < 0 &&
+	    find_func(cmp_zp_funcs, p[1]) < 0)
+		return (PEEP_NOMATCH);
+	return (1);
+}
 
-			 (p[0]->data == p[1]->data)) {
-				if (p[0]->code == X_LDB_S)
-					p[0]->code = I_EXTW;
-				else
-					p[0]->code = I_EXTUW;
-				p[0]->type = p[0]->data = 0;
-			}
+/*  __boolw         --> __tstw
+ *  __tstw
+ *
+ */
+static int peep_boolw_tstw (INS **p)
+{
+	p[1]->code = I_TSTW;
+	return (1);
+}
 
-			/*  @_lea_s i                   --> @_pea_s i
-			 *  __pushw
-			 *
-			 *  ====
-			 *  bytes  : 10+23 = 33         --> 25
-			 *  cycles : 16+49 = 65         --> 44
-			 *
-			 */
-			else if
-			((p[0]->code == I_PUSHW) &&
-			 (p[1]->code == X_LEA_S)) {
-				/* replace code */
-				p[1]->code = X_PEA_S;
-				nb = 1;
-			}
+/*  __notw         --> __notw
+ *  __tstw
+ *
+ *  __cmpwi_*         --> __cmpwi_*
+ *  __tstw
+ *
+ */
+static int peep_tstw (INS **p)
+{
+	return (1);
+}
 
-			/*  __stw   __ptr               --> @_ldb_p
-			 *  __ldbp  __ptr
-			 *
-			 *  ====
-			 *  bytes  : 4+10 = 14          --> 11
-			 *  cycles : 8+19 = 27          --> 23
-			 *
-			 */
-			else if
-			((p[0]->code == I_LDBP) &&
-			 (p[1]->code == I_STW) &&
-
-			 (p[1]->type == T_PTR)) {
-				/* replace code */
-				p[1]->code = X_LDB_P;
-				nb = 1;
-			}
-			else if
-			((p[0]->code == I_LDUBP) &&
-			 (p[1]->code == I_STW) &&
-
-			 (p[1]->type == T_PTR)) {
-				/* replace code */
-				p[1]->code = X_LDUB_P;
-				nb = 1;
-			}
+/*  __st{b|w}i  p, 0        --> __st{b|w}z p
+ *  <load>
+ *
+ */
+static int peep_stz (INS **p)
+{
+	if (p[1]->imm_type != T_VALUE ||
+	    p[1]->imm != 0 ||
+	    !is_load(p[0]) ||
+	    p[0]->code == X_LDB_P ||
+	    p[0]->code == X_LDUB_P)
+		return (PEEP_NOMATCH);
+
+	p[1]->code = (p[1]->code == I_STWI) ? I_STWZ : I_STBZ;
+	return (0);
+}
 
-			/*  @_lea_s i                   --> @_ld(u)b_s i
-			 *  @_ld(u)b_p
-			 *
-			 *  ====
-			 *  bytes  : 10+11 = 21         -->  9
-			 *  cycles : 16+23 = 39         --> 17
-			 *
-			 */
-			else if
-			((p[0]->code == X_LDB_P) &&
-			 (p[1]->code == X_LEA_S)) {
-				/* replace code */
-				p[1]->code = X_LDB_S;
-				nb = 1;
-			}
-			else if
-			((p[0]->code == X_LDUB_P) &&
-			 (p[1]->code == X_LEA_S)) {
-				/* replace code */
-				p[1]->code = X_LDUB_S;
-				nb = 1;
-			}
+#define LOADS   I_LDW, I_LDWI, X_LDW_S, X_LEA_S, I_LDB, I_LDBP, I_LDBY, \
+	X_LDB, X_LDB_S, I_LDUB, I_LDUBP, X_LDUB, X_LDUB_S
 
-			/*  @_ldwi i                   --> @_ld(u)b i
-			 *  @_ld(u)b_p
-			 *
-			 */
-			else if
-			((p[0]->code == X_LDB_P) &&
-			 (p[1]->code == I_LDWI)) {
-				/* replace code */
-				p[1]->code = I_LDB;
-				nb = 1;
-			}
-			else if
-			((p[0]->code == X_LDUB_P) &&
-			 (p[1]->code == I_LDWI)) {
-				/* replace code */
-				p[1]->code = I_LDUB;
-				nb = 1;
-			}
+/* the rules, longest patterns first; the first rule that matches
+ * wins, so a more specific rule must come before a general one
+ */
+static PEEP_RULE peep_rules[] = {
+	/* 6-instruction patterns */
+	{ "ldwp_addwi_stwps", { OPS(I_STWPS), OPS(I_ADDWI, I_SUBWI), OPS(I_LDWP), OPS(I_STW), OPS(I_PUSHW), OPS(I_LDWI) }, peep_ldwp_addwi_stwps },
+
+	/* 5-instruction patterns */
+	{ "index_ldw_s", { OPS(I_ADDWS), OPS(I_ASLW), OPS(X_LDW_S), OPS(I_PUSHW), OPS(I_LDWI) }, peep_index_ldw_s },
+	{ "index_ldw", { OPS(I_ADDWS), OPS(I_ASLW), OPS(I_LDW), OPS(I_PUSHW), OPS(I_LDWI) }, peep_index_ldw },
+	{ "index_ldb_p", { OPS(X_LDB_P), OPS(I_ADDWS), OPS(I_LDUB), OPS(I_PUSHW), OPS(I_LDWI) }, peep_index_ldb_p },
+
+	/* 4-instruction patterns */
+	{ "postinc_s", { OPS(I_SUBWI), OPS(X_STW_S, X_STB_S), OPS(I_ADDWI), OPS(X_LDW_S, X_LDB_S, X_LDUB_S) }, peep_postinc_s },
+	{ "umul_const", { OPS(I_JSR), OPS(I_LDWI), OPS(I_PUSHW), OPS(I_LDWI) }, peep_umul_const },
+	{ "stwi", { OPS(I_STWPS, I_STBPS), OPS(I_LDWI), OPS(I_PUSHW), OPS(I_LDWI) }, peep_stwi },
+	{ "addbi_p", { OPS(I_STBPS), OPS(I_ADDWI), OPS(X_LDB_P), OPS(I_PUSHW) }, peep_addbi_p },
+
+	/* 3-instruction patterns */
+	{ "addi", { OPS(I_ADDWS, I_ADDBS), OPS(I_LDWI), OPS(I_PUSHW) }, peep_addi },
+	{ "subi_andi_ori", { OPS(I_SUBWS, I_ANDWS, I_ORWS), OPS(I_LDWI), OPS(I_PUSHW) }, peep_subi_andi_ori },
+	{ "stip", { OPS(I_STWPS, I_STBPS), OPS(I_LDWI), OPS(I_PUSHW) }, peep_stip },
+	{ "shifti", { OPS(I_JSR), OPS(I_LDWI), OPS(I_PUSHW) }, peep_shifti },
+	{ "muli", { OPS(I_JSR), OPS(I_LDWI), OPS(I_PUSHW) }, peep_muli },
+	{ "addws_load", { OPS(I_ADDWS), OPS(I_LDW, I_LDB, I_LDUB, X_LDB_S, X_LDUB_S, X_LDW_S), OPS(I_PUSHW) }, peep_addws_load },
+	{ "subw", { OPS(I_SUBWS), OPS(I_LDW), OPS(I_PUSHW) }, peep_subw },
+	{ "sti_s", { OPS(I_STBPS, I_STWPS), OPS(I_LDWI), OPS(X_PEA_S) }, peep_sti_s },
+	{ "lea_s", { OPS(I_ADDWS), OPS(I_LDWI), OPS(X_PEA_S) }, peep_lea_s },
+	{ "lea_s_ldwp", { OPS(I_LDWP), OPS(I_STW), OPS(X_LEA_S) }, peep_lea_s_ldwp },
+	{ "ldwi_ldwp", { OPS(I_LDWP, I_LDUBP), OPS(I_STW), OPS(I_LDWI) }, peep_ldwi_ldwp },
+	{ "pea_s_ldwp", { OPS(I_LDWP), OPS(I_STW), OPS(X_PEA_S) }, peep_pea_s_ldwp },
+	{ "cmp_zp", { OPS(I_JSR), OPS(I_LDWI, I_LDW, X_LDW_S, I_LDB, X_LDB_S), OPS(I_PUSHW) }, peep_cmp_zp },
+	{ "cmpwi", { OPS(I_JSR), OPS(I_LDWI), OPS(I_STW) }, peep_cmpwi },
+	{ "preinc", { OPS(I_STW, I_STB), OPS(I_ADDWI), OPS(I_LDW, I_LDUB, I_LDB) }, peep_preinc },
+	{ "postinc", { OPS(I_SUBWI), OPS(I_LDW, I_LDB, I_LDUB), OPS(I_INCW, I_INCB) }, peep_postinc },
+
+	/* 2-instruction patterns */
+	{ "lbra_next", { OPS(I_LABEL), OPS(I_LBRA, I_LBRAN) }, peep_lbra_next },
+	{ "addmi", { OPS(I_ADDMI), OPS(I_ADDMI) }, peep_addmi },
+	{ "addwi_addwi", { OPS(I_ADDWI), OPS(I_ADDWI) }, peep_addwi_addwi },
+	{ "ldwi_addi", { OPS(I_ADDWI, I_ADDBI), OPS(I_LDWI) }, peep_ldwi_addi },
+	{ "ldwi_fold", { OPS(I_SUBWI, I_ANDWI, I_ORWI, I_MULWI, I_ASLW, I_COMW, I_NEGW), OPS(I_LDWI) }, peep_ldwi_fold },
+	{ "mul_pow2", { OPS(I_JSR), OPS(I_LDWI) }, peep_mul_pow2 },
+	{ "stw_ldw", { OPS(I_LDW), OPS(I_STW) }, peep_stw_ldw },
+	{ "load_load", { OPS(LOADS), OPS(LOADS) }, peep_load_load },
+	{ "nop_imm", { OPS(I_ADDWI, I_ASLWI, I_LSRWI, I_ASRWI, I_SUBWI) }, peep_nop_imm },
+	{ "stw_s_ldw_s", { OPS(X_LDW_S), OPS(X_STW_S) }, peep_stw_s_ldw_s },
+	{ "stb_s_ldb_s", { OPS(X_LDB_S, X_LDUB_S), OPS(X_STB_S) }, peep_stb_s_ldb_s },
+	{ "pea_s", { OPS(I_PUSHW), OPS(X_LEA_S) }, peep_pea_s },
+	{ "ldb_p", { OPS(I_LDBP, I_LDUBP), OPS(I_STW) }, peep_ldb_p },
+	{ "ldb_p_direct", { OPS(X_LDB_P, X_LDUB_P), OPS(X_LEA_S, I_LDWI) }, peep_ldb_p_direct },
+	{ "pea_s_ldb_p", { OPS(X_LDB_P, X_LDUB_P), OPS(X_PEA_S) }, peep_pea_s_ldb_p },
+	{ "stip_ldwi", { OPS(I_STWIP, I_STBIP), OPS(I_LDWI) }, peep_stip_ldwi },
+	{ "ldwi_st_const", { OPS(I_STW, I_STB), OPS(I_LDWI) }, peep_ldwi_st_const },
+	{ "unused_addwi", { OPS(I_LDW, I_LDWI, X_LDW_S), OPS(I_SUBWI, I_ADDWI) }, peep_unused_addwi },
+	{ "cmp_tstw", { OPS(I_TSTW), OPS(I_JSR) }, peep_cmp_tstw },
+	{ "boolw_tstw", { OPS(I_TSTW), OPS(I_BOOLW) }, peep_boolw_tstw },
+	{ "tstw", { OPS(I_TSTW), OPS(I_NOTW, I_CMPWI_EQ, I_CMPWI_NE) }, peep_tstw },
+	{ "stz", { ANY, OPS(I_STWI, I_STBI) }, peep_stz },
+	{ NULL }
+};
 
-			/*  @_pea_s i                   --> @_pea_s i
-			 *  @_ldb_p                         @_ldb_s i+2
-			 *
-			 *  ====
-			 *  bytes  : 25+11 = 36         --> 25+ 9 = 34
-			 *  cycles : 44+23 = 67         --> 44+17 = 61
-			 *
-			 */
-			else if
-			((p[0]->code == X_LDB_P) &&
-			 (p[1]->code == X_PEA_S) &&
-
-			 (optimize >= 2)) {
-				/* replace code */
-				p[0]->code = X_LDB_S;
-				p[0]->data = p[1]->data + 2;
-				p[0]->sym = p[1]->sym;
-
-				/* loop */
-				goto lv1_loop;
-			}
-			else if
-			((p[0]->code == X_LDUB_P) &&
-			 (p[1]->code == X_PEA_S) &&
-
-			 (optimize >= 2)) {
-				/* replace code */
-				p[0]->code = X_LDUB_S;
-				p[0]->data = p[1]->data + 2;
-				p[0]->sym = p[1]->sym;
-
-				/* loop */
-				goto lv1_loop;
-			}
 
-			/* ldwi i; stwip j	--> stwi i, j */
-			else if (p[0]->code == I_STWIP &&
-				 p[1]->code == I_LDWI) {
-				p[1]->code = I_STWI;
-				p[1]->imm = p[0]->data;
-				nb = 1;
-			}
-			/* ldwi i; stbip j	--> stbi i, j */
-			else if (p[0]->code == I_STBIP &&
-				 p[1]->code == I_LDWI) {
-				p[1]->code = I_STBI;
-				p[1]->imm = p[0]->data;
-				nb = 1;
-			}
+/* ----
+ * peep_init()
+ * ----
+ * build the first opcode dispatch of the rule table
+ *
+ */
+static void peep_init (void)
+{
+	PEEP_RULE *r;
+	long *op;
+	int b, n;
+
+	for (r = peep_rules; r->name; r++)
+		for (r->len = 0; r->ops[r->len]; r->len++)
+			;
+
+	for (b = 0; b < PEEP_HASH; b++) {
+		peep_index[b] = malloc(sizeof(short) * (sizeof(peep_rules) / sizeof(PEEP_RULE)));
+		if (peep_index[b] == NULL) {
+			error("out of memory");
+			exit(1);
+		}
+		n = 0;
+		for (r = peep_rules; r->name; r++) {
+			for (op = r->ops[0]; *op >= 0; op++)
+				if (peep_hash(*op) == b)
+					break;
+			if (r->ops[0] == ANY || *op >= 0)
+				peep_index[b][n++] = r - peep_rules;
+		}
+		peep_index[b][n] = -1;
+	}
+}
 
-			/* ldwi i; stw const	--> stwi const, i */
-			/* XXX: This doesn't really do anything... */
-			else if ((p[0]->code == I_STW || p[0]->code == I_STB) &&
-				 p[0]->type == T_VALUE &&
-				 p[1]->code == I_LDWI) {
-				p[1]->code = (p[0]->code == I_STW) ? I_STWI : I_STBI;
-				p[1]->imm = p[1]->data;
-				p[1]->imm_type = p[1]->type;
-				p[1]->data = p[0]->data;
-				p[1]->type = p[0]->type;
-				nb = 1;
-			}
+/* ----
+ * peep_apply()
+ * ----
+ * try the rules on the window ending at q_ins[top]; returns the number
+ * of instructions removed, or PEEP_NOMATCH
+ *
+ */
+static int peep_apply (long top)
+{
+	INS *p[PEEP_MAXLEN];
+	PEEP_RULE *r;
+	short *idx;
+	long *op;
+	int i, nb, len;
+
+	if (peep_index[0] == NULL)
+		peep_init();
+
+	len = (top + 1 < PEEP_MAXLEN) ? top + 1 : PEEP_MAXLEN;
+	for (i = 0; i < len; i++)
+		p[i] = &q_ins[top - i];
+
+	for (idx = peep_index[peep_hash(p[0]->code)]; *idx >= 0; idx++) {
+		r = &peep_rules[*idx];
+		if (r->len > len)
+			continue;
+		for (i = 0; i < r->len; i++) {
+			if (r->ops[i] == ANY)
+				continue;
+			for (op = r->ops[i]; *op >= 0; op++)
+				if (*op == p[i]->code)
+					break;
+			if (*op < 0)
+				break;
+		}
+		if (i < r->len)
+			continue;
+		nb = r->apply(p);
+		if (nb == PEEP_NOMATCH)
+			continue;
+#ifdef DEBUG_OPTIMIZER
+		printf("rule %s\n", r->name);
+#endif
+		r->hits++;
 
-			/* subwi/addwi i; ldw j --> ldw j
-			   This is a frequent case in which the result
-			   of a post-increment or decrement is not used. */
-			else if ((p[0]->code == I_LDW ||
-				  p[0]->code == I_LDWI ||
-				  p[0]->code == X_LDW_S) &&
-				 (p[1]->code == I_SUBWI ||
-				  p[1]->code == I_ADDWI)) {
-				*p[1] = *p[0];
-				nb = 1;
-			}
+		/* drop the top of the window */
+		if (nb) {
+			memmove(&q_ins[top - nb + 1], &q_ins[top + 1],
+				(q_nb - top - 1) * sizeof(INS));
+			q_nb -= nb;
+		}
+		return (nb);
+	}
+	return (PEEP_NOMATCH);
+}
 
-			/*  jsr eq/ne/eqzp/nezp         --> jsr eq/ne/eqzp/nezp
-			 *  __tstw
-			 *
-			 *  ====
-			 *  bytes  : x+4         --> x
-			 *  cycles : y+8         --> y
-			 *
-			 */
-			else if
-			((p[0]->code == I_TSTW) &&
-			 (p[1]->code == I_JSR) &&
-			 ((strcmp((char *)p[1]->data, "eq") == 0) ||
-			  (strcmp((char *)p[1]->data, "eqb") == 0) ||
-			  (strcmp((char *)p[1]->data, "ne") == 0) ||
-			  (strcmp((char *)p[1]->data, "neb") == 0) ||
-			  (strcmp((char *)p[1]->data, "ge") == 0) ||
-			  (strcmp((char *)p[1]->data, "geb") == 0) ||
-			  (strcmp((char *)p[1]->data, "uge") == 0) ||
-			  (strcmp((char *)p[1]->data, "ubge") == 0) ||
-			  (strcmp((char *)p[1]->data, "gt") == 0) ||
-			  (strcmp((char *)p[1]->data, "gtb") == 0) ||
-			  (strcmp((char *)p[1]->data, "ugt") == 0) ||
-			  (strcmp((char *)p[1]->data, "ubgt") == 0) ||
-			  (strcmp((char *)p[1]->data, "le") == 0) ||
-			  (strcmp((char *)p[1]->data, "leb") == 0) ||
-			  (strcmp((char *)p[1]->data, "ule") == 0) ||
-			  (strcmp((char *)p[1]->data, "uble") == 0) ||
-			  (strcmp((char *)p[1]->data, "lt") == 0) ||
-			  (strcmp((char *)p[1]->data, "ltb") == 0) ||
-			  (strcmp((char *)p[1]->data, "ult") == 0) ||
-			  (strcmp((char *)p[1]->data, "ublt") == 0) ||
-			  (strcmp((char *)p[1]->data, "eqzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "eqbzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "nezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "nebzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "gezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "gebzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ugezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ubgezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "gtzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "gtbzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ugtzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ubgtzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "lezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "lebzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ulezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ublezp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ltzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ltbzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ultzp") == 0) ||
-			  (strcmp((char *)p[1]->data, "ubltzp") == 0)))
-				nb = 1;
-
-			/*  __boolw         --> __tstw
-			 *  __tstw
-			 *
-			 */
-			else if ((p[0]->code == I_TSTW) &&
-				 (p[1]->code == I_BOOLW)) {
-				p[1]->code = I_TSTW;
-				nb = 1;
+/* ----
+ * peep_passes()
+ * ----
+ * run the rules over the whole instruction list until a pass changes
+ * nothing; push_ins() only sees the newest instructions, this also
+ * catches patterns that later rewrites open up further back
+ *
+ */
+static void peep_passes (void)
+{
+	long top;
+	int nb, changed;
+
+	do {
+		changed = 0;
+		for (top = 0; top < q_nb;) {
+			nb = peep_apply(top);
+			if (nb == PEEP_NOMATCH)
+				top++;
+			else {
+				changed = 1;
+				top -= nb;
+				if (top < 0)
+					top = 0;
 			}
+		}
+	} while (changed);
+}
 
-			/*  __notw         --> __notw
-			 *  __tstw
-			 *
-			 */
-			else if ((p[0]->code == I_TSTW) &&
-				 (p[1]->code == I_NOTW))
-				nb = 1;
+/* ----
+ * dump_peep_stats()
+ * ----
+ * report (and reset) how often each rule fired
+ *
+ */
+void dump_peep_stats (void)
+{
+	PEEP_RULE *r;
+
+	for (r = peep_rules; r->name; r++) {
+		if (r->hits) {
+			comment();
+			ot("peephole ");
+			outstr(r->name);
+			outstr(": ");
+			outdec(r->hits);
+			nl();
+		}
+		r->hits = 0;
+	}
+}
 
-			/*  __cmpwi_*         --> __cmpwi_*
-			 *  __tstw
-			 *
-			 */
-			else if ((p[0]->code == I_TSTW) &&
-				 (p[1]->code == I_CMPWI_EQ ||
-				  p[1]->code == I_CMPWI_NE))
-				nb = 1;
-
-			else if (p[1]->code == I_STWI &&
-				 p[1]->imm_type == T_VALUE &&
-				 p[1]->imm == 0 &&
-				 is_load(p[0]) &&
-				 p[0]->code != X_LDB_P &&
-				 p[0]->code != X_LDUB_P)
-				p[1]->code = I_STWZ;
-			else if (p[1]->code == I_STBI &&
-				 p[1]->imm_type == T_VALUE &&
-				 p[1]->imm == 0 &&
-				 is_load(p[0]) &&
-				 p[0]->code != X_LDB_P &&
-				 p[0]->code != X_LDUB_P)
-				p[1]->code = I_STBZ;
-
-			/* flush queue */
-			if (nb) {
-				q_wr -= nb;
-				q_nb -= nb;
-				nb = 0;
-
-				if (q_wr < 0)
-					q_wr += Q_SIZE;
-
-				/* loop */
-				goto lv1_loop;
-			}
+/* ----
+ * push_ins()
+ * ----
+ *
+ */
+void push_ins (INS *ins)
+{
+#ifdef DEBUG_OPTIMIZER
+	printf("push "); dump_ins(ins);
+#endif
+	/* grow the queue */
+	if (q_nb == q_max) {
+		q_max += Q_CHUNK;
+		q_ins = realloc(q_ins, q_max * sizeof(INS));
+		if (q_ins == NULL) {
+			error("out of memory");
+			exit(1);
 		}
 	}
 
+	/* push new instruction */
+	q_ins[q_nb++] = *ins;
+
+	/* optimization level 1 - simple peephole optimizer,
+	 * replace known instruction patterns by highly
+	 * optimized asm code
+	 */
+	if (optimize >= 1) {
+		while (q_nb && peep_apply(q_nb - 1) != PEEP_NOMATCH)
+			;
+	}
+
 	/* optimization level 2 - instruction re-scheduler,
 	 * change instruction order to allow direct assignments
 	 * rather than stack based assignments :
@@ -1610,9 +1305,10 @@ lv1_loop:
 	if (optimize >= 2) {
 		long offset;
 		long i, j;
-		long flag;
 		long t;
 		long jp;
+		long q_wr = q_nb - 1;
+		long depth = (q_nb < Q_LOOKBACK) ? q_nb : Q_LOOKBACK;
 
 		/* check last instruction */
 		if (q_nb > 1 &&
@@ -1628,22 +1324,15 @@ lv1_loop:
 			 */
 			offset = 2;
 
-			for (i = 1, j = q_wr; i < q_nb; i++) {
+			for (i = 1, j = q_wr; i < depth; i++) {
 				j -= 1;
 
-				if (j < 0)
-					j += Q_SIZE;
-
 				/* Index of insn precdeing j. */
 				jp = j - 1;
-				if (jp < 0)
-					jp += Q_SIZE;
 
 				/* check instruction */
 				switch (q_ins[j].code) {
 				case I_JSR:
-					flag |= 0x0001;
-
 					if (q_ins[j].type == T_LIB)
 						offset += 2;
 					break;
@@ -1697,7 +1386,8 @@ lv1_loop:
 						/* Only handle sequences that start with
 						   pea_s or ldwi/pushw. */
 						if (q_ins[j].code != X_PEA_S &&
-						    (q_ins[j].code != I_PUSHW || q_ins[jp].code != I_LDWI)
+						    (q_ins[j].code != I_PUSHW || jp < 0 ||
+						     q_ins[jp].code != I_LDWI)
 						    )
 							break;
 
@@ -1746,44 +1436,35 @@ lv1_loop:
 					/* adjust stack references;
 					 * because of the removal of pea_s
 					 */
-					for (t = i; t > 1; t--) {
-						j += 1;
-						if (j >= Q_SIZE)
-							j -= Q_SIZE;
-
+					for (t = j + 1; t < q_wr; t++) {
 						/* check instruction */
-						if (is_sprel(&q_ins[j])) {
+						if (is_sprel(&q_ins[t])) {
 							/* adjust stack offset */
-							q_ins[j].data -= 2;
+							q_ins[t].data -= 2;
 						}
 					}
 
 					/* remove all the instructions... */
-					q_wr -= (i + 1);
-					q_nb -= (i + 1);
-					j -= (i - 1);
+					{
+						INS tmp[Q_LOOKBACK];
 
-					if (q_wr < 0)
-						q_wr += Q_SIZE;
-					if (j < 0)
-						j += Q_SIZE;
+						memcpy(tmp, &q_ins[j + 1], i * sizeof(INS));
+						q_nb = j;
 
-					/* ... and re-insert them one by one
-					 * in the queue (for further optimizations)
-					 */
-					for (; i > 0; i--) {
-						j += 1;
-						if (j >= Q_SIZE)
-							j -= Q_SIZE;
-
-						ODEBUG("re");
-						push_ins(&q_ins[j]);
+						/* ... and re-insert them one by one
+						 * in the queue (for further optimizations)
+						 */
+						for (t = 0; t < i; t++) {
+							ODEBUG("re");
+							push_ins(&tmp[t]);
+						}
 					}
 					break;
 				}
 			}
 		}
 
+		q_wr = q_nb - 1;
 		if (q_nb >= 3) {
 			/* pushw/<load>/st*ps --> stw __ptr/<load>/st*p __ptr */
 			/* This cannot be done earlier because it screws up
@@ -1818,29 +1499,25 @@ lv1_loop:
  */
 void flush_ins_label (int nextlabel)
 {
-	while (q_nb) {
+	long i;
+
+	if (optimize >= 1)
+		peep_passes();
+
+	for (i = 0; i < q_nb; i++) {
 		/* skip last op if it's a branch to nextlabel */
-		if (q_nb > 1 || nextlabel == -1 ||
-		    (q_ins[q_rd].code != I_LBRA && q_ins[q_rd].code != I_LBRAN) ||
-		    q_ins[q_rd].data != nextlabel) {
+		if (i < q_nb - 1 || nextlabel == -1 ||
+		    (q_ins[i].code != I_LBRA && q_ins[i].code != I_LBRAN) ||
+		    q_ins[i].data != nextlabel) {
 			/* gen code */
 			if (arg_stack_flag)
-				arg_push_ins(&q_ins[q_rd]);
+				arg_push_ins(&q_ins[i]);
 			else
-				gen_code(&q_ins[q_rd]);
+				gen_code(&q_ins[i]);
 		}
-
-		/* advance and wrap queue read pointer */
-		q_rd++;
-		q_nb--;
-
-		if (q_rd == Q_SIZE)
-			q_rd = 0;
 	}
 
 	/* reset queue */
-	q_rd = 0;
-	q_wr = Q_SIZE - 1;
 	q_nb = 0;
 }
 
@@ -10,5 +10,6 @@ void push_ins (INS *ins);
 void flush_ins (void);
 void flush_ins_label (int nextlabel);
 void gen_asm (INS *inst);
+void dump_peep_stats (void);
 
 #endif
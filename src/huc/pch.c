@@ -0,0 +1,684 @@
+/*
+ * pch.c: precompiled header cache
+ *
+ * If the environment variable PCE_PCH_DIR names a directory, the
+ * compiler state built up before the first line of real code in a
+ * source file is cached there: the default fastcall pragmas, the
+ * built-in macros and externs, and everything declared by the
+ * #include lines at the very top of the file (huc.h and friends).
+ *
+ * The "prefix" of a source file is the leading run of blank lines,
+ * comments and #include lines.  The cache file is keyed by the prefix
+ * text, the compiler version, the flags that influence the prologue and
+ * the macros defined on the command line; it also records a content
+ * hash of every header read while it was built, and is only used if
+ * those still match.  On a hit, the saved state is mapped and restored
+ * and the lexer starts right after the prefix.
+ *
+ * Headers that do more than declare things (emit code or data, define
+ * initialized variables, leave an #if open, raise errors...) are simply
+ * not cached.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "defs.h"
+#include "data.h"
+#include "fastcall.h"
+#include "io.h"
+#include "main.h"
+#include "pch.h"
+#include "preproc.h"
+#include "sym.h"
+
+#if defined(DJGPP) || defined(MSDOS) || defined(WIN32)
+
+long pch_load (void) { return (0); }
+void pch_dep (char *name) { }
+void pch_reached (void) { }
+
+int pch_recording = 0;
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define PCH_MAGIC "HuCPCH1"
+
+int pch_recording;
+
+static char pch_file[FILENAMESIZE + 32];
+static long prefix_end;		/* offset of first byte after the prefix */
+static long prefix_lines;	/* line_number at that point */
+static unsigned long long pch_key;
+
+static char **deps;
+static int ndeps;
+
+/* state at the time the main file is first read */
+static long base_out, base_nxtlab, base_macptr;
+static long base_irq, base_sirq;
+static int base_initials;
+static int have_base;
+
+/*
+ * 64-bit FNV-1a
+ */
+static unsigned long long hash_mem (unsigned long long h, const void *p, size_t len)
+{
+	const unsigned char *c = p;
+
+	while (len--)
+		h = (h ^ *c++) * 0x100000001b3ULL;
+	return (h);
+}
+
+static unsigned long long hash_str (unsigned long long h, const char *s)
+{
+	return (hash_mem(h, s ? s : "", s ? strlen(s) + 1 : 1));
+}
+
+static unsigned long long hash_long (unsigned long long h, long v)
+{
+	return (hash_mem(h, &v, sizeof(v)));
+}
+
+static int hash_file (const char *name, unsigned long long *h)
+{
+	FILE *fp;
+	char buf[4096];
+	size_t n;
+
+	fp = fopen(name, "rb");
+	if (!fp)
+		return (0);
+
+	*h = 0xcbf29ce484222325ULL;
+	while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+		*h = hash_mem(*h, buf, n);
+	fclose(fp);
+	return (1);
+}
+
+static int count_initials (void)
+{
+	int i;
+
+	for (i = 0; i < NUMGLBS && initials_table[i].type != 0; i++) ;
+	return (i);
+}
+
+/*
+ *	find the prefix of the main input file and return its text; an
+ *	empty prefix still lets the prologue be cached
+ */
+static char *scan_prefix (void)
+{
+	char buf[LINESIZE + 2];
+	char *text = strdup(""), *p, *q;
+	char *src = input->src->data;
+	long pos = 0, len = 0, l;
+	long lines = 0, end = 0;
+	int in_comment = 0;
+
+	prefix_end = prefix_lines = 0;
+	while (pos < input->src->size) {
+		q = memchr(src + pos, '\n', input->src->size - pos);
+		if (!q || q - (src + pos) >= LINEMAX - 1)
+			break;
+		l = q + 1 - (src + pos);
+		memcpy(buf, src + pos, l);
+		buf[l] = 0;
+		pos += l;
+		if (strlen(buf) != l)
+			break;
+		if (strchr(buf, '\r') || strchr(buf, '$'))
+			break;
+		p = buf;
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if (in_comment) {
+			q = strstr(p, "*/");
+			if (q) {
+				in_comment = 0;
+				p = q + 2;
+				while (*p == ' ' || *p == '\t')
+					p++;
+				if (*p != '\n')
+					break;
+			}
+		}
+		else if (*p == '\n' || (p[0] == '/' && p[1] == '/'))
+			;
+		else if (p[0] == '/' && p[1] == '*') {
+			q = strstr(p + 2, "*/");
+			if (!q)
+				in_comment = 1;
+			else {
+				p = q + 2;
+				while (*p == ' ' || *p == '\t')
+					p++;
+				if (*p != '\n')
+					break;
+			}
+		}
+		else if (strncmp(p, "#include", 8) == 0) {
+			p += 8;
+			while (*p == ' ' || *p == '\t')
+				p++;
+			if (*p != '<' && *p != '"')
+				break;
+			q = strchr(p + 1, *p == '<' ? '>' : '"');
+			if (!q)
+				break;
+			q++;
+			while (*q == ' ' || *q == '\t')
+				q++;
+			if (*q != '\n')
+				break;
+			end = len + l;
+			lines++;
+			text = realloc(text, end + 1);
+			memcpy(text + len, buf, l);
+			text[end] = 0;
+			len = end;
+			prefix_lines = lines;
+			prefix_end = end;
+			continue;
+		}
+		else
+			break;
+
+		/* keep comments and blank lines in the text so that the
+		   line count is part of the key */
+		text = realloc(text, len + l + 1);
+		memcpy(text + len, buf, l);
+		len += l;
+		text[len] = 0;
+		lines++;
+	}
+	text[end] = 0;
+	return (text);
+}
+
+/*
+ *	reader/writer helpers; the reader runs twice, first to check that
+ *	the whole file is consistent, then to apply it
+ */
+struct pch_rd {
+	const char *p, *end;
+	int ok;
+};
+
+static const void *rd_mem (struct pch_rd *r, size_t len)
+{
+	const char *p = r->p;
+
+	if (!r->ok || (size_t)(r->end - r->p) < len) {
+		r->ok = 0;
+		return (NULL);
+	}
+	r->p += len;
+	return (p);
+}
+
+static long rd_long (struct pch_rd *r)
+{
+	long v = 0;
+	const void *p = rd_mem(r, sizeof(v));
+
+	if (p)
+		memcpy(&v, p, sizeof(v));
+	return (v);
+}
+
+static const char *rd_str (struct pch_rd *r)
+{
+	long len = rd_long(r);
+	const char *p;
+
+	if (len < 0) {
+		r->ok = 0;
+		return (NULL);
+	}
+	p = rd_mem(r, len + 1);
+	if (p && p[len]) {
+		r->ok = 0;
+		return (NULL);
+	}
+	return (p);
+}
+
+static void wr_long (FILE *fp, long v)
+{
+	fwrite(&v, sizeof(v), 1, fp);
+}
+
+static void wr_str (FILE *fp, const char *s)
+{
+	long len = strlen(s);
+
+	wr_long(fp, len);
+	fwrite(s, len + 1, 1, fp);
+}
+
+static long macro_argc (struct macro *mp)
+{
+	long n = 0;
+
+	while (mp->args && mp->args[n])
+		n++;
+	return (n);
+}
+
+static long macro_npos (struct macro *mp)
+{
+	long n = 0;
+
+	while (mp->argpos && mp->argpos[n].arg != -1)
+		n++;
+	return (n);
+}
+
+/*
+ *	restore (or with apply == 0, just check) a saved state
+ */
+static int pch_read (const char *data, size_t size, int apply)
+{
+	struct pch_rd r;
+	struct macro *mp;
+	struct fastcall *fc;
+	const char *s;
+	const void *m;
+	long n, i, j, k, na, np, h;
+	SYMBOL sym;
+
+	r.p = data;
+	r.end = data + size;
+	r.ok = 1;
+
+	/* header */
+	rd_mem(&r, sizeof(PCH_MAGIC));
+	rd_mem(&r, sizeof(pch_key));
+
+	/* dependencies, checked by pch_load() */
+	n = rd_long(&r);
+	for (i = 0; i < n && r.ok; i++) {
+		rd_str(&r);
+		rd_mem(&r, sizeof(pch_key));
+	}
+
+	/* scalars */
+	n = rd_long(&r);
+	if (apply)
+		norecurse = n;
+	n = rd_long(&r);
+	if (apply)
+		rglbptr = n;
+
+	/* macros defined after the command line ones */
+	n = rd_long(&r);
+	for (i = 0; i < n && r.ok; i++) {
+		s = rd_str(&r);
+		na = rd_long(&r);
+		if (na < 0 || na >= 40)
+			r.ok = 0;
+		mp = NULL;
+		if (apply && r.ok) {
+			mp = newmac((char *)s);
+			mp->name = strdup(s);
+			mp->argc = rd_long(&r);
+			mp->args = malloc(sizeof(char *) * (na + 1));
+		}
+		else
+			rd_long(&r);
+		for (j = 0; j < na && r.ok; j++) {
+			s = rd_str(&r);
+			if (mp)
+				mp->args[j] = strdup(s);
+		}
+		if (mp)
+			mp->args[na] = 0;
+		np = rd_long(&r);
+		if (np < 0)
+			r.ok = 0;
+		if (mp)
+			mp->argpos = malloc(sizeof(*mp->argpos) * (np + 1));
+		for (j = 0; j < np && r.ok; j++) {
+			k = rd_long(&r);
+			if (k < 0 || k >= na)
+				r.ok = 0;
+			if (mp) {
+				mp->argpos[j].arg = k;
+				mp->argpos[j].pos = rd_long(&r);
+			}
+			else
+				rd_long(&r);
+		}
+		if (mp) {
+			mp->argpos[np].arg = -1;
+			mp->argpos[np].pos = -1;
+		}
+		s = rd_str(&r);
+		if (mp)
+			mp->def = strdup(s);
+		/* #undef'd in the prefix */
+		if (rd_long(&r) && mp)
+			delmac(mp);
+	}
+
+	/* fastcall table, chains in order */
+	for (h = 0; h < 256 && r.ok; h++) {
+		n = rd_long(&r);
+		for (i = 0; i < n && r.ok; i++) {
+			m = rd_mem(&r, sizeof(*fc));
+			if (apply && m) {
+				fc = malloc(sizeof(*fc));
+				memcpy(fc, m, sizeof(*fc));
+				fc->next = 0;
+				if (fastcall_tbl[h] == 0)
+					fastcall_tbl[h] = fc;
+				else {
+					struct fastcall *last = fastcall_tbl[h];
+					while (last->next)
+						last = last->next;
+					last->next = fc;
+				}
+			}
+		}
+	}
+
+	/* global symbols */
+	n = rd_long(&r);
+	for (i = 0; i < n && r.ok; i++) {
+		m = rd_mem(&r, sizeof(sym));
+		if (apply && m) {
+			memcpy(&sym, m, sizeof(sym));
+			restoreglb(&sym);
+		}
+	}
+
+	/* typedefs */
+	n = rd_long(&r);
+	m = rd_mem(&r, n * sizeof(*typedefs));
+	if (apply && m) {
+		typedefs = realloc(typedefs, (n + 1) * sizeof(*typedefs));
+		memcpy(typedefs, m, n * sizeof(*typedefs));
+		typedef_ptr = n;
+	}
+
+	/* enums */
+	n = rd_long(&r);
+	m = rd_mem(&r, n * sizeof(*enums));
+	if (apply && m) {
+		enums = realloc(enums, (n + 1) * sizeof(*enums));
+		memcpy(enums, m, n * sizeof(*enums));
+		enum_ptr = n;
+	}
+	n = rd_long(&r);
+	m = rd_mem(&r, n * sizeof(*enum_types));
+	if (apply && m) {
+		enum_types = realloc(enum_types, (n + 1) * sizeof(*enum_types));
+		memcpy(enum_types, m, n * sizeof(*enum_types));
+		enum_type_ptr = n;
+	}
+
+	/* struct tags and members */
+	n = rd_long(&r);
+	if (n < 0 || n > NUMTAG)
+		r.ok = 0;
+	m = rd_mem(&r, n * sizeof(*tag_table));
+	if (apply && m) {
+		memcpy(tag_table, m, n * sizeof(*tag_table));
+		tag_table_index = n;
+	}
+	n = rd_long(&r);
+	if (n < 0 || n > NUMMEMB)
+		r.ok = 0;
+	m = rd_mem(&r, n * sizeof(*member_table));
+	if (apply && m) {
+		memcpy(member_table, m, n * sizeof(*member_table));
+		member_table_index = n;
+	}
+
+	if (r.p != r.end)
+		r.ok = 0;
+	return (r.ok);
+}
+
+static void pch_write (void)
+{
+	char tmp[sizeof(pch_file) + 16];
+	struct macro *mp;
+	struct fastcall *fc;
+	SYMBOL sym;
+	unsigned long long h;
+	long i, j, n, na, np;
+	FILE *fp;
+
+	sprintf(tmp, "%s.%d", pch_file, (int)getpid());
+	fp = fopen(tmp, "wb");
+	if (!fp)
+		return;
+
+	fwrite(PCH_MAGIC, sizeof(PCH_MAGIC), 1, fp);
+	fwrite(&pch_key, sizeof(pch_key), 1, fp);
+
+	wr_long(fp, ndeps);
+	for (i = 0; i < ndeps; i++) {
+		if (!hash_file(deps[i], &h))
+			goto fail;
+		wr_str(fp, deps[i]);
+		fwrite(&h, sizeof(h), 1, fp);
+	}
+
+	wr_long(fp, norecurse);
+	wr_long(fp, rglbptr);
+
+	wr_long(fp, macptr - base_macptr);
+	for (i = base_macptr; i < macptr; i++) {
+		mp = &macq[i];
+		wr_str(fp, mp->name ? mp->name : "");
+		na = macro_argc(mp);
+		wr_long(fp, na);
+		wr_long(fp, mp->argc);
+		for (j = 0; j < na; j++)
+			wr_str(fp, mp->args[j]);
+		np = macro_npos(mp);
+		wr_long(fp, np);
+		for (j = 0; j < np; j++) {
+			wr_long(fp, mp->argpos[j].arg);
+			wr_long(fp, mp->argpos[j].pos);
+		}
+		wr_str(fp, mp->def ? mp->def : "");
+		wr_long(fp, mp->name == 0);
+	}
+
+	for (i = 0; i < 256; i++) {
+		n = 0;
+		for (fc = fastcall_tbl[i]; fc; fc = fc->next)
+			n++;
+		wr_long(fp, n);
+		for (fc = fastcall_tbl[i]; fc; fc = fc->next)
+			fwrite(fc, sizeof(*fc), 1, fp);
+	}
+
+	wr_long(fp, glbptr);
+	for (i = 0; i < glbptr; i++) {
+		sym = *glbsym(i);
+		sym.hnext = 0;
+		fwrite(&sym, sizeof(sym), 1, fp);
+	}
+
+	wr_long(fp, typedef_ptr);
+	fwrite(typedefs, sizeof(*typedefs), typedef_ptr, fp);
+	wr_long(fp, enum_ptr);
+	fwrite(enums, sizeof(*enums), enum_ptr, fp);
+	wr_long(fp, enum_type_ptr);
+	fwrite(enum_types, sizeof(*enum_types), enum_type_ptr, fp);
+	wr_long(fp, tag_table_index);
+	fwrite(tag_table, sizeof(*tag_table), tag_table_index, fp);
+	wr_long(fp, member_table_index);
+	fwrite(member_table, sizeof(*member_table), member_table_index, fp);
+
+	if (fclose(fp) == 0 && rename(tmp, pch_file) == 0)
+		return;
+	unlink(tmp);
+	return;
+
+fail:
+	fclose(fp);
+	unlink(tmp);
+}
+
+/*
+ *	try to restore the prologue and header state for the current input
+ *	file; returns 1 on success, with the input positioned after the
+ *	prefix.  Otherwise, arms the recorder (see pch_reached()).
+ */
+long pch_load (void)
+{
+	const char *dir;
+	char cwd[FILENAMESIZE];
+	char *prefix;
+	const char *data, *s;
+	unsigned long long h, dh;
+	struct stat st;
+	struct pch_rd r;
+	long i, n;
+	int fd, ok;
+
+	pch_recording = 0;
+	dir = getenv("PCE_PCH_DIR");
+	if (!dir || !*dir || ctext || access("globals.h", F_OK) == 0)
+		return (0);
+
+	/* command line macros #undef'd by an earlier file */
+	for (i = 0; i < macptr; i++)
+		if (!macq[i].name)
+			return (0);
+
+	prefix = scan_prefix();
+
+	h = 0xcbf29ce484222325ULL;
+	h = hash_str(h, PCH_MAGIC);
+	h = hash_str(h, HUC_VERSION);
+	h = hash_long(h, sizeof(SYMBOL));
+	h = hash_long(h, sizeof(struct fastcall));
+	h = hash_long(h, sizeof(struct type));
+	h = hash_long(h, cdflag);
+	h = hash_long(h, overlayflag);
+	h = hash_long(h, norecurse);
+	h = hash_long(h, user_short_enums);
+	h = hash_long(h, optimize);
+	h = hash_str(h, getenv("PCE_INCLUDE"));
+	h = hash_str(h, getcwd(cwd, sizeof(cwd)) ? cwd : "");
+	for (i = 0; i < macptr; i++) {
+		h = hash_str(h, macq[i].name);
+		h = hash_str(h, macq[i].def);
+		h = hash_long(h, macq[i].argc);
+	}
+	h = hash_str(h, prefix);
+	free(prefix);
+	pch_key = h;
+	snprintf(pch_file, sizeof(pch_file), "%s/%016llx.pch", dir, pch_key);
+
+	base_macptr = macptr;
+	ndeps = 0;
+	have_base = 0;
+	pch_recording = 1;
+
+	fd = open(pch_file, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	if (fstat(fd, &st) < 0 || st.st_size == 0) {
+		close(fd);
+		return (0);
+	}
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return (0);
+
+	/* check the key and the headers the state was built from */
+	ok = 0;
+	r.p = data;
+	r.end = data + st.st_size;
+	r.ok = 1;
+	s = rd_mem(&r, sizeof(PCH_MAGIC));
+	if (!s || memcmp(s, PCH_MAGIC, sizeof(PCH_MAGIC)))
+		goto out;
+	s = rd_mem(&r, sizeof(pch_key));
+	if (!s || memcmp(s, &pch_key, sizeof(pch_key)))
+		goto out;
+	n = rd_long(&r);
+	for (i = 0; i < n && r.ok; i++) {
+		s = rd_str(&r);
+		if (!s || !hash_file(s, &h))
+			goto out;
+		s = rd_mem(&r, sizeof(dh));
+		if (!s || memcmp(s, &h, sizeof(h)))
+			goto out;
+	}
+	if (!r.ok || !pch_read(data, st.st_size, 0))
+		goto out;
+
+	pch_read(data, st.st_size, 1);
+	ok = 1;
+	pch_recording = 0;
+	kill();
+	input->pos = prefix_end;
+	line_number = prefix_lines;
+
+out:
+	munmap((void *)data, st.st_size);
+	return (ok);
+}
+
+/*
+ *	remember a header opened while recording
+ */
+void pch_dep (char *name)
+{
+	deps = realloc(deps, (ndeps + 1) * sizeof(*deps));
+	deps[ndeps++] = strdup(name);
+}
+
+/*
+ *	called by readline() before it reads from the main input file;
+ *	saves the state once the whole prefix has been processed
+ */
+void pch_reached (void)
+{
+	/* the first read from the main file happens before anything
+	   in the prefix has been processed */
+	if (!have_base) {
+		have_base = 1;
+		outflush();
+		base_out = ftell(output);
+		base_nxtlab = nxtlab;
+		base_irq = have_irq_handler;
+		base_sirq = have_sirq_handler;
+		base_initials = count_initials();
+	}
+	if (input->pos < prefix_end)
+		return;
+
+	pch_recording = 0;
+	outflush();
+	if (ftell(output) == base_out &&
+	    nxtlab == base_nxtlab &&
+	    have_irq_handler == base_irq &&
+	    have_sirq_handler == base_sirq &&
+	    count_initials() == base_initials &&
+	    errcnt == 0 && iflevel == 0 && skiplevel == 0 &&
+	    litptr == 0 && const_nb == 0 && cmode && !ctext &&
+	    line_number == prefix_lines)
+		pch_write();
+}
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef _PCH_H
+#define _PCH_H
+
+long pch_load (void);
+void pch_dep (char *name);
+void pch_reached (void);
+
+extern int pch_recording;
+
+#endif
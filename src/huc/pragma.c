@@ -150,6 +150,10 @@ void dopragma (void)
 	for (i = 0;; i++) {
 		if (ch() == 0)
 			break;
+		if (i == LINEMAX) {
+			error("pragma too long");
+			break;
+		}
 		cmd[i] = gch();
 	}
 	cmd[i] = 0;
@@ -16,6 +16,7 @@
 #include "io.h"
 #include "lex.h"
 #include "optimize.h"
+#include "pch.h"
 #include "pragma.h"
 #include "preproc.h"
 #include "primary.h"
@@ -41,6 +42,16 @@
 /* locals */
 static char *incpath[10];
 
+/* macro hash index: open-addressed, each slot holds an index into
+   macq[] or -1 if empty.  A slot that refers to an #undef'd macro
+   (name == 0) or to an entry beyond macptr (dropped when macptr was
+   reset for the next input file) is a tombstone: lookups probe past
+   it, insertions may reuse it. */
+static long *machash;
+static long machashsize;
+static long machashused;	/* live slots plus tombstones */
+static long macqsize;
+
 static const char *include_path (void)
 {
 	const char *p;
@@ -97,9 +108,9 @@ void init_path (void)
 /*
  *  open a file - browse paths
  */
-FILE *file_open (char *name, char *mode)
+INFILE *file_open (char *name)
 {
-	FILE *fp = NULL;
+	INFILE *fp = NULL;
 	char testname[256];
 	long i;
 
@@ -108,7 +119,7 @@ FILE *file_open (char *name, char *mode)
 			strcpy(testname, incpath[i]);
 			strcat(testname, name);
 			strcpy(inclstk_name[inclsp], testname);
-			fp = fopen(testname, mode);
+			fp = inopen(testname);
 			if (fp != NULL) break;
 		}
 	}
@@ -121,19 +132,21 @@ FILE *file_open (char *name, char *mode)
  */
 void doinclude (void)
 {
-	FILE *inp2;
+	INFILE *inp2;
 
 	blanks();
 	inp2 = fixiname();
 	if (inp2) {
 		if (inclsp < INCLSIZ) {
+			if (pch_recording)
+				pch_dep(inclstk_name[inclsp]);
 			inclstk_line[inclsp] = line_number;
 			line_number = 0;
 			inclstk[inclsp++] = input2;
 			input2 = inp2;
 		}
 		else {
-			fclose(inp2);
+			inclose(inp2);
 			error("too many nested includes");
 		}
 	}
@@ -144,12 +157,12 @@ void doinclude (void)
 
 void incl_globals (void)
 {
-	FILE *inp2;
+	INFILE *inp2;
 
 	/* open the globals.h file to include those variables */
 	/* but if we can't open it, it's no problem */
 
-	inp2 = fopen("globals.h", "r");
+	inp2 = inopen("globals.h");
 
 	if (inp2) {
 		if (inclsp < INCLSIZ) {
@@ -161,7 +174,7 @@ void incl_globals (void)
 			globals_h_in_process = 1;
 		}
 		else {
-			fclose(inp2);
+			inclose(inp2);
 			error("too many nested includes");
 		}
 	}
@@ -171,11 +184,11 @@ void incl_globals (void)
 /*
  *	fixiname - remove "brackets" around include file name
  */
-FILE *fixiname (void)
+INFILE *fixiname (void)
 {
 	char c1, c2, *p, *ibp;
-	char buf[LINESIZE];
-	FILE *fp;
+	char buf[FILENAMESIZE];
+	INFILE *fp;
 
 	ibp = &buf[0];
 	c1 = gch();
@@ -184,7 +197,7 @@ FILE *fixiname (void)
 		error("incorrect file name delimiter");
 		return (NULL);
 	}
-	for (p = line + lptr; *p;) {
+	for (p = line + lptr; *p && ibp < buf + FILENAMESIZE - 1;) {
 		if (*p == c2)
 			break;
 		if ((*p == '\\') && (p[1] == '\\'))
@@ -198,8 +211,8 @@ FILE *fixiname (void)
 	*ibp = 0;
 	fp = NULL;
 	strcpy(inclstk_name[inclsp], buf);
-	if ((c1 == '<') || ((fp = fopen(buf, "r")) == NULL))
-		fp = file_open(buf, "r");
+	if ((c1 == '<') || ((fp = inopen(buf)) == NULL))
+		fp = file_open(buf);
 	return (fp);
 }
 
@@ -218,7 +231,7 @@ void doasm (void)
 		readline();
 		if (match("#endasm"))
 			break;
-		if (feof(input))
+		if (infeof(input))
 			break;
 		outstr(line);
 		nl();
@@ -349,7 +362,7 @@ long ifline (void)
 	FOREVER {
 		readline();
 cont_no_read:
-		if (!input || feof(input)) return (1);
+		if (!input || infeof(input)) return (1);
 
 		if (match("#ifdef")) {
 			doifdef(YES);
@@ -505,7 +518,7 @@ long cpp (int subline)
 						readline();
 					else
 						inchar();
-					if (feof(input))
+					if (infeof(input))
 						break;
 				}
 			inchar();
@@ -619,9 +632,8 @@ long cpp (int subline)
 			keepch(gch());
 	}
 	keepch(0);
-	if (mptr >= MPMAX)
-		error("line too long");
 	/* copy cooked input back to where we got the raw input from */
+	growline(llptr + mptr);
 	strcpy(&line[llptr], mline);
 	/* ...and continue processing at that point */
 	lptr = llptr;
@@ -630,14 +642,17 @@ long cpp (int subline)
 
 long keepch (char c)
 {
-	mline[mptr] = c;
-	if (mptr < MPMAX)
-		mptr++;
+	if (mptr >= mlinesize) {
+		mlinesize = mptr + LINESIZE;
+		mline = realloc(mline, mlinesize);
+	}
+	mline[mptr++] = c;
 	return (c);
 }
 
 void defmac (char *s)
 {
+	growline(strlen(s));
 	kill();
 	strcpy(line, s);
 	addmac();
@@ -659,7 +674,7 @@ void addmac (void)
 		delmac(mp);
 	}
 	else
-		mp = &macq[macptr++];
+		mp = newmac(sname);
 
 	mp->name = strdup(sname);
 
@@ -755,8 +770,6 @@ void addmac (void)
 #ifdef DEBUG_PREPROC
 	printf("macdef %s\n", mp->def);
 #endif
-	if (macptr >= MACMAX)
-		error("macro table full");
 }
 
 void delmac (struct macro *mp)
@@ -775,16 +788,95 @@ void delmac (struct macro *mp)
 	mp->argpos = 0;
 }
 
-struct macro *findmac (char *sname)
+static unsigned long machashname (char *sname)
 {
+	unsigned long h = 2166136261UL;
 	long k;
 
-	k = 0;
-	while (k < macptr) {
-		if (macq[k].name && astreq(sname, macq[k].name, NAMEMAX))
-			return (&macq[k]);
+	/* must agree with astreq(..., NAMEMAX) */
+	for (k = 0; k < NAMEMAX && an(sname[k]); k++)
+		h = (h ^ (unsigned char)sname[k]) * 16777619UL;
+	return (h);
+}
+
+static int macslot_live (long k)
+{
+	return (k < macptr && macq[k].name);
+}
+
+/*
+ *	rebuild the hash index from the live macros, resizing it so
+ *	that it is at most a quarter full
+ */
+static void machash_rebuild (void)
+{
+	long k, i, live;
+
+	live = 0;
+	for (k = 0; k < macptr; k++)
+		if (macq[k].name)
+			live++;
+	if (!machashsize)
+		machashsize = MACHASHSZ;
+	while (machashsize < live * 4)
+		machashsize *= 2;
+	machash = realloc(machash, machashsize * sizeof(*machash));
+	memset(machash, -1, machashsize * sizeof(*machash));
+	machashused = 0;
+	for (k = 0; k < macptr; k++) {
+		if (!macq[k].name)
+			continue;
+		i = machashname(macq[k].name) & (machashsize - 1);
+		while (machash[i] != -1)
+			i = (i + 1) & (machashsize - 1);
+		machash[i] = k;
+		machashused++;
+	}
+}
+
+/*
+ *	allocate a new macro table entry and enter it into the hash
+ *	index; the caller has already made sure that sname is not
+ *	defined
+ */
+struct macro *newmac (char *sname)
+{
+	long i, k;
+
+	if (macptr >= macqsize) {
+		k = macqsize;
+		macqsize = macqsize ? macqsize * 2 : MACHASHSZ;
+		macq = realloc(macq, macqsize * sizeof(*macq));
+		memset(macq + k, 0, (macqsize - k) * sizeof(*macq));
+	}
+	k = macptr++;
+
+	if ((machashused + 1) * 2 > machashsize)
+		machash_rebuild();
+	i = machashname(sname) & (machashsize - 1);
+	while (machash[i] != -1 && macslot_live(machash[i]))
+		i = (i + 1) & (machashsize - 1);
+	if (machash[i] == -1)
+		machashused++;
+	machash[i] = k;
+	return (&macq[k]);
+}
+
+struct macro *findmac (char *sname)
+{
+	long i, k;
 
-		k++;
+	maclookups++;
+	if (!machash)
+		return (0);
+
+	i = machashname(sname) & (machashsize - 1);
+	while ((k = machash[i]) != -1) {
+		if (macslot_live(k) && astreq(sname, macq[k].name, NAMEMAX)) {
+			machits++;
+			return (&macq[k]);
+		}
+		i = (i + 1) & (machashsize - 1);
 	}
 	return (0);
 }
@@ -5,7 +5,7 @@ void doinclude (void);
 
 void incl_globals (void);
 
-FILE *fixiname (void);
+INFILE *fixiname (void);
 
 void init_path (void);
 
@@ -35,6 +35,8 @@ void addmac (void);
 
 void delmac (struct macro *mp);
 
+struct macro *newmac (char *sname);
+
 struct macro *findmac (char *sname);
 
 void toggle (char name, long onoff);
@@ -35,7 +35,7 @@
  */
 long statement (long func)
 {
-	if ((ch() == 0) & feof(input))
+	if ((ch() == 0) & infeof(input))
 		return (0);
 
 	lastst = 0;
@@ -203,7 +203,7 @@ void compound (long func)
 	if (!func && top_level_stkp == 1 && !norecurse)
 		top_level_stkp = stkp;
 	while (!match("}")) {
-		if (feof(input))
+		if (infeof(input))
 			return;
 
 		if (decls) {
@@ -224,7 +224,7 @@ void compound (long func)
 void doif (void)
 {
 	long fstkp, flab1, flab2;
-	SYMBOL *flev;
+	long flev;
 
 	flev = locptr;
 	fstkp = stkp;
@@ -263,7 +263,7 @@ void dowhile (void)
 	statement(NO);
 	jump(ws[WSTEST]);
 	gnlabel(ws[WSEXIT]);
-	locptr = (SYMBOL *)ws[WSSYM];
+	locptr = ws[WSSYM];
 	stkp = modstk(ws[WSSP]);
 	delwhile();
 }
@@ -291,7 +291,7 @@ void dodo (void)
 	gnlabel(ws[WSTEST]);
 	test(ws[WSBODY], TRUE);
 	gnlabel(ws[WSEXIT]);
-	locptr = (SYMBOL *)ws[WSSYM];
+	locptr = ws[WSSYM];
 	stkp = modstk(ws[WSSP]);
 	delwhile();
 }
@@ -340,7 +340,7 @@ void dofor (void)
 	stkp = modstk(pws[WSSP]);
 	jump(pws[WSINCR]);
 	gnlabel(pws[WSEXIT]);
-	locptr = (SYMBOL *)pws[WSSYM];
+	locptr = pws[WSSYM];
 	delwhile();
 }
 
@@ -359,19 +359,16 @@ void doswitch (void)
 	ws[WSTAB] = getlabel();
 	ws[WSDEF] = ws[WSEXIT] = getlabel();
 	addwhile(ws);
-	immed(T_LABEL, ws[WSTAB]);
-	gpush();
 	needbrack("(");
 	expression(YES);
 	needbrack(")");
-	stkp = stkp + INTSIZE;	/* '?case' will adjust the stack */
-	gjcase();
+	jump(ws[WSTAB]);
 	statement(NO);
 	ptr = readswitch();
 	jump(ptr[WSEXIT]);
 	dumpsw(ptr);
 	gnlabel(ptr[WSEXIT]);
-	locptr = (SYMBOL *)ptr[WSSYM];
+	locptr = ptr[WSSYM];
 	stkp = modstk(ptr[WSSP]);
 	swstp = ptr[WSCASEP];
 	delwhile();
@@ -540,38 +537,164 @@ void dogoto (void)
 
 
 /*
- *	dump switch table
+ *	dump the switch dispatch code and its case table
+ *
+ *	the primary register holds the switch value on entry; the cases
+ *	are sorted on their 16-bit value and the cheapest lowering is
+ *	picked: a compare chain for a handful of cases, a jump table
+ *	indexed by (value - min) when the values are dense, and a binary
+ *	search through the sorted table (___case) otherwise
  */
 void dumpsw (long *ws)
 /*long	ws[];*/
 {
-	long i, j;
+	long val[SWSTSZ], lab[SWSTSZ], slot[SWTABMAX];
+	long i, j, k, n, v, base, range, next, tab;
 
-//	gdata ();
 	gnlabel(ws[WSTAB]);
 	flush_ins();
-	if (ws[WSCASEP] != swstp) {
-		j = ws[WSCASEP];
-		while (j < swstp) {
+
+	/* insertion sort, keeping the first of any duplicate cases */
+	n = 0;
+	for (j = ws[WSCASEP]; j < swstp; j++) {
+		v = swstcase[j] & 0xffff;
+		for (i = n; i > 0 && val[i - 1] > v; i--)
+			;
+		if (i > 0 && val[i - 1] == v)
+			continue;
+		for (k = n; k > i; k--) {
+			val[k] = val[k - 1];
+			lab[k] = lab[k - 1];
+		}
+		val[i] = v;
+		lab[i] = swstlab[j];
+		n++;
+	}
+
+	if (n <= SWCHAIN) {
+		for (i = 0; i < n; i++) {
+			next = getlabel();
+			ot("  cpx\t#");
+			outdec(val[i] & 0xff);
+			nl();
+			ot("  bne\t");
+			outlabel(next);
+			nl();
+			ot("  cmp\t#");
+			outdec(val[i] >> 8);
+			nl();
+			ot("  bne\t");
+			outlabel(next);
+			nl();
+			ot("  jmp\t");
+			outlabel(lab[i]);
+			nl();
+			outlabel(next);
+			col();
+			nl();
+		}
+		ot("  jmp\t");
+		outlabel(ws[WSDEF]);
+		nl();
+		return;
+	}
+
+	/* the values may also be dense when read as signed,
+	   e.g. -1, 0, 1 */
+	base = val[0];
+	range = val[n - 1] - val[0] + 1;
+	for (k = 0; k < n && val[k] < 0x8000; k++)
+		;
+	if (k > 0 && k < n && val[k - 1] - val[k] + 0x10001 < range) {
+		base = val[k];
+		range = val[k - 1] - val[k] + 0x10001;
+	}
+
+	next = getlabel();
+	tab = getlabel();
+	if (range <= SWTABMAX && range <= SWHOLES * n) {
+		/* A:X - base must fit in the low byte and be below range */
+		if (base) {
+			ol("  tay");
+			ol("  txa");
+			ol("  sec");
+			ot("  sbc\t#");
+			outdec(base & 0xff);
+			nl();
+			ol("  tax");
+			ol("  tya");
+			ot("  sbc\t#");
+			outdec(base >> 8);
+			nl();
+		}
+		else
+			ol("  cmp\t#0");
+		ot("  bne\t");
+		outlabel(next);
+		nl();
+		ot("  cpx\t#");
+		outdec(range);
+		nl();
+		ot("  bcs\t");
+		outlabel(next);
+		nl();
+		ol("  txa");
+		ol("  asl\ta");
+		ol("  tax");
+		ot("  jmp\t[");
+		outlabel(tab);
+		outstr(",x]");
+		nl();
+		outlabel(next);
+		col();
+		nl();
+		ot("  jmp\t");
+		outlabel(ws[WSDEF]);
+		nl();
+		outlabel(tab);
+		col();
+		nl();
+		for (i = 0; i < range; i++)
+			slot[i] = ws[WSDEF];
+		for (i = 0; i < n; i++)
+			slot[(val[i] - base) & 0xffff] = lab[i];
+		for (i = 0; i < range; i++) {
 			defword();
-			i = 4;
-			while (i--) {
-				outdec(swstcase[j]);
-				outbyte(',');
-				outlabel(swstlab[j++]);
-				if ((i == 0) | (j >= swstp)) {
-					nl();
-					break;
-				}
-				outbyte(',');
-			}
+			outlabel(slot[i]);
+			nl();
 		}
+		return;
 	}
+
+	/* ___case takes the table in __ptr and the index of its
+	   last entry in Y */
+	ot("  ldy\t#low(");
+	outlabel(tab);
+	outstr(")");
+	nl();
+	ol("  sty\t<__ptr");
+	ot("  ldy\t#high(");
+	outlabel(tab);
+	outstr(")");
+	nl();
+	ol("  sty\t<__ptr+1");
+	ot("  ldy\t#");
+	outdec(n - 1);
+	nl();
+	ol("  jmp\t___case");
+	outlabel(tab);
+	col();
+	nl();
 	defword();
 	outlabel(ws[WSDEF]);
-	outstr(",0");
 	nl();
-//	gtext ();
+	for (i = 0; i < n; i++) {
+		defword();
+		outdec(val[i]);
+		outbyte(',');
+		outlabel(lab[i]);
+		nl();
+	}
 }
 
 void test (long label, long ft)
@@ -450,33 +450,105 @@ long needsub (void)
 	return (num[0]);
 }
 
-SYMBOL *findglb (char *sname)
+/*
+ *	symbol arenas
+ *
+ *	Symbols are allocated in chunks of SYMCHUNK entries and
+ *	addressed by index (glbptr/locptr count the entries in use), so
+ *	the tables can grow without moving symbols that are already
+ *	referenced elsewhere.  Each arena has a hash index; chains are
+ *	kept in insertion order, newest first.  Scopes are left by simply
+ *	lowering glbptr/locptr; the stale entries are unlinked from the
+ *	hash the next time the arena is used.
+ */
+struct symarena {
+	SYMBOL **chunk;
+	long nchunk;
+	long linked;	/* number of entries linked into hash */
+	SYMBOL *hash[SYMHASHSZ];
+};
+
+static struct symarena glbarena, locarena;
+
+static unsigned long namehash (char *sname)
 {
-	SYMBOL *ptr;
+	unsigned long h = 2166136261UL;
+	long k;
 
-	ptr = STARTGLB;
-	while (ptr != glbptr) {
-		if (astreq(sname, ptr->name, NAMEMAX))
-			return (ptr);
+	/* must agree with astreq(..., NAMEMAX) */
+	for (k = 0; k < NAMEMAX && an(sname[k]); k++)
+		h = (h ^ (unsigned char)sname[k]) * 16777619UL;
+	return (h & (SYMHASHSZ - 1));
+}
+
+static SYMBOL *arena_sym (struct symarena *a, long idx)
+{
+	return (&a->chunk[idx / SYMCHUNK][idx % SYMCHUNK]);
+}
 
-		ptr++;
+static SYMBOL *arena_new (struct symarena *a, long idx)
+{
+	if (idx / SYMCHUNK >= a->nchunk) {
+		a->chunk = realloc(a->chunk, (a->nchunk + 1) * sizeof(SYMBOL *));
+		if (!a->chunk)
+			return (NULL);
+		a->chunk[a->nchunk] = calloc(SYMCHUNK, sizeof(SYMBOL));
+		if (!a->chunk[a->nchunk])
+			return (NULL);
+		a->nchunk++;
 	}
-	return (NULL);
+	return (arena_sym(a, idx));
 }
 
-SYMBOL *findloc (char *sname)
+/* drop hash entries for symbols at or above "top" */
+static void arena_sync (struct symarena *a, long top)
 {
 	SYMBOL *ptr;
 
-	ptr = locptr;
-	while (ptr != STARTLOC) {
-		ptr--;
+	while (a->linked > top) {
+		ptr = arena_sym(a, --a->linked);
+		/* entries go away in reverse order of insertion, so
+		   each one is at the head of its chain */
+		a->hash[namehash(ptr->name)] = ptr->hnext;
+	}
+}
+
+static SYMBOL *arena_find (struct symarena *a, long top, char *sname)
+{
+	SYMBOL *ptr;
+
+	arena_sync(a, top);
+	for (ptr = a->hash[namehash(sname)]; ptr; ptr = ptr->hnext) {
 		if (astreq(sname, ptr->name, NAMEMAX))
 			return (ptr);
 	}
 	return (NULL);
 }
 
+static void arena_link (struct symarena *a, SYMBOL *ptr)
+{
+	unsigned long h = namehash(ptr->name);
+
+	ptr->hnext = a->hash[h];
+	a->hash[h] = ptr;
+	a->linked++;
+}
+
+SYMBOL *glbsym (long idx)
+{
+	return (arena_sym(&glbarena, idx));
+}
+
+SYMBOL *findglb (char *sname)
+{
+	return (arena_find(&glbarena, glbptr, sname));
+}
+
+SYMBOL *findloc (char *sname)
+{
+	return (arena_find(&locarena, locptr, sname));
+}
+
 SYMBOL *addglb (char *sname, char id, char typ, long value, long stor, SYMBOL *replace)
 {
 	char *ptr;
@@ -486,18 +558,22 @@ SYMBOL *addglb (char *sname, char id, char typ, long value, long stor, SYMBOL *r
 		if (cptr)
 			return (cptr);
 
-		if (glbptr >= ENDGLB) {
+		cptr = arena_new(&glbarena, glbptr);
+		if (!cptr) {
 			error("global symbol table overflow");
 			return (NULL);
 		}
-		cptr = glbptr;
+		ptr = cptr->name;
+		while (an(*ptr++ = *sname++)) ;
+		arena_link(&glbarena, cptr);
 		glbptr++;
 	}
-	else
+	else {
 		cptr = replace;
+		ptr = cptr->name;
+		while (an(*ptr++ = *sname++)) ;
+	}
 
-	ptr = cptr->name;
-	while (an(*ptr++ = *sname++)) ;
 	cptr->ident = id;
 	cptr->type = typ;
 	cptr->storage = stor;
@@ -513,6 +589,22 @@ SYMBOL *addglb (char *sname, char id, char typ, long value, long stor, SYMBOL *r
 	return (cptr);
 }
 
+/*
+ *	re-create a global from a saved copy (see pch.c)
+ */
+SYMBOL *restoreglb (SYMBOL *sym)
+{
+	SYMBOL *ptr, *hnext;
+
+	ptr = addglb(sym->name, sym->ident, sym->type, sym->offset, sym->storage, 0);
+	if (ptr) {
+		hnext = ptr->hnext;
+		*ptr = *sym;
+		ptr->hnext = hnext;
+	}
+	return (ptr);
+}
+
 SYMBOL *addglb_far (char *sname, char typ)
 {
 	SYMBOL *ptr;
@@ -532,13 +624,14 @@ SYMBOL *addloc (char *sname, char id, char typ, long value, long stclass, long s
 	if (cptr)
 		return (cptr);
 
-	if (locptr >= ENDLOC) {
+	cptr = arena_new(&locarena, locptr);
+	if (!cptr) {
 		error("local symbol table overflow");
 		return (NULL);
 	}
-	cptr = locptr;
-	ptr = locptr->name;
+	ptr = cptr->name;
 	while (an(*ptr++ = *sname++)) ;
+	arena_link(&locarena, cptr);
 	cptr->ident = id;
 	cptr->type = typ;
 	cptr->storage = stclass;
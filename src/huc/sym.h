@@ -4,9 +4,11 @@
 long declglb (long typ, long stor, TAG_SYMBOL *mtag, int otag, int is_struct);
 void declloc (long typ, long stclass, int otag);
 long needsub (void);
+SYMBOL *glbsym (long idx);
 SYMBOL *findglb (char *sname);
 SYMBOL *findloc (char *sname);
 SYMBOL *addglb (char *sname, char id, char typ, long value, long stor, SYMBOL *replace);
+SYMBOL *restoreglb (SYMBOL *sym);
 SYMBOL *addglb_far (char *sname, char typ);
 SYMBOL *addloc (char *sname, char id, char typ, long value, long stclass, long size);
 long symname (char *sname);
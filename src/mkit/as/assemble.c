@@ -14,15 +14,39 @@ int if_flag[256];	/* .if/.else status */
 int skip_lines;		/* set when lines must be skipped */
 int continued_line;	/* set when a line is the continuation of another line */
 
+/* instruction table: each mnemonic the machine knows has a slot of
+ * its own, found from the hash of its name plus the displacement that
+ * inst_hash() picked for its bucket; names are compared as two words
+ */
+#define OP_SLOTS	1024
+#define OP_BUCKETS	256
+
+typedef union t_opname {
+	char c[16];
+	unsigned long long w[2];
+} t_opname;
+
+static struct t_opslot {
+	t_opname name;
+	struct t_opcode *op;
+} op_slot[OP_SLOTS];
+static unsigned short op_disp[OP_BUCKETS];
+static unsigned long long op_seed;
+static struct t_opcode *op_list;	/* instructions added by addinst() */
+
+static int op_scan(int *idx, struct t_opcode **found);
+static unsigned int op_hash(t_opname *name, unsigned long long seed);
+static int op_place(unsigned long long seed);
+
 
 /* ----
- * assemble()
+ * assemble_line()
  * ----
  * translate source line to machine language
  */
 
 void
-assemble(int do_label)
+assemble_line(int do_label)
 {
 	struct t_line *ptr;
 	char *buf;
@@ -51,7 +75,7 @@ assemble(int do_label)
 		if (oplook(&i) >= 0) {
 			if (opflg == PSEUDO) {
 				if (opval == P_MACRO) {
-					error("Can not nest macro definitions!");
+					as_error("Can not nest macro definitions!");
 					return;
 				}
 				if (opval == P_ENDM) {
@@ -66,16 +90,18 @@ assemble(int do_label)
 			ptr = (void *)malloc(sizeof(struct t_line));
 			buf = (void *)malloc(strlen(&prlnbuf[SFIELD]) + 1);
 			if ((ptr == NULL) || (buf == NULL)) {
-				error("Out of memory!");
+				as_error("Out of memory!");
 				return;
 			}
 			strcpy(buf, &prlnbuf[SFIELD]);
 			ptr->next = NULL;
 			ptr->data = buf;
+			ptr->plain = strcspn(buf, "\\");
+			memset(&ptr->ir, 0, sizeof(struct t_ir));
 			if (mlptr)
 				mlptr->next = ptr;
 			else
-				mptr->line = ptr;
+				macro_ptr->line = ptr;
 			mlptr = ptr;
 		}
 		return;
@@ -179,8 +205,8 @@ assemble(int do_label)
 
 	/* is it a macro? */
 	ip = i;
-	mptr = macro_look(&ip);
-	if (mptr) {
+	macro_ptr = macro_look(&ip);
+	if (macro_ptr) {
 		/* define label */
 		labldef(loccnt, 1);
 
@@ -202,7 +228,7 @@ assemble(int do_label)
 		mcntmax++;
 		mcounter = mcntmax;
 		expand_macro = 1;
-		mlptr = mptr->line;
+		mlptr = macro_ptr->line;
 		return;
 	}
 
@@ -212,12 +238,12 @@ assemble(int do_label)
 	if (flag < 0) {
 		if (flag == -1 && !do_label) {
 			/* try again, maybe it's a label */
-			assemble(1);
+			assemble_line(1);
 			return;
 		}
 		labldef(loccnt, 1);
 		if ((flag == -1))
-			error("Unknown instruction!");
+			as_error("Unknown instruction!");
 		if ((flag == -2) && (pass == LAST_PASS)) {
 			if (lablptr)
 				loadlc(loccnt, 0);
@@ -260,19 +286,66 @@ assemble(int do_label)
 
 int
 oplook(int *idx)
+{
+	struct t_ir *ir = line_ir;
+	struct t_opcode *ptr;
+	int pos = *idx;
+	int res;
+
+	/* the line was seen before, by the other pass or
+	 * an earlier expansion of its macro
+	 */
+	if (ir && ir->op_pos == pos) {
+		*idx = ir->op_end;
+		opext = ir->op_ext;
+		if ((ptr = ir->op) != NULL) {
+			opproc = ptr->proc;
+			opflg = ptr->flag;
+			opval = ptr->value;
+			optype = ptr->type_idx;
+		}
+		return (ir->op_res);
+	}
+
+	/* look it up, and keep the result if the text it
+	 * depends on is the same every time the line is read
+	 */
+	ptr = NULL;
+	res = op_scan(idx, &ptr);
+	if (ir && *idx < line_plain) {
+		ir->op_pos = pos;
+		ir->op_end = *idx;
+		ir->op_res = res;
+		ir->op_ext = opext;
+		ir->op = ptr;
+	}
+	return (res);
+}
+
+
+/* ----
+ * op_scan()
+ * ----
+ * read the instruction name and search it in the hash table
+ */
+
+static int
+op_scan(int *idx, struct t_opcode **found)
 {
 	struct t_opcode *ptr;
-	char name[16];
+	struct t_opslot *slot;
+	t_opname name;
+	unsigned int hash;
 	char c;
 	int flag;
-	int hash;
 	int i;
 
 	/* get instruction name */
 	i = 0;
 	opext = 0;
 	flag = 0;
-	hash = 0;
+	name.w[0] = 0;
+	name.w[1] = 0;
 
 	for (;;) {
 		c = toupper(prlnbuf[*idx]);
@@ -300,8 +373,7 @@ oplook(int *idx)
 		}
 
 		/* store char */
-		name[i++] = c;
-		hash += c;
+		name.c[i++] = c;
 		(*idx)++;
 
 		/* break if '=' directive */
@@ -315,38 +387,34 @@ oplook(int *idx)
 			return (-1);
 	}
 
-	/* end name string */
-	name[i] = '\0';
-
 	/* return if no instruction */
 	if (i == 0)
 		return (-2);
 
-	/* search the instruction in the hash table */
-	ptr = inst_tbl[hash & 0xFF];
-
-	while (ptr) {
-		if (name[0] == ptr->name[0] && !strcmp(name, ptr->name)) {
-			opproc = ptr->proc;
-			opflg = ptr->flag;
-			opval = ptr->value;
-			optype = ptr->type_idx;
-
-			if (opext) {
-				/* no extension for pseudos */
-				if (opflg == PSEUDO)
-					return (-1);
-				/* extension valid only for these addressing modes */
-				if (!(opflg & (IMM | ZP | ZP_X | ZP_IND_Y | ABS | ABS_X | ABS_Y)))
-					return (-1);
-			}
-			return (i);
-		}
-		ptr = ptr->next;
-	}
+	/* the only slot where it can be */
+	hash = op_hash(&name, op_seed);
+	slot = &op_slot[((hash >> 8) + op_disp[hash & (OP_BUCKETS - 1)]) & (OP_SLOTS - 1)];
 
 	/* didn't find this instruction */
-	return (-1);
+	if (slot->name.w[0] != name.w[0] || slot->name.w[1] != name.w[1] || slot->op == NULL)
+		return (-1);
+
+	ptr = slot->op;
+	*found = ptr;
+	opproc = ptr->proc;
+	opflg = ptr->flag;
+	opval = ptr->value;
+	optype = ptr->type_idx;
+
+	if (opext) {
+		/* no extension for pseudos */
+		if (opflg == PSEUDO)
+			return (-1);
+		/* extension valid only for these addressing modes */
+		if (!(opflg & (IMM | ZP | ZP_X | ZP_IND_Y | ABS | ABS_X | ABS_Y)))
+			return (-1);
+	}
+	return (i);
 }
 
 
@@ -354,38 +422,20 @@ oplook(int *idx)
  * addinst()
  * ----
  * add a list of instructions to the instruction
- * hash table
+ * table, see inst_hash()
  */
 
 void
 addinst(struct t_opcode *optbl)
 {
-	int hash;
-	int len;
-	int i;
-	char *ptr;
-	char c;
-
 	if (optbl == NULL)
 		return;
 
 	/* parse list */
 	while (optbl->name) {
-		/* calculate instruction hash value */
-		hash = 0;
-		len = strlen(optbl->name);
-		ptr = optbl->name;
-
-		for (i = 0; i < len; i++) {
-			c = *ptr++;
-			hash += c;
-		}
-
-		hash &= 0xFF;
-
-		/* insert the instruction in the hash table */
-		optbl->next = inst_tbl[hash];
-		inst_tbl[hash] = optbl;
+		/* the latest one wins if a name is used twice */
+		optbl->next = op_list;
+		op_list = optbl;
 
 		/* next instruction */
 		optbl++;
@@ -393,6 +443,129 @@ addinst(struct t_opcode *optbl)
 }
 
 
+/* ----
+ * inst_hash()
+ * ----
+ * give every instruction added by addinst() since the last call
+ * a slot of its own; try hash seeds until one lets all the buckets
+ * be placed
+ */
+
+void
+inst_hash(void)
+{
+	unsigned long long seed;
+
+	for (seed = 0; !op_place(seed); seed++)
+		;
+	op_seed = seed;
+	op_list = NULL;
+}
+
+
+/* ----
+ * op_hash()
+ * ----
+ * hash of an instruction name; the low bits pick the bucket
+ * and the high bits the slot
+ */
+
+static unsigned int
+op_hash(t_opname *name, unsigned long long seed)
+{
+	unsigned long long h;
+
+	h = (name->w[0] ^ seed) * 0x9E3779B97F4A7C15ULL;
+	h = (h ^ (h >> 29) ^ name->w[1]) * 0xBF58476D1CE4E5B9ULL;
+	return ((unsigned int)(h >> 32));
+}
+
+
+/* ----
+ * op_place()
+ * ----
+ * fill the instruction table using <seed>, biggest buckets first,
+ * each with the first displacement that moves all its names to
+ * free slots; return 0 if a bucket can't be placed
+ */
+
+static int
+op_place(unsigned long long seed)
+{
+	static t_opname name[OP_SLOTS];
+	static struct t_opcode *op[OP_SLOTS];
+	static unsigned int hash[OP_SLOTS];
+	int count[OP_BUCKETS];
+	struct t_opcode *ptr;
+	unsigned int s;
+	int nb, size;
+	int b, d, i, j;
+
+	/* the names, without the ones that a later table redefines */
+	nb = 0;
+	for (ptr = op_list; ptr; ptr = ptr->next) {
+		memset(&name[nb], 0, sizeof(t_opname));
+		strncpy(name[nb].c, ptr->name, 15);
+		for (i = 0; i < nb; i++)
+			if (name[i].w[0] == name[nb].w[0] && name[i].w[1] == name[nb].w[1])
+				break;
+		if (i < nb)
+			continue;
+		if (nb == OP_SLOTS / 2) {
+			fatal_error("Too many instructions!");
+			return (1);
+		}
+		op[nb] = ptr;
+		hash[nb] = op_hash(&name[nb], seed);
+		nb++;
+	}
+
+	memset(op_slot, 0, sizeof(op_slot));
+	memset(op_disp, 0, sizeof(op_disp));
+	memset(count, 0, sizeof(count));
+	for (i = 0; i < nb; i++)
+		count[hash[i] & (OP_BUCKETS - 1)]++;
+
+	/* place the buckets */
+	for (size = nb; size > 0; size--) {
+		for (b = 0; b < OP_BUCKETS; b++) {
+			if (count[b] != size)
+				continue;
+			for (d = 0; d < OP_SLOTS; d++) {
+				/* all the names of the bucket must land on free slots */
+				for (i = 0; i < nb; i++) {
+					if ((hash[i] & (OP_BUCKETS - 1)) != b)
+						continue;
+					s = ((hash[i] >> 8) + d) & (OP_SLOTS - 1);
+					if (op_slot[s].op)
+						break;
+					op_slot[s].op = op[i];
+				}
+				if (i == nb)
+					break;
+
+				/* no, take them back */
+				for (j = 0; j < i; j++) {
+					if ((hash[j] & (OP_BUCKETS - 1)) != b)
+						continue;
+					op_slot[((hash[j] >> 8) + d) & (OP_SLOTS - 1)].op = NULL;
+				}
+			}
+			if (d == OP_SLOTS)
+				return (0);
+
+			/* keep it */
+			op_disp[b] = d;
+			for (i = 0; i < nb; i++) {
+				if ((hash[i] & (OP_BUCKETS - 1)) == b)
+					op_slot[((hash[i] >> 8) + d) & (OP_SLOTS - 1)].name = name[i];
+			}
+		}
+	}
+	return (1);
+}
+
+
 /* ----
  * check_eol()
  * ----
@@ -407,7 +580,7 @@ check_eol(int *ip)
 	if (prlnbuf[*ip] == ';' || prlnbuf[*ip] == '\0')
 		return (1);
 	else {
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return (0);
 	}
 }
@@ -475,7 +648,7 @@ do_ifdef(int *ip)
 
 	/* get symbol */
 	if (!colsym(ip)) {
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return;
 	}
 	if (!check_eol(ip))
@@ -0,0 +1,19 @@
+/*
+ *  MagicKit assembler - command line tool
+ *
+ *  The assembler itself lives in libpceas.a (see pceas.h).
+ */
+
+#include "pceas.h"
+
+
+/* ----
+ * main()
+ * ----
+ */
+
+int
+main(int argc, char **argv)
+{
+	return (pceas_main(argc, argv));
+}
@@ -63,7 +63,7 @@ class2(int *ip)
 
 		/* check range */
 		if (addr > 0x7F && addr < 0xFFFFFF80) {
-			error("Branch address out of range!");
+			as_error("Branch address out of range!");
 			return;
 		}
 
@@ -267,7 +267,7 @@ class5(int *ip)
 
 		/* check range */
 		if (addr > 0x7F && addr < 0xFFFFFF80) {
-			error("Branch address out of range!");
+			as_error("Branch address out of range!");
 			return;
 		}
 
@@ -301,7 +301,7 @@ class6(int *ip)
 			return;
 		if (pass == LAST_PASS) {
 			if (value & 0xFFFF0000) {
-				error("Operand size error!");
+				as_error("Operand size error!");
 				return;
 			}
 		}
@@ -411,7 +411,7 @@ class8(int *ip)
 	if (pass == LAST_PASS) {
 		/* check page index */
 		if (value & 0xF8) {
-			error("Incorrect page index!");
+			as_error("Incorrect page index!");
 			return;
 		}
 
@@ -455,7 +455,7 @@ class9(int *ip)
 	if (pass == LAST_PASS) {
 		/* check bit number */
 		if (bit > 7) {
-			error("Incorrect bit number!");
+			as_error("Incorrect bit number!");
 			return;
 		}
 
@@ -507,7 +507,7 @@ class10(int *ip)
 	if (pass == LAST_PASS) {
 		/* check bit number */
 		if (bit > 7) {
-			error("Incorrect bit number!");
+			as_error("Incorrect bit number!");
 			return;
 		}
 
@@ -520,7 +520,7 @@ class10(int *ip)
 
 		/* check range */
 		if (addr > 0x7F && addr < 0xFFFFFF80) {
-			error("Branch address out of range!");
+			as_error("Branch address out of range!");
 			return;
 		}
 
@@ -533,6 +533,72 @@ class10(int *ip)
 }
 
 
+/* ----
+ * class11()
+ * ----
+ * relaxable branch, the short form (2 bytes) when the target
+ * is in range, else the inverted branch over a JMP (5 bytes),
+ * or a plain JMP for JBRA (3 bytes)
+ */
+
+void
+class11(int *ip)
+{
+	unsigned int addr;
+	int far;
+
+	/* get destination address */
+	if (!evaluate(ip, ';'))
+		return;
+
+	/* pick the form */
+	if ((far = relax_branch()) < 0)
+		return;
+
+	/* update location counter */
+	if (far)
+		loccnt += (opval == 0x80) ? 3 : 5;
+	else
+		loccnt += 2;
+
+	/* generate code */
+	if (pass == LAST_PASS) {
+		if (far) {
+			/* long form */
+			if (opval == 0x80) {
+				putbyte(data_loccnt, 0x4C);
+				putword(data_loccnt + 1, value);
+			}
+			else {
+				putbyte(data_loccnt, opval ^ 0x20);
+				putbyte(data_loccnt + 1, 0x03);
+				putbyte(data_loccnt + 2, 0x4C);
+				putword(data_loccnt + 3, value);
+			}
+		}
+		else {
+			/* opcode */
+			putbyte(data_loccnt, opval);
+
+			/* calculate branch offset */
+			addr = value - (loccnt + (page << 13));
+
+			/* check range */
+			if (addr > 0x7F && addr < 0xFFFFFF80) {
+				as_error("Branch address out of range!");
+				return;
+			}
+
+			/* offset */
+			putbyte(data_loccnt + 1, addr);
+		}
+
+		/* output line */
+		println();
+	}
+}
+
+
 /* ----
  * getoperand()
  * ----
@@ -541,12 +607,14 @@ class10(int *ip)
 int
 getoperand(int *ip, int flag, int last_char)
 {
+	struct t_ir *ir;
 	unsigned int tmp;
 	char c;
 	int code;
 	int mode;
 	int pos;
 	int end;
+	int start;
 
 	/* init */
 	auto_inc = 0;
@@ -561,7 +629,7 @@ getoperand(int *ip, int flag, int last_char)
 	case '\0':
 	case ';':
 		/* no operand */
-		error("Operand missing!");
+		as_error("Operand missing!");
 		return (0);
 
 	case 'A':
@@ -605,7 +673,17 @@ getoperand(int *ip, int flag, int last_char)
 		if (!evaluate(ip, 0))
 			return (0);
 
-		/* check addressing mode */
+		/* check addressing mode, or take what was found
+		 * at the same place of the line before
+		 */
+		ir = line_ir;
+		if (ir && ir->md_pos == *ip) {
+			code = ir->md_code;
+			pos = ir->md_comma;
+			*ip = ir->md_end;
+			goto mode;
+		}
+		start = *ip;
 		code = 0;
 		end = 0;
 		pos = 0;
@@ -646,7 +724,14 @@ getoperand(int *ip, int flag, int last_char)
 				break;
 			}
 		}
+		if (ir && *ip + 1 < line_plain) {
+			ir->md_pos = start;
+			ir->md_end = *ip;
+			ir->md_comma = pos;
+			ir->md_code = code;
+		}
 
+mode:
 		/* absolute, zp, or immediate */
 		if (code == 0x000000)
 			mode &= (ABS | ZP | IMM);
@@ -707,13 +792,13 @@ getoperand(int *ip, int flag, int last_char)
 				/* extension stuff */
 				if (opext && !auto_inc) {
 					if (mode & (ZP_IND | ZP_IND_X | ZP_IND_Y))
-						error("Instruction extension not supported in indirect modes!");
+						as_error("Instruction extension not supported in indirect modes!");
 					if (opext == 'H')
 						value++;
 				}
 				/* check address validity */
 				if ((value & 0xFFFFFF00) && ((value & 0xFFFFFF00) != machine->ram_base))
-					error("Incorrect zero page address!");
+					as_error("Incorrect zero page address!");
 			}
 
 			/* immediate mode */
@@ -726,7 +811,7 @@ getoperand(int *ip, int flag, int last_char)
 				else {
 					/* check value validity */
 					if ((value > 0xFF) && (value < 0xFFFFFF00))
-						error("Incorrect immediate value!");
+						as_error("Incorrect immediate value!");
 				}
 			}
 
@@ -735,13 +820,13 @@ getoperand(int *ip, int flag, int last_char)
 				/* extension stuff */
 				if (opext && !auto_inc) {
 					if (mode & (ABS_IND | ABS_IND_X))
-						error("Instruction extension not supported in indirect modes!");
+						as_error("Instruction extension not supported in indirect modes!");
 					if (opext == 'H')
 						value++;
 				}
 				/* check address validity */
 				if (value & 0xFFFF0000)
-					error("Incorrect absolute address!");
+					as_error("Incorrect absolute address!");
 			}
 		}
 		break;
@@ -750,7 +835,7 @@ getoperand(int *ip, int flag, int last_char)
 	/* compare addressing mode */
 	mode &= flag;
 	if (!mode) {
-		error("Incorrect addressing mode!");
+		as_error("Incorrect addressing mode!");
 		return (0);
 	}
 
@@ -766,7 +851,7 @@ getoperand(int *ip, int flag, int last_char)
 	case ';':
 		/* last operand */
 		if (c != ';' && c != '\0') {
-			error("Syntax error!");
+			as_error("Syntax error!");
 			return (0);
 		}
 		(*ip)++;
@@ -775,7 +860,7 @@ getoperand(int *ip, int flag, int last_char)
 	case ',':
 		/* need more operands */
 		if (c != ',') {
-			error("Operand missing!");
+			as_error("Operand missing!");
 			return (0);
 		}
 		(*ip)++;
@@ -805,7 +890,7 @@ getstring(int *ip, char *buffer, int size)
 
 	/* string must be enclosed */
 	if (prlnbuf[(*ip)++] != '\"') {
-		error("Incorrect string syntax!");
+		as_error("Incorrect string syntax!");
 		return (0);
 	}
 
@@ -816,7 +901,7 @@ getstring(int *ip, char *buffer, int size)
 		if (c == '\"')
 			break;
 		if (i >= size) {
-			error("String too long!");
+			as_error("String too long!");
 			return (0);
 		}
 		buffer[i++] = c;
@@ -30,6 +30,10 @@ do_pseudo(int *ip)
 	int old_bank;
 	int size;
 
+	/* only some can go in an object */
+	if (obj_rec)
+		obj_pseudo();
+
 	/* check if the directive is allowed in the current section */
 	if (!(pseudo_flag[opval] & (1 << section)))
 		fatal_error("Directive not allowed in the current section!");
@@ -79,7 +83,7 @@ do_pseudo(int *ip)
 					size = ((bank - old_bank - 1) * 8192) + loccnt;
 					if (size) {
 						sprintf(str, "Warning, bank overflow by %i bytes!\n", size);
-						warning(str);
+						as_warning(str);
 					}
 				}
 				break;
@@ -188,7 +192,7 @@ do_db(int *ip)
 				if (c == '\"')
 					break;
 				if (c == '\0') {
-					error("Unterminated ASCII string!");
+					as_error("Unterminated ASCII string!");
 					return;
 				}
 				if (c == '\\') {
@@ -227,7 +231,7 @@ do_db(int *ip)
 			if (pass == LAST_PASS) {
 				/* check for overflow */
 				if ((value > 0xFF) && (value < 0xFFFFFF80)) {
-					error("Overflow error!");
+					as_error("Overflow error!");
 					return;
 				}
 
@@ -245,7 +249,7 @@ do_db(int *ip)
 
 	/* check error */
 	if (c != ';' && c != '\0') {
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return;
 	}
 
@@ -299,7 +303,7 @@ do_dw(int *ip)
 		if (pass == LAST_PASS) {
 			/* check for overflow */
 			if ((value > 0xFFFF) && (value < 0xFFFF8000)) {
-				error("Overflow error!");
+				as_error("Overflow error!");
 				return;
 			}
 
@@ -316,7 +320,7 @@ do_dw(int *ip)
 
 	/* check error */
 	if (c != ';' && c != '\0') {
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return;
 	}
 
@@ -370,7 +374,7 @@ do_dwl(int *ip)
 		if (pass == LAST_PASS) {
 			/* check for overflow */
 			if ((value > 0xFFFF) && (value < 0xFFFF8000)) {
-				error("Overflow error!");
+				as_error("Overflow error!");
 				return;
 			}
 
@@ -387,7 +391,7 @@ do_dwl(int *ip)
 
 	/* check error */
 	if (c != ';' && c != '\0') {
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return;
 	}
 
@@ -436,7 +440,7 @@ do_dwh(int *ip)
 		if (pass == LAST_PASS) {
 			/* check for overflow */
 			if ((value > 0xFFFF) && (value < 0xFFFF8000)) {
-				error("Overflow error!");
+				as_error("Overflow error!");
 				return;
 			}
 
@@ -453,7 +457,7 @@ do_dwh(int *ip)
 
 	/* check error */
 	if (c != ';' && c != '\0') {
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return;
 	}
 
@@ -522,7 +526,7 @@ do_page(int *ip)
 	if (!evaluate(ip, ';'))
 		return;
 	if (value > 7) {
-		error("Invalid page index!");
+		as_error("Invalid page index!");
 		return;
 	}
 	page = value;
@@ -550,7 +554,7 @@ do_org(int *ip)
 
 	/* check for undefined symbol - they are not allowed in .org */
 	if (undef != 0) {
-		error("Undefined symbol in operand field!");
+		as_error("Undefined symbol in operand field!");
 		return;
 	}
 
@@ -559,7 +563,7 @@ do_org(int *ip)
 	case S_ZP:
 		/* zero page section */
 		if ((value & 0xFFFFFF00) && ((value & 0xFFFFFF00) != machine->ram_base)) {
-			error("Invalid address!");
+			as_error("Invalid address!");
 			return;
 		}
 		break;
@@ -567,7 +571,7 @@ do_org(int *ip)
 	case S_BSS:
 		/* ram section */
 		if ((value < machine->ram_base) || (value >= (machine->ram_base + machine->ram_limit))) {
-			error("Invalid address!");
+			as_error("Invalid address!");
 			return;
 		}
 		break;
@@ -582,7 +586,7 @@ do_org(int *ip)
 
 		/* code and data section */
 		if (value & 0xFFFF0000) {
-			error("Invalid address!");
+			as_error("Invalid address!");
 			return;
 		}
 		page = (value >> 13) & 0x07;
@@ -627,7 +631,7 @@ do_bank(int *ip)
 	if (!evaluate(ip, 0))
 		return;
 	if (value > bank_limit) {
-		error("Bank index out of range!");
+		as_error("Bank index out of range!");
 		return;
 	}
 
@@ -646,7 +650,7 @@ do_bank(int *ip)
 		/* check name validity */
 		if (strlen(bank_name[value])) {
 			if (strcasecmp(bank_name[value], name)) {
-				error("Different bank names not allowed!");
+				as_error("Different bank names not allowed!");
 				return;
 			}
 		}
@@ -662,7 +666,7 @@ do_bank(int *ip)
 		break;
 
 	default:
-		error("Syntax error!");
+		as_error("Syntax error!");
 		return;
 	}
 
@@ -712,11 +716,15 @@ do_incbin(int *ip)
 		if (!strchr(p, PATH_SEPARATOR)) {
 			/* check if it's a mx file */
 			if (!strcasecmp(p, ".mx")) {
+				if (obj_rec)
+					obj_nocache();
 				do_mx(fname);
 				return;
 			}
 			/* check if it's a map file */
 			if (!strcasecmp(p, ".fmp")) {
+				if (obj_rec)
+					obj_nocache();
 				if (pce_load_map(fname, 0))
 					return;
 			}
@@ -735,6 +743,8 @@ do_incbin(int *ip)
 		fatal_error("Can not open file!");
 		return;
 	}
+	if (obj_rec)
+		obj_file(fname);
 
 	/* get file size */
 	fseek(fp, 0, SEEK_END);
@@ -744,13 +754,15 @@ do_incbin(int *ip)
 	/* check if it will fit in the rom */
 	if (((bank << 13) + loccnt + size) > rom_limit) {
 		fclose(fp);
-		error("ROM overflow!");
+		as_error("ROM overflow!");
 		return;
 	}
 
 	/* load data on last pass */
 	if (pass == LAST_PASS) {
 		fread(&rom[bank][loccnt], 1, size, fp);
+		if (obj_rec)
+			obj_put(loccnt, size);
 		memset(&map[bank][loccnt], section + (page << 5), size);
 
 		/* output line */
@@ -818,7 +830,7 @@ do_mx(char *fname)
 
 			/* error on unsupported records */
 			if ((type != '2') && (type != '8')) {
-				error("Unsupported S-record type!");
+				as_error("Unsupported S-record type!");
 				return;
 			}
 
@@ -827,7 +839,7 @@ do_mx(char *fname)
 			addr = htoi(&line[4], 6);
 
 			if ((strlen(line) < 12) || (cnt < 4) || (addr == -1)) {
-				error("Incorrect S-record line!");
+				as_error("Incorrect S-record line!");
 				return;
 			}
 
@@ -849,7 +861,7 @@ do_mx(char *fname)
 				ptr += 2;
 
 				if (data == -1) {
-					error("Syntax error in a S-record line!");
+					as_error("Syntax error in a S-record line!");
 					return;
 				}
 			}
@@ -859,7 +871,7 @@ do_mx(char *fname)
 			chksum = (~chksum) & 0xFF;
 
 			if (data != chksum) {
-				error("Checksum error!");
+				as_error("Checksum error!");
 				return;
 			}
 
@@ -871,7 +883,7 @@ do_mx(char *fname)
 			if (type == '2') {
 				/* set the location counter */
 				if (addr & 0xFFFF0000) {
-					error("Invalid address!");
+					as_error("Invalid address!");
 					return;
 				}
 				page = (addr >> 13) & 0x07;
@@ -948,11 +960,19 @@ do_include(int *ip)
 	if (!getstring(ip, fname, 127))
 		return;
 
+	/* an object may stand for the file */
+	if (obj_include(fname)) {
+		if (pass == LAST_PASS)
+			println();
+		return;
+	}
+
 	/* open file */
 	if (open_input(fname) == -1) {
 		fatal_error("Can not open file!");
 		return;
 	}
+	obj_record();
 
 	/* output line */
 	if (pass == LAST_PASS)
@@ -976,7 +996,7 @@ do_rsset(int *ip)
 	if (!evaluate(ip, ';'))
 		return;
 	if (value & 0xFFFF0000) {
-		error("Address out of range!");
+		as_error("Address out of range!");
 		return;
 	}
 
@@ -1016,7 +1036,7 @@ do_rs(int *ip)
 	/* update 'rs' base */
 	rsbase += value;
 	if (rsbase & 0xFFFF0000)
-		error("Address out of range!");
+		as_error("Address out of range!");
 }
 
 
@@ -1060,7 +1080,7 @@ do_ds(int *ip)
 
 	/* check range */
 	if ((loccnt + value) > limit) {
-		error("Out of range!");
+		as_error("Out of range!");
 		return;
 	}
 
@@ -1088,6 +1108,8 @@ do_ds(int *ip)
 		case S_DATA:
 			memset(&rom[bank][loccnt], 0, value);
 			memset(&map[bank][loccnt], section + (page << 5), value);
+			if (obj_rec)
+				obj_put(loccnt, value);
 			if (bank > max_bank)
 				max_bank = bank;
 			break;
@@ -1256,7 +1278,7 @@ do_opt(int *ip)
 			if (c == ',' || c == ';' || c == '\0')
 				break;
 			if (i > 31) {
-				error("Syntax error!");
+				as_error("Syntax error!");
 				return;
 			}
 			name[i++] = c;
@@ -1278,7 +1300,7 @@ do_opt(int *ip)
 		else if (!strcasecmp(name, "o"))
 			opt = OPT_OPTIMIZE;
 		else {
-			error("Unknown option!");
+			as_error("Unknown option!");
 			return;
 		}
 
@@ -150,15 +150,75 @@ typedef struct t_opcode {
 	int type_idx;
 } t_opcode;
 
+/* one step of a parsed expression: a value to push, a symbol
+ * to look at or an operator to apply (E_xxx in expr.h)
+ */
+typedef struct t_estep {
+	int type;
+	union {
+		unsigned int value;
+		int op;
+		struct t_symbol *sym;
+		char *name;	/* local symbol, looked up each time */
+	} u;
+} t_estep;
+
+/* an expression of a line as evaluate() parsed it, the steps in
+ * the order it took them; run again by expr_run()
+ */
+typedef struct t_expr {
+	struct t_expr *next;	/* other expressions of the line */
+	short pos;		/* prlnbuf index it starts at */
+	short stop;		/* index the parse stopped at */
+	char end;		/* and why */
+	int func_gen;		/* func_gen when parsed */
+	int nb;			/* number of steps */
+	struct t_estep *step;
+} t_expr;
+
+/* what the first look at a line found; kept with the line so that
+ * later passes and macro expansions don't scan it again
+ */
+typedef struct t_ir {
+	short op_pos;		/* prlnbuf index of the mnemonic, 0 = not seen yet */
+	short op_end;		/* index after it */
+	short op_res;		/* oplook() result */
+	char op_ext;		/* instruction extension */
+	struct t_opcode *op;	/* instruction, NULL if not found */
+	short mac_pos;		/* same for macro_look() */
+	short mac_end;
+	int mac_gen;		/* macro_gen when looked up */
+	struct t_macro *mac;
+	short md_pos;		/* getoperand() index mode suffix, 0 = not seen */
+	short md_end;		/* index after it */
+	short md_comma;		/* index of its first comma, 0 = none */
+	int md_code;		/* and what it holds */
+	struct t_expr *expr;	/* expressions parsed on the line */
+} t_ir;
+
+/* a source file, read once for all passes */
+typedef struct t_source {
+	struct t_source *next;
+	char *text;		/* lines, '\0' terminated */
+	int *start;		/* offset of each line */
+	struct t_ir *ir;	/* and what it holds */
+	int nb_lines;
+	long nb_read;		/* lines assembled from it, macro lines included */
+	long ticks;		/* clock() time spent on them */
+	unsigned long long hash;	/* of its contents */
+	char path[256];		/* where it was found */
+	char name[116];
+} t_source;
+
 typedef struct t_input_info {
-	FILE *fp;
+	struct t_source *src;
+	int line;		/* next line to read */
 	int lnum;
 	int if_level;
 	char name[116];
 } t_input_info;
 
 typedef struct t_proc {
-	struct t_proc *next;
 	struct t_proc *link;
 	struct t_proc *group;
 	int old_bank;
@@ -169,11 +229,25 @@ typedef struct t_proc {
 	int call;
 	int type;
 	int refcnt;
+	int br_base;
+	int br_end;
+	int br_last;
+	int br_grow;
 	char name[SBOLSZ];
 } t_proc;
 
+typedef struct t_branch {
+	struct t_symbol *sym;
+	struct t_proc *proc;
+	int offset;
+	int addr;
+	int delta;
+	int far;
+	int grow;
+} t_branch;
+
 typedef struct t_symbol {
-	struct t_symbol *next;
+	struct t_symbol *next;		/* next local symbol of the same global */
 	struct t_symbol *local;
 	struct t_proc *proc;
 	int type;
@@ -188,26 +262,44 @@ typedef struct t_symbol {
 	int reserved;
 	int data_type;
 	int data_size;
+	int br_last;
+	int serial;		/* order of creation */
 	char name[SBOLSZ];
 } t_symbol;
 
 typedef struct t_line {
 	struct t_line *next;
 	char *data;
+	int plain;		/* chars before the first macro argument */
+	struct t_ir ir;
 } t_line;
 
 typedef struct t_macro {
-	struct t_macro *next;
 	struct t_line *line;
+	int gen;		/* macro_gen once defined */
 	char name[SBOLSZ];
 } t_macro;
 
 typedef struct t_func {
-	struct t_func *next;
 	char line[128];
+	int gen;		/* func_gen once defined */
 	char name[SBOLSZ];
 } t_func;
 
+/* hash table of labels, macros, functions or procs (see hash.c) */
+typedef struct t_htab {
+	void **slot;		/* entries, NULL if free */
+	unsigned int *hash;	/* hash of their names */
+	int size;		/* number of slots, a power of two */
+	int count;		/* number of entries */
+	int name_ofs;		/* where the entries keep their name */
+	char *title;
+	long lookups;		/* statistics for -stats */
+	long probes;
+	int max_probe;
+	int grows;
+} t_htab;
+
 typedef struct t_tile {
 	struct t_tile *next;
 	unsigned char *data;
@@ -221,6 +313,7 @@ typedef struct t_machine {
 	char *asm_title;
 	char *rom_ext;
 	char *include_env;
+	char *obj_env;
 	const char *default_dir;
 	unsigned int zp_limit;
 	unsigned int ram_limit;
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <strings.h>
 #include <string.h>
 #include <ctype.h>
@@ -7,18 +8,27 @@
 #include "protos.h"
 #include "expr.h"
 
+static int expr_run(struct t_expr *e);
+static void expr_keep(struct t_ir *ir, int pos, int end);
+static void expr_rec(int type, unsigned int val, struct t_symbol *sym);
+static unsigned int expr_pc(void);
+
 /* ----
  * evaluate()
  * ----
- * evaluate an expression
+ * evaluate an expression; one parsed before at the same place of
+ * the line is only run again
  */
 
 int
 evaluate(int *ip, char last_char)
 {
+	struct t_ir *ir = line_ir;
+	struct t_expr *e;
 	int end, level;
 	int op, type;
 	int arg;
+	int errors;
 	int i;
 	unsigned char c;
 
@@ -35,6 +45,25 @@ evaluate(int *ip, char last_char)
 	op = OP_START;
 	func_idx = 0;
 
+	/* seen before? */
+	if (ir) {
+		for (e = ir->expr; e; e = e->next)
+			if (e->pos == *ip)
+				break;
+		if (e && e->func_gen == func_gen && !obj_rec) {
+			expr_nb = -1;
+			if (!expr_run(e))
+				return (0);
+			expr = &prlnbuf[e->stop];
+			end = e->end;
+			goto done;
+		}
+	}
+
+	/* record the steps, to keep them if the parse goes well */
+	errors = as_errcnt;
+	expr_nb = 0;
+
 	/* array index to pointer */
 	expr = &prlnbuf[*ip];
 
@@ -63,9 +92,10 @@ cont:
 
 			/* ok */
 			continued_line++;
+			expr_nb = -1;
 
 			/* read a new line */
-			if (readline() == -1)
+			if (read_line() == -1)
 				return (0);
 
 			/* rewind line pointer and continue */
@@ -101,16 +131,17 @@ cont:
 			/* function arg */
 			case '\\':
 				if (func_idx == 0) {
-					error("Syntax error in expression!");
+					as_error("Syntax error in expression!");
 					return (0);
 				}
 				expr++;
 				c = *expr++;
 				if (c < '1' || c > '9') {
-					error("Invalid function argument index!");
+					as_error("Invalid function argument index!");
 					return (0);
 				}
 				arg = c - '1';
+				expr_nb = -1;
 				expr_stack[func_idx++] = expr;
 				expr = func_arg[func_idx - 2][arg];
 				break;
@@ -324,13 +355,18 @@ cont:
 			return (0);
 	}
 
+	/* keep it with the line if the text is the same each time */
+	if (ir && expr_nb >= 0 && as_errcnt == errors && expr - prlnbuf < line_plain)
+		expr_keep(ir, *ip, end);
+
+done:
 	/* get the expression value */
 	value = val_stack[val_idx];
 
 	/* any undefined symbols? trap that if in the last pass */
 	if (undef) {
 		if (pass == LAST_PASS)
-			error("Undefined symbol in operand field!");
+			as_error("Undefined symbol in operand field!");
 	}
 
 	/* check if the last char is what the user asked for */
@@ -342,7 +378,7 @@ cont:
 		break;
 	case ',':
 		if (end != 2) {
-			error("Argument missing!");
+			as_error("Argument missing!");
 			return (0);
 		}
 		expr++;
@@ -357,11 +393,197 @@ cont:
 
 	/* syntax error */
 error:
-	error("Syntax error in expression!");
+	as_error("Syntax error in expression!");
 	return (0);
 }
 
 
+/* ----
+ * expr_run()
+ * ----
+ * take again the steps of an expression parsed before
+ */
+
+static int
+expr_run(struct t_expr *e)
+{
+	struct t_estep *step;
+	struct t_symbol *sym;
+	unsigned int val;
+	int i;
+
+	for (i = 0; i < e->nb; i++) {
+		step = &e->step[i];
+
+		switch (step->type) {
+		case E_VALUE:
+			val = step->u.value;
+			break;
+
+		case E_PC:
+			val = expr_pc();
+			break;
+
+		case E_LOCAL:
+			/* depends on the current global label */
+			strcpy(symbol, step->u.name);
+			if ((sym = stlook(1)) == NULL)
+				return (0);
+			goto label;
+
+		case E_SYMBOL:
+			sym = step->u.sym;
+			if (obj_rec)
+				obj_use(sym);
+			sym->refcnt++;
+label:
+			expr_lablptr = sym;
+			if ((sym->type == UNDEF) || (sym->type == IFUNDEF)) {
+				undef++;
+				val = 0;
+			}
+			else
+				val = sym->value;
+			expr_lablcnt++;
+			break;
+
+		case E_KEYWORD:
+			expr_lablptr = NULL;
+			expr_lablcnt = 0;
+			continue;
+
+		default:
+			op_stack[++op_idx] = step->u.op;
+			if (!do_op())
+				return (0);
+			continue;
+		}
+		val_stack[++val_idx] = val;
+	}
+	need_operator = 1;
+	return (1);
+}
+
+
+/* ----
+ * expr_keep()
+ * ----
+ * store the steps of the expression just parsed with its line
+ */
+
+static void
+expr_keep(struct t_ir *ir, int pos, int end)
+{
+	struct t_expr **link, *e;
+	struct t_estep *step;
+	int i;
+
+	/* replace an older parse */
+	for (link = &ir->expr; *link; link = &(*link)->next) {
+		if ((*link)->pos == pos) {
+			e = *link;
+			*link = e->next;
+			e->next = NULL;
+			expr_free(e);
+			break;
+		}
+	}
+
+	e = malloc(sizeof(struct t_expr) + expr_nb * sizeof(struct t_estep));
+	if (e == NULL)
+		return;
+	e->pos = pos;
+	e->stop = expr - prlnbuf;
+	e->end = end;
+	e->func_gen = func_gen;
+	e->nb = expr_nb;
+	e->step = (struct t_estep *)(e + 1);
+	memcpy(e->step, expr_step, expr_nb * sizeof(struct t_estep));
+
+	/* local symbols are looked up by name */
+	for (i = 0; i < e->nb; i++) {
+		step = &e->step[i];
+		if (step->type == E_LOCAL) {
+			step->u.name = malloc(step->u.sym->name[0] + 2);
+			if (step->u.name == NULL) {
+				e->nb = i;
+				expr_free(e);
+				return;
+			}
+			strcpy(step->u.name, expr_step[i].u.sym->name);
+		}
+	}
+	e->next = ir->expr;
+	ir->expr = e;
+}
+
+
+/* ----
+ * expr_rec()
+ * ----
+ * add a step to the expression being parsed
+ */
+
+static void
+expr_rec(int type, unsigned int val, struct t_symbol *sym)
+{
+	struct t_estep *step;
+
+	if (expr_nb < 0)
+		return;
+	if (expr_nb == E_STEPS) {
+		expr_nb = -1;
+		return;
+	}
+	step = &expr_step[expr_nb++];
+	step->type = type;
+	if (type == E_SYMBOL || type == E_LOCAL)
+		step->u.sym = sym;
+	else if (type == E_OP)
+		step->u.op = val;
+	else
+		step->u.value = val;
+}
+
+
+/* ----
+ * expr_free()
+ * ----
+ * free the expressions of a line
+ */
+
+void
+expr_free(struct t_expr *e)
+{
+	struct t_expr *next;
+	int i;
+
+	for (; e; e = next) {
+		next = e->next;
+		for (i = 0; i < e->nb; i++)
+			if (e->step[i].type == E_LOCAL)
+				free(e->step[i].u.name);
+		free(e);
+	}
+}
+
+
+/* ----
+ * expr_pc()
+ * ----
+ * value of '*'
+ */
+
+static unsigned int
+expr_pc(void)
+{
+	if (data_loccnt == -1)
+		return (loccnt + (page << 13));
+	else
+		return (data_loccnt + (page << 13));
+}
+
+
 /* ----
  * push_val()
  * ----
@@ -381,10 +603,8 @@ push_val(int type)
 	switch (type) {
 	/* program counter */
 	case T_PC:
-		if (data_loccnt == -1)
-			val = (loccnt + (page << 13));
-		else
-			val = (data_loccnt + (page << 13));
+		val = expr_pc();
+		expr_rec(E_PC, 0, NULL);
 		expr++;
 		break;
 
@@ -393,10 +613,11 @@ push_val(int type)
 		expr++;
 		val = *expr++;
 		if ((*expr != c) || (val == 0)) {
-			error("Syntax Error!");
+			as_error("Syntax Error!");
 			return (0);
 		}
 		expr++;
+		expr_rec(E_VALUE, val, NULL);
 		break;
 
 	/* symbol */
@@ -407,6 +628,7 @@ push_val(int type)
 
 		/* an user function? */
 		if (func_look()) {
+			expr_nb = -1;
 			if (!func_getargs())
 				return (0);
 
@@ -418,6 +640,7 @@ push_val(int type)
 		/* a predefined function? */
 		op = check_keyword();
 		if (op) {
+			expr_rec(E_KEYWORD, 0, NULL);
 			if (!push_op(op))
 				return (0);
 			else
@@ -439,6 +662,7 @@ push_val(int type)
 
 		/* remember we have seen a symbol in the expression */
 		expr_lablcnt++;
+		expr_rec(symbol[1] == '.' ? E_LOCAL : E_SYMBOL, 0, expr_lablptr);
 		break;
 
 	/* binary number %1100_0011 */
@@ -486,12 +710,13 @@ extract:
 				break;
 			val = (val * mul) + c;
 		}
+		expr_rec(E_VALUE, val, NULL);
 		break;
 	}
 
 	/* check for too big expression */
 	if (val_idx == 63) {
-		error("Expression too complex!");
+		as_error("Expression too complex!");
 		return (0);
 	}
 
@@ -547,7 +772,7 @@ getsym(void)
 		case 'A':
 		case 'X':
 		case 'Y':
-			error("Symbol is reserved (A, X or Y)!");
+			as_error("Symbol is reserved (A, X or Y)!");
 			i = 0;
 		}
 	}
@@ -608,7 +833,7 @@ getsym_op(void)
 		case 'A':
 		case 'X':
 		case 'Y':
-			error("Symbol is reserved (A, X or Y)!");
+			as_error("Symbol is reserved (A, X or Y)!");
 			i = 0;
 		}
 	}
@@ -690,7 +915,7 @@ push_op(int op)
 		}
 	}
 	if (op_idx == 63) {
-		error("Expression too complex!");
+		as_error("Expression too complex!");
 		return (0);
 	}
 	op_idx++;
@@ -714,6 +939,7 @@ do_op(void)
 
 	/* operator */
 	op = op_stack[op_idx--];
+	expr_rec(E_OP, op, NULL);
 
 	/* first arg */
 	val[0] = val_stack[val_idx];
@@ -731,7 +957,7 @@ do_op(void)
 			return (0);
 		if (pass == LAST_PASS) {
 			if (expr_lablptr->bank == RESERVED_BANK) {
-				error("No BANK index for this symbol!");
+				as_error("No BANK index for this symbol!");
 				val[0] = 0;
 				break;
 			}
@@ -752,7 +978,7 @@ do_op(void)
 			return (0);
 		if (pass == LAST_PASS) {
 			if (expr_lablptr->vram == -1)
-				error("No VRAM address for this symbol!");
+				as_error("No VRAM address for this symbol!");
 		}
 		val[0] = expr_lablptr->vram;
 		break;
@@ -763,7 +989,7 @@ do_op(void)
 			return (0);
 		if (pass == LAST_PASS) {
 			if (expr_lablptr->pal == -1)
-				error("No palette index for this symbol!");
+				as_error("No palette index for this symbol!");
 		}
 		val[0] = expr_lablptr->pal;
 		break;
@@ -786,7 +1012,7 @@ do_op(void)
 			return (0);
 		if (pass == LAST_PASS) {
 			if (expr_lablptr->data_type == -1) {
-				error("No size attributes for this symbol!");
+				as_error("No size attributes for this symbol!");
 				return (0);
 			}
 		}
@@ -817,7 +1043,7 @@ do_op(void)
 
 	case OP_DIV:
 		if (val[0] == 0) {
-			error("Divide by zero!");
+			as_error("Divide by zero!");
 			return (0);
 		}
 		val[0] = val[1] / val[0];
@@ -825,7 +1051,7 @@ do_op(void)
 
 	case OP_MOD:
 		if (val[0] == 0) {
-			error("Divide by zero!");
+			as_error("Divide by zero!");
 			return (0);
 		}
 		val[0] = val[1] % val[0];
@@ -888,7 +1114,7 @@ do_op(void)
 		break;
 
 	default:
-		error("Invalid operator in expression!");
+		as_error("Invalid operator in expression!");
 		return (0);
 	}
 
@@ -918,7 +1144,7 @@ check_func_args(char *func_name)
 	}
 
 	/* output message */
-	error(string);
+	as_error(string);
 	return (0);
 }
 
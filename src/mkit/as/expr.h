@@ -6,6 +6,15 @@
 #define T_SYMBOL	4
 #define T_PC		5
 
+/* expression steps */
+#define E_VALUE		0	/* push a number */
+#define E_PC		1	/* push the program counter */
+#define E_SYMBOL	2	/* push a symbol */
+#define E_LOCAL		3	/* push a local symbol, found by name */
+#define E_KEYWORD	4	/* BANK(), HIGH(), ... starts */
+#define E_OP		5	/* apply an operator */
+#define E_STEPS		256
+
 /* operators */
 #define OP_START	0
 #define OP_OPEN		1
@@ -59,6 +68,8 @@ char *expr;			/* pointer to the expression string */
 char *expr_stack[16];		/* expression stack */
 struct t_symbol *expr_lablptr;	/* pointer to the lastest label */
 int expr_lablcnt;		/* number of label seen in an expression */
+struct t_estep expr_step[E_STEPS];	/* steps of the expression being parsed */
+int expr_nb = -1;		/* and their number, -1 = don't keep it */
 const char *keyword[8] = {	/* predefined functions */
 	"\7DEFINED",
 	"\4HIGH", "\3LOW",
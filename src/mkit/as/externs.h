@@ -39,32 +39,46 @@ extern int mcounter, mcntmax;
 extern int mcntstack[8];
 extern struct t_line *mstack[8];
 extern struct t_line *mlptr;
-extern struct t_macro *macro_tbl[256];
-extern struct t_macro *mptr;
-extern struct t_func *func_tbl[256];
+extern struct t_htab macro_tbl;
+extern struct t_macro *macro_ptr;
+extern int macro_gen;
+extern struct t_htab func_tbl;
 extern struct t_func *func_ptr;
 extern struct t_proc *proc_ptr;
+extern struct t_proc *proc_first;
+extern struct t_htab proc_tbl;
 extern int proc_nb;
+extern int call_ptr;
+extern int call_bank;
+extern struct t_branch *br_tbl;
+extern int br_nb;
+extern int br_idx;
 extern char func_arg[8][10][80];
 extern int func_idx;
+extern int func_gen;
 extern int infile_error;
 extern int infile_num;
+extern char incpath[10][128];
+extern char open_name[256];	/* file open_file() found */
 extern FILE *out_fp;		/* file pointers, output */
-extern FILE *in_fp;		/* input */
+extern char *in_buf;		/* in-memory main file */
+extern long in_buflen;
+extern struct t_ir *line_ir;	/* what is known about the current line */
+extern int line_plain;		/* and up to where */
 extern FILE *lst_fp;		/* listing */
 extern struct t_input_info input_file[8];
 extern struct t_machine *machine;
 extern struct t_machine nes;
 extern struct t_machine pce;
-extern struct t_opcode *inst_tbl[256];		/* instructions hash table */
-extern struct t_symbol *hash_tbl[256];		/* label hash table */
+extern struct t_htab hash_tbl;			/* label hash table */
+extern int sym_serial;				/* number of symbols created */
 extern struct t_symbol *lablptr;		/* label pointer into symbol table */
 extern struct t_symbol *glablptr;		/* pointer to the latest defined global symbol */
 extern struct t_symbol *lastlabl;		/* last label we have seen */
 extern struct t_symbol *bank_glabl[4][256];	/* latest global label in each bank */
 extern char hex[];				/* hexadecimal character buffer */
 extern int stop_pass;				/* stop the program; set by fatal_error() */
-extern int errcnt;				/* error counter */
+extern int as_errcnt;				/* error counter */
 extern void (*opproc)(int *);			/* instruction gen proc */
 extern int opflg;				/* instruction flags */
 extern int opval;				/* instruction value */
@@ -82,4 +96,6 @@ extern int xlist;				/* listing file main flag */
 extern int list_level;				/* output level */
 extern int asm_opt[8];				/* assembler option state */
 extern int opvaltab[6][16];
+extern int obj_rec;				/* recording an object */
+extern int obj_pending;				/* an object waits to be linked */
 
@@ -6,11 +6,12 @@
 #include "externs.h"
 #include "protos.h"
 
-struct t_func *func_tbl[256];
+struct t_htab func_tbl;
 struct t_func *func_ptr;
 char func_line[128];
 char func_arg[8][10][80];
 int func_idx;
+int func_gen;		/* bumped when a function is defined */
 
 
 /* ----
@@ -27,7 +28,7 @@ do_func(int *ip)
 	else {
 		/* error checking */
 		if (lablptr == NULL) {
-			error("No name for this function!");
+			as_error("No name for this function!");
 			return;
 		}
 		if (lablptr->refcnt) {
@@ -56,16 +57,10 @@ do_func(int *ip)
 int
 func_look(void)
 {
-	int hash;
-
 	/* search the function in the hash table */
-	hash = symhash();
-	func_ptr = func_tbl[hash];
-	while (func_ptr) {
-		if (!strcmp(&symbol[1], func_ptr->name))
-			break;
-		func_ptr = func_ptr->next;
-	}
+	func_ptr = htab_find(&func_tbl, &symbol[1], sym_hash());
+	if (obj_rec)
+		obj_func(func_ptr);
 
 	/* ok */
 	if (func_ptr)
@@ -80,14 +75,12 @@ func_look(void)
 int
 func_install(int ip)
 {
-	int hash;
-
 	/* mark the function name as reserved */
 	lablptr->type = FUNC;
 
 	/* check function name syntax */
 	if (strchr(&symbol[1], '.')) {
-		error("Invalid function name!");
+		as_error("Invalid function name!");
 		return (0);
 	}
 
@@ -97,19 +90,17 @@ func_install(int ip)
 
 	/* allocate a new func struct */
 	if ((func_ptr = (void *)malloc(sizeof(struct t_func))) == NULL) {
-		error("Out of memory!");
+		as_error("Out of memory!");
 		return (0);
 	}
 
 	/* initialize it */
 	strcpy(func_ptr->name, &symbol[1]);
 	strcpy(func_ptr->line, func_line);
-	hash = symhash();
-	func_ptr->next = func_tbl[hash];
-	func_tbl[hash] = func_ptr;
+	func_ptr->gen = ++func_gen;
 
 	/* ok */
-	return (1);
+	return (htab_insert(&func_tbl, func_ptr, sym_hash()));
 }
 
 /* extract function body */
@@ -148,7 +139,7 @@ func_extract(int ip)
 			i++;
 			c = prlnbuf[ip++];
 			if ((c < '1') || (c > '9')) {
-				error("Invalid function argument!");
+				as_error("Invalid function argument!");
 				return (-1);
 			}
 			arg = c - '1';
@@ -160,7 +151,7 @@ func_extract(int ip)
 			*ptr++ = c;
 			i++;
 			if (i == 127) {
-				error("Function line too long!");
+				as_error("Function line too long!");
 				return (-1);
 			}
 			break;
@@ -182,7 +173,7 @@ func_getargs(void)
 
 	/* can not nest too much macros */
 	if (func_idx == 7) {
-		error("Too many nested function calls!");
+		as_error("Too many nested function calls!");
 		return (0);
 	}
 
@@ -215,7 +206,7 @@ func_getargs(void)
 			arg++;
 			ptr = func_arg[func_idx][arg];
 			if (arg == 9) {
-				error("Too many arguments for a function!");
+				as_error("Too many arguments for a function!");
 				return (0);
 			}
 			break;
@@ -223,7 +214,7 @@ func_getargs(void)
 		/* end of line */
 		case ';':
 		case '\0':
-			error("Syntax error in function call!");
+			as_error("Syntax error in function call!");
 			return (0);
 
 		/* end of function */
@@ -256,12 +247,12 @@ func_getargs(void)
 				}
 				else if (c == '\\') {
 					if (func_idx == 0) {
-						error("Syntax error!");
+						as_error("Syntax error!");
 						return (0);
 					}
 					c = *expr++;
 					if (c < '1' || c > '9') {
-						error("Invalid function argument index!");
+						as_error("Invalid function argument index!");
 						return (0);
 					}
 					line = func_arg[func_idx - 1][c - '1'];
@@ -292,7 +283,7 @@ func_getargs(void)
 					ptr[i++] = c;
 				}
 				if (i == 80) {
-					error("Invalid function argument length!");
+					as_error("Invalid function argument length!");
 					return (0);
 				}
 				x++;
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "defs.h"
+#include "externs.h"
+#include "protos.h"
+
+/* the label, macro, function and proc tables: open addressing with
+ * linear probing, kept at most half full so that probes stay short;
+ * each slot holds an entry and the full hash of its name
+ */
+
+static int htab_grow(struct t_htab *ht);
+
+
+/* ----
+ * strhash()
+ * ----
+ * FNV-1a hash of a name
+ */
+
+unsigned int
+strhash(const char *name, int len)
+{
+	unsigned int hash = 2166136261U;
+	int i;
+
+	for (i = 0; i < len; i++)
+		hash = (hash ^ (unsigned char)name[i]) * 16777619U;
+
+	return (hash);
+}
+
+
+/* ----
+ * htab_init()
+ * ----
+ * empty a table; its entries keep their name at <name_ofs>
+ */
+
+void
+htab_init(struct t_htab *ht, char *title, int name_ofs)
+{
+	free(ht->slot);
+	free(ht->hash);
+	memset(ht, 0, sizeof(struct t_htab));
+	ht->title = title;
+	ht->name_ofs = name_ofs;
+}
+
+
+/* ----
+ * htab_find()
+ * ----
+ * search the entry called <name>, return NULL if there is none
+ */
+
+void *
+htab_find(struct t_htab *ht, const char *name, unsigned int hash)
+{
+	void *entry;
+	int mask;
+	int i, n;
+
+	if (ht->size == 0)
+		return (NULL);
+
+	mask = ht->size - 1;
+	i = hash & mask;
+	for (n = 1; (entry = ht->slot[i]) != NULL; n++) {
+		if (ht->hash[i] == hash && !strcmp(name, (char *)entry + ht->name_ofs))
+			break;
+		i = (i + 1) & mask;
+	}
+
+	/* statistics */
+	ht->lookups++;
+	ht->probes += n;
+	if (ht->max_probe < n)
+		ht->max_probe = n;
+
+	return (entry);
+}
+
+
+/* ----
+ * htab_insert()
+ * ----
+ * add an entry that isn't in the table yet
+ */
+
+int
+htab_insert(struct t_htab *ht, void *entry, unsigned int hash)
+{
+	int mask;
+	int i;
+
+	if ((ht->count + 1) * 2 > ht->size) {
+		if (!htab_grow(ht)) {
+			fatal_error("Out of memory!");
+			return (0);
+		}
+	}
+
+	mask = ht->size - 1;
+	i = hash & mask;
+	while (ht->slot[i])
+		i = (i + 1) & mask;
+	ht->slot[i] = entry;
+	ht->hash[i] = hash;
+	ht->count++;
+
+	return (1);
+}
+
+
+/* ----
+ * htab_grow()
+ * ----
+ * double the number of slots
+ */
+
+static int
+htab_grow(struct t_htab *ht)
+{
+	unsigned int *hash;
+	void **slot;
+	int size, mask;
+	int i, j;
+
+	size = ht->size ? ht->size * 2 : 256;
+	mask = size - 1;
+	slot = calloc(size, sizeof(void *));
+	hash = malloc(size * sizeof(unsigned int));
+	if (slot == NULL || hash == NULL) {
+		free(slot);
+		free(hash);
+		return (0);
+	}
+
+	/* move the entries */
+	for (i = 0; i < ht->size; i++) {
+		if (ht->slot[i] == NULL)
+			continue;
+		j = ht->hash[i] & mask;
+		while (slot[j])
+			j = (j + 1) & mask;
+		slot[j] = ht->slot[i];
+		hash[j] = ht->hash[i];
+	}
+
+	free(ht->slot);
+	free(ht->hash);
+	ht->slot = slot;
+	ht->hash = hash;
+	ht->size = size;
+	ht->grows++;
+
+	return (1);
+}
+
+
+/* ----
+ * htab_stats()
+ * ----
+ * show the size and the load of a table, and how many
+ * slots its lookups had to look at
+ */
+
+void
+htab_stats(struct t_htab *ht)
+{
+	printf("%-10s %7i %7i  %3i%%  %8li  %6.2f  %4i  %5i\n",
+		ht->title, ht->count, ht->size,
+		ht->size ? (ht->count * 100) / ht->size : 0,
+		ht->lookups,
+		ht->lookups ? (double)ht->probes / ht->lookups : 0.0,
+		ht->max_probe, ht->grows);
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <time.h>
 #include <sys/stat.h>
 #include "defs.h"
 #include "externs.h"
@@ -11,16 +12,27 @@ int infile_error;
 int infile_num;
 struct t_input_info input_file[8];
 char incpath[10][128];
+char open_name[256];	/* file open_file() found */
+char *in_buf;		/* in-memory main file (see pceas_assemble()) */
+long in_buflen;
+struct t_ir *line_ir;	/* what is known about the current line */
+int line_plain;		/* prlnbuf index up to which it is the same text */
+static struct t_source *sources;
+static struct t_source **sources_end = &sources;
+static struct t_source *timed_src;	/* file the clock runs for */
+static clock_t timed_start;
+
+static void time_source(struct t_source *src);
 
 
 /* ----
- * init_path()
+ * init_incpath()
  * ----
  * init the include path
  */
 
 void
-init_path(void)
+init_incpath(void)
 {
 	const char *p, *pl;
 	int i, l;
@@ -52,15 +64,16 @@ init_path(void)
 
 
 /* ----
- * readline()
+ * read_line()
  * ----
  * read and format an input line.
  */
 
 int
-readline(void)
+read_line(void)
 {
-	char *ptr, *arg, num[8];
+	struct t_source *src;
+	char *ptr, *arg, num[12];
 	int j, n;
 	int i;		/* pointer into prlnbuf */
 	int c;		/* current character		*/
@@ -100,8 +113,7 @@ start:
 
 					/* \@ */
 					if (c == '@') {
-						n = 5;
-						sprintf(num, "%05i", mcounter);
+						n = sprintf(num, "%05i", mcounter);
 						arg = num;
 					}
 
@@ -124,7 +136,7 @@ start:
 							arg = num;
 						}
 						else {
-							error("Invalid macro argument index!");
+							as_error("Invalid macro argument index!");
 							return (-1);
 						}
 					}
@@ -138,13 +150,13 @@ start:
 
 					/* unknown macro special command */
 					else {
-						error("Invalid macro argument index!");
+						as_error("Invalid macro argument index!");
 						return (-1);
 					}
 
 					/* check for line overflow */
 					if ((i + n) >= LAST_CH_POS - 1) {
-						error("Invalid line length!");
+						as_error("Invalid line length!");
 						return (-1);
 					}
 
@@ -156,7 +168,10 @@ start:
 					i = LAST_CH_POS - 1;
 			}
 			prlnbuf[i] = '\0';
+			line_ir = &mlptr->ir;
+			line_plain = SFIELD + mlptr->plain;
 			mlptr = mlptr->next;
+			input_file[infile_num].src->nb_read++;
 			return (0);
 		}
 	}
@@ -172,34 +187,201 @@ start:
 	}
 
 	/* get a line */
-	i = SFIELD;
-	c = getc_unlocked(in_fp);
-	if (c == EOF) {
-		if (close_input())
+	src = input_file[infile_num].src;
+	if (input_file[infile_num].line == src->nb_lines) {
+		if (close_input()) {
+			time_source(NULL);
 			return (-1);
+		}
 		goto start;
 	}
-	for (;;) {
-		/* check for the end of line */
-		if (c == '\r') {
-			c = getc_unlocked(in_fp);
-			if (c == '\n' || c == EOF)
-				break;
-			ungetc(c, in_fp);
-			break;
+	n = input_file[infile_num].line++;
+	ptr = &src->text[src->start[n]];
+	i = SFIELD;
+	while (*ptr && i < LAST_CH_POS)
+		prlnbuf[i++] = *ptr++;
+	prlnbuf[i] = '\0';
+	line_ir = &src->ir[n];
+	line_plain = LAST_CH_POS + 1;
+	src->nb_read++;
+	return (0);
+}
+
+
+/* ----
+ * load_source()
+ * ----
+ * read a source file whole and split it in lines; a file read
+ * by an earlier pass is only looked up
+ */
+
+static struct t_source *
+load_source(char *name)
+{
+	struct t_source *src;
+	FILE *fp;
+	char *text, *p, *end;
+	long len;
+	int n;
+
+	for (src = sources; src; src = src->next)
+		if (!strcmp(src->name, name))
+			return (src);
+
+	/* read the file */
+	if (infile_num == 0 && in_buf) {
+		len = in_buflen;
+		text = malloc(len + 1);
+		if (text)
+			memcpy(text, in_buf, len);
+		open_name[0] = '\0';
+	}
+	else {
+		if ((fp = open_file(name, "rb")) == NULL)
+			return (NULL);
+		fseek(fp, 0, SEEK_END);
+		len = ftell(fp);
+		rewind(fp);
+		text = malloc(len + 1);
+		if (text && fread(text, 1, len, fp) != (size_t)len) {
+			free(text);
+			text = NULL;
 		}
-		if (c == '\n' || c == EOF)
-			break;
+		fclose(fp);
+	}
+	if (text == NULL)
+		return (NULL);
+	end = &text[len];
+	*end = '\0';
+
+	/* count the lines, at most one per end of line */
+	n = 1;
+	for (p = text; p < end; p++)
+		if (*p == '\n' || *p == '\r')
+			n++;
+
+	src = malloc(sizeof(struct t_source));
+	if (src == NULL) {
+		free(text);
+		return (NULL);
+	}
+	src->text = text;
+	src->hash = obj_hash(text, len);
+	strcpy(src->path, open_name);
+	src->start = malloc(n * sizeof(int));
+	src->ir = calloc(n, sizeof(struct t_ir));
+	if (src->start == NULL || src->ir == NULL) {
+		free(src->start);
+		free(src->ir);
+		free(src);
+		free(text);
+		return (NULL);
+	}
+
+	/* split them; lines end with LF, CR LF or CR */
+	n = 0;
+	p = text;
+	while (p < end) {
+		src->start[n++] = p - text;
+		while (p < end && *p != '\n' && *p != '\r')
+			p++;
+		if (p < end) {
+			if (*p == '\r' && p[1] == '\n')
+				*p++ = '\0';
+			*p++ = '\0';
+		}
+	}
+	src->nb_lines = n;
+	src->nb_read = 0;
+	src->ticks = 0;
+	strcpy(src->name, name);
+	src->next = NULL;
+	*sources_end = src;
+	sources_end = &src->next;
+	return (src);
+}
+
+
+/* ----
+ * time_source()
+ * ----
+ * charge the time since the last call to the file that was
+ * being read, and start counting for <src>
+ */
+
+static void
+time_source(struct t_source *src)
+{
+	clock_t now = clock();
+
+	if (timed_src)
+		timed_src->ticks += now - timed_start;
+	timed_src = src;
+	timed_start = now;
+}
+
 
-		/* store char in the line buffer */
-		prlnbuf[i] = c;
-		i += (i < LAST_CH_POS) ? 1 : 0;
+/* ----
+ * show_source_stats()
+ * ----
+ * show what each source file cost, both passes together
+ */
 
-		/* get next char */
-		c = getc_unlocked(in_fp);
+void
+show_source_stats(void)
+{
+	struct t_source *src;
+
+	printf("source files:\n");
+	printf("\n");
+	printf("   lines  assembled      ms  file\n");
+	for (src = sources; src; src = src->next) {
+		printf("%8i  %9li  %6.1f  %s\n", src->nb_lines, src->nb_read,
+			src->ticks * 1000.0 / CLOCKS_PER_SEC, src->name);
 	}
-	prlnbuf[i] = '\0';
-	return (0);
+	printf("\n");
+}
+
+
+/* ----
+ * free_sources()
+ * ----
+ * forget the source files at the end of the assembly
+ */
+
+void
+free_sources(void)
+{
+	struct t_source *src;
+	int i;
+
+	while ((src = sources) != NULL) {
+		sources = src->next;
+		for (i = 0; i < src->nb_lines; i++)
+			expr_free(src->ir[i].expr);
+		free(src->text);
+		free(src->start);
+		free(src->ir);
+		free(src);
+	}
+	sources_end = &sources;
+	timed_src = NULL;
+	line_ir = NULL;
+}
+
+
+/* ----
+ * rewind_input()
+ * ----
+ * start the main file over for the next pass
+ */
+
+void
+rewind_input(void)
+{
+	input_file[infile_num].line = 0;
+	slnum = 0;
+	time_source(input_file[infile_num].src);
 }
 
 /* ----
@@ -211,22 +393,20 @@ start:
 int
 open_input(char *name)
 {
-	FILE *fp;
+	struct t_source *src;
 	char *p;
 	char temp[128];
 	int i;
 
 	/* only 7 nested input files */
 	if (infile_num == 7) {
-		error("Too many include levels, max. 7!");
+		as_error("Too many include levels, max. 7!");
 		return (1);
 	}
 
 	/* backup current input file infos */
-	if (infile_num) {
+	if (infile_num)
 		input_file[infile_num].lnum = slnum;
-		input_file[infile_num].fp = in_fp;
-	}
 
 	/* get a copy of the file name */
 	strcpy(temp, name);
@@ -244,21 +424,24 @@ open_input(char *name)
 	if (infile_num) {
 		for (i = 1; i < infile_num; i++) {
 			if (!strcmp(input_file[i].name, temp)) {
-				error("Repeated include file!");
+				as_error("Repeated include file!");
 				return (1);
 			}
 		}
 	}
 
 	/* open the file */
-	if ((fp = open_file(temp, "r")) == NULL)
+	if ((src = load_source(temp)) == NULL)
 		return (-1);
+	if (obj_rec)
+		obj_source(src);
 
 	/* update input file infos */
-	in_fp = fp;
 	slnum = 0;
 	infile_num++;
-	input_file[infile_num].fp = fp;
+	input_file[infile_num].src = src;
+	input_file[infile_num].line = 0;
+	time_source(src);
 	input_file[infile_num].if_level = if_level;
 	strcpy(input_file[infile_num].name, temp);
 	if ((pass == LAST_PASS) && (xlist) && (list_level))
@@ -293,13 +476,14 @@ close_input(void)
 	if (infile_num <= 1)
 		return (-1);
 
-	fclose(in_fp);
 	infile_num--;
 	infile_error = -1;
 	slnum = input_file[infile_num].lnum;
-	in_fp = input_file[infile_num].fp;
+	time_source(input_file[infile_num].src);
 	if ((pass == LAST_PASS) && (xlist) && (list_level))
 		fprintf(lst_fp, "#[%i]   %s\n", infile_num, input_file[infile_num].name);
+	if (obj_rec)
+		obj_close();
 
 	/* ok */
 	return (0);
@@ -320,7 +504,10 @@ open_file(char *name, char *mode)
 	int i;
 
 	fileptr = fopen(name, mode);
-	if (fileptr != NULL) return (fileptr);
+	if (fileptr != NULL) {
+		strcpy(open_name, name);
+		return (fileptr);
+	}
 
 	for (i = 0; i < 10; i++) {
 		if (strlen(incpath[i])) {
@@ -328,7 +515,10 @@ open_file(char *name, char *mode)
 			strcat(testname, name);
 
 			fileptr = fopen(testname, mode);
-			if (fileptr != NULL) break;
+			if (fileptr != NULL) {
+				strcpy(open_name, testname);
+				break;
+			}
 		}
 	}
 
@@ -1,6 +1,6 @@
 /* instruction table */
 /* *INDENT-OFF* */
-struct t_opcode base_inst[57] = {
+struct t_opcode base_inst[65] = {
 	{NULL, "ADC", class4, IMM|ZP|ZP_X|ZP_IND|ZP_IND_X|ZP_IND_Y|ABS|ABS_X|ABS_Y, 0x61, 0},
 	{NULL, "AND", class4, IMM|ZP|ZP_X|ZP_IND|ZP_IND_X|ZP_IND_Y|ABS|ABS_X|ABS_Y, 0x21, 0},
 	{NULL, "ASL", class4, ACC|ZP|ZP_X|ABS|ABS_X, 0x02, 0},
@@ -28,6 +28,14 @@ struct t_opcode base_inst[57] = {
 	{NULL, "INC", class4, ACC|ZP|ZP_X|ABS|ABS_X, 0x00, 4},
 	{NULL, "INX", class1, 0, 0xE8, 0},
 	{NULL, "INY", class1, 0, 0xC8, 0},
+	{NULL, "JBCC", class11, 0, 0x90, 0},
+	{NULL, "JBCS", class11, 0, 0xB0, 0},
+	{NULL, "JBEQ", class11, 0, 0xF0, 0},
+	{NULL, "JBMI", class11, 0, 0x30, 0},
+	{NULL, "JBNE", class11, 0, 0xD0, 0},
+	{NULL, "JBPL", class11, 0, 0x10, 0},
+	{NULL, "JBVC", class11, 0, 0x50, 0},
+	{NULL, "JBVS", class11, 0, 0x70, 0},
 	{NULL, "JMP", class4, ABS|ABS_IND|ABS_IND_X, 0x40, 0},
 	{NULL, "JSR", class4, ABS, 0x14, 0},
 	{NULL, "LDA", class4, IMM|ZP|ZP_X|ZP_IND|ZP_IND_X|ZP_IND_Y|ABS|ABS_X|ABS_Y, 0xA1, 0},
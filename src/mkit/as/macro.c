@@ -15,8 +15,11 @@ int mcounter, mcntmax;
 int mcntstack[8];
 struct t_line *mstack[8];
 struct t_line *mlptr;
-struct t_macro *macro_tbl[256];
-struct t_macro *mptr;
+struct t_htab macro_tbl;
+struct t_macro *macro_ptr;
+int macro_gen;		/* bumped when a macro is defined */
+
+static struct t_macro *macro_scan(int *ip);
 
 /* .macro pseudo */
 
@@ -28,7 +31,7 @@ do_macro(int *ip)
 	else {
 		/* error checking */
 		if (expand_macro) {
-			error("Can not nest macro definitions!");
+			as_error("Can not nest macro definitions!");
 			return;
 		}
 		if (lablptr == NULL) {
@@ -38,7 +41,7 @@ do_macro(int *ip)
 
 			/* search a label after the .macro */
 			if (colsym(ip) == 0) {
-				error("No name for this macro!");
+				as_error("No name for this macro!");
 				return;
 			}
 
@@ -76,24 +79,45 @@ do_macro(int *ip)
 void
 do_endm(int *ip)
 {
-	error("Unexpected ENDM!");
+	as_error("Unexpected ENDM!");
 	return;
 }
 
-/* search a macro in the hash table */
+/* search a macro in the hash table, or take what an earlier look at
+ * the same place of the line found if no macro was defined since
+ */
 
 struct t_macro *
 macro_look(int *ip)
+{
+	struct t_ir *ir = line_ir;
+	struct t_macro *ptr;
+	int pos = *ip;
+
+	if (ir && ir->mac_pos == pos && ir->mac_gen == macro_gen && !obj_rec) {
+		*ip = ir->mac_end;
+		return (ir->mac);
+	}
+	ptr = macro_scan(ip);
+	if (ir && *ip < line_plain) {
+		ir->mac_pos = pos;
+		ir->mac_end = *ip;
+		ir->mac_gen = macro_gen;
+		ir->mac = ptr;
+	}
+	return (ptr);
+}
+
+static struct t_macro *
+macro_scan(int *ip)
 {
 	struct t_macro *ptr;
 	char name[32];
 	char c;
-	int hash;
 	int l;
 
-	/* calculate the symbol hash value and check syntax */
+	/* check syntax */
 	l = 0;
-	hash = 0;
 	for (;;) {
 		c = prlnbuf[*ip];
 		if (c == '\0' || c == ' ' || c == '\t' || c == ';')
@@ -109,21 +133,14 @@ macro_look(int *ip)
 		if (l == 31)
 			return (NULL);
 		name[l++] = c;
-		hash += c;
 		(*ip)++;
 	}
 	name[l] = '\0';
-	hash &= 0xFF;
 
-	/* browse the hash table */
-	ptr = macro_tbl[hash];
-	while (ptr) {
-		if (!strcmp(name, ptr->name))
-			break;
-		ptr = ptr->next;
-	}
-
-	/* return result */
+	/* search the hash table */
+	ptr = htab_find(&macro_tbl, name, strhash(name, l));
+	if (obj_rec)
+		obj_macro(ptr, name);
 	return (ptr);
 }
 
@@ -139,7 +156,7 @@ macro_getargs(int ip)
 
 	/* can not nest too much macros */
 	if (midx == 7) {
-		error("Too many nested macro calls!");
+		as_error("Too many nested macro calls!");
 		return (0);
 	}
 
@@ -165,7 +182,7 @@ macro_getargs(int ip)
 			arg++;
 			ptr = marg[midx][arg];
 			if (arg == 9) {
-				error("Too many arguments for a macro!");
+				as_error("Too many arguments for a macro!");
 				return (0);
 			}
 			break;
@@ -180,11 +197,11 @@ macro_getargs(int ip)
 			for (;;) {
 				t = prlnbuf[ip++];
 				if (t == '\0') {
-					error("Unterminated string!");
+					as_error("Unterminated string!");
 					return (0);
 				}
 				if (i == 80) {
-					error("String too long, max. 80 characters!");
+					as_error("String too long, max. 80 characters!");
 					return (0);
 				}
 				if (t == c)
@@ -206,7 +223,7 @@ macro_getargs(int ip)
 				break;
 
 			default:
-				error("Syntax error!");
+				as_error("Syntax error!");
 				return (0);
 			}
 
@@ -235,7 +252,7 @@ macro_getargs(int ip)
 				}
 
 				/* read a new line */
-				if (readline() == -1)
+				if (read_line() == -1)
 					return (0);
 
 				/* rewind line pointer and continue */
@@ -279,7 +296,7 @@ macro_getargs(int ip)
 					ptr[i++] = c;
 				}
 				if (i == 80) {
-					error("Macro argument string too long, max. 80 characters!");
+					as_error("Macro argument string too long, max. 80 characters!");
 					return (0);
 				}
 				j++;
@@ -301,7 +318,7 @@ macro_getargs(int ip)
 
 						/* check string length */
 						if (strlen(ptr) > 75) {
-							error("Macro argument string too long, max. 80 characters!");
+							as_error("Macro argument string too long, max. 80 characters!");
 							return (0);
 						}
 
@@ -323,44 +340,32 @@ macro_getargs(int ip)
 int
 macro_install(void)
 {
-	char c;
-	int hash = 0;
-	int i;
-
 	/* mark the macro name as reserved */
 	lablptr->type = MACRO;
 
 	/* check macro name syntax */
 	/*
 	   if (strchr(&symbol[1], '.')) {
-	        error("Invalid macro name!");
+	        as_error("Invalid macro name!");
 	        return (0);
 	   }
 	 */
 
-	/* calculate symbol hash value */
-	for (i = 1; i <= symbol[0]; i++) {
-		c = symbol[i];
-		hash += c;
-	}
-	hash &= 0xFF;
-
 	/* allocate a macro struct */
-	mptr = (void *)malloc(sizeof(struct t_macro));
-	if (mptr == NULL) {
-		error("Out of memory!");
+	macro_ptr = (void *)malloc(sizeof(struct t_macro));
+	if (macro_ptr == NULL) {
+		as_error("Out of memory!");
 		return (0);
 	}
 
 	/* initialize it */
-	strcpy(mptr->name, &symbol[1]);
-	mptr->line = NULL;
-	mptr->next = macro_tbl[hash];
-	macro_tbl[hash] = mptr;
+	strcpy(macro_ptr->name, &symbol[1]);
+	macro_ptr->line = NULL;
 	mlptr = NULL;
+	macro_ptr->gen = ++macro_gen;
 
 	/* ok */
-	return (1);
+	return (htab_insert(&macro_tbl, macro_ptr, sym_hash()));
 }
 
 /* send back the addressing mode of a macro arg */
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <strings.h>
 #include <string.h>
+#include <stddef.h>
 #include <ctype.h>
 #include "defs.h"
 #include "externs.h"
@@ -31,6 +32,7 @@
 #include "vars.h"
 #include "inst.h"
 #include "../../../include/overlay.h"
+#include "pceas.h"
 
 /* defines */
 #define STANDARD_CD	1
@@ -45,13 +47,13 @@ char lst_fname[128];	/* listing */
 char sym_fname[128];	/* symbol table */
 char zeroes[2048];	/* CDROM sector full of zeores */
 char *prg_name;		/* program name */
-FILE *in_fp;		/* file pointers, input */
 FILE *lst_fp;		/* listing */
 char section_name[4][8] = {
 	"  ZP", " BSS", "CODE", "DATA"
 };
 int dump_seg;
-int overlayflag;
+int stats_opt;
+static int overlayflag;
 int develo_opt;
 int header_opt;
 int srec_opt;
@@ -67,12 +69,14 @@ int zero_need;		/* counter for trailing empty sectors on CDROM */
 
 
 /* ----
- * main()
+ * pceas_main()
  * ----
+ * assembler entry point, called with the command line arguments
+ * (see cli.c)
  */
 
 int
-main(int argc, char **argv)
+pceas_main(int argc, char **argv)
 {
 	FILE *fp, *ipl;
 	char *p;
@@ -127,6 +131,10 @@ main(int argc, char **argv)
 				else if (!strcmp(argv[i], "-S"))
 					dump_seg = 2;
 
+				/* hash table statistics */
+				else if (!strcmp(argv[i], "-stats"))
+					stats_opt = 1;
+
 				/* forces macros expansion */
 				else if (!strcmp(argv[i], "-m"))
 					mlist_opt = 1;
@@ -239,7 +247,10 @@ main(int argc, char **argv)
 		strcat(in_fname, ".asm");
 
 	/* init include path */
-	init_path();
+	init_incpath();
+
+	/* and the object cache */
+	obj_init();
 
 	/* init crc functions */
 	crc_init();
@@ -255,12 +266,10 @@ main(int argc, char **argv)
 	memset(map, 0xFF, 8192 * 128);
 
 	/* clear symbol hash tables */
-	for (i = 0; i < 256; i++) {
-		hash_tbl[i] = NULL;
-		macro_tbl[i] = NULL;
-		func_tbl[i] = NULL;
-		inst_tbl[i] = NULL;
-	}
+	htab_init(&hash_tbl, "labels", offsetof(struct t_symbol, name));
+	htab_init(&macro_tbl, "macros", offsetof(struct t_macro, name));
+	htab_init(&func_tbl, "functions", offsetof(struct t_func, name));
+	htab_init(&proc_tbl, "procs", offsetof(struct t_proc, name));
 
 	/* fill the instruction hash table */
 	addinst(base_inst);
@@ -269,6 +278,7 @@ main(int argc, char **argv)
 	/* add machine specific instructions and pseudos */
 	addinst(machine->inst);
 	addinst(machine->pseudo_inst);
+	inst_hash();
 
 	/* predefined symbols */
 	lablset("MAGICKIT", 1);
@@ -286,7 +296,8 @@ main(int argc, char **argv)
 	rom_limit = 0x100000;		/* 1MB */
 	bank_limit = 0x7F;
 	bank_base = 0;
-	errcnt = 0;
+	br_nb = 0;
+	as_errcnt = 0;
 
 	if (cd_opt) {
 		rom_limit = 0x10000;	/* 64KB */
@@ -315,6 +326,7 @@ main(int argc, char **argv)
 		skip_lines = 0;
 		rsbase = 0;
 		proc_nb = 0;
+		br_idx = 0;
 
 		/* reset assembler options */
 		asm_opt[OPT_LIST] = 0;
@@ -359,8 +371,12 @@ main(int argc, char **argv)
 		printf("pass %i\n", pass + 1);
 
 		/* assemble */
-		while (readline() != -1) {
-			assemble(0);
+		while (read_line() != -1) {
+			if (obj_rec)
+				obj_line(0);
+			assemble_line(0);
+			if (obj_rec)
+				obj_line(1);
 			if (loccnt > 0x2000) {
 				loccnt &= 0x1fff;
 				page++;
@@ -370,15 +386,19 @@ main(int argc, char **argv)
 			}
 			if (stop_pass)
 				break;
+			if (obj_pending)
+				obj_replay();
 		}
 
-		/* relocate procs */
-		if (pass == FIRST_PASS)
+		/* relax branches and relocate procs */
+		if (pass == FIRST_PASS) {
+			relax_resolve();
 			proc_reloc();
+		}
 
 		/* abord pass on errors */
-		if (errcnt) {
-			printf("# %d error(s)\n", errcnt);
+		if (as_errcnt) {
+			printf("# %d as_error(s)\n", as_errcnt);
 			exit(1);
 			// break;
 		}
@@ -402,7 +422,7 @@ main(int argc, char **argv)
 		}
 
 		/* rewind input file */
-		rewind(in_fp);
+		rewind_input();
 
 		/* open the listing file */
 		if (pass == FIRST_PASS) {
@@ -417,7 +437,7 @@ main(int argc, char **argv)
 	}
 
 	/* rom */
-	if (errcnt == 0) {
+	if (as_errcnt == 0) {
 		/* cd-rom */
 		if (cd_opt || scd_opt) {
 			/* open output file */
@@ -536,9 +556,6 @@ main(int argc, char **argv)
 	if (xlist && list_level)
 		fclose(lst_fp);
 
-	/* close input file */
-	fclose(in_fp);
-
 	/* dump the symbol table */
 	if ((fp = fopen(sym_fname, "w")) != NULL) {
 		labldump(fp);
@@ -548,12 +565,40 @@ main(int argc, char **argv)
 	/* dump the bank table */
 	if (dump_seg)
 		show_seg_usage();
+	if (dump_seg == 2)
+		show_proc_usage();
+
+	/* where the time went, and how the symbol tables did */
+	if (stats_opt) {
+		show_source_stats();
+		show_hash_stats();
+		obj_stats();
+	}
+
+	/* forget the input files */
+	free_sources();
 
 	/* ok */
 	return (0);
 }
 
 
+/* ----
+ * pceas_assemble()
+ * ----
+ * same as pceas_main(), but the source file named on the command
+ * line is read from memory instead of from disk
+ */
+
+int
+pceas_assemble(int argc, char **argv, char *src, long len)
+{
+	in_buf = src;
+	in_buflen = len;
+	return (pceas_main(argc, argv));
+}
+
+
 /* ----
  * calc_bank_base()
  * ----
@@ -606,6 +651,7 @@ help(void)
 	/* display help */
 	printf("%s [-options] [-? (for help)] infile\n\n", prg_name);
 	printf("-s/S       : show segment usage\n");
+	printf("-stats     : show time per source file, hash table use\n");
 	printf("-l #       : listing file output level (0-3)\n");
 	printf("-m         : force macro expansion in listing\n");
 	printf("-raw       : prevent adding a ROM header\n");
@@ -729,3 +775,22 @@ show_seg_usage(void)
 	printf("\n\t\t\tTOTAL SIZE =     %4iK\n", (rom_used + rom_free));
 }
 
+
+/* ----
+ * show_hash_stats()
+ * ----
+ */
+
+void
+show_hash_stats(void)
+{
+	printf("hash tables:\n");
+	printf("\n");
+	printf("           entries   slots  load   lookups  probes   max  grows\n");
+	htab_stats(&hash_tbl);
+	htab_stats(&macro_tbl);
+	htab_stats(&func_tbl);
+	htab_stats(&proc_tbl);
+	printf("\n");
+}
+
@@ -116,7 +116,7 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 			snd_octave = mml_get_value(&ptr);
 
 			if ((snd_octave < 1) || (snd_octave > 7)) {
-				error("Incorrect octave!");
+				as_error("Incorrect octave!");
 				return (-1);
 			}
 			break;
@@ -126,7 +126,7 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 			snd_volume = mml_get_value(&ptr);
 
 			if (snd_volume > 15) {
-				error("Incorrect volume!");
+				as_error("Incorrect volume!");
 				return (-1);
 			}
 
@@ -141,7 +141,7 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 			snd_tempo = mml_get_value(&ptr);
 
 			if ((snd_tempo < 32) || (snd_tempo > 256)) {
-				error("Incorrect tempo!");
+				as_error("Incorrect tempo!");
 				return (-1);
 			}
 			break;
@@ -151,7 +151,7 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 			snd_length = mml_get_length(&ptr);
 
 			if (!snd_length) {
-				error("Incorrect note length!");
+				as_error("Incorrect note length!");
 				return (-1);
 			}
 			break;
@@ -188,7 +188,7 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 
 			/* check length */
 			if (!len) {
-				error("Incorrect note length!");
+				as_error("Incorrect note length!");
 				return (-1);
 			}
 
@@ -237,7 +237,7 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 
 			/* check length */
 			if (!len) {
-				error("Incorrect note length!");
+				as_error("Incorrect note length!");
 				return (-1);
 			}
 
@@ -255,14 +255,14 @@ mml_parse(unsigned char *buffer, int bufsize, char *ptr)
 			snd_wave_flag = 1;
 
 			if ((snd_wave < 1) || (snd_wave > 3)) {
-				error("Incorrect waveform!");
+				as_error("Incorrect waveform!");
 				return (-1);
 			}
 			break;
 
 		/* other */
 		default:
-			error("Syntax error!");
+			as_error("Syntax error!");
 			return (-1);
 		}
 
@@ -107,12 +107,12 @@ nes_pack_8x8_tile(unsigned char *buffer, void *data, int line_offset, int format
 
 		/* error message */
 		if (err)
-			error("Incorrect pixel color index!");
+			as_error("Incorrect pixel color index!");
 		break;
 
 	default:
 		/* other formats not supported */
-		error("Internal error: unsupported format passed to 'pack_8x8_tile'!");
+		as_error("Internal error: unsupported format passed to 'pack_8x8_tile'!");
 		break;
 	}
 
@@ -178,7 +178,7 @@ nes_inesprg(int *ip)
 		return;
 
 	if ((value < 0) || (value > 64)) {
-		error("Prg bank value out of range!");
+		as_error("Prg bank value out of range!");
 
 		return;
 	}
@@ -204,7 +204,7 @@ nes_ineschr(int *ip)
 		return;
 
 	if ((value < 0) || (value > 64)) {
-		error("Prg bank value out of range!");
+		as_error("Prg bank value out of range!");
 
 		return;
 	}
@@ -230,7 +230,7 @@ nes_inesmap(int *ip)
 		return;
 
 	if ((value < 0) || (value > 255)) {
-		error("Mapper value out of range!");
+		as_error("Mapper value out of range!");
 
 		return;
 	}
@@ -258,7 +258,7 @@ nes_inesmir(int *ip)
 		return;
 
 	if ((value < 0) || (value > 15)) {
-		error("Mirror value out of range!");
+		as_error("Mirror value out of range!");
 
 		return;
 	}
@@ -46,6 +46,7 @@ struct t_machine nes = {
 	NES_ASM_VERSION,	/* asm_title */
 	".nes",			/* rom_ext */
 	"NES_INCLUDE",		/* include_env */
+	"NES_OBJ_DIR",		/* obj_env */
 	defdirs_nes,		/* default_dirs */
 	0x100,			/* zp_limit */
 	0x800,			/* ram_limit */
@@ -0,0 +1,2335 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include "defs.h"
+#include "externs.h"
+#include "protos.h"
+
+#if defined(DJGPP) || defined(MSDOS) || defined(WIN32)
+/* no object cache on these (see obj_init()) */
+#define getcwd(buf, size)	NULL
+#define getpid()		0
+#else
+#include <unistd.h>
+#endif
+
+/* object cache: if PCE_OBJ_DIR (NES_OBJ_DIR) names a directory, each
+ * file the main file includes is kept there as an object once it has
+ * been assembled, and linked in place of its source the next time it
+ * is included in the same situation
+ *
+ * an object is keyed by the assembler version, the include path, the
+ * file name and the state of the assembler at the .include (location,
+ * banks, macros and functions); it lists the files it was built from
+ * with a hash of their contents, and holds:
+ *
+ *  - for the first pass, the symbols, macros, functions and branch
+ *    decisions the file made, where it left the assembler, and the
+ *    symbols from outside it that it looked at, as they were;
+ *
+ *  - for the last pass, the bytes it wrote and its relocations: the
+ *    lines whose code depends on symbols from outside; linking the
+ *    object assembles them again at their place, with the values the
+ *    symbols have now; outside symbols that the rest of the file
+ *    depends on (.if, .bank, .org...) are checked instead
+ *
+ * when a check fails in the first pass the file is assembled and
+ * recorded again; in the last pass it is assembled from its source,
+ * the first pass having left the same state behind
+ *
+ * files that do more than the usual directives (procs, graphics,
+ * errors and warnings, code crossing a page...) are not cached
+ */
+
+#define OBJ_MAGIC	"PCEOBJ1"
+#define OBJ_HASH	0xcbf29ce484222325ULL
+
+/* what became of an .include */
+#define OBJ_SOURCE	0	/* assembled from its source */
+#define OBJ_RECORD	1	/* same, and recorded */
+#define OBJ_LINK	2	/* linked from an object */
+#define OBJ_WRITTEN	3	/* recorded and written (-stats) */
+
+/* the fields of a symbol an object keeps */
+#define NB_FIELDS	13
+#define F_TYPE		0
+#define F_VALUE		1
+#define F_REFCNT	8
+#define F_RESERVED	9
+#define F_PROC		12
+
+/* an object being built */
+struct t_obuf {
+	char *data;
+	int len;
+	int size;
+};
+
+/* a reader over an object; it goes through a part of it twice,
+ * first to check it, then to apply it
+ */
+struct t_ord {
+	const char *p;
+	const char *end;
+	int ok;
+};
+
+/* an .include of the main file */
+struct t_obj {
+	struct t_obj *next;
+	int mode;
+	int last;		/* what the last pass did, for -stats */
+	unsigned long long key;
+	char name[128];
+	char *data;		/* OBJ_LINK: the object */
+	int size;
+	int p1;			/* offset of its first pass part */
+	int p2;			/* and of its last pass part */
+	struct t_symbol **sym;	/* symbols the file created */
+	int *st;		/* OBJ_RECORD: their state after the first pass */
+	int nb_sym;
+	int max_sym;
+	int serial;		/* sym_serial before the file */
+	int mgen[2];		/* macro_gen before and after it */
+	int fgen[2];		/* func_gen */
+	struct t_htab nomac;	/* macros and functions looked for */
+	struct t_htab nofunc;	/* and not found */
+	struct t_obuf deps;	/* files it was built from */
+	int nb_deps;
+	struct t_obuf first;	/* OBJ_RECORD: first pass part */
+};
+
+/* a symbol or a name a line looked for */
+struct t_ouse {
+	struct t_symbol *sym;
+	char name[SBOLSZ + 1];
+};
+
+int obj_rec;			/* set while a file is recorded */
+int obj_pending;		/* an object waits to be linked */
+
+static char *obj_dir;
+static struct t_obj *obj_list;	/* .includes of the first pass */
+static struct t_obj **obj_end = &obj_list;
+static struct t_obj *obj_next;	/* next one the last pass will see */
+static struct t_obj *obj_cur;	/* recorded or linked */
+static struct t_obj *obj_arm;	/* to record once it is open */
+static int obj_pass = -1;
+static int obj_lost;		/* the passes don't include the same files */
+
+/* recording */
+static int obj_level;		/* infile_num of the file */
+static int obj_ok;		/* nothing makes it uncacheable yet */
+static int obj_err;		/* as_errcnt before it */
+static int obj_br;		/* br_nb or br_idx before it */
+static unsigned long long obj_entry;	/* last pass state before it */
+static unsigned char *obj_seen;	/* symbols looked at already, by serial */
+static int obj_nb_seen;
+static struct t_symbol **obj_used;	/* first pass: outside symbols looked at */
+static int *obj_ust;			/* and their state then */
+static int obj_nb_used;
+static int obj_max_used;
+static int *obj_par;		/* parent of each symbol created, -1 if global */
+static struct t_htab obj_absent;	/* names looked for and not found */
+static struct t_obuf obj_guard;	/* last pass: outside symbols looked at */
+static int obj_nb_guard;
+static struct t_obuf obj_reloc;	/* relocations */
+static int obj_nb_reloc;
+static int *obj_snap;		/* created symbols when the last pass started */
+static unsigned char *obj_dirty;	/* bytes written, 2 if by a relocation */
+static int save_loccnt[4][256];	/* bank arrays before the file */
+static int save_page[4][256];
+static struct t_symbol *save_glabl[4][256];
+static char save_name[128][64];
+
+/* the line being assembled */
+static int line_on;
+static char line_text[LAST_CH_POS + 4];
+static int line_loccnt, line_bank, line_page, line_section;
+static int line_br, line_err;
+static struct t_symbol *line_glabl, *line_last;
+static struct t_ouse *line_use;	/* outside symbols it looked at */
+static int line_nb_use, line_max_use;
+static int (*line_put)[2];	/* rom ranges it wrote */
+static int line_nb_put, line_max_put;
+
+/* max_bank, max_zp and max_bss only grow; in the last pass each line
+ * of the recorded file starts them from the bottom, so that what it
+ * adds doesn't depend on where the file is linked
+ */
+static int *obj_max[3] = { &max_bank, &max_zp, &max_bss };
+static int obj_low[3] = { -1, 0, 0 };
+static int obj_top[3];		/* what the lines that aren't relocations added */
+static int line_max[3];		/* before the line */
+static int line_low;		/* set while the line runs from the bottom */
+
+/* protos */
+static unsigned long long hash_mem(unsigned long long h, const void *p, int len);
+static unsigned long long hash_str(unsigned long long h, const char *s);
+static unsigned long long hash_int(unsigned long long h, int v);
+static int  hash_file(const char *name, unsigned long long *h);
+static void ob_mem(struct t_obuf *b, const void *p, int len);
+static void ob_int(struct t_obuf *b, int v);
+static void ob_str(struct t_obuf *b, const char *s);
+static void ob_state(struct t_obuf *b, struct t_symbol *sym);
+static void ob_ref(struct t_obuf *b, struct t_symbol *sym);
+static void ob_names(struct t_obuf *b, struct t_htab *ht);
+static void ob_absent(struct t_obuf *b, struct t_htab *ht, struct t_htab *tbl, int ofs, int *gen);
+static void ob_exit(struct t_obuf *b);
+static const void *rd_mem(struct t_ord *r, int len);
+static int  rd_int(struct t_ord *r);
+static const char *rd_str(struct t_ord *r);
+static void rd_state(struct t_ord *r, int *st);
+static struct t_symbol *rd_ref(struct t_ord *r, struct t_obj *obj, int apply);
+static int  rd_exit(struct t_ord *r, struct t_obj *obj, int apply);
+static void sym_get(struct t_symbol *sym, int *st);
+static void sym_set(struct t_symbol *sym, const int *st);
+static int  sym_same(struct t_symbol *sym, const int *st);
+static struct t_symbol *sym_find(const char *name);
+static int  sym_fixed(struct t_obj *obj, struct t_symbol *sym);
+static int  sym_moved(struct t_obj *obj);
+static void sym_guard(struct t_symbol *sym);
+static void name_add(struct t_htab *ht, const char *name);
+static void name_free(struct t_htab *ht);
+static unsigned long long obj_state(unsigned long long h);
+static unsigned long long obj_key(char *fname);
+static int  obj_load(struct t_obj *obj);
+static int  obj_deps(struct t_ord *r);
+static int  obj_first(struct t_obj *obj, int apply);
+static int  obj_last(struct t_obj *obj, int apply);
+static void obj_relink(struct t_obj *obj, const char *text, int *pos, int size);
+static void obj_save(void);
+static void obj_lift(void);
+static void obj_end1(struct t_obj *obj);
+static void obj_end2(struct t_obj *obj);
+static void obj_write(struct t_obj *obj, struct t_obuf *last);
+static void obj_free(struct t_obj *obj);
+
+
+/* ----
+ * obj_init()
+ * ----
+ * forget the objects of an earlier assembly, and see if there
+ * is a cache to use
+ */
+
+void
+obj_init(void)
+{
+	struct t_obj *obj;
+
+	while ((obj = obj_list) != NULL) {
+		obj_list = obj->next;
+		obj_free(obj);
+	}
+	obj_end = &obj_list;
+	obj_next = NULL;
+	obj_cur = NULL;
+	obj_arm = NULL;
+	obj_pass = -1;
+	obj_lost = 0;
+	obj_rec = 0;
+	obj_pending = 0;
+	sym_serial = 0;
+
+#if defined(DJGPP) || defined(MSDOS) || defined(WIN32)
+	obj_dir = NULL;
+#else
+	obj_dir = getenv(machine->obj_env);
+	if (obj_dir && *obj_dir == '\0')
+		obj_dir = NULL;
+#endif
+}
+
+
+/* ----
+ * obj_include()
+ * ----
+ * called for an .include; returns 1 if an object stands for
+ * the file, to be linked by obj_replay() once the line is done
+ */
+
+int
+obj_include(char *fname)
+{
+	struct t_obj *obj;
+
+	/* only the files of the main file */
+	if ((obj_dir == NULL) || (infile_num != 1) || expand_macro || proc_ptr)
+		return (0);
+
+	obj_cur = NULL;
+	obj_arm = NULL;
+
+	/* first pass */
+	if (pass == FIRST_PASS) {
+		if ((obj = calloc(1, sizeof(struct t_obj))) == NULL)
+			return (0);
+		strcpy(obj->name, fname);
+		*obj_end = obj;
+		obj_end = &obj->next;
+
+		/* not with a listing, nor after an error */
+		if ((xlist && list_level) || as_errcnt)
+			return (0);
+
+		obj->key = obj_key(fname);
+		if (obj_load(obj)) {
+			obj->mode = OBJ_LINK;
+			obj_cur = obj;
+			obj_pending = 1;
+			return (1);
+		}
+		obj->mode = OBJ_RECORD;
+		obj_arm = obj;
+		return (0);
+	}
+
+	/* last pass, the same .include as in the first one */
+	if (obj_pass != pass) {
+		obj_pass = pass;
+		obj_next = obj_list;
+	}
+	obj = obj_next;
+	if (obj_lost || (obj == NULL) || strcmp(obj->name, fname)) {
+		obj_lost = 1;
+		return (0);
+	}
+	obj_next = obj->next;
+
+	switch (obj->mode) {
+	case OBJ_LINK:
+		if (obj_last(obj, 0)) {
+			obj->last = OBJ_LINK;
+			obj_cur = obj;
+			obj_pending = 1;
+			return (1);
+		}
+		obj->last = OBJ_SOURCE;
+		break;
+
+	case OBJ_RECORD:
+		obj_arm = obj;
+		break;
+	}
+	return (0);
+}
+
+
+/* ----
+ * obj_record()
+ * ----
+ * the file obj_include() wanted recorded is open, start
+ */
+
+void
+obj_record(void)
+{
+	struct t_obj *obj = obj_arm;
+
+	if (obj == NULL)
+		return;
+
+	obj_arm = NULL;
+	obj_cur = obj;
+	obj_rec = 1;
+	obj_level = infile_num;
+	obj_ok = 1;
+	obj_err = as_errcnt;
+	line_on = 0;
+	obj_save();
+
+	/* symbols looked at */
+	obj_nb_seen = sym_serial;
+	if ((obj_seen = calloc(obj_nb_seen + 1, 1)) == NULL)
+		obj_ok = 0;
+	htab_init(&obj_absent, "absent", 0);
+
+	if (pass == FIRST_PASS) {
+		obj->serial = sym_serial;
+		obj->mgen[0] = macro_gen;
+		obj->fgen[0] = func_gen;
+		htab_init(&obj->nomac, "macros", 0);
+		htab_init(&obj->nofunc, "functions", 0);
+		obj_br = br_nb;
+		obj_nb_used = 0;
+		obj_source(input_file[infile_num].src);
+	}
+	else {
+		obj_br = br_idx;
+		memcpy(obj_top, obj_low, sizeof(obj_top));
+		obj_entry = obj_state(OBJ_HASH);
+		obj_nb_guard = 0;
+		obj_guard.len = 0;
+		obj_nb_reloc = 0;
+		obj_reloc.len = 0;
+		if ((obj_dirty = calloc(128, 8192)) == NULL)
+			obj_ok = 0;
+		if ((obj_snap = malloc((obj->nb_sym + 1) * NB_FIELDS * sizeof(int))) == NULL)
+			obj_ok = 0;
+		else {
+			int i;
+
+			for (i = 0; i < obj->nb_sym; i++)
+				sym_get(obj->sym[i], &obj_snap[i * NB_FIELDS]);
+		}
+		if (sym_moved(obj))
+			obj_ok = 0;
+	}
+}
+
+
+/* ----
+ * obj_close()
+ * ----
+ * called when an input file ends; finish the recording
+ * if it was the recorded file
+ */
+
+void
+obj_close(void)
+{
+	struct t_obj *obj = obj_cur;
+
+	if (infile_num >= obj_level)
+		return;
+
+	obj_rec = 0;
+	line_on = 0;
+	obj_lift();
+	if (as_errcnt != obj_err)
+		obj_ok = 0;
+
+	if (pass == FIRST_PASS)
+		obj_end1(obj);
+	else
+		obj_end2(obj);
+
+	free(obj_seen);
+	obj_seen = NULL;
+	name_free(&obj_absent);
+}
+
+
+/* ----
+ * obj_replay()
+ * ----
+ * link the object obj_include() found
+ */
+
+void
+obj_replay(void)
+{
+	obj_pending = 0;
+
+	if (pass == FIRST_PASS)
+		obj_first(obj_cur, 1);
+	else
+		obj_last(obj_cur, 1);
+	infile_error = -1;
+}
+
+
+/* ----
+ * obj_line()
+ * ----
+ * called before (end = 0) and after (end = 1) a line of the
+ * recorded file is assembled; in the last pass, the line is a
+ * relocation if it looked at symbols from outside and only
+ * produced code or data at the location counter
+ */
+
+void
+obj_line(int end)
+{
+	struct t_obj *obj = obj_cur;
+	unsigned char *p;
+	int reloc, call;
+	int i, j;
+
+	/* before */
+	if (!end) {
+		line_on = 1;
+		line_nb_use = 0;
+		line_nb_put = 0;
+		if (pass == LAST_PASS) {
+			strcpy(line_text, &prlnbuf[SFIELD]);
+			line_loccnt = loccnt;
+			line_bank = bank;
+			line_page = page;
+			line_section = section;
+			line_glabl = glablptr;
+			line_last = lastlabl;
+			line_br = br_idx;
+			line_err = as_errcnt;
+			for (i = 0; i < 3; i++) {
+				line_max[i] = *obj_max[i];
+				*obj_max[i] = obj_low[i];
+			}
+			line_low = 1;
+		}
+		return;
+	}
+
+	/* after */
+	if (!line_on)
+		return;
+	line_on = 0;
+
+	/* code crossing a page isn't where it was meant to be */
+	if (loccnt > 0x2000)
+		obj_ok = 0;
+	if (pass == FIRST_PASS)
+		return;
+
+	/* a relocation? a .call always is, it depends on the procs */
+	call = (data_loccnt == line_loccnt) && (opflg == PSEUDO) && (opval == P_CALL);
+	reloc = 0;
+	if (line_nb_use || call) {
+		reloc = (data_loccnt == line_loccnt) &&
+			((opflg != PSEUDO) || (opval == P_DB) || (opval == P_DW) ||
+			 (opval == P_DWL) || (opval == P_DWH) || call) &&
+			!continued_line && (as_errcnt == line_err) &&
+			(bank == line_bank) && (page == line_page) &&
+			(section == line_section) &&
+			((line_last == NULL) || (line_last->serial >= obj->serial));
+
+		/* no, what it looked at must stay the same */
+		if (!reloc) {
+			if (call)
+				obj_ok = 0;
+			for (i = 0; i < line_nb_use; i++) {
+				if (line_use[i].sym)
+					sym_guard(line_use[i].sym);
+				else
+					name_add(&obj_absent, line_use[i].name);
+			}
+		}
+	}
+
+	/* the bytes it wrote; a relocation must be the only
+	 * line writing them
+	 */
+	for (i = 0; i < line_nb_put; i++) {
+		p = &obj_dirty[line_put[i][0]];
+		for (j = 0; j < line_put[i][1]; j++) {
+			if (p[j] && (reloc || (p[j] == 2)))
+				obj_ok = 0;
+			p[j] = reloc ? 2 : 1;
+		}
+	}
+
+	/* the banks it used, when linking goes past it */
+	for (i = 0; i < 3; i++) {
+		if (line_low && !reloc && (*obj_max[i] > obj_top[i]))
+			obj_top[i] = *obj_max[i];
+	}
+	obj_lift();
+
+	/* keep the line */
+	if (reloc) {
+		ob_str(&obj_reloc, line_text);
+		ob_int(&obj_reloc, line_loccnt);
+		ob_int(&obj_reloc, line_bank);
+		ob_int(&obj_reloc, line_page);
+		ob_int(&obj_reloc, line_section);
+		ob_ref(&obj_reloc, line_glabl);
+		ob_ref(&obj_reloc, line_last);
+		ob_int(&obj_reloc, line_br - obj_br);
+		ob_int(&obj_reloc, obj_top[0]);
+		ob_int(&obj_reloc, loccnt - line_loccnt);
+		obj_nb_reloc++;
+	}
+}
+
+
+/* ----
+ * obj_use()
+ * ----
+ * the recorded file looks at a symbol, NULL if there is no
+ * symbol called <symbol>
+ */
+
+void
+obj_use(struct t_symbol *sym)
+{
+	struct t_obj *obj = obj_cur;
+	struct t_ouse *use;
+
+	/* a local symbol belongs to the file, or the file can't be cached */
+	if (sym == NULL ? (symbol[1] == '.') : (sym->name[1] == '.')) {
+		if (sym == NULL) {
+			if ((glablptr == NULL) || (glablptr->serial < obj->serial))
+				obj_ok = 0;
+			return;
+		}
+		if ((sym->serial < obj->serial) ||
+		    ((pass == LAST_PASS) && !sym_fixed(obj, sym)))
+			obj_ok = 0;
+		return;
+	}
+
+	/* first pass, all the file needs is the symbols from before it */
+	if (pass == FIRST_PASS) {
+		if (sym == NULL)
+			name_add(&obj_absent, symbol);
+		else if ((sym->serial < obj->serial) && !obj_seen[sym->serial]) {
+			obj_seen[sym->serial] = 1;
+			if (obj_nb_used == obj_max_used) {
+				obj_max_used = obj_max_used ? (obj_max_used * 2) : 256;
+				obj_used = realloc(obj_used, obj_max_used * sizeof(struct t_symbol *));
+				obj_ust = realloc(obj_ust, obj_max_used * NB_FIELDS * sizeof(int));
+				if ((obj_used == NULL) || (obj_ust == NULL)) {
+					fatal_error("Out of memory!");
+					return;
+				}
+			}
+			obj_used[obj_nb_used] = sym;
+			sym_get(sym, &obj_ust[obj_nb_used * NB_FIELDS]);
+			obj_nb_used++;
+		}
+		return;
+	}
+
+	/* last pass, the symbols of the file are the same everywhere */
+	if (sym && sym_fixed(obj, sym))
+		return;
+
+	/* the others go with the line, or must stay the same */
+	if (line_on) {
+		if (line_nb_use == line_max_use) {
+			line_max_use = line_max_use ? (line_max_use * 2) : 16;
+			line_use = realloc(line_use, line_max_use * sizeof(struct t_ouse));
+			if (line_use == NULL) {
+				fatal_error("Out of memory!");
+				return;
+			}
+		}
+		use = &line_use[line_nb_use++];
+		use->sym = sym;
+		if (sym == NULL)
+			strcpy(use->name, symbol);
+	}
+	else if (sym)
+		sym_guard(sym);
+	else
+		name_add(&obj_absent, symbol);
+}
+
+
+/* ----
+ * obj_new()
+ * ----
+ * the recorded file creates a symbol
+ */
+
+void
+obj_new(struct t_symbol *sym, int local)
+{
+	struct t_obj *obj = obj_cur;
+
+	/* the last pass only uses what the first one created */
+	if (pass == LAST_PASS) {
+		obj_ok = 0;
+		return;
+	}
+	if (local && (glablptr->serial < obj->serial))
+		obj_ok = 0;
+
+	if (obj->nb_sym == obj->max_sym) {
+		obj->max_sym = obj->max_sym ? (obj->max_sym * 2) : 256;
+		obj->sym = realloc(obj->sym, obj->max_sym * sizeof(struct t_symbol *));
+		obj_par = realloc(obj_par, obj->max_sym * sizeof(int));
+		if ((obj->sym == NULL) || (obj_par == NULL)) {
+			fatal_error("Out of memory!");
+			return;
+		}
+	}
+	obj_par[obj->nb_sym] = local ? (glablptr->serial - obj->serial) : -1;
+	obj->sym[obj->nb_sym++] = sym;
+}
+
+
+/* ----
+ * obj_macro()
+ * ----
+ * the recorded file looks for a macro
+ */
+
+void
+obj_macro(struct t_macro *ptr, char *name)
+{
+	struct t_obj *obj = obj_cur;
+
+	if (ptr == NULL)
+		name_add(&obj->nomac, name);
+	else if ((pass == LAST_PASS) && (ptr->gen > obj->mgen[1]))
+		obj_ok = 0;
+}
+
+
+/* ----
+ * obj_func()
+ * ----
+ * the recorded file looks for a function called <symbol>
+ */
+
+void
+obj_func(struct t_func *ptr)
+{
+	struct t_obj *obj = obj_cur;
+
+	if (ptr == NULL)
+		name_add(&obj->nofunc, &symbol[1]);
+	else if ((pass == LAST_PASS) && (ptr->gen > obj->fgen[1]))
+		obj_ok = 0;
+}
+
+
+/* ----
+ * obj_put()
+ * ----
+ * the recorded file writes <size> bytes at <offset> in the current bank
+ */
+
+void
+obj_put(int offset, int size)
+{
+	int addr = (bank << 13) + offset;
+
+	if ((pass != LAST_PASS) || (size == 0))
+		return;
+	if ((size < 0) || (addr < 0) || (addr + size > 128 * 8192)) {
+		obj_ok = 0;
+		return;
+	}
+	if (!line_on) {
+		obj_ok = 0;
+		return;
+	}
+
+	/* next to the last range */
+	if (line_nb_put &&
+	   ((line_put[line_nb_put - 1][0] + line_put[line_nb_put - 1][1]) == addr)) {
+		line_put[line_nb_put - 1][1] += size;
+		return;
+	}
+	if (line_nb_put == line_max_put) {
+		line_max_put = line_max_put ? (line_max_put * 2) : 16;
+		line_put = realloc(line_put, line_max_put * 2 * sizeof(int));
+		if (line_put == NULL) {
+			fatal_error("Out of memory!");
+			return;
+		}
+	}
+	line_put[line_nb_put][0] = addr;
+	line_put[line_nb_put][1] = size;
+	line_nb_put++;
+}
+
+
+/* ----
+ * obj_pseudo()
+ * ----
+ * the recorded file uses a directive; check that it's
+ * one that can be cached
+ */
+
+void
+obj_pseudo(void)
+{
+	switch (opval) {
+	case P_DB:
+	case P_DW:
+	case P_DWL:
+	case P_DWH:
+	case P_DS:
+	case P_EQU:
+	case P_ORG:
+	case P_PAGE:
+	case P_BANK:
+	case P_INCBIN:
+	case P_INCLUDE:
+	case P_MACRO:
+	case P_ENDM:
+	case P_FUNC:
+		/* a listing would miss the file */
+		if (xlist && list_level)
+			obj_ok = 0;
+		break;
+
+	case P_LIST:
+		/* it turns the listing on for what follows */
+		obj_ok = 0;
+		break;
+
+	case P_MLIST:
+	case P_NOLIST:
+	case P_NOMLIST:
+	case P_RSSET:
+	case P_RS:
+	case P_IF:
+	case P_IFDEF:
+	case P_IFNDEF:
+	case P_ELSE:
+	case P_ENDIF:
+	case P_FAIL:
+	case P_ZP:
+	case P_BSS:
+	case P_CODE:
+	case P_DATA:
+	case P_VRAM:
+	case P_PAL:
+	case P_OPT:
+		break;
+
+	case P_CALL:
+		/* it may take a bank for its code */
+		obj_lift();
+		break;
+
+	default:
+		obj_ok = 0;
+		break;
+	}
+}
+
+
+/* ----
+ * obj_nocache()
+ * ----
+ * the recorded file can't be cached
+ */
+
+void
+obj_nocache(void)
+{
+	obj_ok = 0;
+}
+
+
+/* ----
+ * obj_source()
+ * ----
+ * the recorded file reads a source file
+ */
+
+void
+obj_source(struct t_source *src)
+{
+	struct t_obj *obj = obj_cur;
+
+	if (pass != FIRST_PASS)
+		return;
+
+	ob_str(&obj->deps, src->name);
+	ob_str(&obj->deps, src->path);
+	ob_mem(&obj->deps, &src->hash, sizeof(src->hash));
+	obj->nb_deps++;
+}
+
+
+/* ----
+ * obj_file()
+ * ----
+ * the recorded file reads a binary file open_file() just found
+ */
+
+void
+obj_file(char *name)
+{
+	struct t_obj *obj = obj_cur;
+	unsigned long long h;
+
+	if (pass != FIRST_PASS)
+		return;
+	if (!hash_file(open_name, &h)) {
+		obj_ok = 0;
+		return;
+	}
+
+	ob_str(&obj->deps, name);
+	ob_str(&obj->deps, open_name);
+	ob_mem(&obj->deps, &h, sizeof(h));
+	obj->nb_deps++;
+}
+
+
+/* ----
+ * obj_hash()
+ * ----
+ * hash of the contents of a file
+ */
+
+unsigned long long
+obj_hash(const void *data, long len)
+{
+	unsigned long long h = OBJ_HASH;
+	const unsigned char *p = data;
+
+	while (len--)
+		h = (h ^ *p++) * 0x100000001b3ULL;
+
+	return (h);
+}
+
+
+/* ----
+ * obj_stats()
+ * ----
+ * show what became of each included file
+ */
+
+void
+obj_stats(void)
+{
+	struct t_obj *obj;
+	char *what;
+
+	if (obj_dir == NULL)
+		return;
+
+	printf("object cache:\n");
+	printf("\n");
+	for (obj = obj_list; obj; obj = obj->next) {
+		switch (obj->mode) {
+		case OBJ_LINK:
+			what = (obj->last == OBJ_LINK) ? "linked" : "linked, last pass from source";
+			break;
+
+		case OBJ_RECORD:
+			if (obj->last == OBJ_WRITTEN) {
+				what = "assembled, stored";
+				break;
+			}
+
+		default:
+			what = "assembled, can't be cached";
+			break;
+		}
+		printf("   %-24s  %s\n", obj->name, what);
+	}
+	printf("\n");
+}
+
+
+/* ----
+ * hash_mem()
+ * ----
+ * 64-bit FNV-1a
+ */
+
+static unsigned long long
+hash_mem(unsigned long long h, const void *p, int len)
+{
+	const unsigned char *c = p;
+
+	while (len--)
+		h = (h ^ *c++) * 0x100000001b3ULL;
+
+	return (h);
+}
+
+static unsigned long long
+hash_str(unsigned long long h, const char *s)
+{
+	return (hash_mem(h, s, strlen(s) + 1));
+}
+
+static unsigned long long
+hash_int(unsigned long long h, int v)
+{
+	return (hash_mem(h, &v, sizeof(v)));
+}
+
+static int
+hash_file(const char *name, unsigned long long *h)
+{
+	FILE *fp;
+	char buf[4096];
+	int n;
+
+	if ((fp = fopen(name, "rb")) == NULL)
+		return (0);
+
+	*h = OBJ_HASH;
+	while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+		*h = hash_mem(*h, buf, n);
+	fclose(fp);
+
+	return (1);
+}
+
+
+/* ----
+ * ob_mem()
+ * ----
+ * append to an object
+ */
+
+static void
+ob_mem(struct t_obuf *b, const void *p, int len)
+{
+	char *data;
+	int size;
+
+	if (b->len + len > b->size) {
+		size = b->size ? b->size : 4096;
+		while (size < b->len + len)
+			size *= 2;
+		if ((data = realloc(b->data, size)) == NULL) {
+			fatal_error("Out of memory!");
+			return;
+		}
+		b->data = data;
+		b->size = size;
+	}
+	memcpy(&b->data[b->len], p, len);
+	b->len += len;
+}
+
+static void
+ob_int(struct t_obuf *b, int v)
+{
+	ob_mem(b, &v, sizeof(v));
+}
+
+static void
+ob_str(struct t_obuf *b, const char *s)
+{
+	int len = strlen(s);
+
+	ob_int(b, len);
+	ob_mem(b, s, len + 1);
+}
+
+static void
+ob_state(struct t_obuf *b, struct t_symbol *sym)
+{
+	int st[NB_FIELDS];
+
+	sym_get(sym, st);
+	ob_mem(b, st, sizeof(st));
+}
+
+
+/* ----
+ * ob_ref()
+ * ----
+ * a symbol of the file by its index, another by its name
+ */
+
+static void
+ob_ref(struct t_obuf *b, struct t_symbol *sym)
+{
+	int i = sym ? (sym->serial - obj_cur->serial) : -1;
+
+	if (sym == NULL)
+		ob_int(b, -1);
+	else if ((i >= 0) && (i < obj_cur->nb_sym))
+		ob_int(b, i);
+	else {
+		if (sym->name[1] == '.')
+			obj_ok = 0;
+		ob_int(b, -2);
+		ob_str(b, sym->name);
+	}
+}
+
+static void
+ob_names(struct t_obuf *b, struct t_htab *ht)
+{
+	int i;
+
+	ob_int(b, ht->count);
+	for (i = 0; i < ht->size; i++) {
+		if (ht->slot[i])
+			ob_str(b, ht->slot[i]);
+	}
+}
+
+
+/* ----
+ * ob_absent()
+ * ----
+ * the macros or functions the file looked for and didn't find,
+ * but those it defined afterwards
+ */
+
+static void
+ob_absent(struct t_obuf *b, struct t_htab *ht, struct t_htab *tbl, int ofs, int *gen)
+{
+	char *name, *entry;
+	int i, k, n, g;
+
+	/* count them, then write them */
+	for (n = 0, k = 0; k < 2; k++) {
+		if (k)
+			ob_int(b, n);
+		for (i = 0; i < ht->size; i++) {
+			if ((name = ht->slot[i]) == NULL)
+				continue;
+			entry = htab_find(tbl, name, strhash(name, strlen(name)));
+			if (entry) {
+				memcpy(&g, entry + ofs, sizeof(int));
+				if ((g > gen[0]) && (g <= gen[1]))
+					continue;
+			}
+			if (k)
+				ob_str(b, name);
+			else
+				n++;
+		}
+	}
+}
+
+
+/* ----
+ * ob_exit()
+ * ----
+ * where the file left the assembler
+ */
+
+static void
+ob_exit(struct t_obuf *b)
+{
+	int i, j, n;
+
+	ob_int(b, section);
+	ob_int(b, bank);
+	ob_int(b, page);
+	ob_int(b, loccnt);
+	ob_int(b, rsbase);
+	ob_int(b, max_zp);
+	ob_int(b, max_bss);
+	ob_int(b, max_bank);
+	ob_int(b, xlist);
+	ob_int(b, mcntmax);
+	ob_int(b, mcounter);
+	for (i = 0; i < 4; i++) {
+		ob_int(b, section_bank[i]);
+		ob_int(b, asm_opt[i]);
+	}
+	ob_ref(b, glablptr);
+	ob_ref(b, lastlabl);
+
+	/* the bank arrays it changed */
+	n = 0;
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 256; j++) {
+			if ((bank_loccnt[i][j] != save_loccnt[i][j]) ||
+			    (bank_page[i][j] != save_page[i][j]) ||
+			    (bank_glabl[i][j] != save_glabl[i][j]))
+				n++;
+		}
+	}
+	ob_int(b, n);
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 256; j++) {
+			if ((bank_loccnt[i][j] != save_loccnt[i][j]) ||
+			    (bank_page[i][j] != save_page[i][j]) ||
+			    (bank_glabl[i][j] != save_glabl[i][j])) {
+				ob_int(b, (i << 8) + j);
+				ob_int(b, bank_loccnt[i][j]);
+				ob_int(b, bank_page[i][j]);
+				ob_ref(b, bank_glabl[i][j]);
+			}
+		}
+	}
+	n = 0;
+	for (i = 0; i < 128; i++) {
+		if (strcmp(bank_name[i], save_name[i]))
+			n++;
+	}
+	ob_int(b, n);
+	for (i = 0; i < 128; i++) {
+		if (strcmp(bank_name[i], save_name[i])) {
+			ob_int(b, i);
+			ob_str(b, bank_name[i]);
+		}
+	}
+}
+
+
+/* ----
+ * rd_mem()
+ * ----
+ * read from an object
+ */
+
+static const void *
+rd_mem(struct t_ord *r, int len)
+{
+	const char *p = r->p;
+
+	if (!r->ok || (len < 0) || ((r->end - r->p) < len)) {
+		r->ok = 0;
+		return (NULL);
+	}
+	r->p += len;
+
+	return (p);
+}
+
+static int
+rd_int(struct t_ord *r)
+{
+	const void *p = rd_mem(r, sizeof(int));
+	int v = 0;
+
+	if (p)
+		memcpy(&v, p, sizeof(int));
+
+	return (v);
+}
+
+static const char *
+rd_str(struct t_ord *r)
+{
+	const char *p;
+	int len;
+
+	len = rd_int(r);
+	p = rd_mem(r, len + 1);
+	if (p && p[len]) {
+		r->ok = 0;
+		return (NULL);
+	}
+
+	return (p);
+}
+
+static void
+rd_state(struct t_ord *r, int *st)
+{
+	const void *p = rd_mem(r, NB_FIELDS * sizeof(int));
+
+	if (p)
+		memcpy(st, p, NB_FIELDS * sizeof(int));
+	else
+		memset(st, 0, NB_FIELDS * sizeof(int));
+}
+
+static struct t_symbol *
+rd_ref(struct t_ord *r, struct t_obj *obj, int apply)
+{
+	struct t_symbol *sym = NULL;
+	const char *s;
+	int i;
+
+	i = rd_int(r);
+	if (i == -2) {
+		s = rd_str(r);
+		if (s && ((sym = sym_find(s)) == NULL))
+			r->ok = 0;
+	}
+	else if (i >= obj->nb_sym)
+		r->ok = 0;
+	else if (i >= 0)
+		sym = apply ? obj->sym[i] : NULL;
+	else if (i != -1)
+		r->ok = 0;
+
+	return (sym);
+}
+
+
+/* ----
+ * rd_exit()
+ * ----
+ * put the assembler where the file left it
+ */
+
+static int
+rd_exit(struct t_ord *r, struct t_obj *obj, int apply)
+{
+	struct t_symbol *sym;
+	const char *s;
+	int v[19];
+	int i, j, n;
+
+	for (i = 0; i < 19; i++)
+		v[i] = rd_int(r);
+	if (apply) {
+		section = v[0];
+		bank = v[1];
+		page = v[2];
+		loccnt = v[3];
+		rsbase = v[4];
+		max_zp = v[5];
+		max_bss = v[6];
+		max_bank = v[7];
+		xlist = v[8];
+		mcntmax = v[9];
+		mcounter = v[10];
+		for (i = 0; i < 4; i++) {
+			section_bank[i] = v[11 + i * 2];
+			asm_opt[i] = v[12 + i * 2];
+		}
+	}
+	sym = rd_ref(r, obj, apply);
+	if (apply)
+		glablptr = sym;
+	sym = rd_ref(r, obj, apply);
+	if (apply)
+		lastlabl = sym;
+
+	/* bank arrays */
+	n = rd_int(r);
+	for (i = 0; (i < n) && r->ok; i++) {
+		j = rd_int(r);
+		v[0] = rd_int(r);
+		v[1] = rd_int(r);
+		sym = rd_ref(r, obj, apply);
+		if ((j < 0) || (j >= 4 * 256))
+			r->ok = 0;
+		if (apply && r->ok) {
+			bank_loccnt[j >> 8][j & 0xFF] = v[0];
+			bank_page[j >> 8][j & 0xFF] = v[1];
+			bank_glabl[j >> 8][j & 0xFF] = sym;
+		}
+	}
+	n = rd_int(r);
+	for (i = 0; (i < n) && r->ok; i++) {
+		j = rd_int(r);
+		s = rd_str(r);
+		if ((j < 0) || (j >= 128) || (s && (strlen(s) > 63)))
+			r->ok = 0;
+		if (apply && r->ok)
+			strcpy(bank_name[j], s);
+	}
+
+	return (r->ok);
+}
+
+
+/* ----
+ * sym_get()
+ * ----
+ * the fields of a symbol an object keeps
+ */
+
+static void
+sym_get(struct t_symbol *sym, int *st)
+{
+	st[0] = sym->type;
+	st[1] = sym->value;
+	st[2] = sym->bank;
+	st[3] = sym->page;
+	st[4] = sym->nb;
+	st[5] = sym->size;
+	st[6] = sym->vram;
+	st[7] = sym->pal;
+	st[8] = sym->refcnt;
+	st[9] = sym->reserved;
+	st[10] = sym->data_type;
+	st[11] = sym->data_size;
+	st[12] = (sym->proc != NULL);
+}
+
+static void
+sym_set(struct t_symbol *sym, const int *st)
+{
+	sym->type = st[0];
+	sym->value = st[1];
+	sym->bank = st[2];
+	sym->page = st[3];
+	sym->nb = st[4];
+	sym->size = st[5];
+	sym->vram = st[6];
+	sym->pal = st[7];
+	sym->refcnt = st[8];
+	sym->reserved = st[9];
+	sym->data_type = st[10];
+	sym->data_size = st[11];
+}
+
+
+/* ----
+ * sym_same()
+ * ----
+ * check that a symbol is as it was, its reference count aside
+ */
+
+static int
+sym_same(struct t_symbol *sym, const int *st)
+{
+	int cur[NB_FIELDS];
+	int i;
+
+	sym_get(sym, cur);
+	for (i = 0; i < NB_FIELDS; i++) {
+		if ((i != F_REFCNT) && (cur[i] != st[i]))
+			return (0);
+	}
+
+	return (1);
+}
+
+
+/* ----
+ * sym_find()
+ * ----
+ * search a global symbol
+ */
+
+static struct t_symbol *
+sym_find(const char *name)
+{
+	return (htab_find(&hash_tbl, name, strhash(&name[1], strlen(&name[1]))));
+}
+
+
+/* ----
+ * sym_fixed()
+ * ----
+ * check if a symbol was defined by the recorded file, with the
+ * value it gave it
+ */
+
+static int
+sym_fixed(struct t_obj *obj, struct t_symbol *sym)
+{
+	int *st;
+	int i;
+
+	i = sym->serial - obj->serial;
+	if ((i < 0) || (i >= obj->nb_sym))
+		return (0);
+
+	st = &obj->st[i * NB_FIELDS];
+	if ((st[F_TYPE] == UNDEF) || (st[F_TYPE] == IFUNDEF) || st[F_RESERVED])
+		return (0);
+	if ((sym->type != st[F_TYPE]) || (sym->value != st[F_VALUE]))
+		return (0);
+
+	return (1);
+}
+
+
+/* ----
+ * sym_moved()
+ * ----
+ * in the last pass, check if what came after the file changed one
+ * of the symbols it defined (a .db after its last label...); the
+ * code of the file may have looked at it ahead
+ */
+
+static int
+sym_moved(struct t_obj *obj)
+{
+	int *st;
+	int i;
+
+	for (i = 0; i < obj->nb_sym; i++) {
+		st = &obj->st[i * NB_FIELDS];
+		if ((st[F_TYPE] == UNDEF) || (st[F_TYPE] == IFUNDEF) || st[F_RESERVED])
+			continue;
+		if (!sym_same(obj->sym[i], st))
+			return (1);
+	}
+
+	return (0);
+}
+
+
+/* ----
+ * sym_guard()
+ * ----
+ * in the last pass, an outside symbol the file depends on
+ */
+
+static void
+sym_guard(struct t_symbol *sym)
+{
+	if (sym->serial >= obj_nb_seen) {
+		obj_ok = 0;
+		return;
+	}
+	if (obj_seen[sym->serial])
+		return;
+
+	obj_seen[sym->serial] = 1;
+	ob_str(&obj_guard, sym->name);
+	ob_state(&obj_guard, sym);
+	obj_nb_guard++;
+}
+
+
+/* ----
+ * name_add()
+ * ----
+ * add a name to a set
+ */
+
+static void
+name_add(struct t_htab *ht, const char *name)
+{
+	unsigned int hash = strhash(name, strlen(name));
+	char *s;
+
+	if (htab_find(ht, name, hash))
+		return;
+	if ((s = strdup(name)) == NULL) {
+		fatal_error("Out of memory!");
+		return;
+	}
+	htab_insert(ht, s, hash);
+}
+
+static void
+name_free(struct t_htab *ht)
+{
+	int i;
+
+	for (i = 0; i < ht->size; i++)
+		free(ht->slot[i]);
+	htab_init(ht, ht->title, 0);
+}
+
+
+/* ----
+ * obj_state()
+ * ----
+ * hash the state of the assembler an included file starts with
+ */
+
+static unsigned long long
+obj_state(unsigned long long h)
+{
+	struct t_symbol *sym;
+	int i, j;
+
+	h = hash_int(h, section);
+	h = hash_int(h, bank);
+	h = hash_int(h, page);
+	h = hash_int(h, loccnt);
+	h = hash_int(h, rsbase);
+	h = hash_int(h, bank_base);
+	h = hash_int(h, call_ptr);
+	h = hash_int(h, call_bank);
+	h = hash_int(h, xlist);
+	h = hash_int(h, mcntmax);
+	h = hash_int(h, if_level);
+	h = hash_mem(h, asm_opt, sizeof(asm_opt));
+	h = hash_mem(h, section_bank, sizeof(section_bank));
+	h = hash_mem(h, bank_loccnt, sizeof(bank_loccnt));
+	h = hash_mem(h, bank_page, sizeof(bank_page));
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 256; j++) {
+			sym = bank_glabl[i][j];
+			h = hash_str(h, sym ? sym->name : "");
+		}
+	}
+	h = hash_str(h, glablptr ? glablptr->name : "");
+	h = hash_str(h, lastlabl ? lastlabl->name : "");
+	for (i = 0; i < 128; i++)
+		h = hash_str(h, bank_name[i]);
+
+	return (h);
+}
+
+
+/* ----
+ * obj_key()
+ * ----
+ * the key of an object: what the assembly of the file depends
+ * on, but the symbols and the files it reads
+ */
+
+static unsigned long long
+obj_key(char *fname)
+{
+	struct t_macro *m;
+	struct t_line *ln;
+	struct t_func *f;
+	char cwd[256];
+	unsigned long long h;
+	int i;
+
+	h = hash_str(OBJ_HASH, OBJ_MAGIC);
+	h = hash_str(h, machine->asm_title);
+	h = hash_int(h, machine->type);
+	h = hash_int(h, rom_limit);
+	h = hash_int(h, bank_limit);
+	h = hash_int(h, list_level != 0);
+	h = hash_int(h, max_zp);
+	h = hash_int(h, max_bss);
+	h = hash_int(h, max_bank);
+	for (i = 0; i < 10; i++)
+		h = hash_str(h, incpath[i]);
+	h = hash_str(h, getcwd(cwd, sizeof(cwd)) ? cwd : "");
+	h = hash_str(h, fname);
+	h = obj_state(h);
+
+	/* macros and functions so far */
+	for (i = 0; i < macro_tbl.size; i++) {
+		if ((m = macro_tbl.slot[i]) == NULL)
+			continue;
+		h = hash_str(h, m->name);
+		for (ln = m->line; ln; ln = ln->next)
+			h = hash_str(h, ln->data);
+		h = hash_int(h, i);
+	}
+	for (i = 0; i < func_tbl.size; i++) {
+		if ((f = func_tbl.slot[i]) == NULL)
+			continue;
+		h = hash_str(h, f->name);
+		h = hash_str(h, f->line);
+		h = hash_int(h, i);
+	}
+
+	return (h);
+}
+
+
+/* ----
+ * obj_load()
+ * ----
+ * read the object of an .include and check that the first pass
+ * can use it
+ */
+
+static int
+obj_load(struct t_obj *obj)
+{
+	struct t_ord r;
+	char file[512];
+	const char *s;
+	FILE *fp;
+	long len;
+
+	snprintf(file, sizeof(file), "%s" PATH_SEPARATOR_STRING "%016llx.obj", obj_dir, obj->key);
+	if ((fp = fopen(file, "rb")) == NULL)
+		return (0);
+	fseek(fp, 0, SEEK_END);
+	len = ftell(fp);
+	rewind(fp);
+	if ((len <= 0) || (len > 0x10000000) || ((obj->data = malloc(len)) == NULL)) {
+		fclose(fp);
+		return (0);
+	}
+	if (fread(obj->data, 1, len, fp) != (size_t)len) {
+		fclose(fp);
+		goto fail;
+	}
+	fclose(fp);
+	obj->size = len;
+
+	/* the key, and the files it was built from */
+	r.p = obj->data;
+	r.end = obj->data + len;
+	r.ok = 1;
+	s = rd_mem(&r, sizeof(OBJ_MAGIC));
+	if ((s == NULL) || memcmp(s, OBJ_MAGIC, sizeof(OBJ_MAGIC)))
+		goto fail;
+	s = rd_mem(&r, sizeof(obj->key));
+	if ((s == NULL) || memcmp(s, &obj->key, sizeof(obj->key)))
+		goto fail;
+	if (!obj_deps(&r))
+		goto fail;
+
+	/* the symbols it needs */
+	obj->p1 = r.p - obj->data;
+	if (obj_first(obj, 0))
+		return (1);
+
+fail:
+	free(obj->data);
+	obj->data = NULL;
+	return (0);
+}
+
+
+/* ----
+ * obj_deps()
+ * ----
+ * check the files an object was built from
+ */
+
+static int
+obj_deps(struct t_ord *r)
+{
+	unsigned long long h;
+	const char *name, *path, *s;
+	FILE *fp;
+	int i, n;
+
+	n = rd_int(r);
+	for (i = 0; (i < n) && r->ok; i++) {
+		name = rd_str(r);
+		path = rd_str(r);
+		s = rd_mem(r, sizeof(h));
+		if (!r->ok || (strlen(name) > 127))
+			return (0);
+
+		/* the same file, found at the same place */
+		if ((fp = open_file((char *)name, "rb")) == NULL)
+			return (0);
+		fclose(fp);
+		if (strcmp(open_name, path))
+			return (0);
+		if (!hash_file(path, &h) || memcmp(s, &h, sizeof(h)))
+			return (0);
+	}
+
+	return (r->ok);
+}
+
+
+/* ----
+ * obj_first()
+ * ----
+ * first pass part of an object: check that the symbols from
+ * outside are as the file saw them, then (apply = 1) define what
+ * the file defined
+ */
+
+static int
+obj_first(struct t_obj *obj, int apply)
+{
+	struct t_symbol *sym;
+	struct t_macro *m;
+	struct t_func *f;
+	struct t_line *ln, **tail;
+	struct t_ord r;
+	const char *s;
+	int st[NB_FIELDS];
+	int i, j, n, nb, par;
+
+	r.p = obj->data + obj->p1;
+	r.end = obj->data + obj->size;
+	r.ok = 1;
+
+	/* symbols from outside */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		rd_state(&r, st);
+		j = rd_int(&r);
+		if (!r.ok)
+			break;
+		sym = sym_find(s);
+		if (apply)
+			sym->refcnt += j;
+		else if ((sym == NULL) || !sym_same(sym, st))
+			return (0);
+	}
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		if (!apply && s && sym_find(s))
+			return (0);
+	}
+
+	/* symbols of the file */
+	nb = rd_int(&r);
+	if ((nb < 0) || (nb > 0x1000000))
+		return (0);
+	if (apply) {
+		obj->sym = malloc((nb + 1) * sizeof(struct t_symbol *));
+		obj->st = malloc((nb + 1) * NB_FIELDS * sizeof(int));
+		if ((obj->sym == NULL) || (obj->st == NULL)) {
+			fatal_error("Out of memory!");
+			return (0);
+		}
+		obj->nb_sym = nb;
+	}
+	for (i = 0; (i < nb) && r.ok; i++) {
+		s = rd_str(&r);
+		par = rd_int(&r);
+		rd_state(&r, st);
+		if (!r.ok)
+			break;
+		if ((strlen(s) >= SBOLSZ) || (s[0] != strlen(&s[1])) || (par >= i) ||
+		    ((s[1] == '.') != (par >= 0))) {
+			r.ok = 0;
+			break;
+		}
+		if (!apply) {
+			if ((par < 0) && sym_find(s))
+				return (0);
+			continue;
+		}
+		strcpy(symbol, s);
+		if (par < 0)
+			sym = stinstall(sym_hash(), 0);
+		else {
+			glablptr = obj->sym[par];
+			sym = stinstall(0, 1);
+		}
+		if (sym == NULL)
+			return (0);
+		sym_set(sym, st);
+		memcpy(&obj->st[i * NB_FIELDS], st, sizeof(st));
+		obj->sym[i] = sym;
+	}
+	if (!apply)
+		obj->nb_sym = nb;
+
+	/* macros */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		nb = rd_int(&r);
+		if (!r.ok || (strlen(s) >= SBOLSZ)) {
+			r.ok = 0;
+			break;
+		}
+		m = NULL;
+		if (apply) {
+			if ((m = malloc(sizeof(struct t_macro))) == NULL) {
+				fatal_error("Out of memory!");
+				return (0);
+			}
+			strcpy(m->name, s);
+			m->line = NULL;
+		}
+		else if (htab_find(&macro_tbl, s, strhash(s, strlen(s))))
+			return (0);
+		tail = m ? &m->line : NULL;
+		for (j = 0; (j < nb) && r.ok; j++) {
+			s = rd_str(&r);
+			if (!apply || (s == NULL))
+				continue;
+			ln = malloc(sizeof(struct t_line));
+			if ((ln == NULL) || ((ln->data = strdup(s)) == NULL)) {
+				fatal_error("Out of memory!");
+				return (0);
+			}
+			ln->next = NULL;
+			ln->plain = strcspn(s, "\\");
+			memset(&ln->ir, 0, sizeof(struct t_ir));
+			*tail = ln;
+			tail = &ln->next;
+		}
+		if (apply) {
+			m->gen = ++macro_gen;
+			htab_insert(&macro_tbl, m, strhash(m->name, strlen(m->name)));
+		}
+	}
+
+	/* functions */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		f = NULL;
+		if (r.ok && (strlen(s) < SBOLSZ) && apply) {
+			if ((f = malloc(sizeof(struct t_func))) == NULL) {
+				fatal_error("Out of memory!");
+				return (0);
+			}
+			strcpy(f->name, s);
+		}
+		else if (r.ok && htab_find(&func_tbl, s, strhash(s, strlen(s))))
+			return (0);
+		s = rd_str(&r);
+		if (!r.ok || (strlen(s) >= 128)) {
+			free(f);
+			r.ok = 0;
+			break;
+		}
+		if (f) {
+			strcpy(f->line, s);
+			f->gen = ++func_gen;
+			htab_insert(&func_tbl, f, strhash(f->name, strlen(f->name)));
+		}
+	}
+
+	/* branches */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		j = rd_int(&r);
+		if (apply)
+			relax_add(j);
+	}
+
+	/* where the file left the assembler */
+	if (!rd_exit(&r, obj, apply))
+		return (0);
+	obj->p2 = r.p - obj->data;
+
+	return (r.ok);
+}
+
+
+/* ----
+ * obj_last()
+ * ----
+ * last pass part of an object: check that what the code the file
+ * produced depends on is the same, then (apply = 1) copy it and
+ * assemble the relocations
+ */
+
+static int
+obj_last(struct t_obj *obj, int apply)
+{
+	struct t_symbol *sym, *glabl, *last;
+	struct t_ord r;
+	unsigned long long h;
+	const char *s, *p;
+	int st[NB_FIELDS];
+	int pos[8];
+	int *snap = NULL;
+	int i, j, n, len, br = 0;
+	int top[3], cur[3];
+
+	r.p = obj->data + obj->p2;
+	r.end = obj->data + obj->size;
+	r.ok = 1;
+
+	/* the state it starts with */
+	h = obj_state(OBJ_HASH);
+	s = rd_mem(&r, sizeof(h));
+	if ((s == NULL) || memcmp(s, &h, sizeof(h)) || sym_moved(obj))
+		return (0);
+
+	/* symbols and names from outside */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		rd_state(&r, st);
+		if (!r.ok)
+			break;
+		if (!apply && (((sym = sym_find(s)) == NULL) || !sym_same(sym, st)))
+			return (0);
+	}
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		if (!apply && s && sym_find(s))
+			return (0);
+	}
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		if (!apply && s && htab_find(&macro_tbl, s, strhash(s, strlen(s))))
+			return (0);
+	}
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		if (!apply && s && htab_find(&func_tbl, s, strhash(s, strlen(s))))
+			return (0);
+	}
+
+	/* the code */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		j = rd_int(&r);
+		len = rd_int(&r);
+		s = rd_mem(&r, len);
+		p = rd_mem(&r, len);
+		if (!r.ok || (j < 0) || (j + len > 128 * 8192)) {
+			r.ok = 0;
+			break;
+		}
+		if (apply) {
+			memcpy(&rom[0][0] + j, s, len);
+			memcpy(&map[0][0] + j, p, len);
+		}
+	}
+
+	/* the relocations; what they do to the symbols of the
+	 * file was done already
+	 */
+	if (apply) {
+		if ((snap = malloc((obj->nb_sym + 1) * NB_FIELDS * sizeof(int))) == NULL) {
+			fatal_error("Out of memory!");
+			return (0);
+		}
+		for (i = 0; i < obj->nb_sym; i++)
+			sym_get(obj->sym[i], &snap[i * NB_FIELDS]);
+		br = br_idx;
+	}
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		s = rd_str(&r);
+		pos[0] = rd_int(&r);
+		pos[1] = rd_int(&r);
+		pos[2] = rd_int(&r);
+		pos[3] = rd_int(&r);
+		glabl = rd_ref(&r, obj, apply);
+		last = rd_ref(&r, obj, apply);
+		pos[4] = rd_int(&r);
+		pos[5] = rd_int(&r);
+		len = rd_int(&r);
+		if (!r.ok || (strlen(s) > LAST_CH_POS - SFIELD)) {
+			r.ok = 0;
+			break;
+		}
+		if (apply) {
+			glablptr = glabl;
+			lastlabl = last;
+			pos[4] += br;
+			obj_relink(obj, s, pos, len);
+		}
+	}
+	n = rd_int(&r);
+	for (i = 0; i < 3; i++)
+		top[i] = rd_int(&r);
+	if (apply) {
+		br_idx = br + n;
+		for (i = 0; i < obj->nb_sym; i++)
+			sym_set(obj->sym[i], &snap[i * NB_FIELDS]);
+		free(snap);
+	}
+
+	/* symbols the last pass changed */
+	n = rd_int(&r);
+	for (i = 0; (i < n) && r.ok; i++) {
+		j = rd_int(&r);
+		rd_state(&r, st);
+		if ((j < 0) || (j >= obj->nb_sym))
+			r.ok = 0;
+		else if (apply && r.ok) {
+			st[F_REFCNT] = obj->sym[j]->refcnt;
+			sym_set(obj->sym[j], st);
+		}
+	}
+
+	/* where the file left the assembler, and the memory it used */
+	for (i = 0; i < 3; i++)
+		cur[i] = *obj_max[i];
+	if (!rd_exit(&r, obj, apply))
+		return (0);
+	for (i = 0; (i < 3) && apply; i++)
+		*obj_max[i] = (cur[i] > top[i]) ? cur[i] : top[i];
+
+	return (r.p == r.end);
+}
+
+
+/* ----
+ * obj_relink()
+ * ----
+ * assemble a relocation again
+ */
+
+static void
+obj_relink(struct t_obj *obj, const char *text, int *pos, int size)
+{
+	char file[512];
+
+	memset(prlnbuf, ' ', SFIELD);
+	strcpy(&prlnbuf[SFIELD], text);
+	loccnt = pos[0];
+	bank = pos[1];
+	page = pos[2];
+	section = pos[3];
+	br_idx = pos[4];
+	if (max_bank < pos[5])
+		max_bank = pos[5];
+	skip_lines = 0;
+	line_ir = NULL;
+	assemble_line(0);
+
+	/* the code must not move */
+	if (loccnt - pos[0] != size) {
+		as_error("Relocation changed size, object removed from the cache!");
+		snprintf(file, sizeof(file), "%s" PATH_SEPARATOR_STRING "%016llx.obj", obj_dir, obj->key);
+		remove(file);
+	}
+}
+
+
+/* ----
+ * obj_save()
+ * ----
+ * copy the bank arrays before the recorded file
+ */
+
+static void
+obj_save(void)
+{
+	memcpy(save_loccnt, bank_loccnt, sizeof(save_loccnt));
+	memcpy(save_page, bank_page, sizeof(save_page));
+	memcpy(save_glabl, bank_glabl, sizeof(save_glabl));
+	memcpy(save_name, bank_name, sizeof(save_name));
+}
+
+
+/* ----
+ * obj_lift()
+ * ----
+ * end the bottom start of a line, see obj_max[]
+ */
+
+static void
+obj_lift(void)
+{
+	int i;
+
+	if (!line_low)
+		return;
+	for (i = 0; i < 3; i++) {
+		if (*obj_max[i] < line_max[i])
+			*obj_max[i] = line_max[i];
+	}
+	line_low = 0;
+}
+
+
+/* ----
+ * obj_end1()
+ * ----
+ * end of the recorded file in the first pass
+ */
+
+static void
+obj_end1(struct t_obj *obj)
+{
+	struct t_obuf *b = &obj->first;
+	struct t_symbol *sym;
+	struct t_macro **mac, *m;
+	struct t_func **fun, *f;
+	struct t_line *ln;
+	int i, j, n;
+
+	obj->mgen[1] = macro_gen;
+	obj->fgen[1] = func_gen;
+
+	/* the file may look at symbols from outside, not change them */
+	for (i = 0; i < obj_nb_used; i++) {
+		if (!sym_same(obj_used[i], &obj_ust[i * NB_FIELDS]))
+			obj_ok = 0;
+	}
+
+	/* its local symbols must be defined, its branches can't be in procs */
+	for (i = 0; i < obj->nb_sym; i++) {
+		sym = obj->sym[i];
+		if ((sym->name[1] == '.') && ((sym->type == UNDEF) || (sym->type == IFUNDEF)))
+			obj_ok = 0;
+	}
+	for (i = obj_br; i < br_nb; i++) {
+		if (br_tbl[i].proc)
+			obj_ok = 0;
+	}
+
+	/* its macros and functions, in the order they were defined */
+	mac = calloc(obj->mgen[1] - obj->mgen[0] + 1, sizeof(struct t_macro *));
+	fun = calloc(obj->fgen[1] - obj->fgen[0] + 1, sizeof(struct t_func *));
+	if ((mac == NULL) || (fun == NULL))
+		obj_ok = 0;
+	else {
+		for (i = 0; i < macro_tbl.size; i++) {
+			m = macro_tbl.slot[i];
+			if (m && (m->gen > obj->mgen[0]))
+				mac[m->gen - obj->mgen[0] - 1] = m;
+		}
+		for (i = 0; i < func_tbl.size; i++) {
+			f = func_tbl.slot[i];
+			if (f && (f->gen > obj->fgen[0]))
+				fun[f->gen - obj->fgen[0] - 1] = f;
+		}
+		for (i = 0; i < obj->mgen[1] - obj->mgen[0]; i++) {
+			if (mac[i] == NULL)
+				obj_ok = 0;
+		}
+		for (i = 0; i < obj->fgen[1] - obj->fgen[0]; i++) {
+			if (fun[i] == NULL)
+				obj_ok = 0;
+		}
+	}
+	if (!obj_ok) {
+		obj->mode = OBJ_SOURCE;
+		free(mac);
+		free(fun);
+		return;
+	}
+
+	/* symbols from outside */
+	ob_int(b, obj_nb_used);
+	for (i = 0; i < obj_nb_used; i++) {
+		ob_str(b, obj_used[i]->name);
+		ob_mem(b, &obj_ust[i * NB_FIELDS], NB_FIELDS * sizeof(int));
+		ob_int(b, obj_used[i]->refcnt - obj_ust[i * NB_FIELDS + F_REFCNT]);
+	}
+	ob_names(b, &obj_absent);
+
+	/* symbols of the file, and their state for the last pass */
+	obj->st = malloc((obj->nb_sym + 1) * NB_FIELDS * sizeof(int));
+	if (obj->st == NULL) {
+		fatal_error("Out of memory!");
+		return;
+	}
+	ob_int(b, obj->nb_sym);
+	for (i = 0; i < obj->nb_sym; i++) {
+		sym = obj->sym[i];
+		sym_get(sym, &obj->st[i * NB_FIELDS]);
+		ob_str(b, sym->name);
+		ob_int(b, obj_par[i]);
+		ob_state(b, sym);
+	}
+
+
+	/* macros and functions */
+	n = obj->mgen[1] - obj->mgen[0];
+	ob_int(b, n);
+	for (i = 0; i < n; i++) {
+		ob_str(b, mac[i]->name);
+		j = 0;
+		for (ln = mac[i]->line; ln; ln = ln->next)
+			j++;
+		ob_int(b, j);
+		for (ln = mac[i]->line; ln; ln = ln->next)
+			ob_str(b, ln->data);
+	}
+	n = obj->fgen[1] - obj->fgen[0];
+	ob_int(b, n);
+	for (i = 0; i < n; i++) {
+		ob_str(b, fun[i]->name);
+		ob_str(b, fun[i]->line);
+	}
+	free(mac);
+	free(fun);
+
+	/* branches */
+	ob_int(b, br_nb - obj_br);
+	for (i = obj_br; i < br_nb; i++)
+		ob_int(b, br_tbl[i].far);
+
+	/* where it left the assembler */
+	ob_exit(b);
+	if (!obj_ok)
+		obj->mode = OBJ_SOURCE;
+}
+
+
+/* ----
+ * obj_end2()
+ * ----
+ * end of the recorded file in the last pass
+ */
+
+static void
+obj_end2(struct t_obj *obj)
+{
+	struct t_obuf last;
+	int i, j, n;
+
+	memset(&last, 0, sizeof(last));
+	obj->last = OBJ_RECORD;
+
+	/* the state it started with */
+	ob_mem(&last, &obj_entry, sizeof(obj_entry));
+
+	/* symbols and names from outside */
+	ob_int(&last, obj_nb_guard);
+	ob_mem(&last, obj_guard.data, obj_guard.len);
+	ob_names(&last, &obj_absent);
+	ob_absent(&last, &obj->nomac, &macro_tbl, offsetof(struct t_macro, gen), obj->mgen);
+	ob_absent(&last, &obj->nofunc, &func_tbl, offsetof(struct t_func, gen), obj->fgen);
+
+	/* the bytes it wrote, but those of the relocations */
+	for (n = 0, i = 0; i < 128 * 8192; i++) {
+		if ((obj_dirty[i] == 1) && ((i == 0) || (obj_dirty[i - 1] != 1)))
+			n++;
+	}
+	ob_int(&last, n);
+	for (i = 0; i < 128 * 8192; i = j) {
+		if (obj_dirty[i] != 1) {
+			j = i + 1;
+			continue;
+		}
+		for (j = i; (j < 128 * 8192) && (obj_dirty[j] == 1); j++)
+			;
+		ob_int(&last, i);
+		ob_int(&last, j - i);
+		ob_mem(&last, &rom[0][0] + i, j - i);
+		ob_mem(&last, &map[0][0] + i, j - i);
+	}
+
+	/* relocations, and the branches they use */
+	ob_int(&last, obj_nb_reloc);
+	ob_mem(&last, obj_reloc.data, obj_reloc.len);
+	ob_int(&last, br_idx - obj_br);
+	ob_mem(&last, obj_top, sizeof(obj_top));
+
+	/* symbols of the file the last pass changed; only those
+	 * it defined itself are the same wherever it is linked
+	 */
+	for (n = 0, i = 0; i < obj->nb_sym; i++) {
+		if (!sym_same(obj->sym[i], &obj_snap[i * NB_FIELDS])) {
+			if (!sym_fixed(obj, obj->sym[i]))
+				obj_ok = 0;
+			n++;
+		}
+	}
+	ob_int(&last, n);
+	for (i = 0; i < obj->nb_sym; i++) {
+		if (!sym_same(obj->sym[i], &obj_snap[i * NB_FIELDS])) {
+			ob_int(&last, i);
+			ob_state(&last, obj->sym[i]);
+		}
+	}
+
+	/* where it left the assembler */
+	ob_exit(&last);
+
+	if (obj_ok)
+		obj_write(obj, &last);
+
+	free(last.data);
+	free(obj_dirty);
+	free(obj_snap);
+	obj_dirty = NULL;
+	obj_snap = NULL;
+}
+
+
+/* ----
+ * obj_write()
+ * ----
+ * store the object of a file
+ */
+
+static void
+obj_write(struct t_obj *obj, struct t_obuf *last)
+{
+	char file[512];
+	char temp[532];
+	FILE *fp;
+	int ok;
+
+	snprintf(file, sizeof(file), "%s" PATH_SEPARATOR_STRING "%016llx.obj", obj_dir, obj->key);
+	snprintf(temp, sizeof(temp), "%s.%d", file, (int)getpid());
+	if ((fp = fopen(temp, "wb")) == NULL)
+		return;
+
+	ok  = (fwrite(OBJ_MAGIC, sizeof(OBJ_MAGIC), 1, fp) == 1);
+	ok &= (fwrite(&obj->key, sizeof(obj->key), 1, fp) == 1);
+	ok &= (fwrite(&obj->nb_deps, sizeof(int), 1, fp) == 1);
+	if (obj->deps.len)
+		ok &= (fwrite(obj->deps.data, obj->deps.len, 1, fp) == 1);
+	if (obj->first.len)
+		ok &= (fwrite(obj->first.data, obj->first.len, 1, fp) == 1);
+	ok &= (fwrite(last->data, last->len, 1, fp) == 1);
+	ok &= (fclose(fp) == 0);
+
+	/* readers see the old object or the new one */
+	if (ok && (rename(temp, file) == 0))
+		obj->last = OBJ_WRITTEN;
+	else
+		remove(temp);
+}
+
+
+/* ----
+ * obj_free()
+ * ----
+ */
+
+static void
+obj_free(struct t_obj *obj)
+{
+	name_free(&obj->nomac);
+	name_free(&obj->nofunc);
+	free(obj->data);
+	free(obj->sym);
+	free(obj->st);
+	free(obj->deps.data);
+	free(obj->first.data);
+	free(obj);
+}
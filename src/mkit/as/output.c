@@ -159,6 +159,8 @@ putbyte(int offset, int data)
 	if (offset < 0x2000) {
 		rom[bank][offset] = (data) & 0xFF;
 		map[bank][offset] = section + (page << 5);
+		if (obj_rec)
+			obj_put(offset, 1);
 
 		/* update rom size */
 		if (bank > max_bank)
@@ -186,6 +188,8 @@ putword(int offset, int data)
 		/* high byte */
 		rom[bank][offset + 1] = (data >> 8) & 0xFF;
 		map[bank][offset + 1] = section + (page << 5);
+		if (obj_rec)
+			obj_put(offset, 2);
 
 		/* update rom size */
 		if (bank > max_bank)
@@ -236,6 +240,8 @@ putbuffer(void *data, int size)
 				memset(&rom[bank][loccnt], 0, size);
 				memset(&map[bank][loccnt], section + (page << 5), size);
 			}
+			if (obj_rec)
+				obj_put(loccnt, size);
 		}
 	}
 
@@ -358,36 +364,40 @@ write_srec(char *file, char *ext, int base)
 void
 fatal_error(char *stptr)
 {
-	error(stptr);
+	as_error(stptr);
 	stop_pass = 1;
 }
 
 
 /* ----
- * error()
+ * as_error()
  * ----
  * error printing routine
  */
 
 void
-error(char *stptr)
+as_error(char *stptr)
 {
-	warning(stptr);
-	errcnt++;
+	as_warning(stptr);
+	as_errcnt++;
 }
 
 
 /* ----
- * warning()
+ * as_warning()
  * ----
  * warning printing routine
  */
 
 void
-warning(char *stptr)
+as_warning(char *stptr)
 {
 	int i, temp;
 
+	/* the message must show each time */
+	if (obj_rec)
+		obj_nocache();
+
 	/* put the source line number into prlnbuf */
 	i = 4;
 	temp = slnum;
@@ -94,7 +94,7 @@ pce_pack_8x8_tile(unsigned char *buffer, void *data, int line_offset, int format
 
 	default:
 		/* other formats not supported */
-		error("Internal error: unsupported format passed to 'pack_8x8_tile'!");
+		as_error("Internal error: unsupported format passed to 'pack_8x8_tile'!");
 		break;
 	}
 
@@ -155,7 +155,7 @@ pce_pack_16x16_tile(unsigned char *buffer, void *data, int line_offset, int form
 
 	default:
 		/* other formats not supported */
-		error("Internal error: unsupported format passed to 'pack_16x16_tile'!");
+		as_error("Internal error: unsupported format passed to 'pack_16x16_tile'!");
 		break;
 	}
 
@@ -253,7 +253,7 @@ pce_pack_16x16_sprite(unsigned char *buffer, void *data, int line_offset, int fo
 
 	default:
 		/* other formats not supported */
-		error("Internal error: unsupported format passed to 'pack_16x16_sprite'!");
+		as_error("Internal error: unsupported format passed to 'pack_16x16_sprite'!");
 		break;
 	}
 
@@ -276,7 +276,7 @@ pce_vram(int *ip)
 
 	/* check if there's a label */
 	if (lastlabl == NULL) {
-		error("No label!");
+		as_error("No label!");
 		return;
 	}
 
@@ -284,7 +284,7 @@ pce_vram(int *ip)
 	if (!evaluate(ip, ';'))
 		return;
 	if (value >= 0x7F00) {
-		error("Incorrect VRAM address!");
+		as_error("Incorrect VRAM address!");
 		return;
 	}
 	lastlabl->vram = value;
@@ -311,7 +311,7 @@ pce_pal(int *ip)
 
 	/* check if there's a label */
 	if (lastlabl == NULL) {
-		error("No label!");
+		as_error("No label!");
 		return;
 	}
 
@@ -319,7 +319,7 @@ pce_pal(int *ip)
 	if (!evaluate(ip, ';'))
 		return;
 	if (value > 15) {
-		error("Incorrect palette index!");
+		as_error("Incorrect palette index!");
 		return;
 	}
 	lastlabl->pal = value;
@@ -359,7 +359,7 @@ pce_defchr(int *ip)
 		if (!evaluate(ip, ','))
 			return;
 		if (value >= 0x7F00) {
-			error("Incorrect VRAM address!");
+			as_error("Incorrect VRAM address!");
 			return;
 		}
 		lablptr->vram = value;
@@ -368,7 +368,7 @@ pce_defchr(int *ip)
 		if (!evaluate(ip, ','))
 			return;
 		if (value > 0x0F) {
-			error("Incorrect palette index!");
+			as_error("Incorrect palette index!");
 			return;
 		}
 		lablptr->pal = value;
@@ -451,7 +451,7 @@ pce_defpal(int *ip)
 
 	/* check errors */
 	if (c != ';' && c != '\0')
-		error("Syntax error!");
+		as_error("Syntax error!");
 }
 
 
@@ -482,7 +482,7 @@ pce_defspr(int *ip)
 		if (!evaluate(ip, ','))
 			return;
 		if (value >= 0x7F00) {
-			error("Incorrect VRAM address!");
+			as_error("Incorrect VRAM address!");
 			return;
 		}
 		lablptr->vram = value;
@@ -491,7 +491,7 @@ pce_defspr(int *ip)
 		if (!evaluate(ip, ','))
 			return;
 		if (value > 0x0F) {
-			error("Incorrect palette index!");
+			as_error("Incorrect palette index!");
 			return;
 		}
 		lablptr->pal = value;
@@ -576,7 +576,7 @@ pce_incbat(int *ip)
 
 		/* errors */
 		if (flag)
-			error("Invalid color index found!");
+			as_error("Invalid color index found!");
 	}
 
 	/* store data */
@@ -627,7 +627,7 @@ pce_incpal(int *ip)
 
 	/* check args */
 	if (((start + nb) > 256) || (nb == 0)) {
-		error("Palette index out of range!");
+		as_error("Palette index out of range!");
 		return;
 	}
 
@@ -817,7 +817,7 @@ pce_incmap(int *ip)
 
 	/* error */
 	if (err)
-		error("One or more tiles didn't match!");
+		as_error("One or more tiles didn't match!");
 
 	/* output */
 	if (pass == LAST_PASS)
@@ -870,7 +870,7 @@ pce_mml(int *ip)
 		c = prlnbuf[(*ip)++];
 
 		if ((c != ',') && (c != ';') && (c != '\0')) {
-			error("Syntax error!");
+			as_error("Syntax error!");
 			return;
 		}
 		if (c != ',')
@@ -897,14 +897,14 @@ pce_mml(int *ip)
 				}
 
 				/* read a new line */
-				if (readline() == -1)
+				if (read_line() == -1)
 					return;
 
 				/* rewind line pointer and continue */
 				*ip = SFIELD;
 			}
 			else {
-				error("Syntax error!");
+				as_error("Syntax error!");
 				return;
 			}
 		}
@@ -23,7 +23,7 @@ int mml_parse(unsigned char *buffer, int bufsize, char *ptr);
 
 /* *INDENT-OFF* */
 /* PCE specific instructions */
-struct t_opcode pce_inst[82] = {
+struct t_opcode pce_inst[83] = {
 	{NULL, "BBR",  class10,0, 0x0F, 0},
 	{NULL, "BBR0", class5, 0, 0x0F, 0},
 	{NULL, "BBR1", class5, 0, 0x1F, 0},
@@ -49,6 +49,7 @@ struct t_opcode pce_inst[82] = {
 	{NULL, "CLY",  class1, 0, 0xC2, 0},
 	{NULL, "CSH",  class1, 0, 0xD4, 0},
 	{NULL, "CSL",  class1, 0, 0x54, 0},
+	{NULL, "JBRA", class11,0, 0x80, 0},
 	{NULL, "PHX",  class1, 0, 0xDA, 0},
 	{NULL, "PHY",  class1, 0, 0x5A, 0},
 	{NULL, "PLX",  class1, 0, 0xFA, 0},
@@ -158,6 +159,7 @@ struct t_machine pce = {
 	PCE_ASM_VERSION,	/* asm_title */
 	".pce",			/* rom_ext */
 	"PCE_INCLUDE",		/* include_env */
+	"PCE_OBJ_DIR",		/* obj_env */
 	defdirs_pce,		/* default_dirs */
 	0xD8,			/* zp_limit */
 	0x2000,			/* ram_limit */
@@ -0,0 +1,17 @@
+/*
+ *  pceas.h - library interface to the assembler
+ *
+ *  The assembler objects are archived in libpceas.a so that huc can
+ *  run it in-process on the generated code instead of spawning pceas.
+ *  Both functions take the usual command line arguments (argv[0] picks
+ *  the machine) and return 0 on success; like the command line tool,
+ *  they exit(1) on assembly errors.
+ */
+
+#ifndef PCEAS_H
+#define PCEAS_H
+
+int pceas_main(int argc, char **argv);
+int pceas_assemble(int argc, char **argv, char *src, long len);
+
+#endif
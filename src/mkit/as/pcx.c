@@ -125,16 +125,16 @@ pcx_set_tile(struct t_symbol *ref, unsigned int offset)
 	/* check symbol */
 	if (ref->nb == 0) {
 		if ((ref->type == IFUNDEF) || (ref->type == UNDEF))
-			error("Tile table undefined!");
+			as_error("Tile table undefined!");
 		else
-			error("Incorrect tile table reference!");
+			as_error("Incorrect tile table reference!");
 
 		/* no tile table */
 		tile_lablptr = NULL;
 		return (1);
 	}
 	if (ref->size == 0) {
-		error("Tile table has not been compiled yet!");
+		as_error("Tile table has not been compiled yet!");
 		tile_lablptr = NULL;
 		return (1);
 	}
@@ -187,7 +187,7 @@ pcx_set_tile(struct t_symbol *ref, unsigned int offset)
 	/* error */
 err:
 	tile_lablptr = NULL;
-	error("Incorrect tile table reference!");
+	as_error("Incorrect tile table reference!");
 	return (1);
 }
 
@@ -257,7 +257,7 @@ pcx_get_args(int *ip)
 
 		/* check syntax */
 		if ((c != ',') && (c != ';') && (c != 0)) {
-			error("Syntax error!");
+			as_error("Syntax error!");
 			return (0);
 		}
 		if (c != ',')
@@ -277,7 +277,7 @@ pcx_get_args(int *ip)
 
 	/* check number of args */
 	if (optype & (1 << pcx_nb_args)) {
-		error("Invalid number of arguments!");
+		as_error("Invalid number of arguments!");
 		return (0);
 	}
 
@@ -288,10 +288,10 @@ pcx_get_args(int *ip)
 	/* parse tiles */
 	if (opval == P_INCMAP) {
 		if (expr_lablcnt == 0)
-			error("No tile table reference!");
+			as_error("No tile table reference!");
 		if (expr_lablcnt > 1) {
 			expr_lablcnt = 0;
-			error("Too many tile table references!");
+			as_error("Too many tile table references!");
 		}
 		if (!pcx_set_tile(expr_lablptr, value))
 			return (0);
@@ -334,7 +334,7 @@ pcx_parse_args(int i, int nb, int *a, int *b, int *c, int *d, int size)
 
 	/* check */
 	if (((x + w * size) > pcx_w) || ((y + h * size) > pcx_h)) {
-		error("Coordinates out of range!");
+		as_error("Coordinates out of range!");
 		return (0);
 	}
 
@@ -375,7 +375,7 @@ pcx_load(char *name)
 
 	/* open the file */
 	if ((f = open_file(name, "rb")) == NULL) {
-		error("Can not open file!");
+		as_error("Can not open file!");
 		return (0);
 	}
 
@@ -390,18 +390,18 @@ pcx_load(char *name)
 
 	/* check size range */
 	if ((pcx_w > 1024) || (pcx_h > 768)) {
-		error("Picture size too big, max. 1024x768!");
+		as_error("Picture size too big, max. 1024x768!");
 		return (0);
 	}
 	if ((pcx_w < 16) || (pcx_h < 16)) {
-		error("Picture size too small, min. 16x16!");
+		as_error("Picture size too small, min. 16x16!");
 		return (0);
 	}
 
 	/* malloc a buffer */
 	pcx_buf = malloc(pcx_w * pcx_h);
 	if (pcx_buf == NULL) {
-		error("Can not load file, not enough memory!");
+		as_error("Can not load file, not enough memory!");
 		return (0);
 	}
 
@@ -411,7 +411,7 @@ pcx_load(char *name)
 	else if ((pcx.bpp == 1) && (pcx.np <= 4))
 		decode_16(f, pcx_w, pcx_h);
 	else {
-		error("Unsupported or invalid PCX format!");
+		as_error("Unsupported or invalid PCX format!");
 		return (0);
 	}
 
@@ -469,7 +469,7 @@ decode_256(FILE *f, int w, int h)
 		break;
 
 	default:
-		error("Unsupported PCX encoding scheme!");
+		as_error("Unsupported PCX encoding scheme!");
 		return;
 	}
 
@@ -509,7 +509,7 @@ decode_16(FILE *f, int w, int h)
 	switch (pcx.encoding) {
 	case 0:
 		/* raw */
-		error("Unsupported PCX encoding scheme!");
+		as_error("Unsupported PCX encoding scheme!");
 		break;
 
 	case 1:
@@ -577,7 +577,7 @@ decode_16(FILE *f, int w, int h)
 		break;
 
 	default:
-		error("Unsupported PCX encoding scheme!");
+		as_error("Unsupported PCX encoding scheme!");
 		return;
 	}
 
@@ -6,7 +6,7 @@
 #include "externs.h"
 #include "protos.h"
 
-struct t_proc *proc_tbl[256];
+struct t_htab proc_tbl;
 struct t_proc *proc_ptr;
 struct t_proc *proc_first;
 struct t_proc *proc_last;
@@ -18,7 +18,32 @@ int call_bank;
 struct t_proc *proc_look(void);
 int            proc_install(void);
 void           poke(int addr, int data);
-void           proc_sortlist(void);
+int            proc_cmp(const void *a, const void *b);
+int            proc_bestfit(void);
+int            proc_search(int banks, int *where);
+int            proc_fit(int k, int banks, int *left, int *where);
+void           proc_place(int banks, int *where);
+
+/* search steps allowed for each try at saving a bank */
+#define PACK_NODES	100000
+
+/* proc banks, as proc_reloc() filled them */
+typedef struct t_pbank {
+	int used;		/* bytes used */
+	int nb;			/* number of procs and groups */
+	struct t_proc *first;	/* the biggest one, which opened the bank */
+} t_pbank;
+
+struct t_proc **pack_item;	/* procs and groups to place, biggest first */
+struct t_pbank *pack_bank;
+int pack_nb;			/* number of procs and groups */
+int pack_total;			/* their size */
+int pack_base;			/* first proc bank */
+int pack_limit;			/* number of banks available */
+int pack_low;			/* fewest banks they could fit in */
+int pack_bfd;			/* banks that best fit needed */
+int pack_used;			/* banks used in the end */
+long pack_nodes;		/* search steps left */
 
 
 /* ----
@@ -210,6 +235,10 @@ do_proc(int *ip)
 	loccnt   = proc_ptr->org;
 	glablptr = lablptr;
 
+	/* branch count at proc start */
+	if (pass == FIRST_PASS)
+		relax_proc(0);
+
 	/* define label */
 	labldef(loccnt, 1);
 
@@ -244,6 +273,8 @@ do_endp(int *ip)
 		return;
 
 	/* record proc size */
+	if (pass == FIRST_PASS)
+		relax_proc(1);
 	bank = proc_ptr->old_bank;
 	proc_ptr->size = loccnt - proc_ptr->base;
 	proc_ptr = proc_ptr->group;
@@ -272,174 +303,115 @@ proc_reloc(void)
 {
 	struct t_symbol *sym;
 	struct t_symbol *local;
-	struct t_proc   *group;
+	struct t_proc **sorted;
+	struct t_proc *ptr;
+	char msg[128];
+	int *where;
 	int i;
-	int *bankleft = NULL;
-	int bank_base = 0;
-	int minbanks = 0;
-	int totalsize = 0;
-	struct t_proc *list = proc_first;
 
 	if (proc_nb == 0)
 		return;
 
-	/* init */
-	proc_ptr = proc_first;
-	bank = max_bank + 1;
-	bank_base = bank;
-
-	while(list)
-	{
-		totalsize += list->size;
-		list = list->link;
-	}
-
-	minbanks = totalsize / 0x2000 + bank_base;
-
-	if(minbanks > bank_limit)
-	{
-		printf("Bank need excceed Bank limit, aborting\n");
+	/* the procs and groups to place */
+	free(pack_item);
+	free(pack_bank);
+	pack_nb = 0;
+	for (ptr = proc_first; ptr; ptr = ptr->link)
+		if (ptr->group == NULL)
+			pack_nb++;
+	pack_item = malloc(pack_nb * sizeof(struct t_proc *));
+	pack_bank = malloc(pack_nb * sizeof(struct t_pbank));
+	where = malloc(pack_nb * sizeof(int));
+	if (pack_item == NULL || pack_bank == NULL || where == NULL) {
+		free(where);
+		fatal_error("Not enough RAM to allocate banks!");
 		return;
 	}
+	pack_total = 0;
+	i = 0;
+	for (ptr = proc_first; ptr; ptr = ptr->link) {
+		if (ptr->group)
+			continue;
+		if (ptr->size > 0x2000) {
+			sprintf(msg, "Proc %.64s is bigger than a bank!", ptr->name);
+			fatal_error(msg);
+			free(where);
+			return;
+		}
+		pack_item[i++] = ptr;
+		pack_total += ptr->size;
+	}
 
-	/* Bin packing, descending order sort */
-	proc_sortlist();
-
-	bankleft = (int*)malloc(sizeof(int)*bank_limit);
-	if(!bankleft)
-	{
+	/* biggest first, in source order when they are the same size */
+	sorted = malloc(pack_nb * sizeof(struct t_proc *));
+	if (sorted == NULL) {
+		free(where);
 		fatal_error("Not enough RAM to allocate banks!");
 		return;
 	}
-
-	for(i = 0; i < bank_limit; i++)
-	{
-		if(i >= bank_base)
-			bankleft[i] = 0x2000;
-		else
-			bankleft[i] = 0;
+	for (i = 0; i < pack_nb; i++)
+		where[i] = i;
+	qsort(where, pack_nb, sizeof(int), proc_cmp);
+	for (i = 0; i < pack_nb; i++)
+		sorted[i] = pack_item[where[i]];
+	free(pack_item);
+	pack_item = sorted;
+
+	/* best fit decreasing, then try to do with fewer banks */
+	pack_base = max_bank + 1;
+	pack_limit = bank_limit - pack_base;
+	pack_low = (pack_total + 0x1FFF) / 0x2000;
+	pack_bfd = proc_bestfit();
+	pack_used = pack_bfd;
+	while (pack_used > pack_low && proc_search(pack_used - 1, where))
+		proc_place(pack_used - 1, where);
+
+	/* out of space */
+	if (pack_used > pack_limit) {
+		fatal_error("Not enough ROM space for procs!");
+		show_proc_usage();
+		free(where);
+		return;
 	}
-
-	proc_ptr = proc_first;
-
-	/* alloc memory */
-	while (proc_ptr) {
-		/* proc */
-		if (proc_ptr->group == NULL) {
-			int check = 0;
-			int unusedspace = 0x2000;
-			int proposedbank = -1;
-
-			while(proposedbank == -1)
-			{
-				for(check = 0; check < minbanks; check++)
-				{
-					if(bankleft[check] > proc_ptr->size)
-					{
-						if(unusedspace > bankleft[check] - proc_ptr->size)
-						{
-							unusedspace = bankleft[check] - proc_ptr->size;
-							proposedbank = check;
-						}
-					}
-				}
-
-				if(proposedbank == -1)
-				{
-					/* bank change */
-					minbanks++;
-					if (minbanks > bank_limit) 
-					{
-						int total = 0;
-		
-						fatal_error("Not enough ROM space for procs!");
-		
-						for(i = bank_base; i < bank; i++)
-						{
-							printf("Bank %d: %d free\n", i, bankleft[i]);
-							total += bankleft[i];
-						}
-						printf("Total free space in all banks %d\n", total);
-		
-						total = 0;
-						proc_ptr = proc_first;
-						while (proc_ptr) {
-							printf("Proc: %s Bank: 0x%X Size: %d\n", proc_ptr->name, proc_ptr->bank == 241 ? 0 : proc_ptr->bank, proc_ptr->size);
-							if(proc_ptr->bank == 241)
-								total += proc_ptr->size;
-							proc_ptr = proc_ptr->link;
-						}
-						printf("Total bytes that didn't fit in ROM %d\n", total);
-						errcnt++;
-						return;
-					}
-					proposedbank = minbanks - 1;
-				}
-			}
-			
-			
-			proc_ptr->bank = proposedbank;
-			proc_ptr->org = 0x2000 - bankleft[proposedbank];
-
-			bankleft[proposedbank] -= proc_ptr->size;
+	free(where);
+
+	/* set the procs' address */
+	for (i = 0; i < pack_nb; i++)
+		pack_item[i]->bank += pack_base;
+	for (ptr = proc_first; ptr; ptr = ptr->link) {
+		/* procs in a group follow it */
+		if (ptr->group) {
+			ptr->bank = ptr->group->bank;
+			ptr->org += (ptr->group->org - ptr->group->base);
 		}
-
-		/* group */
-		else {
-			/* reloc proc */
-			group = proc_ptr->group;
-			proc_ptr->bank = bank;
-			proc_ptr->org += (group->org - group->base);
-		}
-
-		/* next */
-		bank = minbanks-1;
-		max_bank = bank;
-		proc_ptr->refcnt = 0;
-		proc_ptr = proc_ptr->link;
+		ptr->refcnt = 0;
 	}
-
-	free(bankleft);
-	bankleft = NULL;
+	max_bank = pack_base + pack_used - 1;
 
 	/* remap proc symbols */
-	for (i = 0; i < 256; i++) {
-		sym = hash_tbl[i];
+	for (i = 0; i < hash_tbl.size; i++) {
+		if ((sym = hash_tbl.slot[i]) == NULL)
+			continue;
 
-		while (sym) {
+		/* remap addr */
+		if (sym->proc) {
 			proc_ptr = sym->proc;
-
-			/* remap addr */
-			if (sym->proc) {
-				sym->bank   =  proc_ptr->bank;
-				sym->value += (proc_ptr->org - proc_ptr->base);
-
-				/* local symbols */
-				if (sym->local) {
-					local = sym->local;
-	
-					while (local) {
-						proc_ptr = local->proc;
-			
-						/* remap addr */
-						if (local->proc) {
-							local->bank   =  proc_ptr->bank;
-							local->value += (proc_ptr->org - proc_ptr->base);
-						}
-		
-						/* next */
-						local = local->next;
-					}
+			sym->bank   =  proc_ptr->bank;
+			sym->value += (proc_ptr->org - proc_ptr->base);
+
+			/* local symbols */
+			for (local = sym->local; local; local = local->next) {
+				if (local->proc) {
+					proc_ptr = local->proc;
+					local->bank   =  proc_ptr->bank;
+					local->value += (proc_ptr->org - proc_ptr->base);
 				}
 			}
-
-			/* next */
-			sym = sym->next;
 		}
 	}
 
 	/* reserve call bank */
-	lablset("_call_bank", bank_base + max_bank + 1);
+	lablset("_call_bank", pack_base + max_bank + 1);
 
 	/* reset */
 	proc_ptr = NULL;
@@ -456,20 +428,8 @@ proc_reloc(void)
 struct t_proc *
 proc_look(void)
 {
-	struct t_proc *ptr;
-	int hash;
-
 	/* search the procedure in the hash table */
-	hash = symhash();
-	ptr = proc_tbl[hash];
-	while (ptr) {
-		if (!strcmp(&symbol[1], ptr->name))
-			break;			
-		ptr = ptr->next;
-	}
-
-	/* ok */
-	return (ptr);
+	return (htab_find(&proc_tbl, &symbol[1], sym_hash()));
 }
 
 
@@ -484,29 +444,31 @@ int
 proc_install(void)
 {
 	struct t_proc *ptr;
-	int hash;
 
 	/* allocate a new proc struct */
 	if ((ptr = (void *)malloc(sizeof(struct t_proc))) == NULL) {
-		error("Out of memory!");
+		as_error("Out of memory!");
 		return (0);
 	}
 
 	/* initialize it */
 	strcpy(ptr->name, &symbol[1]);
-	hash = symhash();
 	ptr->bank = (optype == P_PGROUP)  ? GROUP_BANK : PROC_BANK;
 	ptr->base = proc_ptr ? loccnt : 0;
 	ptr->org = ptr->base;
 	ptr->size = 0;
 	ptr->call = 0;
 	ptr->refcnt = 0;
+	ptr->br_base = 0;
+	ptr->br_end = 0;
+	ptr->br_last = 0;
+	ptr->br_grow = 0;
 	ptr->link = NULL;
-	ptr->next = proc_tbl[hash];
 	ptr->group = proc_ptr;
 	ptr->type = optype;
 	proc_ptr = ptr;
-	proc_tbl[hash] = proc_ptr;
+	if (!htab_insert(&proc_tbl, proc_ptr, sym_hash()))
+		return (0);
 
 	/* link it */
 	if (proc_first == NULL) {
@@ -536,55 +498,199 @@ poke(int addr, int data)
 	map[call_bank][addr] = S_CODE + (4 << 5);
 }
 
+
 /* ----
- * proc_sortlist()
+ * proc_cmp()
  * ----
- *
+ * qsort() order of the procs, by their index in pack_item[]:
+ * biggest first, then the first one seen
  */
 
-void
-proc_sortlist(void)
+int
+proc_cmp(const void *a, const void *b)
+{
+	int i = *(const int *)a;
+	int j = *(const int *)b;
+
+	if (pack_item[i]->size != pack_item[j]->size)
+		return (pack_item[j]->size - pack_item[i]->size);
+	return (i - j);
+}
+
+
+/* ----
+ * proc_bestfit()
+ * ----
+ * put each proc in the bank where it leaves the least room,
+ * opening a new bank when it fits nowhere; return the number
+ * of banks used
+ */
+
+int
+proc_bestfit(void)
 {
-	struct t_proc *unsorted_list = proc_first;
-	struct t_proc *sorted_list = NULL;
-	while(unsorted_list)
-	{
-		proc_ptr = unsorted_list;
-		unsorted_list = unsorted_list->link;
-		proc_ptr->link = NULL;
-
-		/* link it */
-		if (sorted_list == NULL) 
-		{
-			sorted_list = proc_ptr;
+	struct t_proc *ptr;
+	int banks = 0;
+	int best;
+	int i, j;
+
+	for (i = 0; i < pack_nb; i++) {
+		ptr = pack_item[i];
+		best = -1;
+		for (j = 0; j < banks; j++) {
+			if (pack_bank[j].used + ptr->size > 0x2000)
+				continue;
+			if (best < 0 || pack_bank[j].used > pack_bank[best].used)
+				best = j;
 		}
-		else 
-		{
-			int inserted = 0;
-			struct t_proc *list = sorted_list;
-			struct t_proc *previous = NULL;
-			while(!inserted && list)
-			{
-				if(list->size < proc_ptr->size)
-				{
-					if(!previous)
-						sorted_list = proc_ptr;
-					else
-						previous->link = proc_ptr;
-					proc_ptr->link = list;
-					inserted = 1;
-				}
-				else
-				{
-					previous = list;
-					list = list->link;
-				}
-			}
-	
-			if(!inserted)
-				previous->link = proc_ptr;
+
+		/* bank change */
+		if (best < 0) {
+			best = banks++;
+			pack_bank[best].used = 0;
+			pack_bank[best].nb = 0;
+			pack_bank[best].first = ptr;
+		}
+		ptr->bank = best;
+		ptr->org = pack_bank[best].used;
+		pack_bank[best].used += ptr->size;
+		pack_bank[best].nb++;
+	}
+	return (banks);
+}
+
+
+/* ----
+ * proc_search()
+ * ----
+ * look for a way to put all the procs in <banks> banks, trying
+ * the biggest procs first; gives up after PACK_NODES steps
+ */
+
+int
+proc_search(int banks, int *where)
+{
+	int *left;
+	int i, found;
+
+	left = malloc(banks * sizeof(int));
+	if (left == NULL)
+		return (0);
+	for (i = 0; i < banks; i++)
+		left[i] = 0x2000;
+
+	pack_nodes = PACK_NODES;
+	found = proc_fit(0, banks, left, where);
+	free(left);
+	return (found);
+}
+
+
+/* ----
+ * proc_fit()
+ * ----
+ * place procs <k> and up in the room <left> in the banks
+ */
+
+int
+proc_fit(int k, int banks, int *left, int *where)
+{
+	int empty = 0;
+	int size;
+	int i;
+
+	if (k == pack_nb)
+		return (1);
+	if (--pack_nodes < 0)
+		return (0);
+
+	size = pack_item[k]->size;
+	for (i = 0; i < banks; i++) {
+		if (left[i] < size)
+			continue;
+
+		/* empty banks are as good as each other */
+		if (left[i] == 0x2000) {
+			if (empty)
+				continue;
+			empty = 1;
 		}
+
+		left[i] -= size;
+		where[k] = i;
+		if (proc_fit(k + 1, banks, left, where))
+			return (1);
+		left[i] += size;
+		if (pack_nodes < 0)
+			return (0);
 	}
-	proc_first = sorted_list;
-	return;
-}
\ No newline at end of file
+	return (0);
+}
+
+
+/* ----
+ * proc_place()
+ * ----
+ * take the placement found by proc_search()
+ */
+
+void
+proc_place(int banks, int *where)
+{
+	struct t_proc *ptr;
+	int i, j;
+
+	for (j = 0; j < banks; j++) {
+		pack_bank[j].used = 0;
+		pack_bank[j].nb = 0;
+		pack_bank[j].first = NULL;
+	}
+	for (i = 0; i < pack_nb; i++) {
+		ptr = pack_item[i];
+		j = where[i];
+		if (pack_bank[j].first == NULL)
+			pack_bank[j].first = ptr;
+		ptr->bank = j;
+		ptr->org = pack_bank[j].used;
+		pack_bank[j].used += ptr->size;
+		pack_bank[j].nb++;
+	}
+
+	/* the search may have left the last banks empty */
+	pack_used = banks;
+	while (pack_used && pack_bank[pack_used - 1].nb == 0)
+		pack_used--;
+}
+
+
+/* ----
+ * show_proc_usage()
+ * ----
+ * show how full each proc bank is and which proc opened it
+ */
+
+void
+show_proc_usage(void)
+{
+	int over = 0;
+	int room = 0;
+	int i;
+
+	if (pack_nb == 0)
+		return;
+
+	printf("\nproc banks: %i used, %i available, %i at least, %i with best fit\n\n",
+	       pack_used, pack_limit, pack_low, pack_bfd);
+	for (i = 0; i < pack_used; i++) {
+		printf("BANK %2X  %4i/%4i  %4i procs  opened by %s%s\n",
+		       pack_base + i, pack_bank[i].used, 0x2000 - pack_bank[i].used,
+		       pack_bank[i].nb, pack_bank[i].first->name,
+		       (i < pack_limit) ? "" : "  (over the limit)");
+		if (i < pack_limit)
+			room += 0x2000 - pack_bank[i].used;
+		else
+			over += pack_bank[i].used;
+	}
+	if (over)
+		printf("%i bytes free in the banks available, %i bytes didn't fit\n", room, over);
+}
@@ -1,7 +1,8 @@
 /* ASSEMBLE.C */
-void assemble(int do_label);
+void assemble_line(int do_label);
 int  oplook(int *idx);
 void addinst(struct t_opcode *optbl);
+void inst_hash(void);
 int  check_eol(int *ip);
 void do_if(int *ip);
 void do_else(int *ip);
@@ -19,6 +20,7 @@ void class7(int *ip);
 void class8(int *ip);
 void class9(int *ip);
 void class10(int *ip);
+void class11(int *ip);
 int  getoperand(int *ip, int flag, int last_char);
 int  getstring(int *ip, char *buffer, int size);
 
@@ -60,6 +62,7 @@ int  check_keyword(void);
 int  push_op(int op);
 int  do_op(void);
 int  check_func_args(char *func_name);
+void expr_free(struct t_expr *e);
 
 /* FUNC.C */
 void do_func(int *ip);
@@ -68,11 +71,21 @@ int  func_install(int ip);
 int  func_extract(int ip);
 int  func_getargs(void);
 
+/* HASH.C */
+unsigned int strhash(const char *name, int len);
+void  htab_init(struct t_htab *ht, char *title, int name_ofs);
+void *htab_find(struct t_htab *ht, const char *name, unsigned int hash);
+int   htab_insert(struct t_htab *ht, void *entry, unsigned int hash);
+void  htab_stats(struct t_htab *ht);
+
 /* INPUT.C */
-void  init_path(void);
-int   readline(void);
+void  init_incpath(void);
+int   read_line(void);
 int   open_input(char *name);
 int   close_input(void);
+void  rewind_input(void);
+void  free_sources(void);
+void  show_source_stats(void);
 FILE *open_file(char *fname, char *mode);
 
 /* MACRO.C */
@@ -88,10 +101,30 @@ int  main(int argc, char **argv);
 int  calc_bank_base(void);
 void help(void);
 void show_seg_usage(void);
+void show_hash_stats(void);
 
 /* MAP.C */
 int pce_load_map(char *fname, int mode);
 
+/* OBJ.C */
+void obj_init(void);
+int  obj_include(char *fname);
+void obj_record(void);
+void obj_close(void);
+void obj_replay(void);
+void obj_line(int end);
+void obj_use(struct t_symbol *sym);
+void obj_new(struct t_symbol *sym, int local);
+void obj_macro(struct t_macro *ptr, char *name);
+void obj_func(struct t_func *ptr);
+void obj_put(int offset, int size);
+void obj_pseudo(void);
+void obj_nocache(void);
+void obj_source(struct t_source *src);
+void obj_file(char *name);
+unsigned long long obj_hash(const void *data, long len);
+void obj_stats(void);
+
 /* OUTPUT.C */
 void println(void);
 void clearln(void);
@@ -101,8 +134,8 @@ void putbyte(int offset, int data);
 void putword(int offset, int data);
 void putbuffer(void *data, int size);
 void write_srec(char *fname, char *ext, int base);
-void error(char *stptr);
-void warning(char *stptr);
+void as_error(char *stptr);
+void as_warning(char *stptr);
 void fatal_error(char *stptr);
 
 /* PCX.C */
@@ -122,12 +155,20 @@ void do_call(int *ip);
 void do_proc(int *ip);
 void do_endp(int *ip);
 void proc_reloc(void);
+void show_proc_usage(void);
+
+/* RELAX.C */
+int  relax_branch(void);
+void relax_add(int far);
+void relax_label(struct t_symbol *sym);
+void relax_proc(int end);
+void relax_resolve(void);
 
 /* SYMBOL.C */
-int  symhash(void);
+unsigned int sym_hash(void);
 int  colsym(int *ip);
 struct t_symbol *stlook(int flag);
-struct t_symbol *stinstall(int hash, int type);
+struct t_symbol *stinstall(unsigned int hash, int type);
 int  labldef(int lval, int flag);
 void lablset(char *name, int val);
 int  lablexists(char *name);
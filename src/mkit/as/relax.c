@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "defs.h"
+#include "externs.h"
+#include "protos.h"
+
+extern struct t_symbol *expr_lablptr;	/* pointer to the lastest label */
+extern int expr_lablcnt;		/* number of label seen in an expression */
+
+/* relaxable branches, in source order */
+struct t_branch *br_tbl;
+int br_nb;
+int br_max;
+int br_idx;
+
+/* protos */
+struct t_proc *relax_stream(struct t_proc *ptr);
+int            relax_growth(int last);
+static struct t_branch *relax_new(void);
+
+
+/* ----
+ * relax_branch()
+ * ----
+ * decide between the short and the long form of a relaxable
+ * branch; in the first pass branches inside procs start short
+ * and are settled later by relax_resolve(), elsewhere the code
+ * never moves so the decision can be taken right away;
+ * the last pass replays the decisions of the first one
+ */
+
+int
+relax_branch(void)
+{
+	struct t_branch *br;
+	struct t_symbol *sym;
+	int addr;
+
+	/* last pass */
+	if (pass == LAST_PASS) {
+		if (br_idx >= br_nb) {
+			fatal_error("Internal error[2]!");
+			return (-1);
+		}
+		return (br_tbl[br_idx++].far);
+	}
+
+	/* record the branch */
+	if ((br = relax_new()) == NULL)
+		return (-1);
+	sym = (expr_lablcnt == 1) ? expr_lablptr : NULL;
+	br->sym = sym;
+	br->proc = NULL;
+	br->offset = (sym && !undef) ? (value - sym->value) : 0;
+	br->addr = loccnt + 2 + (page << 13);
+	br->delta = (opval == 0x80) ? 1 : 3;
+	br->grow = 0;
+
+	/* inside a proc, start short and wait for the end of the pass */
+	if (proc_ptr && (section == S_CODE) && sym) {
+		br->proc = relax_stream(proc_ptr);
+		br->proc->br_last = br_nb;
+		br->far = 0;
+		return (0);
+	}
+
+	/* elsewhere only a known target in the same bank can be near */
+	addr = value - br->addr;
+	br->far = undef || (addr > 0x7F) || (addr < -0x80) ||
+		 (sym && (sym->proc || (sym->bank != bank_base + bank)));
+	return (br->far);
+}
+
+
+/* ----
+ * relax_add()
+ * ----
+ * add a branch decided elsewhere (by an object, see obj.c)
+ */
+
+void
+relax_add(int far)
+{
+	struct t_branch *br;
+
+	if ((br = relax_new()) == NULL)
+		return;
+	memset(br, 0, sizeof(struct t_branch));
+	br->far = far;
+}
+
+
+/* ----
+ * relax_new()
+ * ----
+ * grow the branch table by one entry
+ */
+
+static struct t_branch *
+relax_new(void)
+{
+	struct t_branch *br;
+
+	if (br_nb == br_max) {
+		br_max = br_max ? (br_max * 2) : 256;
+		br = (void *)realloc(br_tbl, br_max * sizeof(struct t_branch));
+		if (br == NULL) {
+			fatal_error("Out of memory!");
+			return (NULL);
+		}
+		br_tbl = br;
+	}
+
+	return (&br_tbl[br_nb++]);
+}
+
+
+/* ----
+ * relax_label()
+ * ----
+ * remember how many branches of the current proc precede a label
+ */
+
+void
+relax_label(struct t_symbol *sym)
+{
+	if (proc_ptr && (section == S_CODE))
+		sym->br_last = relax_stream(proc_ptr)->br_last;
+}
+
+
+/* ----
+ * relax_proc()
+ * ----
+ * record the branch count at the start and at the end of a proc
+ */
+
+void
+relax_proc(int end)
+{
+	struct t_proc *top = relax_stream(proc_ptr);
+
+	if (end)
+		proc_ptr->br_end = top->br_last;
+	else
+		proc_ptr->br_base = top->br_last;
+}
+
+
+/* ----
+ * relax_resolve()
+ * ----
+ * grow the out-of-range proc branches until no more change,
+ * then move the labels and resize the procs accordingly
+ */
+
+void
+relax_resolve(void)
+{
+	struct t_branch *br;
+	struct t_symbol *sym;
+	struct t_symbol *local;
+	struct t_proc *ptr;
+	int changed;
+	int addr;
+	int i;
+
+	if (br_nb == 0)
+		return;
+
+	/* iterate */
+	do {
+		changed = 0;
+
+		/* cumulative growth of each proc */
+		for (ptr = proc_first; ptr; ptr = ptr->link)
+			ptr->br_grow = 0;
+
+		for (i = 0; i < br_nb; i++) {
+			br = &br_tbl[i];
+			if (br->proc == NULL)
+				continue;
+			if (br->far)
+				br->proc->br_grow += br->delta;
+			br->grow = br->proc->br_grow;
+		}
+
+		/* check the short branches */
+		for (i = 0; i < br_nb; i++) {
+			br = &br_tbl[i];
+			if ((br->proc == NULL) || (br->far))
+				continue;
+
+			sym = br->sym;
+
+			if ((sym->type == UNDEF) || (sym->type == IFUNDEF) ||
+			    (sym->proc == NULL) || (relax_stream(sym->proc) != br->proc))
+				br->far = 1;
+			else {
+				addr = (sym->value + br->offset + relax_growth(sym->br_last)) -
+				       (br->addr + br->grow);
+				if ((addr > 0x7F) || (addr < -0x80))
+					br->far = 1;
+			}
+			if (br->far)
+				changed = 1;
+		}
+	} while (changed);
+
+	/* move the labels */
+	for (i = 0; i < hash_tbl.size; i++) {
+		if ((sym = hash_tbl.slot[i]) == NULL)
+			continue;
+		if (sym->proc)
+			sym->value += relax_growth(sym->br_last);
+
+		for (local = sym->local; local; local = local->next) {
+			if (local->proc)
+				local->value += relax_growth(local->br_last);
+		}
+	}
+
+	/* resize the procs */
+	for (ptr = proc_first; ptr; ptr = ptr->link) {
+		ptr->size += relax_growth(ptr->br_end) - relax_growth(ptr->br_base);
+		if (ptr->group) {
+			ptr->base += relax_growth(ptr->br_base);
+			ptr->org = ptr->base;
+		}
+	}
+}
+
+
+/* ----
+ * relax_stream()
+ * ----
+ * outermost proc/group, procs inside a group share its code
+ */
+
+struct t_proc *
+relax_stream(struct t_proc *ptr)
+{
+	while (ptr->group)
+		ptr = ptr->group;
+
+	return (ptr);
+}
+
+
+/* ----
+ * relax_growth()
+ * ----
+ * growth of a proc after its first 'last' branches
+ */
+
+int
+relax_growth(int last)
+{
+	return (last ? br_tbl[last - 1].grow : 0);
+}
+
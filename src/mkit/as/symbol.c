@@ -6,28 +6,19 @@
 #include "externs.h"
 #include "protos.h"
 
+int sym_serial;		/* number of symbols created */
+
 
 /* ----
- * symhash()
+ * sym_hash()
  * ----
  * calculate the hash value of a symbol
  */
 
-int
-symhash(void)
+unsigned int
+sym_hash(void)
 {
-	int i;
-	char c;
-	int hash = 0;
-
-	/* hash value */
-	for (i = 1; i <= symbol[0]; i++) {
-		c = symbol[i];
-		hash += c;
-	}
-
-	/* ok */
-	return (hash & 0xFF);
+	return (strhash(&symbol[1], symbol[0]));
 }
 
 
@@ -105,7 +96,7 @@ stlook(int flag)
 {
 	struct t_symbol *sym;
 	int sym_flag = 0;
-	int hash;
+	unsigned int hash;
 
 	/* local symbol */
 	if (symbol[1] == '.') {
@@ -129,7 +120,7 @@ stlook(int flag)
 		}
 		else {
 			if (flag != 2)
-				error("Local symbol not allowed here!");
+				as_error("Local symbol not allowed here!");
 			return (NULL);
 		}
 	}
@@ -137,13 +128,8 @@ stlook(int flag)
 	/* global symbol */
 	else {
 		/* search symbol */
-		hash = symhash();
-		sym = hash_tbl[hash];
-		while (sym) {
-			if (!strcmp(symbol, sym->name))
-				break;
-			sym = sym->next;
-		}
+		hash = sym_hash();
+		sym = htab_find(&hash_tbl, symbol, hash);
 
 		/* new symbol */
 		if (sym == NULL) {
@@ -156,6 +142,8 @@ stlook(int flag)
 
 	/* incremente symbol reference counter */
 	if (sym_flag == 0) {
+		if (obj_rec)
+			obj_use(sym);
 		if (sym)
 			sym->refcnt++;
 	}
@@ -172,7 +160,7 @@ stlook(int flag)
  */
 
 struct t_symbol *
-stinstall(int hash, int type)
+stinstall(unsigned int hash, int type)
 {
 	struct t_symbol *sym;
 
@@ -197,6 +185,8 @@ stinstall(int hash, int type)
 	sym->reserved = 0;
 	sym->data_type = -1;
 	sym->data_size = 0;
+	sym->br_last = 0;
+	sym->serial = sym_serial++;
 	strcpy(sym->name, symbol);
 
 	/* add the symbol to the hash table */
@@ -207,9 +197,12 @@ stinstall(int hash, int type)
 	}
 	else {
 		/* global */
-		sym->next = hash_tbl[hash];
-		hash_tbl[hash] = sym;
+		sym->next = NULL;
+		if (!htab_insert(&hash_tbl, sym, hash))
+			return (NULL);
 	}
+	if (obj_rec)
+		obj_new(sym, type);
 
 	/* ok */
 	return (sym);
@@ -248,11 +241,11 @@ labldef(int lval, int flag)
 
 		/* already defined - error */
 		case MACRO:
-			error("Symbol already used by a macro!");
+			as_error("Symbol already used by a macro!");
 			return (-1);
 
 		case FUNC:
-			error("Symbol already used by a function!");
+			as_error("Symbol already used by a function!");
 			return (-1);
 
 		default:
@@ -269,7 +262,7 @@ labldef(int lval, int flag)
 			/* normal label */
 			lablptr->type = MDEF;
 			lablptr->value = 0;
-			error("Label multiply defined!");
+			as_error("Label multiply defined!");
 			return (-1);
 		}
 	}
@@ -287,6 +280,8 @@ labldef(int lval, int flag)
 	if (flag) {
 		if (section == S_CODE)
 			lablptr->proc = proc_ptr;
+		if (pass == FIRST_PASS)
+			relax_label(lablptr);
 
 		if ((section == S_BSS) || (section == S_ZP)) {
 			lablptr->bank = bank;
@@ -385,28 +380,18 @@ lablremap(void)
 	int i;
 
 	/* browse the symbol table */
-	for (i = 0; i < 256; i++) {
-		sym = hash_tbl[i];
-		while (sym) {
-			/* remap the bank */
-			if (sym->bank <= bank_limit)
-				sym->bank += bank_base;
-
-			/* local symbols */
-			if (sym->local) {
-				local = sym->local;
-
-				while (local) {
-					if (local->bank <= bank_limit)
-						local->bank += bank_base;
-
-					/* next */
-					local = local->next;
-				}
-			}
-
-			/* next */
-			sym = sym->next;
+	for (i = 0; i < hash_tbl.size; i++) {
+		if ((sym = hash_tbl.slot[i]) == NULL)
+			continue;
+
+		/* remap the bank */
+		if (sym->bank <= bank_limit)
+			sym->bank += bank_base;
+
+		/* local symbols */
+		for (local = sym->local; local; local = local->next) {
+			if (local->bank <= bank_limit)
+				local->bank += bank_base;
 		}
 	}
 }
@@ -428,40 +413,30 @@ labldump(FILE *fp)
 	fprintf(fp, "----\t----\t-----\n");
 
 	/* browse the symbol table */
-	for (i = 0; i < 256; i++) {
-		sym = hash_tbl[i];
-		while (sym) {
-			/* dump the label */
-			fprintf(fp, "%2.2x\t%4.4x\t", sym->bank, sym->value);
-			fprintf(fp, "%s\t", &(sym->name[1]));
-			if (strlen(&(sym->name[1])) < 8)
-				fprintf(fp, "\t");
-			if (strlen(&(sym->name[1])) < 16)
+	for (i = 0; i < hash_tbl.size; i++) {
+		if ((sym = hash_tbl.slot[i]) == NULL)
+			continue;
+
+		/* dump the label */
+		fprintf(fp, "%2.2x\t%4.4x\t", sym->bank, sym->value);
+		fprintf(fp, "%s\t", &(sym->name[1]));
+		if (strlen(&(sym->name[1])) < 8)
+			fprintf(fp, "\t");
+		if (strlen(&(sym->name[1])) < 16)
+			fprintf(fp, "\t");
+		if (strlen(&(sym->name[1])) < 24)
+			fprintf(fp, "\t");
+		fprintf(fp, "\n");
+
+		/* local symbols */
+		for (local = sym->local; local; local = local->next) {
+			fprintf(fp, "%2.2x\t%4.4x\t", local->bank, local->value);
+			fprintf(fp, "\t%s\t", &(local->name[1]));
+			if (strlen(&(local->name[1])) < 8)
 				fprintf(fp, "\t");
-			if (strlen(&(sym->name[1])) < 24)
+			if (strlen(&(local->name[1])) < 16)
 				fprintf(fp, "\t");
 			fprintf(fp, "\n");
-
-			/* local symbols */
-			if (sym->local) {
-				local = sym->local;
-
-				while (local) {
-					fprintf(fp, "%2.2x\t%4.4x\t", local->bank, local->value);
-					fprintf(fp, "\t%s\t", &(local->name[1]));
-					if (strlen(&(local->name[1])) < 8)
-						fprintf(fp, "\t");
-					if (strlen(&(local->name[1])) < 16)
-						fprintf(fp, "\t");
-					fprintf(fp, "\n");
-
-					/* next */
-					local = local->next;
-				}
-			}
-
-			/* next */
-			sym = sym->next;
 		}
 	}
 }
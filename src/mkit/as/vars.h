@@ -19,10 +19,9 @@ int rsbase;		/* .rs counter */
 int section;		/* current section: S_ZP, S_BSS, S_CODE or S_DATA */
 int section_bank[4];	/* current bank for each section */
 int stop_pass;		/* stop the program; set by fatal_error() */
-int errcnt;		/* error counter */
+int as_errcnt;		/* error counter */
 struct t_machine *machine;
-struct t_opcode *inst_tbl[256];		/* instructions hash table */
-struct t_symbol *hash_tbl[256];		/* label hash table */
+struct t_htab hash_tbl;			/* label hash table */
 struct t_symbol *lablptr;		/* label pointer into symbol table */
 struct t_symbol *glablptr;		/* pointer to the latest defined global label */
 struct t_symbol *lastlabl;		/* last label we have seen */
@@ -0,0 +1,29 @@
+/* Array loops: fill, scale and sum global int and char arrays. */
+#define N 128
+
+int a[N];
+unsigned char b[N];
+
+int bench()
+{
+  int i, j, s;
+  s = 0;
+  for (j = 0; j < 4; j++) {
+    for (i = 0; i < N; i++) {
+      a[i] = i * 3 + j;
+      b[i] = i + j;
+    }
+    for (i = 0; i < N; i++)
+      a[i] = a[i] + b[N - 1 - i];
+    for (i = 0; i < N; i++)
+      s += a[i];
+  }
+  return s;
+}
+
+int main()
+{
+  if (bench() != 512)
+    abort();
+  return 0;
+}
@@ -0,0 +1,24 @@
+/* Far pointer reads: walk a table included into a ROM data bank. */
+#incbin(tbl, "farptr.bin")
+
+int bench()
+{
+  int i, j, k, s;
+  unsigned char c;
+  s = 0;
+  for (j = 0; j < 4; j++) {
+    for (i = 0; i < 256; i++) {
+      c = farpeekb(tbl + i);
+      k = (c + j) & 255;
+      s += c + farpeekb(tbl + k);
+    }
+  }
+  return s;
+}
+
+int main()
+{
+  if (bench() != -1024)
+    abort();
+  return 0;
+}
@@ -0,0 +1,36 @@
+/* Heap churn: allocate, fill and free blocks of varying sizes. */
+#define N 16
+
+char *blk[N];
+
+int bench()
+{
+  int i, t, s;
+  s = 0;
+  for (i = 0; i < N; i++)
+    blk[i] = 0;
+  for (t = 0; t < 24; t++) {
+    for (i = t & 1; i < N; i += 2) {
+      if (blk[i])
+        free(blk[i]);
+      blk[i] = malloc(8 + ((i * 7 + t * 13) & 63));
+      if (!blk[i])
+        abort();
+      blk[i][0] = i + t;
+    }
+    for (i = 0; i < N; i++)
+      if (blk[i])
+        s += blk[i][0];
+  }
+  for (i = 0; i < N; i++)
+    if (blk[i])
+      free(blk[i]);
+  return s;
+}
+
+int main()
+{
+  if (bench() != 7048)
+    abort();
+  return 0;
+}
@@ -0,0 +1,36 @@
+/* 32-bit math: the library's add32/mul32/cmp32 and carries done in C. */
+char acc[4], term[4], prod[4];
+
+int bench()
+{
+  unsigned int lo, hi, n, i;
+  int s;
+
+  /* 32-bit sum of a series, carry propagated by hand */
+  lo = hi = 0;
+  for (i = 0; i < 500; i++) {
+    n = lo + i * 37;
+    if (n < lo)
+      hi++;
+    lo = n;
+  }
+
+  /* library routines */
+  acc[0] = acc[1] = acc[2] = acc[3] = 0;
+  for (i = 0; i < 64; i++) {
+    term[0] = i; term[1] = i >> 1; term[2] = 0; term[3] = 0;
+    add32(acc, term);
+    prod[0] = 3; prod[1] = 0; prod[2] = 0; prod[3] = 0;
+    mul32(prod, term);
+    add32(acc, prod);
+  }
+  s = cmp32(acc, term);
+  return lo + hi + acc[0] + (acc[1] << 8) + acc[2] + s;
+}
+
+int main()
+{
+  if (bench() != 3356)
+    abort();
+  return 0;
+}
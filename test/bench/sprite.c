@@ -0,0 +1,33 @@
+/* Sprite and BAT updates: move sprites in the SATB copy, upload it, and
+   rewrite a block of the background map. */
+int bench()
+{
+  int i, t, s;
+  for (t = 0; t < 8; t++) {
+    for (i = 0; i < 64; i++) {
+      spr_set(i);
+      spr_x(i * 4 + t);
+      spr_y(i * 3 + t * 2);
+      spr_pattern(0x5000 + (i << 6));
+      spr_ctrl(0xB9, 0);  /* SIZE_MAS | FLIP_MAS, SZ_16x16 */
+      spr_pal(i & 15);
+      spr_pri(1);
+    }
+    satb_update();
+    for (i = 0; i < 64; i++)
+      put_raw(0x1000 + i + t, i & 31, (i >> 5) + t);
+  }
+  s = 0;
+  for (i = 0; i < 64; i++) {
+    spr_set(i);
+    s += spr_get_x() + spr_get_y();
+  }
+  return s + vram[0x40];
+}
+
+int main()
+{
+  if (bench() != 19553)
+    abort();
+  return 0;
+}
@@ -0,0 +1,51 @@
+/* Struct access: update the fields of an array of structs through
+   pointers and by index. */
+#define N 32
+
+struct obj {
+  int x, y;
+  char dx, dy;
+  unsigned char flags;
+};
+
+struct obj objs[N];
+
+void move(struct obj *o)
+{
+  o->x += o->dx;
+  o->y += o->dy;
+  if (o->x < 0 || o->x > 255) {
+    o->dx = -o->dx;
+    o->flags |= 1;
+  }
+  if (o->y < 0 || o->y > 223) {
+    o->dy = -o->dy;
+    o->flags |= 2;
+  }
+}
+
+int bench()
+{
+  int i, t, s;
+  for (i = 0; i < N; i++) {
+    objs[i].x = i * 8;
+    objs[i].y = i * 7;
+    objs[i].dx = (i & 7) - 3;
+    objs[i].dy = 3 - (i & 3);
+    objs[i].flags = 0;
+  }
+  for (t = 0; t < 16; t++)
+    for (i = 0; i < N; i++)
+      move(&objs[i]);
+  s = 0;
+  for (i = 0; i < N; i++)
+    s += objs[i].x + objs[i].y + objs[i].flags;
+  return s;
+}
+
+int main()
+{
+  if (bench() != 8361)
+    abort();
+  return 0;
+}
@@ -0,0 +1,48 @@
+/* Switch dispatch: a dense jump table and a sparse search. */
+int dense(int op, int v)
+{
+  switch (op) {
+  case 0: return v + 1;
+  case 1: return v - 1;
+  case 2: return v << 1;
+  case 3: return v >> 1;
+  case 4: return v ^ 0x55;
+  case 5: return v & 0x3ff;
+  case 6: return v | 0x100;
+  case 7: return -v;
+  }
+  return v;
+}
+
+int sparse(int key)
+{
+  switch (key) {
+  case 10: return 1;
+  case 200: return 2;
+  case 3000: return 3;
+  case -5: return 4;
+  case 512: return 5;
+  case 0x7000: return 6;
+  case 77: return 7;
+  default: return 0;
+  }
+}
+
+int bench()
+{
+  int i, v, s;
+  v = 1;
+  s = 0;
+  for (i = 0; i < 512; i++) {
+    v = dense(i & 7, v) + i;
+    s += sparse(v & 0x7fff) + sparse(i * 5);
+  }
+  return v + s;
+}
+
+int main()
+{
+  if (bench() != -1404)
+    abort();
+  return 0;
+}
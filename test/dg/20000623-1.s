@@ -0,0 +1,646 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 04:33:17 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	  call	_getfoo
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__ldwi	1
+	__stwps
+	__ldwi	2
+	__stw	_foo
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	  jsr	eq
+	__tstw
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+	__ldwi	0
+	  call	_exit
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _getfoo
+	__ldwi	_foo
+	__lbra	LL3
+LL3:
+
+	  rts
+	.endp
+
+
+	.bss
+_foo:		.ds	2
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-4,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+LL6:
+
+	__lea_s	4
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL7
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__andws
+	__tstw
+	__lbeq	LL8
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL9
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL10
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL5
+LL10:
+
+LL9:
+
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__aslw
+	__addws
+	__stwps
+	__stwps
+	__lbra	LL11
+LL8:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	10
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+LL11:
+
+	__lbra	LL6
+LL7:
+
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL12
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL13
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL5
+LL13:
+
+LL12:
+
+	__ldwi	0
+	__lbra	LL5
+LL5:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL15
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__subws
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__stwps
+	__addmi	2,__stack
+LL15:
+
+LL14:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL17
+	__ldwi	0
+	__lbra	LL16
+LL17:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	2
+	__addws
+	__addws
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbne	LL19
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL19:
+
+	__boolw
+	__tstw
+	__lbeq	LL18
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	___compact
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL20
+	__ldwi	0
+	__lbra	LL16
+LL20:
+
+LL18:
+
+	__lea_s	2
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__addws
+	  jsr	uge
+	__tstw
+	__lbeq	LL21
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subws
+	__stwps
+	__lbra	LL22
+LL21:
+
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	6
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+LL22:
+
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__orws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__addws
+	__lbra	LL16
+LL16:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__subws
+	__stwps
+	__stwps
+LL23:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL24:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stwps
+LL25:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_malloc
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	di
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	si
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_memcpy.3
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_free
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL26
+LL26:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:8
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,767 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 04:33:17 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _bar
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	56
+	  jsr	ne
+	__tstw
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__ptr
+	__ldbp	__ptr
+	__pushw
+	__ldwi	97
+	  jsr	ne
+	__tstw
+	__lbeq	LL3
+	  call	_abort
+LL3:
+
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	LL0+0
+	__stwps
+	__ldwi	1
+	__lbra	LL1
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _baz
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	56
+	  jsr	ne
+	__tstw
+	__lbeq	LL5
+	  call	_abort
+LL5:
+
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__ptr
+	__ldbp	__ptr
+	__pushw
+	__ldwi	97
+	  jsr	ne
+	__tstw
+	__lbeq	LL6
+	  call	_abort
+LL6:
+
+	__ldwi	26
+	__lbra	LL4
+LL4:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _foo
+	__pushw
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	2
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	  call	_bar
+	__stwps
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL8
+	__lea_s	4
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	2
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	  call	_baz
+	__stwps
+LL8:
+
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL9
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL7
+LL9:
+
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	6
+	  call	_baz
+	__ldwi	0
+	__lbra	LL7
+LL7:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	56
+	__pushw
+	__ldwi	LL0+4
+	  call	_foo
+	__pushw
+	__ldwi	26
+	  jsr	ne
+	__tstw
+	__lbeq	LL11
+	  call	_abort
+LL11:
+
+	__ldwi	0
+	  call	_exit
+LL10:
+
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	100,101,102,0,97,98,99,0
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:8
+;	constant pool:0
+;	global pool:11
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-4,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+LL14:
+
+	__lea_s	4
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL15
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__andws
+	__tstw
+	__lbeq	LL16
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL17
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL18
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL13
+LL18:
+
+LL17:
+
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__aslw
+	__addws
+	__stwps
+	__stwps
+	__lbra	LL19
+LL16:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	10
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+LL19:
+
+	__lbra	LL14
+LL15:
+
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL20
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL21
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL13
+LL21:
+
+LL20:
+
+	__ldwi	0
+	__lbra	LL13
+LL13:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL23
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__subws
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__stwps
+	__addmi	2,__stack
+LL23:
+
+LL22:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL25
+	__ldwi	0
+	__lbra	LL24
+LL25:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	2
+	__addws
+	__addws
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbne	LL27
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL27:
+
+	__boolw
+	__tstw
+	__lbeq	LL26
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	___compact
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL28
+	__ldwi	0
+	__lbra	LL24
+LL28:
+
+LL26:
+
+	__lea_s	2
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__addws
+	  jsr	uge
+	__tstw
+	__lbeq	LL29
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subws
+	__stwps
+	__lbra	LL30
+LL29:
+
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	6
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+LL30:
+
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__orws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__addws
+	__lbra	LL24
+LL24:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__subws
+	__stwps
+	__stwps
+LL31:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL32:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stwps
+LL33:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_malloc
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	di
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	si
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_memcpy.3
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_free
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL34
+LL34:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:8
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
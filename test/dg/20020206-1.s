@@ -0,0 +1,713 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 04:33:17 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _combine_reloads
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__stwi_s	-1,0
+	__addmi	-2,__stack
+	__stwi_s	-1,0
+	__lea_s	4
+	__pushw
+	__ldwi	0
+	__stwps
+LL2:
+
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	_n_reloads
+	  jsr	lt
+	__tstw
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__lea_s	4
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	1
+	__stwps
+	__subwi	1
+	__lbra	LL2
+LL4:
+
+	__ldwi	_rld
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__mulwi	6
+	__addws
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL6
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ge
+	__tstw
+	__lbeq	LL7
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL1
+LL7:
+
+	__lea_s	2
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+LL6:
+
+	__lbra	LL3
+LL5:
+
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL1
+LL1:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	4
+	__stw	_n_reloads
+	__ldwi	_rld
+	__pushw
+	__ldwi	2
+	__mulwi	6
+	__addws
+	__addwi	2
+	__pushw
+	__ldwi	2
+	__stwps
+	  call	_combine_reloads
+	__pushw
+	__ldwi	2
+	  jsr	ne
+	__tstw
+	__lbeq	LL9
+	  call	_abort
+LL9:
+
+	__ldwi	0
+	  call	_exit
+LL8:
+
+	  rts
+	.endp
+
+
+	.bss
+_n_reloads:		.ds	2
+_rld:		.ds	60
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:11
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-4,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+LL12:
+
+	__lea_s	4
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL13
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__andws
+	__tstw
+	__lbeq	LL14
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL15
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL16
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL11
+LL16:
+
+LL15:
+
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__aslw
+	__addws
+	__stwps
+	__stwps
+	__lbra	LL17
+LL14:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	10
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+LL17:
+
+	__lbra	LL12
+LL13:
+
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL18
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL19
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL11
+LL19:
+
+LL18:
+
+	__ldwi	0
+	__lbra	LL11
+LL11:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL21
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__subws
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__stwps
+	__addmi	2,__stack
+LL21:
+
+LL20:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL23
+	__ldwi	0
+	__lbra	LL22
+LL23:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	2
+	__addws
+	__addws
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbne	LL25
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL25:
+
+	__boolw
+	__tstw
+	__lbeq	LL24
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	___compact
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL26
+	__ldwi	0
+	__lbra	LL22
+LL26:
+
+LL24:
+
+	__lea_s	2
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__addws
+	  jsr	uge
+	__tstw
+	__lbeq	LL27
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subws
+	__stwps
+	__lbra	LL28
+LL27:
+
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	6
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+LL28:
+
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__orws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__addws
+	__lbra	LL22
+LL22:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__subws
+	__stwps
+	__stwps
+LL29:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL30:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stwps
+LL31:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_malloc
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	di
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	si
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_memcpy.3
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_free
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL32
+LL32:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:8
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,664 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 04:33:17 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _bar
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	  jsr	ne
+	__tstw
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+LL1:
+
+	__addmi	10,__stack
+	  rts
+	.endp
+
+	.proc _foo
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_bar
+LL3:
+
+	__addmi	10,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	0
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_foo
+	__ldwi	0
+	  call	_exit
+LL4:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-4,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+LL7:
+
+	__lea_s	4
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL8
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__andws
+	__tstw
+	__lbeq	LL9
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL10
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL11
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL6
+LL11:
+
+LL10:
+
+	__lea_s	6
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	2
+	__pushw
+	__lea_s	12
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__aslw
+	__addws
+	__stwps
+	__stwps
+	__lbra	LL12
+LL9:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	12
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	10
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+LL12:
+
+	__lbra	LL7
+LL8:
+
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	ne
+	__tstw
+	__lbeq	LL13
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	uge
+	__tstw
+	__lbeq	LL14
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL6
+LL14:
+
+LL13:
+
+	__ldwi	0
+	__lbra	LL6
+LL6:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL16
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__subws
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__comw
+	__andws
+	__stwps
+	__addmi	2,__stack
+LL16:
+
+LL15:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__addmi	-2,__stack
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL18
+	__ldwi	0
+	__lbra	LL17
+LL18:
+
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	2
+	__addws
+	__addws
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	6
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbne	LL20
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL20:
+
+	__boolw
+	__tstw
+	__lbeq	LL19
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	___compact
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	0
+	  jsr	eq
+	__tstw
+	__lbeq	LL21
+	__ldwi	0
+	__lbra	LL17
+LL21:
+
+LL19:
+
+	__lea_s	2
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__pushw
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__addws
+	  jsr	uge
+	__tstw
+	__lbeq	LL22
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__aslw
+	__addws
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subws
+	__stwps
+	__lbra	LL23
+LL22:
+
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	0
+	__stwps
+	__lea_s	6
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+LL23:
+
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	1
+	__orws
+	__stwps
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__aslw
+	__addws
+	__lbra	LL17
+LL17:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	lsr
+	__stwps
+	__lea_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	  jsr	asl
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__pushw
+	__lea_s	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__stwps
+	__ldwi	_msys
+	__addwi	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	2
+	__subws
+	__stwps
+	__stwps
+LL24:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL25:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldwi	_msys
+	__addwi	0
+	__pushw
+	__ldwi	_msys
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stwps
+LL26:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__lea_s	0
+	__pushw
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_malloc
+	__stwps
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	di
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	si
+	__lea_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_memcpy.3
+	__lea_s	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_free
+	__lea_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__lbra	LL27
+LL27:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:8
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
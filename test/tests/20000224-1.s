@@ -0,0 +1,389 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:43 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test
+	__addmi	-4,__stack
+	__stwi_s	0,0
+LL2:
+
+	__ldwi	100
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL3
+	__ldw	_flag
+	__andwi	1
+	__tstw
+	__lbeq	LL4
+	__stwi_s	0,2
+LL5:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	7
+	  jsr	ltzp
+	__lbne	LL7
+	__lbra	LL8
+LL6:
+
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL5
+LL7:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL6
+LL8:
+
+LL4:
+
+	__ldw	_flag
+	incw	_flag
+	__lbra	LL2
+LL3:
+
+	__ldwi	1
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	0
+	__stw	_flag
+	  call	_test
+	__cmpwi_ne	1
+	__lbeq	LL10
+	  call	_abort
+LL10:
+
+	__ldwi	0
+	  call	_exit
+LL9:
+
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+_loop_1:
+	.dw	100
+_loop_2:
+	.dw	7
+
+	.bss
+_flag:		.ds	2
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:12
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL13:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL14
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL15
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL16
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL17
+	__ldw_s	2
+	__lbra	LL12
+LL17:
+
+LL16:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL18
+LL15:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL18:
+
+	__lbra	LL13
+LL14:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL19
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL20
+	__ldw_s	2
+	__lbra	LL12
+LL20:
+
+LL19:
+
+	__ldwi	0
+LL12:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL22
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL22:
+
+LL21:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL24
+	__ldwi	0
+	__lbra	LL23
+LL24:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL26
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL26:
+
+	__tstw
+	__lbeq	LL25
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL27
+	__ldwi	0
+	__lbra	LL23
+LL27:
+
+LL25:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL28
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL29
+LL28:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL29:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL23:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL30:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL31:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL32:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL33:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,631 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:43 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _f
+	__pushw
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-10,__stack
+	__stwi_s	7,8
+	__stwi_s	6,6
+	__stwi_s	4,4
+	__stwi_s	7,2
+	__stwi_s	2,0
+	__ldw_s	8
+	__tstw
+	__lbne	LL4
+	__ldw_s	6
+	__pushw
+	__ldw_s	6
+	  jsr	smod
+LL4:
+
+	__boolw
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	8
+	__tstw
+	__lbeq	LL5
+	__ldw_s	6
+	__pushw
+	__ldw_s	6
+	  jsr	smod
+	__lbra	LL6
+LL5:
+
+	__ldwi	0
+LL6:
+
+	__pushw
+	__ldwi	2
+	  call	_f
+	__ldw_s	6
+	__pushw
+	__ldw_s	6
+	  jsr	smod
+	__stw_s	8
+	__pushw
+	__ldwi	2
+	  call	_f
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	  jsr	smod
+	  jsr	smul
+	__stw_s	8
+	__pushw
+	__ldwi	4
+	  call	_f
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	  jsr	smod
+	  jsr	sdiv
+	__stw_s	8
+	__pushw
+	__ldwi	2
+	  call	_f
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	  jsr	smod
+	  jsr	smod
+	__stw_s	8
+	__pushw
+	__ldwi	0
+	  call	_f
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	__pushw
+	__ldw_s	8
+	  jsr	smod
+	__addws
+	__stw_s	8
+	__pushw
+	__ldwi	2
+	  call	_f
+	__ldw_s	2
+	__tstw
+	__lbne	LL7
+	__ldw_s	4
+	__tstw
+	__lbeq	LL8
+	__ldw_s	0
+LL8:
+
+	__boolw
+LL7:
+
+	__boolw
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__tstw
+	__lbeq	LL9
+	__ldw_s	4
+	__tstw
+	__lbeq	LL10
+	__ldw_s	0
+LL10:
+
+	__boolw
+	__lbra	LL11
+LL9:
+
+	__ldwi	0
+LL11:
+
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	4
+	__tstw
+	__lbeq	LL12
+	__ldw_s	0
+LL12:
+
+	__boolw
+	__stw_s	2
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbeq	LL13
+	__ldw_s	2
+LL13:
+
+	__boolw
+	  jsr	smul
+	__stw_s	2
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbeq	LL14
+	__ldw_s	2
+LL14:
+
+	__boolw
+	  jsr	smod
+	__stw_s	2
+	__pushw
+	__ldwi	0
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbeq	LL15
+	__ldw_s	2
+LL15:
+
+	__boolw
+	__addws
+	__stw_s	2
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbeq	LL16
+	__ldw_s	2
+LL16:
+
+	__boolw
+	__subws
+	__stw_s	2
+	__pushw
+	__ldwi	0
+	  call	_f
+	__ldw_s	2
+	__tstw
+	__lbne	LL17
+	__ldw_s	4
+LL17:
+
+	__tstw
+	__lbne	LL18
+	__ldw_s	0
+LL18:
+
+	__boolw
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__tstw
+	__lbeq	LL19
+	__ldw_s	4
+	__tstw
+	__lbne	LL20
+	__ldw_s	0
+LL20:
+
+	__boolw
+	__lbra	LL21
+LL19:
+
+	__ldwi	0
+LL21:
+
+	__pushw
+	__ldwi	0
+	  call	_f
+	__ldw_s	4
+	__tstw
+	__lbne	LL22
+	__ldw_s	0
+LL22:
+
+	__boolw
+	__stw_s	2
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbne	LL23
+	__ldw_s	2
+LL23:
+
+	__boolw
+	  jsr	smul
+	__stw_s	2
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbne	LL24
+	__ldw_s	2
+LL24:
+
+	__boolw
+	  jsr	smod
+	__stw_s	2
+	__pushw
+	__ldwi	0
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbne	LL25
+	__ldw_s	2
+LL25:
+
+	__boolw
+	__addws
+	__stw_s	2
+	__pushw
+	__ldwi	1
+	  call	_f
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__tstw
+	__lbne	LL26
+	__ldw_s	2
+LL26:
+
+	__boolw
+	__subws
+	__stw_s	2
+	__pushw
+	__ldwi	0
+	  call	_f
+	__ldwi	0
+	  call	_exit
+LL3:
+
+	__addmi	10,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:9
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL29:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL30
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL31
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL32
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL33
+	__ldw_s	2
+	__lbra	LL28
+LL33:
+
+LL32:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL34
+LL31:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL34:
+
+	__lbra	LL29
+LL30:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL35
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL36
+	__ldw_s	2
+	__lbra	LL28
+LL36:
+
+LL35:
+
+	__ldwi	0
+LL28:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL38
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL38:
+
+LL37:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL40
+	__ldwi	0
+	__lbra	LL39
+LL40:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL42
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL42:
+
+	__tstw
+	__lbeq	LL41
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL43
+	__ldwi	0
+	__lbra	LL39
+LL43:
+
+LL41:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL44
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL45
+LL44:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL45:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL39:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL46:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL47:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL48:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL49:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
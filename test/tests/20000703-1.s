@@ -0,0 +1,441 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:43 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _foo
+	__pushw
+	__ldw_s	4
+	__addwi	17
+	__stw	di
+	__ldwi	LL0+0
+	__stw	si
+	__ldwi	3
+	  call	_memcpy.3
+	__ldw_s	4
+	__addwi	20
+	__stw	<__ptr
+	__ldw_s	2
+	__stwp	__ptr
+	__ldw_s	4
+	__addwi	22
+	__stw	<__ptr
+	__ldw_s	0
+	__stwp	__ptr
+LL1:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _bar
+	__pushw
+	__ldw_s	4
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	24
+	  call	_memset.3
+	__ldw_s	4
+	__stw	di
+	__ldwi	LL0+4
+	__stw	si
+	__ldwi	17
+	  call	_memcpy.3
+	__ldw_s	4
+	__addwi	17
+	__stw	di
+	__ldwi	LL0+22
+	__stw	si
+	__ldwi	3
+	  call	_memcpy.3
+	__ldw_s	4
+	__addwi	20
+	__stw	<__ptr
+	__ldw_s	2
+	__stwp	__ptr
+	__ldw_s	4
+	__addwi	22
+	__stw	<__ptr
+	__ldw_s	0
+	__stwp	__ptr
+LL2:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-24,__stack
+	__pea_s	0
+	__ldwi	71
+	__pushw
+	__ldwi	18
+	  call	_foo
+	__lea_s	0
+	__addwi	20
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	71
+	__lbne	LL5
+	__lea_s	0
+	__addwi	22
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	18
+LL5:
+
+	__tstw
+	__lbeq	LL4
+	  call	_abort
+LL4:
+
+	__pea_s	0
+	__ldwi	59
+	__pushw
+	__ldwi	26
+	  call	_bar
+	__lea_s	0
+	__addwi	20
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	59
+	__lbne	LL7
+	__lea_s	0
+	__addwi	22
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	26
+LL7:
+
+	__tstw
+	__lbeq	LL6
+	  call	_abort
+LL6:
+
+	__ldwi	0
+	  call	_exit
+LL3:
+
+	__addmi	24,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	97,98,99,0,48,49,50,51
+	.db	52,53,54,55,56,57,48,49
+	.db	50,51,52,53,54,0,97,98
+	.db	99,0
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:26
+;	constant pool:0
+;	global pool:12
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL10:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL11
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL12
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL13
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL14
+	__ldw_s	2
+	__lbra	LL9
+LL14:
+
+LL13:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL15
+LL12:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL15:
+
+	__lbra	LL10
+LL11:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL16
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL17
+	__ldw_s	2
+	__lbra	LL9
+LL17:
+
+LL16:
+
+	__ldwi	0
+LL9:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL19
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL19:
+
+LL18:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL21
+	__ldwi	0
+	__lbra	LL20
+LL21:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL23
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL23:
+
+	__tstw
+	__lbeq	LL22
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL24
+	__ldwi	0
+	__lbra	LL20
+LL24:
+
+LL22:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL25
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL26
+LL25:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL26:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL20:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL27:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL28:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL29:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL30:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,597 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:43 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test1
+	__addmi	-4,__stack
+	__stwi_s	3,2
+	__stwi_s	2,0
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL3
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL4
+LL3:
+
+	__ldw_s	0
+	__incw_s	0
+LL4:
+
+	__cmpwi_ne	2
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+	__ldw_s	2
+	__cmpwi_ne	3
+	__lbeq	LL5
+	  call	_abort
+LL5:
+
+	__ldw_s	0
+	__cmpwi_ne	3
+	__lbeq	LL6
+	  call	_abort
+LL6:
+
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test2
+	__addmi	-6,__stack
+	__stwi_s	3,4
+	__stwi_s	2,2
+	__pea_s	0
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	4
+	  jsr	ltzp
+	__lbeq	LL8
+	__ldw_s	6
+	__incw_s	6
+	__lbra	LL9
+LL8:
+
+	__ldw_s	4
+	__incw_s	4
+LL9:
+
+	__stwps
+	__ldw_s	0
+	__cmpwi_ne	2
+	__lbeq	LL10
+	  call	_abort
+LL10:
+
+	__ldw_s	4
+	__cmpwi_ne	3
+	__lbeq	LL11
+	  call	_abort
+LL11:
+
+	__ldw_s	2
+	__cmpwi_ne	3
+	__lbeq	LL12
+	  call	_abort
+LL12:
+
+LL7:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test3
+	__addmi	-8,__stack
+	__stwi_s	3,6
+	__stwi_s	2,4
+	__stwi_s	3,2
+	__stwi_s	2,0
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL15
+	__ldw_s	6
+	__incw_s	6
+	__lbra	LL16
+LL15:
+
+	__ldw_s	4
+	__incw_s	4
+LL16:
+
+	__cmpwi_ne	2
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__ldw_s	6
+	__cmpwi_ne	3
+	__lbeq	LL17
+	  call	_abort
+LL17:
+
+	__ldw_s	4
+	__cmpwi_ne	3
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+LL13:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc _init_xy
+	__ldwi	3
+	__stw	_x
+	__ldwi	2
+	__stw	_y
+LL19:
+
+	  rts
+	.endp
+
+	.proc _test4
+	  call	_init_xy
+	__ldw	_x
+	__stw	<__temp
+	__ldw	_y
+	  jsr	ltzp
+	__lbeq	LL22
+	__ldw	_x
+	incw	_x
+	__lbra	LL23
+LL22:
+
+	__ldw	_y
+	incw	_y
+LL23:
+
+	__cmpwi_ne	2
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__ldw	_x
+	__cmpwi_ne	3
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldw	_y
+	__cmpwi_ne	3
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+LL20:
+
+	  rts
+	.endp
+
+	.proc _test5
+	__addmi	-2,__stack
+	  call	_init_xy
+	__pea_s	0
+	__ldw	_x
+	__stw	<__temp
+	__ldw	_y
+	  jsr	ltzp
+	__lbeq	LL27
+	__ldw	_x
+	incw	_x
+	__lbra	LL28
+LL27:
+
+	__ldw	_y
+	incw	_y
+LL28:
+
+	__stwps
+	__ldw_s	0
+	__cmpwi_ne	2
+	__lbeq	LL29
+	  call	_abort
+LL29:
+
+	__ldw	_x
+	__cmpwi_ne	3
+	__lbeq	LL30
+	  call	_abort
+LL30:
+
+	__ldw	_y
+	__cmpwi_ne	3
+	__lbeq	LL31
+	  call	_abort
+LL31:
+
+LL26:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6
+	__addmi	-6,__stack
+	__stwi_s	3,4
+	__stwi_s	2,2
+	  call	_init_xy
+	__pea_s	0
+	__ldw_s	6
+	__stw	<__temp
+	__ldw	_y
+	  jsr	ltzp
+	__lbeq	LL33
+	__ldw	_x
+	incw	_x
+	__lbra	LL34
+LL33:
+
+	__ldw	_y
+	incw	_y
+LL34:
+
+	__stwps
+	__ldw_s	0
+	__cmpwi_ne	2
+	__lbeq	LL35
+	  call	_abort
+LL35:
+
+	__ldw	_x
+	__cmpwi_ne	3
+	__lbeq	LL36
+	  call	_abort
+LL36:
+
+	__ldw	_y
+	__cmpwi_ne	3
+	__lbeq	LL37
+	  call	_abort
+LL37:
+
+LL32:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main
+	  call	_test1
+	  call	_test2
+	  call	_test3
+	  call	_test4
+	  call	_test5
+	  call	_test6
+	__ldwi	0
+	  call	_exit
+LL38:
+
+	  rts
+	.endp
+
+
+	.bss
+_x:		.ds	2
+_y:		.ds	2
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:17
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL41:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL42
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL43
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL44
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL45
+	__ldw_s	2
+	__lbra	LL40
+LL45:
+
+LL44:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL46
+LL43:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL46:
+
+	__lbra	LL41
+LL42:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL47
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL48
+	__ldw_s	2
+	__lbra	LL40
+LL48:
+
+LL47:
+
+	__ldwi	0
+LL40:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL50
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL50:
+
+LL49:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL52
+	__ldwi	0
+	__lbra	LL51
+LL52:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL54
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL54:
+
+	__tstw
+	__lbeq	LL53
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL55
+	__ldwi	0
+	__lbra	LL51
+LL55:
+
+LL53:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL56
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL57
+LL56:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL57:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL51:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL58:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL59:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL60:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL61:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
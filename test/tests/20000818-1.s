@@ -0,0 +1,435 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:43 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-2,__stack
+	  call	_yylex
+	__stw_s	0
+	__ldwi	0
+	  call	_exit
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _yylex
+	__addmi	-2,__stack
+LL3:
+
+LL4:
+
+LL5:
+
+	  call	_input
+	__stw_s	0
+	  call	_ISALNUM
+	__tstw
+	__lbeq	LL7
+	__ldwi	_temporary_obstack
+	__pushw
+	__ldw_s	2
+	  call	_obstack_1grow
+	__lbra	LL8
+LL7:
+
+	__ldw_s	0
+	__cmpwi_ne	95
+	__lbeq	LL9
+	__lbra	LL6
+LL9:
+
+LL8:
+
+	__lbra	LL5
+LL6:
+
+	__ldw_s	0
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _input
+	__ldwi	0
+LL10:
+
+	  rts
+	.endp
+
+	.proc _ISALNUM
+	__pushw
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	65
+	  jsr	gezp
+	__lbeq	LL12
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	90
+	  jsr	lezp
+LL12:
+
+	__tstw
+	__lbne	LL13
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	97
+	  jsr	gezp
+	__lbeq	LL14
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	122
+	  jsr	lezp
+LL14:
+
+	__boolw
+LL13:
+
+	__tstw
+	__lbne	LL15
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	48
+	  jsr	gezp
+	__lbeq	LL16
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	48
+	  jsr	lezp
+LL16:
+
+	__boolw
+LL15:
+
+	__boolw
+LL11:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _obstack_1grow
+	__pushw
+LL17:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+
+	.bss
+_temporary_obstack:		.ds	2
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:12
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL20:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL21
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL22
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL23
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL24
+	__ldw_s	2
+	__lbra	LL19
+LL24:
+
+LL23:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL25
+LL22:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL25:
+
+	__lbra	LL20
+LL21:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL26
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL27
+	__ldw_s	2
+	__lbra	LL19
+LL27:
+
+LL26:
+
+	__ldwi	0
+LL19:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL29
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL29:
+
+LL28:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL31
+	__ldwi	0
+	__lbra	LL30
+LL31:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL33
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL33:
+
+	__tstw
+	__lbeq	LL32
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL34
+	__ldwi	0
+	__lbra	LL30
+LL34:
+
+LL32:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL35
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL36
+LL35:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL36:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL30:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL37:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL38:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL39:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL40:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
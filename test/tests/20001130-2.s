@@ -0,0 +1,408 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:44 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _output_25
+	__ldwi	3
+	__lbra	LL2
+LL4:
+
+	__ldwi	LL0+0
+	__lbra	LL1
+LL5:
+
+	  call	_i960_output_ldconst
+	__lbra	LL1
+LL6:
+
+	__ldwi	LL0+10
+	__lbra	LL1
+LL7:
+
+	__ldwi	LL0+19
+	__lbra	LL1
+	__lbra	LL3
+LL2:
+
+	  cpx	#0
+	  bne	LL8
+	  cmp	#0
+	  bne	LL8
+	  jmp	LL4
+LL8:
+
+	  cpx	#1
+	  bne	LL9
+	  cmp	#0
+	  bne	LL9
+	  jmp	LL5
+LL9:
+
+	  cpx	#2
+	  bne	LL10
+	  cmp	#0
+	  bne	LL10
+	  jmp	LL6
+LL10:
+
+	  cpx	#3
+	  bne	LL11
+	  cmp	#0
+	  bne	LL11
+	  jmp	LL7
+LL11:
+
+	  jmp	LL3
+LL3:
+
+LL1:
+
+	  rts
+	.endp
+
+	.proc _i960_output_ldconst
+	__ldwi	LL0+28
+LL12:
+
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-2,__stack
+	  call	_output_25
+	__stw_s	0
+	__ldb_p
+	__cmpwi_ne	115
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__ldwi	0
+	  call	_exit
+LL13:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	109,111,118,9,37,49,44,37
+	.db	48,0,108,100,9,37,49,44
+	.db	37,48,0,115,116,9,37,49
+	.db	44,37,48,0,102,111,111,0
+_which_alternative:
+	.dw	3
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:32
+;	constant pool:2
+;	global pool:11
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL17:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL18
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL19
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL20
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL21
+	__ldw_s	2
+	__lbra	LL16
+LL21:
+
+LL20:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL22
+LL19:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL22:
+
+	__lbra	LL17
+LL18:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL23
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL24
+	__ldw_s	2
+	__lbra	LL16
+LL24:
+
+LL23:
+
+	__ldwi	0
+LL16:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL26
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL26:
+
+LL25:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL28
+	__ldwi	0
+	__lbra	LL27
+LL28:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL30
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL30:
+
+	__tstw
+	__lbeq	LL29
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL31
+	__ldwi	0
+	__lbra	LL27
+LL31:
+
+LL29:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL32
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL33
+LL32:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL33:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL27:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL34:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL35:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL36:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL37:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,480 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:44 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-12,__stack
+	__stwi_s	-1,2
+	__stwi_s	-1,0
+	__stwi_s	0,6
+LL2:
+
+	__ldw_s	6
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ltzp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldw_s	6
+	__incw_s	6
+	__lbra	LL2
+LL4:
+
+	__pea_s	8
+	__ldw_s	8
+	__aslw
+	__addws
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addwi_sym	_listElem
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldw_s	6
+	__aslw
+	__addwi_sym	_listElem
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL6
+	__ldw_s	6
+	__stw_s	2
+	__ldw_s	6
+	__aslw
+	__addwi_sym	_listElem
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	0
+LL6:
+
+	__lbra	LL3
+LL5:
+
+	__stwi_s	2,6
+LL7:
+
+	__ldw_s	6
+	__stw	<__temp
+	__ldwi	4
+	  jsr	ltzp
+	__lbne	LL9
+	__lbra	LL10
+LL8:
+
+	__ldw_s	6
+	__incw_s	6
+	__lbra	LL7
+LL9:
+
+	__ldw_s	6
+	__aslw
+	__addwi_sym	_listElem
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL11
+	__pea_s	8
+	__ldw_s	4
+	__aslw
+	__addws
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addwi_sym	_listElem
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__stwi_s	0,2
+	__ldw_s	8
+	__stw_s	0
+	__stwi_s	1,4
+LL12:
+
+	__ldw_s	4
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ltzp
+	__lbne	LL14
+	__lbra	LL15
+LL13:
+
+	__ldw_s	4
+	__incw_s	4
+	__lbra	LL12
+LL14:
+
+	__pea_s	8
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL16
+	__ldw_s	4
+	__stw_s	2
+	__pea_s	8
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	0
+LL16:
+
+	__lbra	LL13
+LL15:
+
+LL11:
+
+	__lbra	LL8
+LL10:
+
+	__ldw_s	8
+	__cmpwi_ne	5
+	__lbne	LL18
+	__ldw_s	10
+	__cmpwi_ne	2
+LL18:
+
+	__tstw
+	__lbeq	LL17
+	  call	_abort
+LL17:
+
+	__ldwi	0
+	  call	_exit
+LL1:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+_listElem:
+	.dw	30
+	.dw	2
+	.dw	10
+	.dw	5
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:8
+;	global pool:9
+;	Macro pool:8
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL21:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL22
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL23
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL24
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL25
+	__ldw_s	2
+	__lbra	LL20
+LL25:
+
+LL24:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL26
+LL23:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL26:
+
+	__lbra	LL21
+LL22:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL27
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL28
+	__ldw_s	2
+	__lbra	LL20
+LL28:
+
+LL27:
+
+	__ldwi	0
+LL20:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL30
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL30:
+
+LL29:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL32
+	__ldwi	0
+	__lbra	LL31
+LL32:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL34
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL34:
+
+	__tstw
+	__lbeq	LL33
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL35
+	__ldwi	0
+	__lbra	LL31
+LL35:
+
+LL33:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL36
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL37
+LL36:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL37:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL31:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL38:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL39:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL40:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL41:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:8
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
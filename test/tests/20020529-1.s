@@ -0,0 +1,496 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:44 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _foo
+	__pushw
+	__addmi	-2,__stack
+LL2:
+
+LL3:
+
+LL4:
+
+	__ldw_s	8
+	  call	_f1
+	__stw_s	0
+	__tstw
+	__lbeq	LL6
+	__ldwi	0
+	__lbra	LL1
+LL6:
+
+	__ldw_s	6
+	__tstw
+	__lbeq	LL7
+	__lbra	LL4
+LL7:
+
+	__ldw_s	8
+	__addwi	4
+	__stw	<__ptr
+	__ldw_s	2
+	__stwp	__ptr
+	__ldw_s	8
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL8
+	  call	_f2
+LL8:
+
+	__ldw_s	4
+	__tstw
+	__lbeq	LL9
+	  call	_f2
+LL9:
+
+	__ldw_s	8
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	2
+	__ldw_s	0
+	__lbra	LL10
+LL12:
+
+	__ldw_s	8
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__tstw
+	__lbeq	LL13
+	  call	_f2
+LL13:
+
+	__ldw_s	4
+	__tstw
+	__lbeq	LL14
+	  call	_f2
+LL14:
+
+LL15:
+
+	__lbra	LL11
+	__lbra	LL11
+LL10:
+
+	  cpx	#1
+	  bne	LL16
+	  cmp	#0
+	  bne	LL16
+	  jmp	LL12
+LL16:
+
+	  jmp	LL15
+LL11:
+
+	__lbra	LL4
+LL5:
+
+	__ldw_s	2
+LL1:
+
+	__addmi	10,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-6,__stack
+	__stwi_s	0,0
+	__lea_s	0
+	__addwi	2
+	__pushw
+	__lea_s	2
+	__stwps
+	__lea_s	0
+	__addwi	4
+	__stwip	23
+	__pea_s	0
+	__ldwi	0
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldwi	0
+	  call	_foo
+	__cmpwi_ne	0
+	__lbne	LL19
+	__ldw_s	0
+	__cmpwi_ne	0
+LL19:
+
+	__tstw
+	__lbne	LL20
+	__lea_s	0
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	2
+	  jsr	ne
+LL20:
+
+	__tstw
+	__lbne	LL21
+	__lea_s	0
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL21:
+
+	__tstw
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+	__ldwi	0
+	  call	_exit
+LL17:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _f1
+	__pushw
+	__ldw	LL23
+	incw	LL23
+	__stw	<__temp
+	__ldwi	1
+	  jsr	gtzp
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldw	LL23
+	__stw	<__temp
+	__ldwi	1
+	  jsr	gtzp
+LL22:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _f2
+	  call	_abort
+LL25:
+
+	  rts
+	.endp
+
+
+	.bss
+LL23:		.ds	2
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:12
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL28:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL29
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL30
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL31
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL32
+	__ldw_s	2
+	__lbra	LL27
+LL32:
+
+LL31:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL33
+LL30:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL33:
+
+	__lbra	LL28
+LL29:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL34
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL35
+	__ldw_s	2
+	__lbra	LL27
+LL35:
+
+LL34:
+
+	__ldwi	0
+LL27:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL37
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL37:
+
+LL36:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL39
+	__ldwi	0
+	__lbra	LL38
+LL39:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL41
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL41:
+
+	__tstw
+	__lbeq	LL40
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL42
+	__ldwi	0
+	__lbra	LL38
+LL42:
+
+LL40:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL43
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL44
+LL43:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL44:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL38:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL45:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL46:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL47:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL48:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,442 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:45 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _f
+	__pushw
+	__addmi	-3,__stack
+	__stbi_s	16,2
+	__stwi_s	0,0
+LL2:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	16
+	  jsr	ltzp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL2
+LL4:
+
+	__ldub_s	2
+	__addwi	232
+	__stb_s	2
+	__ldw_s	3
+	__pushw
+	__ldub_s	4
+	__aslw
+	__addws
+	__stwip	0
+	__ldub_s	2
+	__subwi	231
+	__stb_s	2
+	__lbra	LL3
+LL5:
+
+LL1:
+
+	__addmi	5,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-514,__stack
+	__stwi_s	0,0
+LL7:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	1024
+	__pushw
+	__ldwi	4
+	  jsr	sdiv
+	  jsr	lt
+	__lbne	LL9
+	__lbra	LL10
+LL8:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL7
+LL9:
+
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__stwip	1
+	__lbra	LL8
+LL10:
+
+	__lea_s	2
+	  call	_f
+	__stwi_s	0,0
+LL11:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	1024
+	__pushw
+	__ldwi	4
+	  jsr	sdiv
+	  jsr	lt
+	__lbne	LL13
+	__lbra	LL14
+LL12:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL11
+LL13:
+
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	8
+	  jsr	gezp
+	__lbeq	LL16
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	248
+	  jsr	ltzp
+LL16:
+
+	__boolw
+	  jsr	ne
+	__lbeq	LL15
+	  call	_abort
+LL15:
+
+	__lbra	LL12
+LL14:
+
+	__ldwi	0
+	  call	_exit
+LL6:
+
+	__addmi	514,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:9
+;	Macro pool:12
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL19:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL20
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL21
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL22
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL23
+	__ldw_s	2
+	__lbra	LL18
+LL23:
+
+LL22:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL24
+LL21:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL24:
+
+	__lbra	LL19
+LL20:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL25
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL26
+	__ldw_s	2
+	__lbra	LL18
+LL26:
+
+LL25:
+
+	__ldwi	0
+LL18:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL28
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL28:
+
+LL27:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL30
+	__ldwi	0
+	__lbra	LL29
+LL30:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL32
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL32:
+
+	__tstw
+	__lbeq	LL31
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL33
+	__ldwi	0
+	__lbra	LL29
+LL33:
+
+LL31:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL34
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL35
+LL34:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL35:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL29:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL36:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL37:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL38:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL39:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,987 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:45 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test1
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-32768
+	__eorws
+	__pushw
+	__ldwi	4660
+	__eorws
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test1u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-32768
+	__eorws
+	__pushw
+	__ldwi	4660
+	__eorws
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	4660
+	__eorws
+	__pushw
+	__ldwi	-32768
+	__eorws
+LL3:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	4660
+	__eorws
+	__pushw
+	__ldwi	-32768
+	__eorws
+LL4:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3
+	__pushw
+	__ldw_s	0
+	__addwi	-32768
+	__pushw
+	__ldwi	4660
+	__eorws
+LL5:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3u
+	__pushw
+	__ldw_s	0
+	__addwi	-32768
+	__pushw
+	__ldwi	4660
+	__eorws
+LL6:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	4660
+	__eorws
+	__addwi	-32768
+LL7:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	4660
+	__eorws
+	__addwi	-32768
+LL8:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5
+	__pushw
+	__ldw_s	0
+	__subwi	-32768
+	__pushw
+	__ldwi	4660
+	__eorws
+LL9:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5u
+	__pushw
+	__ldw_s	0
+	__subwi	-32768
+	__pushw
+	__ldwi	4660
+	__eorws
+LL10:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	4660
+	__eorws
+	__subwi	-32768
+LL11:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	4660
+	__eorws
+	__subwi	-32768
+LL12:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test7
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__pushw
+	__ldw_s	2
+	__eorws
+LL13:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test7u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	32768,0
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__pushw
+	__ldw_s	2
+	__eorws
+LL14:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test8
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__pushw
+	__ldw_s	2
+	__eorws
+LL15:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test8u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__addmi	-2,__stack
+	__stwi_s	32768,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__pushw
+	__ldw_s	2
+	__eorws
+LL16:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test9
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__ldw_s	4
+	__addw_s	2
+	__pushw
+	__ldw_s	2
+	__eorws
+LL17:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test9u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	32768,0
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__ldw_s	4
+	__addw_s	2
+	__pushw
+	__ldw_s	2
+	__eorws
+LL18:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test10
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__addw_s	0
+LL19:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test10u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__addmi	-2,__stack
+	__stwi_s	32768,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__addw_s	0
+LL20:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test11
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__subws
+	__pushw
+	__ldw_s	2
+	__eorws
+LL21:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test11u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	32768,0
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__subws
+	__pushw
+	__ldw_s	2
+	__eorws
+LL22:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test12
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__pushw
+	__ldw_s	2
+	__subws
+LL23:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test12u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	4660,0
+	__addmi	-2,__stack
+	__stwi_s	32768,0
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__eorws
+	__pushw
+	__ldw_s	2
+	__subws
+LL24:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _test
+	__pushw
+	__ldw_s	2
+	  call	_test1
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__ldw_s	2
+	  call	_test2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL27
+	  call	_abort
+LL27:
+
+	__ldw_s	2
+	  call	_test3
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL28
+	  call	_abort
+LL28:
+
+	__ldw_s	2
+	  call	_test4
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL29
+	  call	_abort
+LL29:
+
+	__ldw_s	2
+	  call	_test5
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL30
+	  call	_abort
+LL30:
+
+	__ldw_s	2
+	  call	_test6
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL31
+	  call	_abort
+LL31:
+
+	__ldw_s	2
+	  call	_test7
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL32
+	  call	_abort
+LL32:
+
+	__ldw_s	2
+	  call	_test8
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL33
+	  call	_abort
+LL33:
+
+	__ldw_s	2
+	  call	_test9
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL34
+	  call	_abort
+LL34:
+
+	__ldw_s	2
+	  call	_test10
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL35
+	  call	_abort
+LL35:
+
+	__ldw_s	2
+	  call	_test11
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL36
+	  call	_abort
+LL36:
+
+	__ldw_s	2
+	  call	_test12
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL37
+	  call	_abort
+LL37:
+
+LL25:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _testu
+	__pushw
+	__ldw_s	2
+	  call	_test1u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL39
+	  call	_abort
+LL39:
+
+	__ldw_s	2
+	  call	_test2u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL40
+	  call	_abort
+LL40:
+
+	__ldw_s	2
+	  call	_test3u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL41
+	  call	_abort
+LL41:
+
+	__ldw_s	2
+	  call	_test4u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL42
+	  call	_abort
+LL42:
+
+	__ldw_s	2
+	  call	_test5u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL43
+	  call	_abort
+LL43:
+
+	__ldw_s	2
+	  call	_test6u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL44
+	  call	_abort
+LL44:
+
+	__ldw_s	2
+	  call	_test7u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL45
+	  call	_abort
+LL45:
+
+	__ldw_s	2
+	  call	_test8u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL46
+	  call	_abort
+LL46:
+
+	__ldw_s	2
+	  call	_test9u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL47
+	  call	_abort
+LL47:
+
+	__ldw_s	2
+	  call	_test10u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL48
+	  call	_abort
+LL48:
+
+	__ldw_s	2
+	  call	_test11u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL49
+	  call	_abort
+LL49:
+
+	__ldw_s	2
+	  call	_test12u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL50
+	  call	_abort
+LL50:
+
+LL38:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	0
+	__pushw
+	__ldwi	37428
+	  call	_test
+	__ldwi	4660
+	__pushw
+	__ldwi	32768
+	  call	_test
+	__ldwi	32768
+	__pushw
+	__ldwi	4660
+	  call	_test
+	__ldwi	37428
+	__pushw
+	__ldwi	0
+	  call	_test
+	__ldwi	32767
+	__pushw
+	__ldwi	60875
+	  call	_test
+	__ldwi	65535
+	__pushw
+	__ldwi	28107
+	  call	_test
+	__ldwi	0
+	__pushw
+	__ldwi	37428
+	  call	_testu
+	__ldwi	32768
+	__pushw
+	__ldwi	4660
+	  call	_testu
+	__ldwi	4660
+	__pushw
+	__ldwi	32768
+	  call	_testu
+	__ldwi	37428
+	__pushw
+	__ldwi	0
+	  call	_testu
+	__ldwi	32767
+	__pushw
+	__ldwi	60875
+	  call	_testu
+	__ldwi	65535
+	__pushw
+	__ldwi	28107
+	  call	_testu
+	__ldwi	0
+LL51:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:33
+;	Macro pool:12
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL54:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL55
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL56
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL57
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL58
+	__ldw_s	2
+	__lbra	LL53
+LL58:
+
+LL57:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL59
+LL56:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL59:
+
+	__lbra	LL54
+LL55:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL60
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL61
+	__ldw_s	2
+	__lbra	LL53
+LL61:
+
+LL60:
+
+	__ldwi	0
+LL53:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL63
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL63:
+
+LL62:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL65
+	__ldwi	0
+	__lbra	LL64
+LL65:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL67
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL67:
+
+	__tstw
+	__lbeq	LL66
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL68
+	__ldwi	0
+	__lbra	LL64
+LL68:
+
+LL66:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL69
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL70
+LL69:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL70:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL64:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL71:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL72:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL73:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL74:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
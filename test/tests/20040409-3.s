@@ -0,0 +1,651 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:45 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test1
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-32768
+	__eorws
+	__comw
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test1u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-32768
+	__eorws
+	__comw
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2
+	__pushw
+	__ldw_s	0
+	__addwi	-32768
+	__comw
+LL3:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2u
+	__pushw
+	__ldw_s	0
+	__addwi	-32768
+	__comw
+LL4:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3
+	__pushw
+	__ldw_s	0
+	__subwi	-32768
+	__comw
+LL5:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3u
+	__pushw
+	__ldw_s	0
+	__subwi	-32768
+	__comw
+LL6:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	__eorws
+	__comw
+LL7:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test4u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	__eorws
+	__comw
+LL8:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test5
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	2
+	__addw_s	0
+	__comw
+LL9:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test5u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	2
+	__addw_s	0
+	__comw
+LL10:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test6
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	__subws
+	__comw
+LL11:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test6u
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	-32768,0
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	__subws
+	__comw
+LL12:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _test
+	__pushw
+	__ldw_s	2
+	  call	_test1
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__ldw_s	2
+	  call	_test2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL15
+	  call	_abort
+LL15:
+
+	__ldw_s	2
+	  call	_test3
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL16
+	  call	_abort
+LL16:
+
+	__ldw_s	2
+	  call	_test4
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL17
+	  call	_abort
+LL17:
+
+	__ldw_s	2
+	  call	_test5
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+	__ldw_s	2
+	  call	_test6
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL19
+	  call	_abort
+LL19:
+
+LL13:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _testu
+	__pushw
+	__ldw_s	2
+	  call	_test1u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__ldw_s	2
+	  call	_test2u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL22
+	  call	_abort
+LL22:
+
+	__ldw_s	2
+	  call	_test3u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL23
+	  call	_abort
+LL23:
+
+	__ldw_s	2
+	  call	_test4u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldw_s	2
+	  call	_test5u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+	__ldw_s	2
+	  call	_test6u
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	nezp
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+LL20:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	0
+	__pushw
+	__ldwi	32767
+	  call	_test
+	__ldwi	32768
+	__pushw
+	__ldwi	65535
+	  call	_test
+	__ldwi	4660
+	__pushw
+	__ldwi	28107
+	  call	_test
+	__ldwi	37428
+	__pushw
+	__ldwi	60875
+	  call	_test
+	__ldwi	32767
+	__pushw
+	__ldwi	0
+	  call	_test
+	__ldwi	65535
+	__pushw
+	__ldwi	32768
+	  call	_test
+	__ldwi	0
+	__pushw
+	__ldwi	32767
+	  call	_testu
+	__ldwi	32768
+	__pushw
+	__ldwi	65535
+	  call	_testu
+	__ldwi	4660
+	__pushw
+	__ldwi	28107
+	  call	_testu
+	__ldwi	37428
+	__pushw
+	__ldwi	60875
+	  call	_testu
+	__ldwi	32767
+	__pushw
+	__ldwi	0
+	  call	_testu
+	__ldwi	65535
+	__pushw
+	__ldwi	32768
+	  call	_testu
+	__ldwi	0
+LL27:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:21
+;	Macro pool:12
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL30:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL31
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL32
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL33
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL34
+	__ldw_s	2
+	__lbra	LL29
+LL34:
+
+LL33:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL35
+LL32:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL35:
+
+	__lbra	LL30
+LL31:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL36
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL37
+	__ldw_s	2
+	__lbra	LL29
+LL37:
+
+LL36:
+
+	__ldwi	0
+LL29:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL39
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL39:
+
+LL38:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL41
+	__ldwi	0
+	__lbra	LL40
+LL41:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL43
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL43:
+
+	__tstw
+	__lbeq	LL42
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL44
+	__ldwi	0
+	__lbra	LL40
+LL44:
+
+LL42:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL45
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL46
+LL45:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL46:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL40:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL47:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL48:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL49:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL50:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,441 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:45 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _foo
+	__pushw
+	__addmi	-4,__stack
+	__stwi_s	0,0
+	__stwi_s	0,2
+LL2:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	4
+	  jsr	ultzp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL2
+LL4:
+
+	__ldw_s	8
+	__addw_s	0
+	__phax
+	__ldw_s	2
+	__aslw
+	__addwi_sym	_a
+	__stw	<__ptr
+	__ldwp	__ptr
+	__phax
+	__ldw_s	2
+	__aslw
+	__addwi_sym	_a
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	si
+	  call	_strlen.1
+	__stw	<__temp
+	__plax
+	__stw	si
+	__plax
+	__stw	di
+	__ldw	<__temp
+	  call	_strncmp.3
+	__cmpwi_ne	0
+	__lbeq	LL6
+	__ldwi	2
+	__lbra	LL1
+LL6:
+
+	__pea_s	0
+	__ldw_s	2
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addwi_sym	_a
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	si
+	  call	_strlen.1
+	__addws
+	__stwps
+	__ldw_s	6
+	__tstw
+	__lbeq	LL7
+	__pea_s	0
+	__ldw_s	2
+	__pushw
+	__ldw_s	10
+	__stw	si
+	  call	_strlen.1
+	__addws
+	__stwps
+LL7:
+
+	__lbra	LL3
+LL5:
+
+	__ldwi	0
+LL1:
+
+	__addmi	10,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	LL0+12
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldwi	3
+	  call	_foo
+	__cmpwi_ne	0
+	__lbeq	LL9
+	  call	_abort
+LL9:
+
+	__ldwi	0
+LL8:
+
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	97,0,98,99,0,100,101,0
+	.db	102,103,104,0,97,98,99,100
+	.db	101,0
+_a:
+	.dw	LL0+0
+	.dw	LL0+2
+	.dw	LL0+5
+	.dw	LL0+8
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+	.dw	0
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:18
+;	constant pool:32
+;	global pool:11
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL12:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL13
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL14
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL15
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL16
+	__ldw_s	2
+	__lbra	LL11
+LL16:
+
+LL15:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL17
+LL14:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL17:
+
+	__lbra	LL12
+LL13:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL18
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL19
+	__ldw_s	2
+	__lbra	LL11
+LL19:
+
+LL18:
+
+	__ldwi	0
+LL11:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL21
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL21:
+
+LL20:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL23
+	__ldwi	0
+	__lbra	LL22
+LL23:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL25
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL25:
+
+	__tstw
+	__lbeq	LL24
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL26
+	__ldwi	0
+	__lbra	LL22
+LL26:
+
+LL24:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL27
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL28
+LL27:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL28:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL22:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL29:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL30:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL31:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL32:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:32
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,617 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:45 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _inet_check_attr
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	1,0
+LL2:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	14
+	  jsr	lezp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL2
+LL4:
+
+	__addmi	-2,__stack
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__subwi	1
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	0
+	__tstw
+	__lbeq	LL6
+	__ldw_s	0
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subwi	4
+	__stw	<__temp
+	__ldwi	4
+	  jsr	ultzp
+	__lbeq	LL7
+	__addmi	2,__stack
+	__ldwi	-22
+	__lbra	LL1
+LL7:
+
+	__ldw_s	2
+	__cmpwi_ne	9
+	__lbeq	LL9
+	__ldw_s	2
+	__cmpwi_ne	8
+LL9:
+
+	__tstw
+	__lbeq	LL8
+	__ldw_s	4
+	__pushw
+	__ldw_s	4
+	__subwi	1
+	__aslw
+	__addws
+	__pushw
+	__ldw_s	2
+	__addwi	4
+	__stwps
+LL8:
+
+LL6:
+
+	__addmi	2,__stack
+	__lbra	LL3
+LL5:
+
+	__ldwi	0
+LL1:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-38,__stack
+	__stwi_s	12,30
+	__lea_s	30
+	__addwi	2
+	__stwip	0
+	__ldw_s	30
+	__stw_s	34
+	__stwi_s	0,0
+LL11:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	14
+	  jsr	ltzp
+	__lbne	LL13
+	__lbra	LL14
+LL12:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL11
+LL13:
+
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__pushw
+	__lea_s	32
+	__stwps
+	__lbra	LL12
+LL14:
+
+	__ldwi	0
+	__pushw
+	__lea_s	4
+	  call	_inet_check_attr
+	__cmpwi_ne	0
+	__lbeq	LL15
+	  call	_abort
+LL15:
+
+	__stwi_s	0,0
+LL16:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	14
+	  jsr	ltzp
+	__lbne	LL18
+	__lbra	LL19
+LL17:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL16
+LL18:
+
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__pea_s	32
+	__ldw_s	4
+	__cmpwi_ne	7
+	__lbeq	LL21
+	__ldw_s	4
+	__cmpwi_ne	8
+LL21:
+
+	__boolw
+	__mulwi	4
+	__addws
+	  jsr	ne
+	__lbeq	LL20
+	  call	_abort
+LL20:
+
+	__lbra	LL17
+LL19:
+
+	__stwi_s	0,0
+LL22:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	14
+	  jsr	ltzp
+	__lbne	LL24
+	__lbra	LL25
+LL23:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL22
+LL24:
+
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__pushw
+	__lea_s	32
+	__stwps
+	__lbra	LL23
+LL25:
+
+	__stwi_s	0,4
+	__ldw_s	34
+	__subwi	8
+	__stw_s	34
+	__lea_s	34
+	__stw_s	12
+	__ldwi	0
+	__pushw
+	__lea_s	4
+	  call	_inet_check_attr
+	__cmpwi_ne	-22
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__stwi_s	0,0
+LL27:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	14
+	  jsr	ltzp
+	__lbne	LL29
+	__lbra	LL30
+LL28:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL27
+LL29:
+
+	__ldw_s	0
+	__cmpwi_eq	1
+	__lbeq	LL32
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL32:
+
+	__tstw
+	__lbeq	LL31
+	  call	_abort
+	__lbra	LL33
+LL31:
+
+	__ldw_s	0
+	__cmpwi_ne	1
+	__lbeq	LL35
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	5
+	  jsr	lezp
+LL35:
+
+	__tstw
+	__lbeq	LL36
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	36
+	  jsr	ne
+LL36:
+
+	__tstw
+	__lbeq	LL34
+	  call	_abort
+	__lbra	LL37
+LL34:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	5
+	  jsr	gtzp
+	__lbeq	LL39
+	__pea_s	2
+	__ldw_s	2
+	__aslw
+	__addws
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__lea_s	32
+	  jsr	ne
+LL39:
+
+	__tstw
+	__lbeq	LL38
+	  call	_abort
+LL38:
+
+LL37:
+
+LL33:
+
+	__lbra	LL28
+LL30:
+
+	__ldwi	0
+LL10:
+
+	__addmi	38,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL42:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL43
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL44
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL45
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL46
+	__ldw_s	2
+	__lbra	LL41
+LL46:
+
+LL45:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL47
+LL44:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL47:
+
+	__lbra	LL42
+LL43:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL48
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL49
+	__ldw_s	2
+	__lbra	LL41
+LL49:
+
+LL48:
+
+	__ldwi	0
+LL41:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL51
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL51:
+
+LL50:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL53
+	__ldwi	0
+	__lbra	LL52
+LL53:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL55
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL55:
+
+	__tstw
+	__lbeq	LL54
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL56
+	__ldwi	0
+	__lbra	LL52
+LL56:
+
+LL54:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL57
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL58
+LL57:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL58:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL52:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL59:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL60:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL61:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL62:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,493 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:46 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _foo
+	__pushw
+	__ldw_s	2
+	__addwi	2
+	__stw_s	2
+	__subwi	2
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	2
+	__stwps
+	__subwi	2
+	__pushw
+	__ldw_s	2
+	__addwi	2
+	__stw_s	2
+	__subwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _bar
+	__pushw
+	__ldw_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw_s	2
+	__addwi	2
+	__stw_s	2
+	__subwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldw_s	2
+	__addwi	2
+	__stw_s	2
+	__subwi	2
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	2
+	__stwps
+	__subwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+LL2:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _baz
+	__pushw
+	__ldw_s	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw_s	2
+	__addwi	2
+	__stw_s	2
+	__subwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stwps
+	__ldw_s	2
+	__addwi	2
+	__stw_s	2
+	__subwi	2
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	2
+	__stwps
+	__subwi	2
+LL3:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-6,__stack
+	__stwi_s	42,4
+	__stwi_s	0,2
+	__lea_s	4
+	__stw_s	0
+	__pea_s	0
+	__lea_s	4
+	  call	_foo
+	__ldw_s	0
+	__subwi	2
+	__pushw
+	__lea_s	6
+	  jsr	ne
+	__lbne	LL6
+	__ldw_s	2
+	__cmpwi_ne	0
+LL6:
+
+	__tstw
+	__lbne	LL7
+	__ldw_s	4
+	__cmpwi_ne	0
+LL7:
+
+	__tstw
+	__lbeq	LL5
+	  call	_abort
+LL5:
+
+	__stwi_s	43,4
+	__lea_s	4
+	__stw_s	0
+	__pea_s	0
+	__lea_s	4
+	  call	_bar
+	__ldw_s	0
+	__subwi	2
+	__pushw
+	__lea_s	6
+	  jsr	ne
+	__lbne	LL9
+	__ldw_s	2
+	__cmpwi_ne	0
+LL9:
+
+	__tstw
+	__lbne	LL10
+	__ldw_s	4
+	__cmpwi_ne	0
+LL10:
+
+	__tstw
+	__lbeq	LL8
+	  call	_abort
+LL8:
+
+	__stwi_s	44,4
+	__lea_s	4
+	__stw_s	0
+	__pea_s	0
+	__lea_s	4
+	  call	_baz
+	__ldw_s	0
+	__subwi	2
+	__pushw
+	__lea_s	6
+	  jsr	ne
+	__lbne	LL12
+	__ldw_s	2
+	__cmpwi_ne	0
+LL12:
+
+	__tstw
+	__lbne	LL13
+	__ldw_s	4
+	__cmpwi_ne	0
+LL13:
+
+	__tstw
+	__lbeq	LL11
+	  call	_abort
+LL11:
+
+	__ldwi	0
+LL4:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL16:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL17
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL18
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL19
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL20
+	__ldw_s	2
+	__lbra	LL15
+LL20:
+
+LL19:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL21
+LL18:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL21:
+
+	__lbra	LL16
+LL17:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL22
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL23
+	__ldw_s	2
+	__lbra	LL15
+LL23:
+
+LL22:
+
+	__ldwi	0
+LL15:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL25
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL25:
+
+LL24:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL27
+	__ldwi	0
+	__lbra	LL26
+LL27:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL29
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL29:
+
+	__tstw
+	__lbeq	LL28
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL30
+	__ldwi	0
+	__lbra	LL26
+LL30:
+
+LL28:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL31
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL32
+LL31:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL32:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL26:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL33:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL34:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL35:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL36:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
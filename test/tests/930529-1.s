@@ -0,0 +1,605 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:46 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	  jsr	sdiv
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-2,__stack
+	__stwi_s	-3,0
+LL3:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	3
+	  jsr	lezp
+	__lbne	LL5
+	__lbra	LL6
+LL4:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL3
+LL5:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	1
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	1
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL7
+	  call	_abort
+LL7:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	2
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	2
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL8
+	  call	_abort
+LL8:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	3
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	3
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL9
+	  call	_abort
+LL9:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	4
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	4
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL10
+	  call	_abort
+LL10:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	5
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	5
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL11
+	  call	_abort
+LL11:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	6
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	6
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL12
+	  call	_abort
+LL12:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	7
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	7
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL13
+	  call	_abort
+LL13:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	8
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	8
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__lbra	LL4
+LL6:
+
+	__ldwi	65535
+	__asrwi	1
+	__subwi	3
+	__stw_s	0
+LL15:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	65535
+	__asrwi	1
+	__addwi	3
+	  jsr	le
+	__lbne	LL17
+	__lbra	LL18
+LL16:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL15
+LL17:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	1
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	1
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL19
+	  call	_abort
+LL19:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	2
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	2
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL20
+	  call	_abort
+LL20:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	3
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	3
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	4
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	4
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL22
+	  call	_abort
+LL22:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	5
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	5
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL23
+	  call	_abort
+LL23:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	6
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	6
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	7
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	7
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+	__ldw_s	0
+	__pushw
+	__ldwi	8
+	  call	_dd
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldwi	8
+	  jsr	sdiv
+	  jsr	ne
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__lbra	LL16
+LL18:
+
+	__ldwi	0
+	  call	_exit
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:9
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL29:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL30
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL31
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL32
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL33
+	__ldw_s	2
+	__lbra	LL28
+LL33:
+
+LL32:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL34
+LL31:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL34:
+
+	__lbra	LL29
+LL30:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL35
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL36
+	__ldw_s	2
+	__lbra	LL28
+LL36:
+
+LL35:
+
+	__ldwi	0
+LL28:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL38
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL38:
+
+LL37:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL40
+	__ldwi	0
+	__lbra	LL39
+LL40:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL42
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL42:
+
+	__tstw
+	__lbeq	LL41
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL43
+	__ldwi	0
+	__lbra	LL39
+LL43:
+
+LL41:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL44
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL45
+LL44:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL45:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL39:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL46:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL47:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL48:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL49:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,599 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:47 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _func
+	__pushw
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ltzp
+	__lbeq	LL3
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gezp
+LL3:
+
+	__tstw
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+	__lbeq	LL5
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	lezp
+LL5:
+
+	__tstw
+	__lbeq	LL4
+	  call	_abort
+LL4:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gezp
+	__lbeq	LL7
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ltzp
+LL7:
+
+	__tstw
+	__lbeq	LL6
+	  call	_abort
+LL6:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	lezp
+	__lbeq	LL9
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+LL9:
+
+	__tstw
+	__lbeq	LL8
+	  call	_abort
+LL8:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	ltzp
+	__lbeq	LL11
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gezp
+LL11:
+
+	__tstw
+	__lbeq	LL10
+	  call	_abort
+LL10:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gtzp
+	__lbeq	LL13
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	lezp
+LL13:
+
+	__tstw
+	__lbeq	LL12
+	  call	_abort
+LL12:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gezp
+	__lbeq	LL15
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	ltzp
+LL15:
+
+	__tstw
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	lezp
+	__lbeq	LL17
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gtzp
+LL17:
+
+	__tstw
+	__lbeq	LL16
+	  call	_abort
+LL16:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ltzp
+	__lbne	LL19
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gezp
+LL19:
+
+	__boolw
+	__notw
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+	__lbne	LL21
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	lezp
+LL21:
+
+	__boolw
+	__notw
+	__lbeq	LL20
+	  call	_abort
+LL20:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gezp
+	__lbne	LL23
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ltzp
+LL23:
+
+	__boolw
+	__notw
+	__lbeq	LL22
+	  call	_abort
+LL22:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	lezp
+	__lbne	LL25
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+LL25:
+
+	__boolw
+	__notw
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	ltzp
+	__lbne	LL27
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gezp
+LL27:
+
+	__boolw
+	__notw
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gtzp
+	__lbne	LL29
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	lezp
+LL29:
+
+	__boolw
+	__notw
+	__lbeq	LL28
+	  call	_abort
+LL28:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gezp
+	__lbne	LL31
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	ltzp
+LL31:
+
+	__boolw
+	__notw
+	__lbeq	LL30
+	  call	_abort
+LL30:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	lezp
+	__lbne	LL33
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	77
+	  jsr	gtzp
+LL33:
+
+	__boolw
+	__notw
+	__lbeq	LL32
+	  call	_abort
+LL32:
+
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	0
+	  call	_func
+	__ldwi	1
+	  call	_func
+	__ldwi	0
+LL34:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL37:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL38
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL39
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL40
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL41
+	__ldw_s	2
+	__lbra	LL36
+LL41:
+
+LL40:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL42
+LL39:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL42:
+
+	__lbra	LL37
+LL38:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL43
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL44
+	__ldw_s	2
+	__lbra	LL36
+LL44:
+
+LL43:
+
+	__ldwi	0
+LL36:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL46
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL46:
+
+LL45:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL48
+	__ldwi	0
+	__lbra	LL47
+LL48:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL50
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL50:
+
+	__tstw
+	__lbeq	LL49
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL51
+	__ldwi	0
+	__lbra	LL47
+LL51:
+
+LL49:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL52
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL53
+LL52:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL53:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL47:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL54:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL55:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL56:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL57:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,433 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:48 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _loop
+	__pushw
+LL2:
+
+LL3:
+
+LL4:
+
+	__ldw_s	2
+	__incw_s	2
+	__pushw
+	__ldw_s	2
+	__incw_s	2
+	__ldb_p
+	__stbps
+	__lbra	LL6
+LL8:
+
+	__addmi_sym	LL9_stkp,__stack
+	__lbra	LL9
+LL10:
+
+LL11:
+
+	__ldw_s	2
+	__addwi	-1
+	__stbip	92
+	__ldw_s	2
+	__incw_s	2
+	__pushw
+	__ldw_s	2
+	__addwi	-1
+	__ldb_p
+	__stbps
+	__lbra	LL7
+LL6:
+
+	  cpx	#0
+	  bne	LL12
+	  cmp	#0
+	  bne	LL12
+	  jmp	LL8
+LL12:
+
+	  cpx	#34
+	  bne	LL13
+	  cmp	#0
+	  bne	LL13
+	  jmp	LL10
+LL13:
+
+	  cpx	#92
+	  bne	LL14
+	  cmp	#0
+	  bne	LL14
+	  jmp	LL11
+LL14:
+
+	  jmp	LL7
+LL7:
+
+	__lbra	LL4
+LL5:
+
+LL9_stkp .equ 0
+LL9:
+
+	__ldwi	_a
+	__pushw
+	__ldw_s	4
+	__subws
+	__pushw
+	__ldwi	_b
+	__pushw
+	__ldw_s	4
+	__subws
+	  jsr	neb
+	__lbeq	LL15
+	  call	_abort
+LL15:
+
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	_a
+	__stw	di
+	__ldwi	LL0+0
+	__stw	si
+	  call	_strcpy.2
+	__ldwi	_b
+	__stw	di
+	__ldwi	LL0+6
+	__stw	si
+	  call	_strcpy.2
+	__ldwi	_a
+	__pushw
+	__ldwi	_b
+	  call	_loop
+	__ldwi	0
+	  call	_exit
+LL16:
+
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	49,50,51,52,53,0,49,50
+	.db	51,52,53,0
+
+	.bss
+_a:		.ds	6
+_b:		.ds	6
+
+
+;0 error(s) in compilation
+;	literal pool:12
+;	constant pool:0
+;	global pool:12
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL19:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL20
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL21
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL22
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL23
+	__ldw_s	2
+	__lbra	LL18
+LL23:
+
+LL22:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL24
+LL21:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL24:
+
+	__lbra	LL19
+LL20:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL25
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL26
+	__ldw_s	2
+	__lbra	LL18
+LL26:
+
+LL25:
+
+	__ldwi	0
+LL18:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL28
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL28:
+
+LL27:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL30
+	__ldwi	0
+	__lbra	LL29
+LL30:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL32
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL32:
+
+	__tstw
+	__lbeq	LL31
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL33
+	__ldwi	0
+	__lbra	LL29
+LL33:
+
+LL31:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL34
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL35
+LL34:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL35:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL29:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL36:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL37:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL38:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL39:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
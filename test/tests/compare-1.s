@@ -0,0 +1,749 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:48 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _ieq
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	lezp
+	__lbeq	LL3
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gezp
+LL3:
+
+	__tstw
+	__lbeq	LL2
+	__ldw_s	0
+	__notw
+	__lbeq	LL4
+	  call	_abort
+LL4:
+
+	__lbra	LL5
+LL2:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL6
+	  call	_abort
+LL6:
+
+LL5:
+
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	lezp
+	__lbeq	LL8
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	eqzp
+LL8:
+
+	__tstw
+	__lbeq	LL7
+	__ldw_s	0
+	__notw
+	__lbeq	LL9
+	  call	_abort
+LL9:
+
+	__lbra	LL10
+LL7:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL11
+	  call	_abort
+LL11:
+
+LL10:
+
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	lezp
+	__lbeq	LL13
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	4
+	  jsr	lezp
+LL13:
+
+	__tstw
+	__lbeq	LL12
+	__ldw_s	0
+	__notw
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__lbra	LL15
+LL12:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL16
+	  call	_abort
+LL16:
+
+LL15:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	4
+	  jsr	eqzp
+	__lbeq	LL18
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	lezp
+LL18:
+
+	__tstw
+	__lbeq	LL17
+	__ldw_s	0
+	__notw
+	__lbeq	LL19
+	  call	_abort
+LL19:
+
+	__lbra	LL20
+LL17:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+LL20:
+
+LL1:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _ine
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbne	LL24
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+LL24:
+
+	__tstw
+	__lbeq	LL23
+	__ldw_s	0
+	__notw
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+	__lbra	LL26
+LL23:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL27
+	  call	_abort
+LL27:
+
+LL26:
+
+LL22:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _ilt
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbeq	LL30
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	nezp
+LL30:
+
+	__tstw
+	__lbeq	LL29
+	__ldw_s	0
+	__notw
+	__lbeq	LL31
+	  call	_abort
+LL31:
+
+	__lbra	LL32
+LL29:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL33
+	  call	_abort
+LL33:
+
+LL32:
+
+LL28:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _ile
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbne	LL36
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	eqzp
+LL36:
+
+	__tstw
+	__lbeq	LL35
+	__ldw_s	0
+	__notw
+	__lbeq	LL37
+	  call	_abort
+LL37:
+
+	__lbra	LL38
+LL35:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL39
+	  call	_abort
+LL39:
+
+LL38:
+
+LL34:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _igt
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+	__lbeq	LL42
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	nezp
+LL42:
+
+	__tstw
+	__lbeq	LL41
+	__ldw_s	0
+	__notw
+	__lbeq	LL43
+	  call	_abort
+LL43:
+
+	__lbra	LL44
+LL41:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL45
+	  call	_abort
+LL45:
+
+LL44:
+
+LL40:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _ige
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+	__lbne	LL48
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	eqzp
+LL48:
+
+	__tstw
+	__lbeq	LL47
+	__ldw_s	0
+	__notw
+	__lbeq	LL49
+	  call	_abort
+LL49:
+
+	__lbra	LL50
+LL47:
+
+	__ldw_s	0
+	__tstw
+	__lbeq	LL51
+	  call	_abort
+LL51:
+
+LL50:
+
+LL46:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	1
+	__pushw
+	__ldwi	4
+	__pushw
+	__ldwi	0
+	  call	_ieq
+	__ldwi	3
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	1
+	  call	_ieq
+	__ldwi	5
+	__pushw
+	__ldwi	2
+	__pushw
+	__ldwi	0
+	  call	_ieq
+	__ldwi	1
+	__pushw
+	__ldwi	4
+	__pushw
+	__ldwi	1
+	  call	_ine
+	__ldwi	3
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	0
+	  call	_ine
+	__ldwi	5
+	__pushw
+	__ldwi	2
+	__pushw
+	__ldwi	1
+	  call	_ine
+	__ldwi	1
+	__pushw
+	__ldwi	4
+	__pushw
+	__ldwi	1
+	  call	_ilt
+	__ldwi	3
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	0
+	  call	_ilt
+	__ldwi	5
+	__pushw
+	__ldwi	2
+	__pushw
+	__ldwi	0
+	  call	_ilt
+	__ldwi	1
+	__pushw
+	__ldwi	4
+	__pushw
+	__ldwi	1
+	  call	_ile
+	__ldwi	3
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	1
+	  call	_ile
+	__ldwi	5
+	__pushw
+	__ldwi	2
+	__pushw
+	__ldwi	0
+	  call	_ile
+	__ldwi	1
+	__pushw
+	__ldwi	4
+	__pushw
+	__ldwi	0
+	  call	_igt
+	__ldwi	3
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	0
+	  call	_igt
+	__ldwi	5
+	__pushw
+	__ldwi	2
+	__pushw
+	__ldwi	1
+	  call	_igt
+	__ldwi	1
+	__pushw
+	__ldwi	4
+	__pushw
+	__ldwi	0
+	  call	_ige
+	__ldwi	3
+	__pushw
+	__ldwi	3
+	__pushw
+	__ldwi	1
+	  call	_ige
+	__ldwi	5
+	__pushw
+	__ldwi	2
+	__pushw
+	__ldwi	1
+	  call	_ige
+	__ldwi	0
+LL52:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:13
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL55:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL56
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL57
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL58
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL59
+	__ldw_s	2
+	__lbra	LL54
+LL59:
+
+LL58:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL60
+LL57:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL60:
+
+	__lbra	LL55
+LL56:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL61
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL62
+	__ldw_s	2
+	__lbra	LL54
+LL62:
+
+LL61:
+
+	__ldwi	0
+LL54:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL64
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL64:
+
+LL63:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL66
+	__ldwi	0
+	__lbra	LL65
+LL66:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL68
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL68:
+
+	__tstw
+	__lbeq	LL67
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL69
+	__ldwi	0
+	__lbra	LL65
+LL69:
+
+LL67:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL70
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL71
+LL70:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL71:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL65:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL72:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL73:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL74:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL75:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
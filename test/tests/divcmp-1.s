@@ -0,0 +1,1393 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:48 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test1
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__cmpwi_eq	2
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test1u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__cmpwi_eq	2
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__cmpwi_eq	0
+LL3:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__cmpwi_eq	0
+LL4:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__cmpwi_ne	2
+LL5:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__cmpwi_ne	2
+LL6:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__cmpwi_ne	0
+LL7:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__cmpwi_ne	0
+LL8:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ltzp
+LL9:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ultzp
+LL10:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ltzp
+LL11:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test7
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	lezp
+LL12:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test7u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ulezp
+LL13:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test8
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	lezp
+LL14:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test8u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ulezp
+LL15:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test9
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	gtzp
+LL16:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test9u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ugtzp
+LL17:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test10
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+LL18:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test10u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ugtzp
+LL19:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test11
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	gezp
+LL20:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test11u
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	udiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ugezp
+LL21:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test12
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gezp
+LL22:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	19
+	  call	_test1
+	__cmpwi_ne	0
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldwi	20
+	  call	_test1
+	__cmpwi_ne	1
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+	__ldwi	29
+	  call	_test1
+	__cmpwi_ne	1
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__ldwi	30
+	  call	_test1
+	__cmpwi_ne	0
+	__lbeq	LL27
+	  call	_abort
+LL27:
+
+	__ldwi	19
+	  call	_test1u
+	__cmpwi_ne	0
+	__lbeq	LL28
+	  call	_abort
+LL28:
+
+	__ldwi	20
+	  call	_test1u
+	__cmpwi_ne	1
+	__lbeq	LL29
+	  call	_abort
+LL29:
+
+	__ldwi	29
+	  call	_test1u
+	__cmpwi_ne	1
+	__lbeq	LL30
+	  call	_abort
+LL30:
+
+	__ldwi	30
+	  call	_test1u
+	__cmpwi_ne	0
+	__lbeq	LL31
+	  call	_abort
+LL31:
+
+	__ldwi	0
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL32
+	  call	_abort
+LL32:
+
+	__ldwi	9
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL33
+	  call	_abort
+LL33:
+
+	__ldwi	10
+	  call	_test2
+	__cmpwi_ne	0
+	__lbeq	LL34
+	  call	_abort
+LL34:
+
+	__ldwi	-1
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL35
+	  call	_abort
+LL35:
+
+	__ldwi	-9
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL36
+	  call	_abort
+LL36:
+
+	__ldwi	-10
+	  call	_test2
+	__cmpwi_ne	0
+	__lbeq	LL37
+	  call	_abort
+LL37:
+
+	__ldwi	0
+	  call	_test2u
+	__cmpwi_ne	1
+	__lbeq	LL38
+	  call	_abort
+LL38:
+
+	__ldwi	9
+	  call	_test2u
+	__cmpwi_ne	1
+	__lbeq	LL39
+	  call	_abort
+LL39:
+
+	__ldwi	10
+	  call	_test2u
+	__cmpwi_ne	0
+	__lbeq	LL40
+	  call	_abort
+LL40:
+
+	__ldwi	-1
+	  call	_test2u
+	__cmpwi_ne	0
+	__lbeq	LL41
+	  call	_abort
+LL41:
+
+	__ldwi	-9
+	  call	_test2u
+	__cmpwi_ne	0
+	__lbeq	LL42
+	  call	_abort
+LL42:
+
+	__ldwi	-10
+	  call	_test2u
+	__cmpwi_ne	0
+	__lbeq	LL43
+	  call	_abort
+LL43:
+
+	__ldwi	19
+	  call	_test3
+	__cmpwi_ne	1
+	__lbeq	LL44
+	  call	_abort
+LL44:
+
+	__ldwi	20
+	  call	_test3
+	__cmpwi_ne	0
+	__lbeq	LL45
+	  call	_abort
+LL45:
+
+	__ldwi	29
+	  call	_test3
+	__cmpwi_ne	0
+	__lbeq	LL46
+	  call	_abort
+LL46:
+
+	__ldwi	30
+	  call	_test3
+	__cmpwi_ne	1
+	__lbeq	LL47
+	  call	_abort
+LL47:
+
+	__ldwi	19
+	  call	_test3u
+	__cmpwi_ne	1
+	__lbeq	LL48
+	  call	_abort
+LL48:
+
+	__ldwi	20
+	  call	_test3u
+	__cmpwi_ne	0
+	__lbeq	LL49
+	  call	_abort
+LL49:
+
+	__ldwi	29
+	  call	_test3u
+	__cmpwi_ne	0
+	__lbeq	LL50
+	  call	_abort
+LL50:
+
+	__ldwi	30
+	  call	_test3u
+	__cmpwi_ne	1
+	__lbeq	LL51
+	  call	_abort
+LL51:
+
+	__ldwi	0
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL52
+	  call	_abort
+LL52:
+
+	__ldwi	9
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL53
+	  call	_abort
+LL53:
+
+	__ldwi	10
+	  call	_test4
+	__cmpwi_ne	1
+	__lbeq	LL54
+	  call	_abort
+LL54:
+
+	__ldwi	-1
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL55
+	  call	_abort
+LL55:
+
+	__ldwi	-9
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL56
+	  call	_abort
+LL56:
+
+	__ldwi	-10
+	  call	_test4
+	__cmpwi_ne	1
+	__lbeq	LL57
+	  call	_abort
+LL57:
+
+	__ldwi	0
+	  call	_test4u
+	__cmpwi_ne	0
+	__lbeq	LL58
+	  call	_abort
+LL58:
+
+	__ldwi	9
+	  call	_test4u
+	__cmpwi_ne	0
+	__lbeq	LL59
+	  call	_abort
+LL59:
+
+	__ldwi	10
+	  call	_test4u
+	__cmpwi_ne	1
+	__lbeq	LL60
+	  call	_abort
+LL60:
+
+	__ldwi	-1
+	  call	_test4u
+	__cmpwi_ne	1
+	__lbeq	LL61
+	  call	_abort
+LL61:
+
+	__ldwi	-9
+	  call	_test4u
+	__cmpwi_ne	1
+	__lbeq	LL62
+	  call	_abort
+LL62:
+
+	__ldwi	-10
+	  call	_test4u
+	__cmpwi_ne	1
+	__lbeq	LL63
+	  call	_abort
+LL63:
+
+	__ldwi	19
+	  call	_test5
+	__cmpwi_ne	1
+	__lbeq	LL64
+	  call	_abort
+LL64:
+
+	__ldwi	20
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL65
+	  call	_abort
+LL65:
+
+	__ldwi	29
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL66
+	  call	_abort
+LL66:
+
+	__ldwi	30
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL67
+	  call	_abort
+LL67:
+
+	__ldwi	19
+	  call	_test5u
+	__cmpwi_ne	1
+	__lbeq	LL68
+	  call	_abort
+LL68:
+
+	__ldwi	20
+	  call	_test5u
+	__cmpwi_ne	0
+	__lbeq	LL69
+	  call	_abort
+LL69:
+
+	__ldwi	29
+	  call	_test5u
+	__cmpwi_ne	0
+	__lbeq	LL70
+	  call	_abort
+LL70:
+
+	__ldwi	30
+	  call	_test5u
+	__cmpwi_ne	0
+	__lbeq	LL71
+	  call	_abort
+LL71:
+
+	__ldwi	0
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL72
+	  call	_abort
+LL72:
+
+	__ldwi	9
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL73
+	  call	_abort
+LL73:
+
+	__ldwi	10
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL74
+	  call	_abort
+LL74:
+
+	__ldwi	-1
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL75
+	  call	_abort
+LL75:
+
+	__ldwi	-9
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL76
+	  call	_abort
+LL76:
+
+	__ldwi	-10
+	  call	_test6
+	__cmpwi_ne	1
+	__lbeq	LL77
+	  call	_abort
+LL77:
+
+	__ldwi	19
+	  call	_test7
+	__cmpwi_ne	1
+	__lbeq	LL78
+	  call	_abort
+LL78:
+
+	__ldwi	20
+	  call	_test7
+	__cmpwi_ne	1
+	__lbeq	LL79
+	  call	_abort
+LL79:
+
+	__ldwi	29
+	  call	_test7
+	__cmpwi_ne	1
+	__lbeq	LL80
+	  call	_abort
+LL80:
+
+	__ldwi	30
+	  call	_test7
+	__cmpwi_ne	0
+	__lbeq	LL81
+	  call	_abort
+LL81:
+
+	__ldwi	19
+	  call	_test7u
+	__cmpwi_ne	1
+	__lbeq	LL82
+	  call	_abort
+LL82:
+
+	__ldwi	20
+	  call	_test7u
+	__cmpwi_ne	1
+	__lbeq	LL83
+	  call	_abort
+LL83:
+
+	__ldwi	29
+	  call	_test7u
+	__cmpwi_ne	1
+	__lbeq	LL84
+	  call	_abort
+LL84:
+
+	__ldwi	30
+	  call	_test7u
+	__cmpwi_ne	0
+	__lbeq	LL85
+	  call	_abort
+LL85:
+
+	__ldwi	0
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL86
+	  call	_abort
+LL86:
+
+	__ldwi	9
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL87
+	  call	_abort
+LL87:
+
+	__ldwi	10
+	  call	_test8
+	__cmpwi_ne	0
+	__lbeq	LL88
+	  call	_abort
+LL88:
+
+	__ldwi	-1
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL89
+	  call	_abort
+LL89:
+
+	__ldwi	-9
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL90
+	  call	_abort
+LL90:
+
+	__ldwi	-10
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL91
+	  call	_abort
+LL91:
+
+	__ldwi	0
+	  call	_test8u
+	__cmpwi_ne	1
+	__lbeq	LL92
+	  call	_abort
+LL92:
+
+	__ldwi	9
+	  call	_test8u
+	__cmpwi_ne	1
+	__lbeq	LL93
+	  call	_abort
+LL93:
+
+	__ldwi	10
+	  call	_test8u
+	__cmpwi_ne	0
+	__lbeq	LL94
+	  call	_abort
+LL94:
+
+	__ldwi	-1
+	  call	_test8u
+	__cmpwi_ne	0
+	__lbeq	LL95
+	  call	_abort
+LL95:
+
+	__ldwi	-9
+	  call	_test8u
+	__cmpwi_ne	0
+	__lbeq	LL96
+	  call	_abort
+LL96:
+
+	__ldwi	-10
+	  call	_test8u
+	__cmpwi_ne	0
+	__lbeq	LL97
+	  call	_abort
+LL97:
+
+	__ldwi	19
+	  call	_test9
+	__cmpwi_ne	0
+	__lbeq	LL98
+	  call	_abort
+LL98:
+
+	__ldwi	20
+	  call	_test9
+	__cmpwi_ne	0
+	__lbeq	LL99
+	  call	_abort
+LL99:
+
+	__ldwi	29
+	  call	_test9
+	__cmpwi_ne	0
+	__lbeq	LL100
+	  call	_abort
+LL100:
+
+	__ldwi	30
+	  call	_test9
+	__cmpwi_ne	1
+	__lbeq	LL101
+	  call	_abort
+LL101:
+
+	__ldwi	19
+	  call	_test9u
+	__cmpwi_ne	0
+	__lbeq	LL102
+	  call	_abort
+LL102:
+
+	__ldwi	20
+	  call	_test9u
+	__cmpwi_ne	0
+	__lbeq	LL103
+	  call	_abort
+LL103:
+
+	__ldwi	29
+	  call	_test9u
+	__cmpwi_ne	0
+	__lbeq	LL104
+	  call	_abort
+LL104:
+
+	__ldwi	30
+	  call	_test9u
+	__cmpwi_ne	1
+	__lbeq	LL105
+	  call	_abort
+LL105:
+
+	__ldwi	0
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL106
+	  call	_abort
+LL106:
+
+	__ldwi	9
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL107
+	  call	_abort
+LL107:
+
+	__ldwi	10
+	  call	_test10
+	__cmpwi_ne	1
+	__lbeq	LL108
+	  call	_abort
+LL108:
+
+	__ldwi	-1
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL109
+	  call	_abort
+LL109:
+
+	__ldwi	-9
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL110
+	  call	_abort
+LL110:
+
+	__ldwi	-10
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL111
+	  call	_abort
+LL111:
+
+	__ldwi	0
+	  call	_test10u
+	__cmpwi_ne	0
+	__lbeq	LL112
+	  call	_abort
+LL112:
+
+	__ldwi	9
+	  call	_test10u
+	__cmpwi_ne	0
+	__lbeq	LL113
+	  call	_abort
+LL113:
+
+	__ldwi	10
+	  call	_test10u
+	__cmpwi_ne	1
+	__lbeq	LL114
+	  call	_abort
+LL114:
+
+	__ldwi	-1
+	  call	_test10u
+	__cmpwi_ne	1
+	__lbeq	LL115
+	  call	_abort
+LL115:
+
+	__ldwi	-9
+	  call	_test10u
+	__cmpwi_ne	1
+	__lbeq	LL116
+	  call	_abort
+LL116:
+
+	__ldwi	-10
+	  call	_test10u
+	__cmpwi_ne	1
+	__lbeq	LL117
+	  call	_abort
+LL117:
+
+	__ldwi	19
+	  call	_test11
+	__cmpwi_ne	0
+	__lbeq	LL118
+	  call	_abort
+LL118:
+
+	__ldwi	20
+	  call	_test11
+	__cmpwi_ne	1
+	__lbeq	LL119
+	  call	_abort
+LL119:
+
+	__ldwi	29
+	  call	_test11
+	__cmpwi_ne	1
+	__lbeq	LL120
+	  call	_abort
+LL120:
+
+	__ldwi	30
+	  call	_test11
+	__cmpwi_ne	1
+	__lbeq	LL121
+	  call	_abort
+LL121:
+
+	__ldwi	19
+	  call	_test11u
+	__cmpwi_ne	0
+	__lbeq	LL122
+	  call	_abort
+LL122:
+
+	__ldwi	20
+	  call	_test11u
+	__cmpwi_ne	1
+	__lbeq	LL123
+	  call	_abort
+LL123:
+
+	__ldwi	29
+	  call	_test11u
+	__cmpwi_ne	1
+	__lbeq	LL124
+	  call	_abort
+LL124:
+
+	__ldwi	30
+	  call	_test11u
+	__cmpwi_ne	1
+	__lbeq	LL125
+	  call	_abort
+LL125:
+
+	__ldwi	0
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL126
+	  call	_abort
+LL126:
+
+	__ldwi	9
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL127
+	  call	_abort
+LL127:
+
+	__ldwi	10
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL128
+	  call	_abort
+LL128:
+
+	__ldwi	-1
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL129
+	  call	_abort
+LL129:
+
+	__ldwi	-9
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL130
+	  call	_abort
+LL130:
+
+	__ldwi	-10
+	  call	_test12
+	__cmpwi_ne	0
+	__lbeq	LL131
+	  call	_abort
+LL131:
+
+	__ldwi	0
+LL23:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:29
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL134:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL135
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL136
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL137
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL138
+	__ldw_s	2
+	__lbra	LL133
+LL138:
+
+LL137:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL139
+LL136:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL139:
+
+	__lbra	LL134
+LL135:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL140
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL141
+	__ldw_s	2
+	__lbra	LL133
+LL141:
+
+LL140:
+
+	__ldwi	0
+LL133:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL143
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL143:
+
+LL142:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL145
+	__ldwi	0
+	__lbra	LL144
+LL145:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL147
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL147:
+
+	__tstw
+	__lbeq	LL146
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL148
+	__ldwi	0
+	__lbra	LL144
+LL148:
+
+LL146:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL149
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL150
+LL149:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL150:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL144:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL151:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL152:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL153:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL154:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
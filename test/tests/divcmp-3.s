@@ -0,0 +1,600 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:48 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test1
+	__pushw
+	__ldb_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__cmpwi_eq	3
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test1u
+	__pushw
+	__ldub_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__cmpwi_eq	3
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2
+	__pushw
+	__ldb_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__cmpwi_ne	3
+LL3:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2u
+	__pushw
+	__ldub_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__cmpwi_ne	3
+LL4:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3
+	__pushw
+	__ldb_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	ltzp
+LL5:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3u
+	__pushw
+	__ldub_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	ltzp
+LL6:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4
+	__pushw
+	__ldb_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	lezp
+LL7:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4u
+	__pushw
+	__ldub_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	lezp
+LL8:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5
+	__pushw
+	__ldb_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	gtzp
+LL9:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5u
+	__pushw
+	__ldub_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	gtzp
+LL10:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6
+	__pushw
+	__ldb_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	gezp
+LL11:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6u
+	__pushw
+	__ldub_s	0
+	__pushw
+	__ldwi	100
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	3
+	  jsr	gezp
+LL12:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-2,__stack
+	__stwi_s	-128,0
+LL14:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	256
+	  jsr	ltzp
+	__lbne	LL16
+	__lbra	LL17
+LL15:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL14
+LL16:
+
+	__ldw_s	0
+	  call	_test1
+	__cmpwi_ne	0
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+	__ldw_s	0
+	  call	_test1u
+	__cmpwi_ne	0
+	__lbeq	LL19
+	  call	_abort
+LL19:
+
+	__ldw_s	0
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL20
+	  call	_abort
+LL20:
+
+	__ldw_s	0
+	  call	_test2u
+	__cmpwi_ne	1
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__ldw_s	0
+	  call	_test3
+	__cmpwi_ne	1
+	__lbeq	LL22
+	  call	_abort
+LL22:
+
+	__ldw_s	0
+	  call	_test3u
+	__cmpwi_ne	1
+	__lbeq	LL23
+	  call	_abort
+LL23:
+
+	__ldw_s	0
+	  call	_test4
+	__cmpwi_ne	1
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldw_s	0
+	  call	_test4u
+	__cmpwi_ne	1
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+	__ldw_s	0
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__ldw_s	0
+	  call	_test5u
+	__cmpwi_ne	0
+	__lbeq	LL27
+	  call	_abort
+LL27:
+
+	__ldw_s	0
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL28
+	  call	_abort
+LL28:
+
+	__ldw_s	0
+	  call	_test6u
+	__cmpwi_ne	0
+	__lbeq	LL29
+	  call	_abort
+LL29:
+
+	__lbra	LL15
+LL17:
+
+	__ldwi	0
+LL13:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:19
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL32:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL33
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL34
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL35
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL36
+	__ldw_s	2
+	__lbra	LL31
+LL36:
+
+LL35:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL37
+LL34:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL37:
+
+	__lbra	LL32
+LL33:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL38
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL39
+	__ldw_s	2
+	__lbra	LL31
+LL39:
+
+LL38:
+
+	__ldwi	0
+LL31:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL41
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL41:
+
+LL40:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL43
+	__ldwi	0
+	__lbra	LL42
+LL43:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL45
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL45:
+
+	__tstw
+	__lbeq	LL44
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL46
+	__ldwi	0
+	__lbra	LL42
+LL46:
+
+LL44:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL47
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL48
+LL47:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL48:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL42:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL49:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL50:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL51:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL52:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
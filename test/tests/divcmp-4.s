@@ -0,0 +1,915 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:48 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _test1
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__cmpwi_eq	2
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test2
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__cmpwi_eq	0
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test3
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__cmpwi_ne	2
+LL3:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test4
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__cmpwi_ne	0
+LL4:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test5
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	ltzp
+LL5:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test6
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	ltzp
+LL6:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test7
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	lezp
+LL7:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test8
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	lezp
+LL8:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test9
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	gtzp
+LL9:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test10
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+LL10:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test11
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	2
+	  jsr	gezp
+LL11:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _test12
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldwi	-10
+	  jsr	sdiv
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gezp
+LL12:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	-30
+	  call	_test1
+	__cmpwi_ne	0
+	__lbeq	LL14
+	  call	_abort
+LL14:
+
+	__ldwi	-29
+	  call	_test1
+	__cmpwi_ne	1
+	__lbeq	LL15
+	  call	_abort
+LL15:
+
+	__ldwi	-20
+	  call	_test1
+	__cmpwi_ne	1
+	__lbeq	LL16
+	  call	_abort
+LL16:
+
+	__ldwi	-19
+	  call	_test1
+	__cmpwi_ne	0
+	__lbeq	LL17
+	  call	_abort
+LL17:
+
+	__ldwi	0
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+	__ldwi	9
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL19
+	  call	_abort
+LL19:
+
+	__ldwi	10
+	  call	_test2
+	__cmpwi_ne	0
+	__lbeq	LL20
+	  call	_abort
+LL20:
+
+	__ldwi	-1
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__ldwi	-9
+	  call	_test2
+	__cmpwi_ne	1
+	__lbeq	LL22
+	  call	_abort
+LL22:
+
+	__ldwi	-10
+	  call	_test2
+	__cmpwi_ne	0
+	__lbeq	LL23
+	  call	_abort
+LL23:
+
+	__ldwi	-30
+	  call	_test3
+	__cmpwi_ne	1
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__ldwi	-29
+	  call	_test3
+	__cmpwi_ne	0
+	__lbeq	LL25
+	  call	_abort
+LL25:
+
+	__ldwi	-20
+	  call	_test3
+	__cmpwi_ne	0
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__ldwi	-19
+	  call	_test3
+	__cmpwi_ne	1
+	__lbeq	LL27
+	  call	_abort
+LL27:
+
+	__ldwi	0
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL28
+	  call	_abort
+LL28:
+
+	__ldwi	9
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL29
+	  call	_abort
+LL29:
+
+	__ldwi	10
+	  call	_test4
+	__cmpwi_ne	1
+	__lbeq	LL30
+	  call	_abort
+LL30:
+
+	__ldwi	-1
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL31
+	  call	_abort
+LL31:
+
+	__ldwi	-9
+	  call	_test4
+	__cmpwi_ne	0
+	__lbeq	LL32
+	  call	_abort
+LL32:
+
+	__ldwi	-10
+	  call	_test4
+	__cmpwi_ne	1
+	__lbeq	LL33
+	  call	_abort
+LL33:
+
+	__ldwi	-30
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL34
+	  call	_abort
+LL34:
+
+	__ldwi	-29
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL35
+	  call	_abort
+LL35:
+
+	__ldwi	-20
+	  call	_test5
+	__cmpwi_ne	0
+	__lbeq	LL36
+	  call	_abort
+LL36:
+
+	__ldwi	-19
+	  call	_test5
+	__cmpwi_ne	1
+	__lbeq	LL37
+	  call	_abort
+LL37:
+
+	__ldwi	0
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL38
+	  call	_abort
+LL38:
+
+	__ldwi	9
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL39
+	  call	_abort
+LL39:
+
+	__ldwi	10
+	  call	_test6
+	__cmpwi_ne	1
+	__lbeq	LL40
+	  call	_abort
+LL40:
+
+	__ldwi	-1
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL41
+	  call	_abort
+LL41:
+
+	__ldwi	-9
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL42
+	  call	_abort
+LL42:
+
+	__ldwi	-10
+	  call	_test6
+	__cmpwi_ne	0
+	__lbeq	LL43
+	  call	_abort
+LL43:
+
+	__ldwi	-30
+	  call	_test7
+	__cmpwi_ne	0
+	__lbeq	LL44
+	  call	_abort
+LL44:
+
+	__ldwi	-29
+	  call	_test7
+	__cmpwi_ne	1
+	__lbeq	LL45
+	  call	_abort
+LL45:
+
+	__ldwi	-20
+	  call	_test7
+	__cmpwi_ne	1
+	__lbeq	LL46
+	  call	_abort
+LL46:
+
+	__ldwi	-19
+	  call	_test7
+	__cmpwi_ne	1
+	__lbeq	LL47
+	  call	_abort
+LL47:
+
+	__ldwi	0
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL48
+	  call	_abort
+LL48:
+
+	__ldwi	9
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL49
+	  call	_abort
+LL49:
+
+	__ldwi	10
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL50
+	  call	_abort
+LL50:
+
+	__ldwi	-1
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL51
+	  call	_abort
+LL51:
+
+	__ldwi	-9
+	  call	_test8
+	__cmpwi_ne	1
+	__lbeq	LL52
+	  call	_abort
+LL52:
+
+	__ldwi	-10
+	  call	_test8
+	__cmpwi_ne	0
+	__lbeq	LL53
+	  call	_abort
+LL53:
+
+	__ldwi	-30
+	  call	_test9
+	__cmpwi_ne	1
+	__lbeq	LL54
+	  call	_abort
+LL54:
+
+	__ldwi	-29
+	  call	_test9
+	__cmpwi_ne	0
+	__lbeq	LL55
+	  call	_abort
+LL55:
+
+	__ldwi	-20
+	  call	_test9
+	__cmpwi_ne	0
+	__lbeq	LL56
+	  call	_abort
+LL56:
+
+	__ldwi	-19
+	  call	_test9
+	__cmpwi_ne	0
+	__lbeq	LL57
+	  call	_abort
+LL57:
+
+	__ldwi	0
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL58
+	  call	_abort
+LL58:
+
+	__ldwi	9
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL59
+	  call	_abort
+LL59:
+
+	__ldwi	10
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL60
+	  call	_abort
+LL60:
+
+	__ldwi	-1
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL61
+	  call	_abort
+LL61:
+
+	__ldwi	-9
+	  call	_test10
+	__cmpwi_ne	0
+	__lbeq	LL62
+	  call	_abort
+LL62:
+
+	__ldwi	-10
+	  call	_test10
+	__cmpwi_ne	1
+	__lbeq	LL63
+	  call	_abort
+LL63:
+
+	__ldwi	-30
+	  call	_test11
+	__cmpwi_ne	1
+	__lbeq	LL64
+	  call	_abort
+LL64:
+
+	__ldwi	-29
+	  call	_test11
+	__cmpwi_ne	1
+	__lbeq	LL65
+	  call	_abort
+LL65:
+
+	__ldwi	-20
+	  call	_test11
+	__cmpwi_ne	1
+	__lbeq	LL66
+	  call	_abort
+LL66:
+
+	__ldwi	-19
+	  call	_test11
+	__cmpwi_ne	0
+	__lbeq	LL67
+	  call	_abort
+LL67:
+
+	__ldwi	0
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL68
+	  call	_abort
+LL68:
+
+	__ldwi	9
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL69
+	  call	_abort
+LL69:
+
+	__ldwi	10
+	  call	_test12
+	__cmpwi_ne	0
+	__lbeq	LL70
+	  call	_abort
+LL70:
+
+	__ldwi	-1
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL71
+	  call	_abort
+LL71:
+
+	__ldwi	-9
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL72
+	  call	_abort
+LL72:
+
+	__ldwi	-10
+	  call	_test12
+	__cmpwi_ne	1
+	__lbeq	LL73
+	  call	_abort
+LL73:
+
+	__ldwi	0
+LL13:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:19
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL76:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL77
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL78
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL79
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL80
+	__ldw_s	2
+	__lbra	LL75
+LL80:
+
+LL79:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL81
+LL78:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL81:
+
+	__lbra	LL76
+LL77:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL82
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL83
+	__ldw_s	2
+	__lbra	LL75
+LL83:
+
+LL82:
+
+	__ldwi	0
+LL75:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL85
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL85:
+
+LL84:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL87
+	__ldwi	0
+	__lbra	LL86
+LL87:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL89
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL89:
+
+	__tstw
+	__lbeq	LL88
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL90
+	__ldwi	0
+	__lbra	LL86
+LL90:
+
+LL88:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL91
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL92
+LL91:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL92:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL86:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL93:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL94:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL95:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL96:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,589 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:48 2026
+;
+
+HUC	= 1
+HAVE_INIT = 1
+                                                             
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__ldw	LL6
+	__cmpwi_ne	4
+	__lbne	LL8
+	__ldwi	LL6
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	5
+LL8:
+
+	__tstw
+	__lbne	LL9
+	__ldwi	LL6
+	__addwi	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	7
+LL9:
+
+	__tstw
+	__lbne	LL10
+	__ldwi	LL6
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	6
+LL10:
+
+	__tstw
+	__lbeq	LL7
+	__ldwi	1
+	  call	_exit
+LL7:
+
+	__ldwi	LL5
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	2
+	__lbne	LL12
+	__ldw	LL5
+	__cmpwi_ne	1
+LL12:
+
+	__tstw
+	__lbeq	LL11
+	__ldwi	2
+	  call	_exit
+LL11:
+
+	__ldwi	LL4
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	3
+	__lbne	LL14
+	__ldwi	LL4
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	2
+LL14:
+
+	__tstw
+	__lbne	LL15
+	__ldw	LL4
+	__cmpwi_ne	1
+LL15:
+
+	__tstw
+	__lbeq	LL13
+	__ldwi	3
+	  call	_exit
+LL13:
+
+	__ldb	LL3
+	__cmpwi_ne	3
+	__lbne	LL17
+	__ldw	LL2
+	__cmpwi_ne	5
+LL17:
+
+	__tstw
+	__lbeq	LL16
+	__ldwi	4
+	  call	_exit
+LL16:
+
+	__ldw	_aaa
+	__tstw
+	__lbne	LL19
+	__ldw	_aaa+2
+LL19:
+
+	__tstw
+	__lbne	LL20
+	__ldw	_aaa+4
+LL20:
+
+	__tstw
+	__lbne	LL21
+	__ldw	_aaa+4+2
+LL21:
+
+	__tstw
+	__lbeq	LL18
+	__ldwi	5
+	  call	_exit
+LL18:
+
+	__ldw	_zzzz+8+2
+	__cmpwi_ne	28
+	__lbne	LL23
+	__ldw	_zzzz+8
+	__cmpwi_ne	27
+LL23:
+
+	__tstw
+	__lbne	LL24
+	__ldw	_zzzz+4+2
+	__cmpwi_ne	26
+LL24:
+
+	__tstw
+	__lbne	LL25
+	__ldw	_zzzz+4
+	__cmpwi_ne	25
+LL25:
+
+	__tstw
+	__lbne	LL26
+	__ldw	_zzzz+2
+	__cmpwi_ne	24
+LL26:
+
+	__tstw
+	__lbne	LL27
+	__ldw	_zzzz
+	__cmpwi_ne	23
+LL27:
+
+	__tstw
+	__lbeq	LL22
+	__ldwi	6
+	  call	_exit
+LL22:
+
+	__ldw	_zzz+4+2
+	__cmpwi_ne	4
+	__lbne	LL29
+	__ldw	_zzz+4
+	__cmpwi_ne	5
+LL29:
+
+	__tstw
+	__lbne	LL30
+	__ldw	_zzz+2
+	__cmpwi_ne	6
+LL30:
+
+	__tstw
+	__lbne	LL31
+	__ldw	_zzz
+	__cmpwi_ne	7
+LL31:
+
+	__tstw
+	__lbeq	LL28
+	__ldwi	7
+	  call	_exit
+LL28:
+
+	__ldw	_zz+2
+	__cmpwi_ne	1
+	__lbne	LL33
+	__ldw	_zz
+	__cmpwi_ne	2
+LL33:
+
+	__tstw
+	__lbeq	LL32
+	__ldwi	8
+	  call	_exit
+LL32:
+
+	__ldw	_z+4
+	__cmpwi_ne	1
+	__lbne	LL35
+	__ldw	_z+2
+	__cmpwi_ne	2
+LL35:
+
+	__tstw
+	__lbne	LL36
+	__ldw	_z
+	__cmpwi_ne	3
+LL36:
+
+	__tstw
+	__lbeq	LL34
+	__ldwi	9
+	  call	_exit
+LL34:
+
+	__ldb	_y
+	__cmpwi_ne	11
+	__lbne	LL38
+	__ldw	_x
+	__cmpwi_ne	10
+LL38:
+
+	__tstw
+	__lbeq	LL37
+	__ldwi	10
+	  call	_exit
+LL37:
+
+	__ldwi	0
+LL1:
+
+	  rts
+	.endp
+
+
+	.bss
+_aaa:		.ds	8
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:19
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL41:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL42
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL43
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL44
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL45
+	__ldw_s	2
+	__lbra	LL40
+LL45:
+
+LL44:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL46
+LL43:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL46:
+
+	__lbra	LL41
+LL42:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL47
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL48
+	__ldw_s	2
+	__lbra	LL40
+LL48:
+
+LL47:
+
+	__ldwi	0
+LL40:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL50
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL50:
+
+LL49:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL52
+	__ldwi	0
+	__lbra	LL51
+LL52:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL54
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL54:
+
+	__tstw
+	__lbeq	LL53
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL55
+	__ldwi	0
+	__lbra	LL51
+LL55:
+
+LL53:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL56
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL57
+LL56:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL57:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL51:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL58:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL59:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL60:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL61:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+_x:		.ds	2
+_y:		.ds	1
+_z:		.ds	6
+_zz:		.ds	4
+_zzz:		.ds	8
+_zzzz:		.ds	12
+LL2:		.ds	2
+LL3:		.ds	1
+LL4:		.ds	6
+LL5:		.ds	4
+LL6:		.ds	8
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+
+	.dw	10
+
+	.db	11
+
+	.dw	3,2,1
+	.dw	2
+	.dw	1
+
+	.dw	7
+	.dw	6
+	.dw	5
+	.dw	4
+
+	.dw	23
+	.dw	24
+	.dw	25
+	.dw	26
+	.dw	27
+	.dw	28
+
+
+	.dw	5
+
+	.db	3
+
+	.dw	1,2,3
+	.dw	1
+	.dw	2
+
+	.dw	4
+	.dw	5
+	.dw	6
+	.dw	7
+
+huc_rodata_end:
+___huc_rodata_end:
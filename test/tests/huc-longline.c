@@ -0,0 +1,18 @@
+/* Source lines longer than the old 383-character input buffer. */
+const int tab[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100 };
+
+#define SUM(a, b, c, d, e, f, g, h) ((a) + (b) + (c) + (d) + (e) + (f) + (g) + (h))
+
+int main()
+{
+  int i, sum;
+  sum = 0;
+  for (i = 0; i < 100; i++)
+    sum += tab[i];
+  if (sum != 5050)
+    abort();
+  sum = SUM(tab[10], tab[11], tab[12], tab[13], tab[14], tab[15], tab[16], tab[17]) + SUM(tab[20], tab[21], tab[22], tab[23], tab[24], tab[25], tab[26], tab[27]);                                                                                                                                                                                                                                                                     /* a long line */
+  if (sum != 312)
+    abort();
+  return 0;
+}
@@ -0,0 +1,487 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-4,__stack
+	__stwi_s	0,0
+	__stwi_s	0,2
+LL2:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	100
+	  jsr	ltzp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL2
+LL4:
+
+	__ldw_s	0
+	__pushw
+	__ldw_s	4
+	__aslw
+	__addwi_sym	_tab
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addws
+	__stw_s	0
+	__lbra	LL3
+LL5:
+
+	__ldw_s	0
+	__cmpwi_ne	5050
+	__lbeq	LL6
+	  call	_abort
+LL6:
+
+	__ldw	_tab+20
+	__addw	_tab+22
+	__addw	_tab+24
+	__addw	_tab+26
+	__addw	_tab+28
+	__addw	_tab+30
+	__addw	_tab+32
+	__addw	_tab+34
+	__pushw
+	__ldw	_tab+40
+	__addw	_tab+42
+	__addw	_tab+44
+	__addw	_tab+46
+	__addw	_tab+48
+	__addw	_tab+50
+	__addw	_tab+52
+	__addw	_tab+54
+	__addws
+	__stw_s	0
+	__cmpwi_ne	312
+	__lbeq	LL7
+	  call	_abort
+LL7:
+
+	__ldwi	0
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+_tab:
+	.dw	1
+	.dw	2
+	.dw	3
+	.dw	4
+	.dw	5
+	.dw	6
+	.dw	7
+	.dw	8
+	.dw	9
+	.dw	10
+	.dw	11
+	.dw	12
+	.dw	13
+	.dw	14
+	.dw	15
+	.dw	16
+	.dw	17
+	.dw	18
+	.dw	19
+	.dw	20
+	.dw	21
+	.dw	22
+	.dw	23
+	.dw	24
+	.dw	25
+	.dw	26
+	.dw	27
+	.dw	28
+	.dw	29
+	.dw	30
+	.dw	31
+	.dw	32
+	.dw	33
+	.dw	34
+	.dw	35
+	.dw	36
+	.dw	37
+	.dw	38
+	.dw	39
+	.dw	40
+	.dw	41
+	.dw	42
+	.dw	43
+	.dw	44
+	.dw	45
+	.dw	46
+	.dw	47
+	.dw	48
+	.dw	49
+	.dw	50
+	.dw	51
+	.dw	52
+	.dw	53
+	.dw	54
+	.dw	55
+	.dw	56
+	.dw	57
+	.dw	58
+	.dw	59
+	.dw	60
+	.dw	61
+	.dw	62
+	.dw	63
+	.dw	64
+	.dw	65
+	.dw	66
+	.dw	67
+	.dw	68
+	.dw	69
+	.dw	70
+	.dw	71
+	.dw	72
+	.dw	73
+	.dw	74
+	.dw	75
+	.dw	76
+	.dw	77
+	.dw	78
+	.dw	79
+	.dw	80
+	.dw	81
+	.dw	82
+	.dw	83
+	.dw	84
+	.dw	85
+	.dw	86
+	.dw	87
+	.dw	88
+	.dw	89
+	.dw	90
+	.dw	91
+	.dw	92
+	.dw	93
+	.dw	94
+	.dw	95
+	.dw	96
+	.dw	97
+	.dw	98
+	.dw	99
+	.dw	100
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:200
+;	global pool:8
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL10:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL11
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL12
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL13
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL14
+	__ldw_s	2
+	__lbra	LL9
+LL14:
+
+LL13:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL15
+LL12:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL15:
+
+	__lbra	LL10
+LL11:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL16
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL17
+	__ldw_s	2
+	__lbra	LL9
+LL17:
+
+LL16:
+
+	__ldwi	0
+LL9:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL19
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL19:
+
+LL18:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL21
+	__ldwi	0
+	__lbra	LL20
+LL21:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL23
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL23:
+
+	__tstw
+	__lbeq	LL22
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL24
+	__ldwi	0
+	__lbra	LL20
+LL24:
+
+LL22:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL25
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL26
+LL25:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL26:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL20:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL27:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL28:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL29:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL30:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:200
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,221 @@
+/* More globals than the old fixed-size symbol table could hold. */
+char g0000, g0001, g0002, g0003, g0004, g0005, g0006, g0007, g0008, g0009;
+char g0010, g0011, g0012, g0013, g0014, g0015, g0016, g0017, g0018, g0019;
+char g0020, g0021, g0022, g0023, g0024, g0025, g0026, g0027, g0028, g0029;
+char g0030, g0031, g0032, g0033, g0034, g0035, g0036, g0037, g0038, g0039;
+char g0040, g0041, g0042, g0043, g0044, g0045, g0046, g0047, g0048, g0049;
+char g0050, g0051, g0052, g0053, g0054, g0055, g0056, g0057, g0058, g0059;
+char g0060, g0061, g0062, g0063, g0064, g0065, g0066, g0067, g0068, g0069;
+char g0070, g0071, g0072, g0073, g0074, g0075, g0076, g0077, g0078, g0079;
+char g0080, g0081, g0082, g0083, g0084, g0085, g0086, g0087, g0088, g0089;
+char g0090, g0091, g0092, g0093, g0094, g0095, g0096, g0097, g0098, g0099;
+char g0100, g0101, g0102, g0103, g0104, g0105, g0106, g0107, g0108, g0109;
+char g0110, g0111, g0112, g0113, g0114, g0115, g0116, g0117, g0118, g0119;
+char g0120, g0121, g0122, g0123, g0124, g0125, g0126, g0127, g0128, g0129;
+char g0130, g0131, g0132, g0133, g0134, g0135, g0136, g0137, g0138, g0139;
+char g0140, g0141, g0142, g0143, g0144, g0145, g0146, g0147, g0148, g0149;
+char g0150, g0151, g0152, g0153, g0154, g0155, g0156, g0157, g0158, g0159;
+char g0160, g0161, g0162, g0163, g0164, g0165, g0166, g0167, g0168, g0169;
+char g0170, g0171, g0172, g0173, g0174, g0175, g0176, g0177, g0178, g0179;
+char g0180, g0181, g0182, g0183, g0184, g0185, g0186, g0187, g0188, g0189;
+char g0190, g0191, g0192, g0193, g0194, g0195, g0196, g0197, g0198, g0199;
+char g0200, g0201, g0202, g0203, g0204, g0205, g0206, g0207, g0208, g0209;
+char g0210, g0211, g0212, g0213, g0214, g0215, g0216, g0217, g0218, g0219;
+char g0220, g0221, g0222, g0223, g0224, g0225, g0226, g0227, g0228, g0229;
+char g0230, g0231, g0232, g0233, g0234, g0235, g0236, g0237, g0238, g0239;
+char g0240, g0241, g0242, g0243, g0244, g0245, g0246, g0247, g0248, g0249;
+char g0250, g0251, g0252, g0253, g0254, g0255, g0256, g0257, g0258, g0259;
+char g0260, g0261, g0262, g0263, g0264, g0265, g0266, g0267, g0268, g0269;
+char g0270, g0271, g0272, g0273, g0274, g0275, g0276, g0277, g0278, g0279;
+char g0280, g0281, g0282, g0283, g0284, g0285, g0286, g0287, g0288, g0289;
+char g0290, g0291, g0292, g0293, g0294, g0295, g0296, g0297, g0298, g0299;
+char g0300, g0301, g0302, g0303, g0304, g0305, g0306, g0307, g0308, g0309;
+char g0310, g0311, g0312, g0313, g0314, g0315, g0316, g0317, g0318, g0319;
+char g0320, g0321, g0322, g0323, g0324, g0325, g0326, g0327, g0328, g0329;
+char g0330, g0331, g0332, g0333, g0334, g0335, g0336, g0337, g0338, g0339;
+char g0340, g0341, g0342, g0343, g0344, g0345, g0346, g0347, g0348, g0349;
+char g0350, g0351, g0352, g0353, g0354, g0355, g0356, g0357, g0358, g0359;
+char g0360, g0361, g0362, g0363, g0364, g0365, g0366, g0367, g0368, g0369;
+char g0370, g0371, g0372, g0373, g0374, g0375, g0376, g0377, g0378, g0379;
+char g0380, g0381, g0382, g0383, g0384, g0385, g0386, g0387, g0388, g0389;
+char g0390, g0391, g0392, g0393, g0394, g0395, g0396, g0397, g0398, g0399;
+char g0400, g0401, g0402, g0403, g0404, g0405, g0406, g0407, g0408, g0409;
+char g0410, g0411, g0412, g0413, g0414, g0415, g0416, g0417, g0418, g0419;
+char g0420, g0421, g0422, g0423, g0424, g0425, g0426, g0427, g0428, g0429;
+char g0430, g0431, g0432, g0433, g0434, g0435, g0436, g0437, g0438, g0439;
+char g0440, g0441, g0442, g0443, g0444, g0445, g0446, g0447, g0448, g0449;
+char g0450, g0451, g0452, g0453, g0454, g0455, g0456, g0457, g0458, g0459;
+char g0460, g0461, g0462, g0463, g0464, g0465, g0466, g0467, g0468, g0469;
+char g0470, g0471, g0472, g0473, g0474, g0475, g0476, g0477, g0478, g0479;
+char g0480, g0481, g0482, g0483, g0484, g0485, g0486, g0487, g0488, g0489;
+char g0490, g0491, g0492, g0493, g0494, g0495, g0496, g0497, g0498, g0499;
+char g0500, g0501, g0502, g0503, g0504, g0505, g0506, g0507, g0508, g0509;
+char g0510, g0511, g0512, g0513, g0514, g0515, g0516, g0517, g0518, g0519;
+char g0520, g0521, g0522, g0523, g0524, g0525, g0526, g0527, g0528, g0529;
+char g0530, g0531, g0532, g0533, g0534, g0535, g0536, g0537, g0538, g0539;
+char g0540, g0541, g0542, g0543, g0544, g0545, g0546, g0547, g0548, g0549;
+char g0550, g0551, g0552, g0553, g0554, g0555, g0556, g0557, g0558, g0559;
+char g0560, g0561, g0562, g0563, g0564, g0565, g0566, g0567, g0568, g0569;
+char g0570, g0571, g0572, g0573, g0574, g0575, g0576, g0577, g0578, g0579;
+char g0580, g0581, g0582, g0583, g0584, g0585, g0586, g0587, g0588, g0589;
+char g0590, g0591, g0592, g0593, g0594, g0595, g0596, g0597, g0598, g0599;
+char g0600, g0601, g0602, g0603, g0604, g0605, g0606, g0607, g0608, g0609;
+char g0610, g0611, g0612, g0613, g0614, g0615, g0616, g0617, g0618, g0619;
+char g0620, g0621, g0622, g0623, g0624, g0625, g0626, g0627, g0628, g0629;
+char g0630, g0631, g0632, g0633, g0634, g0635, g0636, g0637, g0638, g0639;
+char g0640, g0641, g0642, g0643, g0644, g0645, g0646, g0647, g0648, g0649;
+char g0650, g0651, g0652, g0653, g0654, g0655, g0656, g0657, g0658, g0659;
+char g0660, g0661, g0662, g0663, g0664, g0665, g0666, g0667, g0668, g0669;
+char g0670, g0671, g0672, g0673, g0674, g0675, g0676, g0677, g0678, g0679;
+char g0680, g0681, g0682, g0683, g0684, g0685, g0686, g0687, g0688, g0689;
+char g0690, g0691, g0692, g0693, g0694, g0695, g0696, g0697, g0698, g0699;
+char g0700, g0701, g0702, g0703, g0704, g0705, g0706, g0707, g0708, g0709;
+char g0710, g0711, g0712, g0713, g0714, g0715, g0716, g0717, g0718, g0719;
+char g0720, g0721, g0722, g0723, g0724, g0725, g0726, g0727, g0728, g0729;
+char g0730, g0731, g0732, g0733, g0734, g0735, g0736, g0737, g0738, g0739;
+char g0740, g0741, g0742, g0743, g0744, g0745, g0746, g0747, g0748, g0749;
+char g0750, g0751, g0752, g0753, g0754, g0755, g0756, g0757, g0758, g0759;
+char g0760, g0761, g0762, g0763, g0764, g0765, g0766, g0767, g0768, g0769;
+char g0770, g0771, g0772, g0773, g0774, g0775, g0776, g0777, g0778, g0779;
+char g0780, g0781, g0782, g0783, g0784, g0785, g0786, g0787, g0788, g0789;
+char g0790, g0791, g0792, g0793, g0794, g0795, g0796, g0797, g0798, g0799;
+char g0800, g0801, g0802, g0803, g0804, g0805, g0806, g0807, g0808, g0809;
+char g0810, g0811, g0812, g0813, g0814, g0815, g0816, g0817, g0818, g0819;
+char g0820, g0821, g0822, g0823, g0824, g0825, g0826, g0827, g0828, g0829;
+char g0830, g0831, g0832, g0833, g0834, g0835, g0836, g0837, g0838, g0839;
+char g0840, g0841, g0842, g0843, g0844, g0845, g0846, g0847, g0848, g0849;
+char g0850, g0851, g0852, g0853, g0854, g0855, g0856, g0857, g0858, g0859;
+char g0860, g0861, g0862, g0863, g0864, g0865, g0866, g0867, g0868, g0869;
+char g0870, g0871, g0872, g0873, g0874, g0875, g0876, g0877, g0878, g0879;
+char g0880, g0881, g0882, g0883, g0884, g0885, g0886, g0887, g0888, g0889;
+char g0890, g0891, g0892, g0893, g0894, g0895, g0896, g0897, g0898, g0899;
+char g0900, g0901, g0902, g0903, g0904, g0905, g0906, g0907, g0908, g0909;
+char g0910, g0911, g0912, g0913, g0914, g0915, g0916, g0917, g0918, g0919;
+char g0920, g0921, g0922, g0923, g0924, g0925, g0926, g0927, g0928, g0929;
+char g0930, g0931, g0932, g0933, g0934, g0935, g0936, g0937, g0938, g0939;
+char g0940, g0941, g0942, g0943, g0944, g0945, g0946, g0947, g0948, g0949;
+char g0950, g0951, g0952, g0953, g0954, g0955, g0956, g0957, g0958, g0959;
+char g0960, g0961, g0962, g0963, g0964, g0965, g0966, g0967, g0968, g0969;
+char g0970, g0971, g0972, g0973, g0974, g0975, g0976, g0977, g0978, g0979;
+char g0980, g0981, g0982, g0983, g0984, g0985, g0986, g0987, g0988, g0989;
+char g0990, g0991, g0992, g0993, g0994, g0995, g0996, g0997, g0998, g0999;
+char g1000, g1001, g1002, g1003, g1004, g1005, g1006, g1007, g1008, g1009;
+char g1010, g1011, g1012, g1013, g1014, g1015, g1016, g1017, g1018, g1019;
+char g1020, g1021, g1022, g1023, g1024, g1025, g1026, g1027, g1028, g1029;
+char g1030, g1031, g1032, g1033, g1034, g1035, g1036, g1037, g1038, g1039;
+char g1040, g1041, g1042, g1043, g1044, g1045, g1046, g1047, g1048, g1049;
+char g1050, g1051, g1052, g1053, g1054, g1055, g1056, g1057, g1058, g1059;
+char g1060, g1061, g1062, g1063, g1064, g1065, g1066, g1067, g1068, g1069;
+char g1070, g1071, g1072, g1073, g1074, g1075, g1076, g1077, g1078, g1079;
+char g1080, g1081, g1082, g1083, g1084, g1085, g1086, g1087, g1088, g1089;
+char g1090, g1091, g1092, g1093, g1094, g1095, g1096, g1097, g1098, g1099;
+char g1100, g1101, g1102, g1103, g1104, g1105, g1106, g1107, g1108, g1109;
+char g1110, g1111, g1112, g1113, g1114, g1115, g1116, g1117, g1118, g1119;
+char g1120, g1121, g1122, g1123, g1124, g1125, g1126, g1127, g1128, g1129;
+char g1130, g1131, g1132, g1133, g1134, g1135, g1136, g1137, g1138, g1139;
+char g1140, g1141, g1142, g1143, g1144, g1145, g1146, g1147, g1148, g1149;
+char g1150, g1151, g1152, g1153, g1154, g1155, g1156, g1157, g1158, g1159;
+char g1160, g1161, g1162, g1163, g1164, g1165, g1166, g1167, g1168, g1169;
+char g1170, g1171, g1172, g1173, g1174, g1175, g1176, g1177, g1178, g1179;
+char g1180, g1181, g1182, g1183, g1184, g1185, g1186, g1187, g1188, g1189;
+char g1190, g1191, g1192, g1193, g1194, g1195, g1196, g1197, g1198, g1199;
+char g1200, g1201, g1202, g1203, g1204, g1205, g1206, g1207, g1208, g1209;
+char g1210, g1211, g1212, g1213, g1214, g1215, g1216, g1217, g1218, g1219;
+char g1220, g1221, g1222, g1223, g1224, g1225, g1226, g1227, g1228, g1229;
+char g1230, g1231, g1232, g1233, g1234, g1235, g1236, g1237, g1238, g1239;
+char g1240, g1241, g1242, g1243, g1244, g1245, g1246, g1247, g1248, g1249;
+char g1250, g1251, g1252, g1253, g1254, g1255, g1256, g1257, g1258, g1259;
+char g1260, g1261, g1262, g1263, g1264, g1265, g1266, g1267, g1268, g1269;
+char g1270, g1271, g1272, g1273, g1274, g1275, g1276, g1277, g1278, g1279;
+char g1280, g1281, g1282, g1283, g1284, g1285, g1286, g1287, g1288, g1289;
+char g1290, g1291, g1292, g1293, g1294, g1295, g1296, g1297, g1298, g1299;
+char g1300, g1301, g1302, g1303, g1304, g1305, g1306, g1307, g1308, g1309;
+char g1310, g1311, g1312, g1313, g1314, g1315, g1316, g1317, g1318, g1319;
+char g1320, g1321, g1322, g1323, g1324, g1325, g1326, g1327, g1328, g1329;
+char g1330, g1331, g1332, g1333, g1334, g1335, g1336, g1337, g1338, g1339;
+char g1340, g1341, g1342, g1343, g1344, g1345, g1346, g1347, g1348, g1349;
+char g1350, g1351, g1352, g1353, g1354, g1355, g1356, g1357, g1358, g1359;
+char g1360, g1361, g1362, g1363, g1364, g1365, g1366, g1367, g1368, g1369;
+char g1370, g1371, g1372, g1373, g1374, g1375, g1376, g1377, g1378, g1379;
+char g1380, g1381, g1382, g1383, g1384, g1385, g1386, g1387, g1388, g1389;
+char g1390, g1391, g1392, g1393, g1394, g1395, g1396, g1397, g1398, g1399;
+char g1400, g1401, g1402, g1403, g1404, g1405, g1406, g1407, g1408, g1409;
+char g1410, g1411, g1412, g1413, g1414, g1415, g1416, g1417, g1418, g1419;
+char g1420, g1421, g1422, g1423, g1424, g1425, g1426, g1427, g1428, g1429;
+char g1430, g1431, g1432, g1433, g1434, g1435, g1436, g1437, g1438, g1439;
+char g1440, g1441, g1442, g1443, g1444, g1445, g1446, g1447, g1448, g1449;
+char g1450, g1451, g1452, g1453, g1454, g1455, g1456, g1457, g1458, g1459;
+char g1460, g1461, g1462, g1463, g1464, g1465, g1466, g1467, g1468, g1469;
+char g1470, g1471, g1472, g1473, g1474, g1475, g1476, g1477, g1478, g1479;
+char g1480, g1481, g1482, g1483, g1484, g1485, g1486, g1487, g1488, g1489;
+char g1490, g1491, g1492, g1493, g1494, g1495, g1496, g1497, g1498, g1499;
+char g1500, g1501, g1502, g1503, g1504, g1505, g1506, g1507, g1508, g1509;
+char g1510, g1511, g1512, g1513, g1514, g1515, g1516, g1517, g1518, g1519;
+char g1520, g1521, g1522, g1523, g1524, g1525, g1526, g1527, g1528, g1529;
+char g1530, g1531, g1532, g1533, g1534, g1535, g1536, g1537, g1538, g1539;
+char g1540, g1541, g1542, g1543, g1544, g1545, g1546, g1547, g1548, g1549;
+char g1550, g1551, g1552, g1553, g1554, g1555, g1556, g1557, g1558, g1559;
+char g1560, g1561, g1562, g1563, g1564, g1565, g1566, g1567, g1568, g1569;
+char g1570, g1571, g1572, g1573, g1574, g1575, g1576, g1577, g1578, g1579;
+char g1580, g1581, g1582, g1583, g1584, g1585, g1586, g1587, g1588, g1589;
+char g1590, g1591, g1592, g1593, g1594, g1595, g1596, g1597, g1598, g1599;
+char g1600, g1601, g1602, g1603, g1604, g1605, g1606, g1607, g1608, g1609;
+char g1610, g1611, g1612, g1613, g1614, g1615, g1616, g1617, g1618, g1619;
+char g1620, g1621, g1622, g1623, g1624, g1625, g1626, g1627, g1628, g1629;
+char g1630, g1631, g1632, g1633, g1634, g1635, g1636, g1637, g1638, g1639;
+char g1640, g1641, g1642, g1643, g1644, g1645, g1646, g1647, g1648, g1649;
+char g1650, g1651, g1652, g1653, g1654, g1655, g1656, g1657, g1658, g1659;
+char g1660, g1661, g1662, g1663, g1664, g1665, g1666, g1667, g1668, g1669;
+char g1670, g1671, g1672, g1673, g1674, g1675, g1676, g1677, g1678, g1679;
+char g1680, g1681, g1682, g1683, g1684, g1685, g1686, g1687, g1688, g1689;
+char g1690, g1691, g1692, g1693, g1694, g1695, g1696, g1697, g1698, g1699;
+char g1700, g1701, g1702, g1703, g1704, g1705, g1706, g1707, g1708, g1709;
+char g1710, g1711, g1712, g1713, g1714, g1715, g1716, g1717, g1718, g1719;
+char g1720, g1721, g1722, g1723, g1724, g1725, g1726, g1727, g1728, g1729;
+char g1730, g1731, g1732, g1733, g1734, g1735, g1736, g1737, g1738, g1739;
+char g1740, g1741, g1742, g1743, g1744, g1745, g1746, g1747, g1748, g1749;
+char g1750, g1751, g1752, g1753, g1754, g1755, g1756, g1757, g1758, g1759;
+char g1760, g1761, g1762, g1763, g1764, g1765, g1766, g1767, g1768, g1769;
+char g1770, g1771, g1772, g1773, g1774, g1775, g1776, g1777, g1778, g1779;
+char g1780, g1781, g1782, g1783, g1784, g1785, g1786, g1787, g1788, g1789;
+char g1790, g1791, g1792, g1793, g1794, g1795, g1796, g1797, g1798, g1799;
+char g1800, g1801, g1802, g1803, g1804, g1805, g1806, g1807, g1808, g1809;
+char g1810, g1811, g1812, g1813, g1814, g1815, g1816, g1817, g1818, g1819;
+char g1820, g1821, g1822, g1823, g1824, g1825, g1826, g1827, g1828, g1829;
+char g1830, g1831, g1832, g1833, g1834, g1835, g1836, g1837, g1838, g1839;
+char g1840, g1841, g1842, g1843, g1844, g1845, g1846, g1847, g1848, g1849;
+char g1850, g1851, g1852, g1853, g1854, g1855, g1856, g1857, g1858, g1859;
+char g1860, g1861, g1862, g1863, g1864, g1865, g1866, g1867, g1868, g1869;
+char g1870, g1871, g1872, g1873, g1874, g1875, g1876, g1877, g1878, g1879;
+char g1880, g1881, g1882, g1883, g1884, g1885, g1886, g1887, g1888, g1889;
+char g1890, g1891, g1892, g1893, g1894, g1895, g1896, g1897, g1898, g1899;
+char g1900, g1901, g1902, g1903, g1904, g1905, g1906, g1907, g1908, g1909;
+char g1910, g1911, g1912, g1913, g1914, g1915, g1916, g1917, g1918, g1919;
+char g1920, g1921, g1922, g1923, g1924, g1925, g1926, g1927, g1928, g1929;
+char g1930, g1931, g1932, g1933, g1934, g1935, g1936, g1937, g1938, g1939;
+char g1940, g1941, g1942, g1943, g1944, g1945, g1946, g1947, g1948, g1949;
+char g1950, g1951, g1952, g1953, g1954, g1955, g1956, g1957, g1958, g1959;
+char g1960, g1961, g1962, g1963, g1964, g1965, g1966, g1967, g1968, g1969;
+char g1970, g1971, g1972, g1973, g1974, g1975, g1976, g1977, g1978, g1979;
+char g1980, g1981, g1982, g1983, g1984, g1985, g1986, g1987, g1988, g1989;
+char g1990, g1991, g1992, g1993, g1994, g1995, g1996, g1997, g1998, g1999;
+char g2000, g2001, g2002, g2003, g2004, g2005, g2006, g2007, g2008, g2009;
+char g2010, g2011, g2012, g2013, g2014, g2015, g2016, g2017, g2018, g2019;
+char g2020, g2021, g2022, g2023, g2024, g2025, g2026, g2027, g2028, g2029;
+char g2030, g2031, g2032, g2033, g2034, g2035, g2036, g2037, g2038, g2039;
+char g2040, g2041, g2042, g2043, g2044, g2045, g2046, g2047, g2048, g2049;
+char g2050, g2051, g2052, g2053, g2054, g2055, g2056, g2057, g2058, g2059;
+char g2060, g2061, g2062, g2063, g2064, g2065, g2066, g2067, g2068, g2069;
+char g2070, g2071, g2072, g2073, g2074, g2075, g2076, g2077, g2078, g2079;
+char g2080, g2081, g2082, g2083, g2084, g2085, g2086, g2087, g2088, g2089;
+char g2090, g2091, g2092, g2093, g2094, g2095, g2096, g2097, g2098, g2099;
+
+int main()
+{
+  g0000 = 1;
+  g1024 = 2;
+  g2099 = 3;
+  if (g0000 != 1 || g1024 != 2 || g2099 != 3)
+    abort();
+  return 0;
+}
@@ -0,0 +1,2448 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__ldwi	1
+	  stx	_g0000
+	__ldwi	2
+	  stx	_g1024
+	__ldwi	3
+	  stx	_g2099
+	__ldb	_g0000
+	__cmpwi_ne	1
+	__lbne	LL3
+	__ldb	_g1024
+	__cmpwi_ne	2
+LL3:
+
+	__tstw
+	__lbne	LL4
+	__ldb	_g2099
+	__cmpwi_ne	3
+LL4:
+
+	__tstw
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+	__ldwi	0
+LL1:
+
+	  rts
+	.endp
+
+
+	.bss
+_g0000:		.ds	1
+_g0001:		.ds	1
+_g0002:		.ds	1
+_g0003:		.ds	1
+_g0004:		.ds	1
+_g0005:		.ds	1
+_g0006:		.ds	1
+_g0007:		.ds	1
+_g0008:		.ds	1
+_g0009:		.ds	1
+_g0010:		.ds	1
+_g0011:		.ds	1
+_g0012:		.ds	1
+_g0013:		.ds	1
+_g0014:		.ds	1
+_g0015:		.ds	1
+_g0016:		.ds	1
+_g0017:		.ds	1
+_g0018:		.ds	1
+_g0019:		.ds	1
+_g0020:		.ds	1
+_g0021:		.ds	1
+_g0022:		.ds	1
+_g0023:		.ds	1
+_g0024:		.ds	1
+_g0025:		.ds	1
+_g0026:		.ds	1
+_g0027:		.ds	1
+_g0028:		.ds	1
+_g0029:		.ds	1
+_g0030:		.ds	1
+_g0031:		.ds	1
+_g0032:		.ds	1
+_g0033:		.ds	1
+_g0034:		.ds	1
+_g0035:		.ds	1
+_g0036:		.ds	1
+_g0037:		.ds	1
+_g0038:		.ds	1
+_g0039:		.ds	1
+_g0040:		.ds	1
+_g0041:		.ds	1
+_g0042:		.ds	1
+_g0043:		.ds	1
+_g0044:		.ds	1
+_g0045:		.ds	1
+_g0046:		.ds	1
+_g0047:		.ds	1
+_g0048:		.ds	1
+_g0049:		.ds	1
+_g0050:		.ds	1
+_g0051:		.ds	1
+_g0052:		.ds	1
+_g0053:		.ds	1
+_g0054:		.ds	1
+_g0055:		.ds	1
+_g0056:		.ds	1
+_g0057:		.ds	1
+_g0058:		.ds	1
+_g0059:		.ds	1
+_g0060:		.ds	1
+_g0061:		.ds	1
+_g0062:		.ds	1
+_g0063:		.ds	1
+_g0064:		.ds	1
+_g0065:		.ds	1
+_g0066:		.ds	1
+_g0067:		.ds	1
+_g0068:		.ds	1
+_g0069:		.ds	1
+_g0070:		.ds	1
+_g0071:		.ds	1
+_g0072:		.ds	1
+_g0073:		.ds	1
+_g0074:		.ds	1
+_g0075:		.ds	1
+_g0076:		.ds	1
+_g0077:		.ds	1
+_g0078:		.ds	1
+_g0079:		.ds	1
+_g0080:		.ds	1
+_g0081:		.ds	1
+_g0082:		.ds	1
+_g0083:		.ds	1
+_g0084:		.ds	1
+_g0085:		.ds	1
+_g0086:		.ds	1
+_g0087:		.ds	1
+_g0088:		.ds	1
+_g0089:		.ds	1
+_g0090:		.ds	1
+_g0091:		.ds	1
+_g0092:		.ds	1
+_g0093:		.ds	1
+_g0094:		.ds	1
+_g0095:		.ds	1
+_g0096:		.ds	1
+_g0097:		.ds	1
+_g0098:		.ds	1
+_g0099:		.ds	1
+_g0100:		.ds	1
+_g0101:		.ds	1
+_g0102:		.ds	1
+_g0103:		.ds	1
+_g0104:		.ds	1
+_g0105:		.ds	1
+_g0106:		.ds	1
+_g0107:		.ds	1
+_g0108:		.ds	1
+_g0109:		.ds	1
+_g0110:		.ds	1
+_g0111:		.ds	1
+_g0112:		.ds	1
+_g0113:		.ds	1
+_g0114:		.ds	1
+_g0115:		.ds	1
+_g0116:		.ds	1
+_g0117:		.ds	1
+_g0118:		.ds	1
+_g0119:		.ds	1
+_g0120:		.ds	1
+_g0121:		.ds	1
+_g0122:		.ds	1
+_g0123:		.ds	1
+_g0124:		.ds	1
+_g0125:		.ds	1
+_g0126:		.ds	1
+_g0127:		.ds	1
+_g0128:		.ds	1
+_g0129:		.ds	1
+_g0130:		.ds	1
+_g0131:		.ds	1
+_g0132:		.ds	1
+_g0133:		.ds	1
+_g0134:		.ds	1
+_g0135:		.ds	1
+_g0136:		.ds	1
+_g0137:		.ds	1
+_g0138:		.ds	1
+_g0139:		.ds	1
+_g0140:		.ds	1
+_g0141:		.ds	1
+_g0142:		.ds	1
+_g0143:		.ds	1
+_g0144:		.ds	1
+_g0145:		.ds	1
+_g0146:		.ds	1
+_g0147:		.ds	1
+_g0148:		.ds	1
+_g0149:		.ds	1
+_g0150:		.ds	1
+_g0151:		.ds	1
+_g0152:		.ds	1
+_g0153:		.ds	1
+_g0154:		.ds	1
+_g0155:		.ds	1
+_g0156:		.ds	1
+_g0157:		.ds	1
+_g0158:		.ds	1
+_g0159:		.ds	1
+_g0160:		.ds	1
+_g0161:		.ds	1
+_g0162:		.ds	1
+_g0163:		.ds	1
+_g0164:		.ds	1
+_g0165:		.ds	1
+_g0166:		.ds	1
+_g0167:		.ds	1
+_g0168:		.ds	1
+_g0169:		.ds	1
+_g0170:		.ds	1
+_g0171:		.ds	1
+_g0172:		.ds	1
+_g0173:		.ds	1
+_g0174:		.ds	1
+_g0175:		.ds	1
+_g0176:		.ds	1
+_g0177:		.ds	1
+_g0178:		.ds	1
+_g0179:		.ds	1
+_g0180:		.ds	1
+_g0181:		.ds	1
+_g0182:		.ds	1
+_g0183:		.ds	1
+_g0184:		.ds	1
+_g0185:		.ds	1
+_g0186:		.ds	1
+_g0187:		.ds	1
+_g0188:		.ds	1
+_g0189:		.ds	1
+_g0190:		.ds	1
+_g0191:		.ds	1
+_g0192:		.ds	1
+_g0193:		.ds	1
+_g0194:		.ds	1
+_g0195:		.ds	1
+_g0196:		.ds	1
+_g0197:		.ds	1
+_g0198:		.ds	1
+_g0199:		.ds	1
+_g0200:		.ds	1
+_g0201:		.ds	1
+_g0202:		.ds	1
+_g0203:		.ds	1
+_g0204:		.ds	1
+_g0205:		.ds	1
+_g0206:		.ds	1
+_g0207:		.ds	1
+_g0208:		.ds	1
+_g0209:		.ds	1
+_g0210:		.ds	1
+_g0211:		.ds	1
+_g0212:		.ds	1
+_g0213:		.ds	1
+_g0214:		.ds	1
+_g0215:		.ds	1
+_g0216:		.ds	1
+_g0217:		.ds	1
+_g0218:		.ds	1
+_g0219:		.ds	1
+_g0220:		.ds	1
+_g0221:		.ds	1
+_g0222:		.ds	1
+_g0223:		.ds	1
+_g0224:		.ds	1
+_g0225:		.ds	1
+_g0226:		.ds	1
+_g0227:		.ds	1
+_g0228:		.ds	1
+_g0229:		.ds	1
+_g0230:		.ds	1
+_g0231:		.ds	1
+_g0232:		.ds	1
+_g0233:		.ds	1
+_g0234:		.ds	1
+_g0235:		.ds	1
+_g0236:		.ds	1
+_g0237:		.ds	1
+_g0238:		.ds	1
+_g0239:		.ds	1
+_g0240:		.ds	1
+_g0241:		.ds	1
+_g0242:		.ds	1
+_g0243:		.ds	1
+_g0244:		.ds	1
+_g0245:		.ds	1
+_g0246:		.ds	1
+_g0247:		.ds	1
+_g0248:		.ds	1
+_g0249:		.ds	1
+_g0250:		.ds	1
+_g0251:		.ds	1
+_g0252:		.ds	1
+_g0253:		.ds	1
+_g0254:		.ds	1
+_g0255:		.ds	1
+_g0256:		.ds	1
+_g0257:		.ds	1
+_g0258:		.ds	1
+_g0259:		.ds	1
+_g0260:		.ds	1
+_g0261:		.ds	1
+_g0262:		.ds	1
+_g0263:		.ds	1
+_g0264:		.ds	1
+_g0265:		.ds	1
+_g0266:		.ds	1
+_g0267:		.ds	1
+_g0268:		.ds	1
+_g0269:		.ds	1
+_g0270:		.ds	1
+_g0271:		.ds	1
+_g0272:		.ds	1
+_g0273:		.ds	1
+_g0274:		.ds	1
+_g0275:		.ds	1
+_g0276:		.ds	1
+_g0277:		.ds	1
+_g0278:		.ds	1
+_g0279:		.ds	1
+_g0280:		.ds	1
+_g0281:		.ds	1
+_g0282:		.ds	1
+_g0283:		.ds	1
+_g0284:		.ds	1
+_g0285:		.ds	1
+_g0286:		.ds	1
+_g0287:		.ds	1
+_g0288:		.ds	1
+_g0289:		.ds	1
+_g0290:		.ds	1
+_g0291:		.ds	1
+_g0292:		.ds	1
+_g0293:		.ds	1
+_g0294:		.ds	1
+_g0295:		.ds	1
+_g0296:		.ds	1
+_g0297:		.ds	1
+_g0298:		.ds	1
+_g0299:		.ds	1
+_g0300:		.ds	1
+_g0301:		.ds	1
+_g0302:		.ds	1
+_g0303:		.ds	1
+_g0304:		.ds	1
+_g0305:		.ds	1
+_g0306:		.ds	1
+_g0307:		.ds	1
+_g0308:		.ds	1
+_g0309:		.ds	1
+_g0310:		.ds	1
+_g0311:		.ds	1
+_g0312:		.ds	1
+_g0313:		.ds	1
+_g0314:		.ds	1
+_g0315:		.ds	1
+_g0316:		.ds	1
+_g0317:		.ds	1
+_g0318:		.ds	1
+_g0319:		.ds	1
+_g0320:		.ds	1
+_g0321:		.ds	1
+_g0322:		.ds	1
+_g0323:		.ds	1
+_g0324:		.ds	1
+_g0325:		.ds	1
+_g0326:		.ds	1
+_g0327:		.ds	1
+_g0328:		.ds	1
+_g0329:		.ds	1
+_g0330:		.ds	1
+_g0331:		.ds	1
+_g0332:		.ds	1
+_g0333:		.ds	1
+_g0334:		.ds	1
+_g0335:		.ds	1
+_g0336:		.ds	1
+_g0337:		.ds	1
+_g0338:		.ds	1
+_g0339:		.ds	1
+_g0340:		.ds	1
+_g0341:		.ds	1
+_g0342:		.ds	1
+_g0343:		.ds	1
+_g0344:		.ds	1
+_g0345:		.ds	1
+_g0346:		.ds	1
+_g0347:		.ds	1
+_g0348:		.ds	1
+_g0349:		.ds	1
+_g0350:		.ds	1
+_g0351:		.ds	1
+_g0352:		.ds	1
+_g0353:		.ds	1
+_g0354:		.ds	1
+_g0355:		.ds	1
+_g0356:		.ds	1
+_g0357:		.ds	1
+_g0358:		.ds	1
+_g0359:		.ds	1
+_g0360:		.ds	1
+_g0361:		.ds	1
+_g0362:		.ds	1
+_g0363:		.ds	1
+_g0364:		.ds	1
+_g0365:		.ds	1
+_g0366:		.ds	1
+_g0367:		.ds	1
+_g0368:		.ds	1
+_g0369:		.ds	1
+_g0370:		.ds	1
+_g0371:		.ds	1
+_g0372:		.ds	1
+_g0373:		.ds	1
+_g0374:		.ds	1
+_g0375:		.ds	1
+_g0376:		.ds	1
+_g0377:		.ds	1
+_g0378:		.ds	1
+_g0379:		.ds	1
+_g0380:		.ds	1
+_g0381:		.ds	1
+_g0382:		.ds	1
+_g0383:		.ds	1
+_g0384:		.ds	1
+_g0385:		.ds	1
+_g0386:		.ds	1
+_g0387:		.ds	1
+_g0388:		.ds	1
+_g0389:		.ds	1
+_g0390:		.ds	1
+_g0391:		.ds	1
+_g0392:		.ds	1
+_g0393:		.ds	1
+_g0394:		.ds	1
+_g0395:		.ds	1
+_g0396:		.ds	1
+_g0397:		.ds	1
+_g0398:		.ds	1
+_g0399:		.ds	1
+_g0400:		.ds	1
+_g0401:		.ds	1
+_g0402:		.ds	1
+_g0403:		.ds	1
+_g0404:		.ds	1
+_g0405:		.ds	1
+_g0406:		.ds	1
+_g0407:		.ds	1
+_g0408:		.ds	1
+_g0409:		.ds	1
+_g0410:		.ds	1
+_g0411:		.ds	1
+_g0412:		.ds	1
+_g0413:		.ds	1
+_g0414:		.ds	1
+_g0415:		.ds	1
+_g0416:		.ds	1
+_g0417:		.ds	1
+_g0418:		.ds	1
+_g0419:		.ds	1
+_g0420:		.ds	1
+_g0421:		.ds	1
+_g0422:		.ds	1
+_g0423:		.ds	1
+_g0424:		.ds	1
+_g0425:		.ds	1
+_g0426:		.ds	1
+_g0427:		.ds	1
+_g0428:		.ds	1
+_g0429:		.ds	1
+_g0430:		.ds	1
+_g0431:		.ds	1
+_g0432:		.ds	1
+_g0433:		.ds	1
+_g0434:		.ds	1
+_g0435:		.ds	1
+_g0436:		.ds	1
+_g0437:		.ds	1
+_g0438:		.ds	1
+_g0439:		.ds	1
+_g0440:		.ds	1
+_g0441:		.ds	1
+_g0442:		.ds	1
+_g0443:		.ds	1
+_g0444:		.ds	1
+_g0445:		.ds	1
+_g0446:		.ds	1
+_g0447:		.ds	1
+_g0448:		.ds	1
+_g0449:		.ds	1
+_g0450:		.ds	1
+_g0451:		.ds	1
+_g0452:		.ds	1
+_g0453:		.ds	1
+_g0454:		.ds	1
+_g0455:		.ds	1
+_g0456:		.ds	1
+_g0457:		.ds	1
+_g0458:		.ds	1
+_g0459:		.ds	1
+_g0460:		.ds	1
+_g0461:		.ds	1
+_g0462:		.ds	1
+_g0463:		.ds	1
+_g0464:		.ds	1
+_g0465:		.ds	1
+_g0466:		.ds	1
+_g0467:		.ds	1
+_g0468:		.ds	1
+_g0469:		.ds	1
+_g0470:		.ds	1
+_g0471:		.ds	1
+_g0472:		.ds	1
+_g0473:		.ds	1
+_g0474:		.ds	1
+_g0475:		.ds	1
+_g0476:		.ds	1
+_g0477:		.ds	1
+_g0478:		.ds	1
+_g0479:		.ds	1
+_g0480:		.ds	1
+_g0481:		.ds	1
+_g0482:		.ds	1
+_g0483:		.ds	1
+_g0484:		.ds	1
+_g0485:		.ds	1
+_g0486:		.ds	1
+_g0487:		.ds	1
+_g0488:		.ds	1
+_g0489:		.ds	1
+_g0490:		.ds	1
+_g0491:		.ds	1
+_g0492:		.ds	1
+_g0493:		.ds	1
+_g0494:		.ds	1
+_g0495:		.ds	1
+_g0496:		.ds	1
+_g0497:		.ds	1
+_g0498:		.ds	1
+_g0499:		.ds	1
+_g0500:		.ds	1
+_g0501:		.ds	1
+_g0502:		.ds	1
+_g0503:		.ds	1
+_g0504:		.ds	1
+_g0505:		.ds	1
+_g0506:		.ds	1
+_g0507:		.ds	1
+_g0508:		.ds	1
+_g0509:		.ds	1
+_g0510:		.ds	1
+_g0511:		.ds	1
+_g0512:		.ds	1
+_g0513:		.ds	1
+_g0514:		.ds	1
+_g0515:		.ds	1
+_g0516:		.ds	1
+_g0517:		.ds	1
+_g0518:		.ds	1
+_g0519:		.ds	1
+_g0520:		.ds	1
+_g0521:		.ds	1
+_g0522:		.ds	1
+_g0523:		.ds	1
+_g0524:		.ds	1
+_g0525:		.ds	1
+_g0526:		.ds	1
+_g0527:		.ds	1
+_g0528:		.ds	1
+_g0529:		.ds	1
+_g0530:		.ds	1
+_g0531:		.ds	1
+_g0532:		.ds	1
+_g0533:		.ds	1
+_g0534:		.ds	1
+_g0535:		.ds	1
+_g0536:		.ds	1
+_g0537:		.ds	1
+_g0538:		.ds	1
+_g0539:		.ds	1
+_g0540:		.ds	1
+_g0541:		.ds	1
+_g0542:		.ds	1
+_g0543:		.ds	1
+_g0544:		.ds	1
+_g0545:		.ds	1
+_g0546:		.ds	1
+_g0547:		.ds	1
+_g0548:		.ds	1
+_g0549:		.ds	1
+_g0550:		.ds	1
+_g0551:		.ds	1
+_g0552:		.ds	1
+_g0553:		.ds	1
+_g0554:		.ds	1
+_g0555:		.ds	1
+_g0556:		.ds	1
+_g0557:		.ds	1
+_g0558:		.ds	1
+_g0559:		.ds	1
+_g0560:		.ds	1
+_g0561:		.ds	1
+_g0562:		.ds	1
+_g0563:		.ds	1
+_g0564:		.ds	1
+_g0565:		.ds	1
+_g0566:		.ds	1
+_g0567:		.ds	1
+_g0568:		.ds	1
+_g0569:		.ds	1
+_g0570:		.ds	1
+_g0571:		.ds	1
+_g0572:		.ds	1
+_g0573:		.ds	1
+_g0574:		.ds	1
+_g0575:		.ds	1
+_g0576:		.ds	1
+_g0577:		.ds	1
+_g0578:		.ds	1
+_g0579:		.ds	1
+_g0580:		.ds	1
+_g0581:		.ds	1
+_g0582:		.ds	1
+_g0583:		.ds	1
+_g0584:		.ds	1
+_g0585:		.ds	1
+_g0586:		.ds	1
+_g0587:		.ds	1
+_g0588:		.ds	1
+_g0589:		.ds	1
+_g0590:		.ds	1
+_g0591:		.ds	1
+_g0592:		.ds	1
+_g0593:		.ds	1
+_g0594:		.ds	1
+_g0595:		.ds	1
+_g0596:		.ds	1
+_g0597:		.ds	1
+_g0598:		.ds	1
+_g0599:		.ds	1
+_g0600:		.ds	1
+_g0601:		.ds	1
+_g0602:		.ds	1
+_g0603:		.ds	1
+_g0604:		.ds	1
+_g0605:		.ds	1
+_g0606:		.ds	1
+_g0607:		.ds	1
+_g0608:		.ds	1
+_g0609:		.ds	1
+_g0610:		.ds	1
+_g0611:		.ds	1
+_g0612:		.ds	1
+_g0613:		.ds	1
+_g0614:		.ds	1
+_g0615:		.ds	1
+_g0616:		.ds	1
+_g0617:		.ds	1
+_g0618:		.ds	1
+_g0619:		.ds	1
+_g0620:		.ds	1
+_g0621:		.ds	1
+_g0622:		.ds	1
+_g0623:		.ds	1
+_g0624:		.ds	1
+_g0625:		.ds	1
+_g0626:		.ds	1
+_g0627:		.ds	1
+_g0628:		.ds	1
+_g0629:		.ds	1
+_g0630:		.ds	1
+_g0631:		.ds	1
+_g0632:		.ds	1
+_g0633:		.ds	1
+_g0634:		.ds	1
+_g0635:		.ds	1
+_g0636:		.ds	1
+_g0637:		.ds	1
+_g0638:		.ds	1
+_g0639:		.ds	1
+_g0640:		.ds	1
+_g0641:		.ds	1
+_g0642:		.ds	1
+_g0643:		.ds	1
+_g0644:		.ds	1
+_g0645:		.ds	1
+_g0646:		.ds	1
+_g0647:		.ds	1
+_g0648:		.ds	1
+_g0649:		.ds	1
+_g0650:		.ds	1
+_g0651:		.ds	1
+_g0652:		.ds	1
+_g0653:		.ds	1
+_g0654:		.ds	1
+_g0655:		.ds	1
+_g0656:		.ds	1
+_g0657:		.ds	1
+_g0658:		.ds	1
+_g0659:		.ds	1
+_g0660:		.ds	1
+_g0661:		.ds	1
+_g0662:		.ds	1
+_g0663:		.ds	1
+_g0664:		.ds	1
+_g0665:		.ds	1
+_g0666:		.ds	1
+_g0667:		.ds	1
+_g0668:		.ds	1
+_g0669:		.ds	1
+_g0670:		.ds	1
+_g0671:		.ds	1
+_g0672:		.ds	1
+_g0673:		.ds	1
+_g0674:		.ds	1
+_g0675:		.ds	1
+_g0676:		.ds	1
+_g0677:		.ds	1
+_g0678:		.ds	1
+_g0679:		.ds	1
+_g0680:		.ds	1
+_g0681:		.ds	1
+_g0682:		.ds	1
+_g0683:		.ds	1
+_g0684:		.ds	1
+_g0685:		.ds	1
+_g0686:		.ds	1
+_g0687:		.ds	1
+_g0688:		.ds	1
+_g0689:		.ds	1
+_g0690:		.ds	1
+_g0691:		.ds	1
+_g0692:		.ds	1
+_g0693:		.ds	1
+_g0694:		.ds	1
+_g0695:		.ds	1
+_g0696:		.ds	1
+_g0697:		.ds	1
+_g0698:		.ds	1
+_g0699:		.ds	1
+_g0700:		.ds	1
+_g0701:		.ds	1
+_g0702:		.ds	1
+_g0703:		.ds	1
+_g0704:		.ds	1
+_g0705:		.ds	1
+_g0706:		.ds	1
+_g0707:		.ds	1
+_g0708:		.ds	1
+_g0709:		.ds	1
+_g0710:		.ds	1
+_g0711:		.ds	1
+_g0712:		.ds	1
+_g0713:		.ds	1
+_g0714:		.ds	1
+_g0715:		.ds	1
+_g0716:		.ds	1
+_g0717:		.ds	1
+_g0718:		.ds	1
+_g0719:		.ds	1
+_g0720:		.ds	1
+_g0721:		.ds	1
+_g0722:		.ds	1
+_g0723:		.ds	1
+_g0724:		.ds	1
+_g0725:		.ds	1
+_g0726:		.ds	1
+_g0727:		.ds	1
+_g0728:		.ds	1
+_g0729:		.ds	1
+_g0730:		.ds	1
+_g0731:		.ds	1
+_g0732:		.ds	1
+_g0733:		.ds	1
+_g0734:		.ds	1
+_g0735:		.ds	1
+_g0736:		.ds	1
+_g0737:		.ds	1
+_g0738:		.ds	1
+_g0739:		.ds	1
+_g0740:		.ds	1
+_g0741:		.ds	1
+_g0742:		.ds	1
+_g0743:		.ds	1
+_g0744:		.ds	1
+_g0745:		.ds	1
+_g0746:		.ds	1
+_g0747:		.ds	1
+_g0748:		.ds	1
+_g0749:		.ds	1
+_g0750:		.ds	1
+_g0751:		.ds	1
+_g0752:		.ds	1
+_g0753:		.ds	1
+_g0754:		.ds	1
+_g0755:		.ds	1
+_g0756:		.ds	1
+_g0757:		.ds	1
+_g0758:		.ds	1
+_g0759:		.ds	1
+_g0760:		.ds	1
+_g0761:		.ds	1
+_g0762:		.ds	1
+_g0763:		.ds	1
+_g0764:		.ds	1
+_g0765:		.ds	1
+_g0766:		.ds	1
+_g0767:		.ds	1
+_g0768:		.ds	1
+_g0769:		.ds	1
+_g0770:		.ds	1
+_g0771:		.ds	1
+_g0772:		.ds	1
+_g0773:		.ds	1
+_g0774:		.ds	1
+_g0775:		.ds	1
+_g0776:		.ds	1
+_g0777:		.ds	1
+_g0778:		.ds	1
+_g0779:		.ds	1
+_g0780:		.ds	1
+_g0781:		.ds	1
+_g0782:		.ds	1
+_g0783:		.ds	1
+_g0784:		.ds	1
+_g0785:		.ds	1
+_g0786:		.ds	1
+_g0787:		.ds	1
+_g0788:		.ds	1
+_g0789:		.ds	1
+_g0790:		.ds	1
+_g0791:		.ds	1
+_g0792:		.ds	1
+_g0793:		.ds	1
+_g0794:		.ds	1
+_g0795:		.ds	1
+_g0796:		.ds	1
+_g0797:		.ds	1
+_g0798:		.ds	1
+_g0799:		.ds	1
+_g0800:		.ds	1
+_g0801:		.ds	1
+_g0802:		.ds	1
+_g0803:		.ds	1
+_g0804:		.ds	1
+_g0805:		.ds	1
+_g0806:		.ds	1
+_g0807:		.ds	1
+_g0808:		.ds	1
+_g0809:		.ds	1
+_g0810:		.ds	1
+_g0811:		.ds	1
+_g0812:		.ds	1
+_g0813:		.ds	1
+_g0814:		.ds	1
+_g0815:		.ds	1
+_g0816:		.ds	1
+_g0817:		.ds	1
+_g0818:		.ds	1
+_g0819:		.ds	1
+_g0820:		.ds	1
+_g0821:		.ds	1
+_g0822:		.ds	1
+_g0823:		.ds	1
+_g0824:		.ds	1
+_g0825:		.ds	1
+_g0826:		.ds	1
+_g0827:		.ds	1
+_g0828:		.ds	1
+_g0829:		.ds	1
+_g0830:		.ds	1
+_g0831:		.ds	1
+_g0832:		.ds	1
+_g0833:		.ds	1
+_g0834:		.ds	1
+_g0835:		.ds	1
+_g0836:		.ds	1
+_g0837:		.ds	1
+_g0838:		.ds	1
+_g0839:		.ds	1
+_g0840:		.ds	1
+_g0841:		.ds	1
+_g0842:		.ds	1
+_g0843:		.ds	1
+_g0844:		.ds	1
+_g0845:		.ds	1
+_g0846:		.ds	1
+_g0847:		.ds	1
+_g0848:		.ds	1
+_g0849:		.ds	1
+_g0850:		.ds	1
+_g0851:		.ds	1
+_g0852:		.ds	1
+_g0853:		.ds	1
+_g0854:		.ds	1
+_g0855:		.ds	1
+_g0856:		.ds	1
+_g0857:		.ds	1
+_g0858:		.ds	1
+_g0859:		.ds	1
+_g0860:		.ds	1
+_g0861:		.ds	1
+_g0862:		.ds	1
+_g0863:		.ds	1
+_g0864:		.ds	1
+_g0865:		.ds	1
+_g0866:		.ds	1
+_g0867:		.ds	1
+_g0868:		.ds	1
+_g0869:		.ds	1
+_g0870:		.ds	1
+_g0871:		.ds	1
+_g0872:		.ds	1
+_g0873:		.ds	1
+_g0874:		.ds	1
+_g0875:		.ds	1
+_g0876:		.ds	1
+_g0877:		.ds	1
+_g0878:		.ds	1
+_g0879:		.ds	1
+_g0880:		.ds	1
+_g0881:		.ds	1
+_g0882:		.ds	1
+_g0883:		.ds	1
+_g0884:		.ds	1
+_g0885:		.ds	1
+_g0886:		.ds	1
+_g0887:		.ds	1
+_g0888:		.ds	1
+_g0889:		.ds	1
+_g0890:		.ds	1
+_g0891:		.ds	1
+_g0892:		.ds	1
+_g0893:		.ds	1
+_g0894:		.ds	1
+_g0895:		.ds	1
+_g0896:		.ds	1
+_g0897:		.ds	1
+_g0898:		.ds	1
+_g0899:		.ds	1
+_g0900:		.ds	1
+_g0901:		.ds	1
+_g0902:		.ds	1
+_g0903:		.ds	1
+_g0904:		.ds	1
+_g0905:		.ds	1
+_g0906:		.ds	1
+_g0907:		.ds	1
+_g0908:		.ds	1
+_g0909:		.ds	1
+_g0910:		.ds	1
+_g0911:		.ds	1
+_g0912:		.ds	1
+_g0913:		.ds	1
+_g0914:		.ds	1
+_g0915:		.ds	1
+_g0916:		.ds	1
+_g0917:		.ds	1
+_g0918:		.ds	1
+_g0919:		.ds	1
+_g0920:		.ds	1
+_g0921:		.ds	1
+_g0922:		.ds	1
+_g0923:		.ds	1
+_g0924:		.ds	1
+_g0925:		.ds	1
+_g0926:		.ds	1
+_g0927:		.ds	1
+_g0928:		.ds	1
+_g0929:		.ds	1
+_g0930:		.ds	1
+_g0931:		.ds	1
+_g0932:		.ds	1
+_g0933:		.ds	1
+_g0934:		.ds	1
+_g0935:		.ds	1
+_g0936:		.ds	1
+_g0937:		.ds	1
+_g0938:		.ds	1
+_g0939:		.ds	1
+_g0940:		.ds	1
+_g0941:		.ds	1
+_g0942:		.ds	1
+_g0943:		.ds	1
+_g0944:		.ds	1
+_g0945:		.ds	1
+_g0946:		.ds	1
+_g0947:		.ds	1
+_g0948:		.ds	1
+_g0949:		.ds	1
+_g0950:		.ds	1
+_g0951:		.ds	1
+_g0952:		.ds	1
+_g0953:		.ds	1
+_g0954:		.ds	1
+_g0955:		.ds	1
+_g0956:		.ds	1
+_g0957:		.ds	1
+_g0958:		.ds	1
+_g0959:		.ds	1
+_g0960:		.ds	1
+_g0961:		.ds	1
+_g0962:		.ds	1
+_g0963:		.ds	1
+_g0964:		.ds	1
+_g0965:		.ds	1
+_g0966:		.ds	1
+_g0967:		.ds	1
+_g0968:		.ds	1
+_g0969:		.ds	1
+_g0970:		.ds	1
+_g0971:		.ds	1
+_g0972:		.ds	1
+_g0973:		.ds	1
+_g0974:		.ds	1
+_g0975:		.ds	1
+_g0976:		.ds	1
+_g0977:		.ds	1
+_g0978:		.ds	1
+_g0979:		.ds	1
+_g0980:		.ds	1
+_g0981:		.ds	1
+_g0982:		.ds	1
+_g0983:		.ds	1
+_g0984:		.ds	1
+_g0985:		.ds	1
+_g0986:		.ds	1
+_g0987:		.ds	1
+_g0988:		.ds	1
+_g0989:		.ds	1
+_g0990:		.ds	1
+_g0991:		.ds	1
+_g0992:		.ds	1
+_g0993:		.ds	1
+_g0994:		.ds	1
+_g0995:		.ds	1
+_g0996:		.ds	1
+_g0997:		.ds	1
+_g0998:		.ds	1
+_g0999:		.ds	1
+_g1000:		.ds	1
+_g1001:		.ds	1
+_g1002:		.ds	1
+_g1003:		.ds	1
+_g1004:		.ds	1
+_g1005:		.ds	1
+_g1006:		.ds	1
+_g1007:		.ds	1
+_g1008:		.ds	1
+_g1009:		.ds	1
+_g1010:		.ds	1
+_g1011:		.ds	1
+_g1012:		.ds	1
+_g1013:		.ds	1
+_g1014:		.ds	1
+_g1015:		.ds	1
+_g1016:		.ds	1
+_g1017:		.ds	1
+_g1018:		.ds	1
+_g1019:		.ds	1
+_g1020:		.ds	1
+_g1021:		.ds	1
+_g1022:		.ds	1
+_g1023:		.ds	1
+_g1024:		.ds	1
+_g1025:		.ds	1
+_g1026:		.ds	1
+_g1027:		.ds	1
+_g1028:		.ds	1
+_g1029:		.ds	1
+_g1030:		.ds	1
+_g1031:		.ds	1
+_g1032:		.ds	1
+_g1033:		.ds	1
+_g1034:		.ds	1
+_g1035:		.ds	1
+_g1036:		.ds	1
+_g1037:		.ds	1
+_g1038:		.ds	1
+_g1039:		.ds	1
+_g1040:		.ds	1
+_g1041:		.ds	1
+_g1042:		.ds	1
+_g1043:		.ds	1
+_g1044:		.ds	1
+_g1045:		.ds	1
+_g1046:		.ds	1
+_g1047:		.ds	1
+_g1048:		.ds	1
+_g1049:		.ds	1
+_g1050:		.ds	1
+_g1051:		.ds	1
+_g1052:		.ds	1
+_g1053:		.ds	1
+_g1054:		.ds	1
+_g1055:		.ds	1
+_g1056:		.ds	1
+_g1057:		.ds	1
+_g1058:		.ds	1
+_g1059:		.ds	1
+_g1060:		.ds	1
+_g1061:		.ds	1
+_g1062:		.ds	1
+_g1063:		.ds	1
+_g1064:		.ds	1
+_g1065:		.ds	1
+_g1066:		.ds	1
+_g1067:		.ds	1
+_g1068:		.ds	1
+_g1069:		.ds	1
+_g1070:		.ds	1
+_g1071:		.ds	1
+_g1072:		.ds	1
+_g1073:		.ds	1
+_g1074:		.ds	1
+_g1075:		.ds	1
+_g1076:		.ds	1
+_g1077:		.ds	1
+_g1078:		.ds	1
+_g1079:		.ds	1
+_g1080:		.ds	1
+_g1081:		.ds	1
+_g1082:		.ds	1
+_g1083:		.ds	1
+_g1084:		.ds	1
+_g1085:		.ds	1
+_g1086:		.ds	1
+_g1087:		.ds	1
+_g1088:		.ds	1
+_g1089:		.ds	1
+_g1090:		.ds	1
+_g1091:		.ds	1
+_g1092:		.ds	1
+_g1093:		.ds	1
+_g1094:		.ds	1
+_g1095:		.ds	1
+_g1096:		.ds	1
+_g1097:		.ds	1
+_g1098:		.ds	1
+_g1099:		.ds	1
+_g1100:		.ds	1
+_g1101:		.ds	1
+_g1102:		.ds	1
+_g1103:		.ds	1
+_g1104:		.ds	1
+_g1105:		.ds	1
+_g1106:		.ds	1
+_g1107:		.ds	1
+_g1108:		.ds	1
+_g1109:		.ds	1
+_g1110:		.ds	1
+_g1111:		.ds	1
+_g1112:		.ds	1
+_g1113:		.ds	1
+_g1114:		.ds	1
+_g1115:		.ds	1
+_g1116:		.ds	1
+_g1117:		.ds	1
+_g1118:		.ds	1
+_g1119:		.ds	1
+_g1120:		.ds	1
+_g1121:		.ds	1
+_g1122:		.ds	1
+_g1123:		.ds	1
+_g1124:		.ds	1
+_g1125:		.ds	1
+_g1126:		.ds	1
+_g1127:		.ds	1
+_g1128:		.ds	1
+_g1129:		.ds	1
+_g1130:		.ds	1
+_g1131:		.ds	1
+_g1132:		.ds	1
+_g1133:		.ds	1
+_g1134:		.ds	1
+_g1135:		.ds	1
+_g1136:		.ds	1
+_g1137:		.ds	1
+_g1138:		.ds	1
+_g1139:		.ds	1
+_g1140:		.ds	1
+_g1141:		.ds	1
+_g1142:		.ds	1
+_g1143:		.ds	1
+_g1144:		.ds	1
+_g1145:		.ds	1
+_g1146:		.ds	1
+_g1147:		.ds	1
+_g1148:		.ds	1
+_g1149:		.ds	1
+_g1150:		.ds	1
+_g1151:		.ds	1
+_g1152:		.ds	1
+_g1153:		.ds	1
+_g1154:		.ds	1
+_g1155:		.ds	1
+_g1156:		.ds	1
+_g1157:		.ds	1
+_g1158:		.ds	1
+_g1159:		.ds	1
+_g1160:		.ds	1
+_g1161:		.ds	1
+_g1162:		.ds	1
+_g1163:		.ds	1
+_g1164:		.ds	1
+_g1165:		.ds	1
+_g1166:		.ds	1
+_g1167:		.ds	1
+_g1168:		.ds	1
+_g1169:		.ds	1
+_g1170:		.ds	1
+_g1171:		.ds	1
+_g1172:		.ds	1
+_g1173:		.ds	1
+_g1174:		.ds	1
+_g1175:		.ds	1
+_g1176:		.ds	1
+_g1177:		.ds	1
+_g1178:		.ds	1
+_g1179:		.ds	1
+_g1180:		.ds	1
+_g1181:		.ds	1
+_g1182:		.ds	1
+_g1183:		.ds	1
+_g1184:		.ds	1
+_g1185:		.ds	1
+_g1186:		.ds	1
+_g1187:		.ds	1
+_g1188:		.ds	1
+_g1189:		.ds	1
+_g1190:		.ds	1
+_g1191:		.ds	1
+_g1192:		.ds	1
+_g1193:		.ds	1
+_g1194:		.ds	1
+_g1195:		.ds	1
+_g1196:		.ds	1
+_g1197:		.ds	1
+_g1198:		.ds	1
+_g1199:		.ds	1
+_g1200:		.ds	1
+_g1201:		.ds	1
+_g1202:		.ds	1
+_g1203:		.ds	1
+_g1204:		.ds	1
+_g1205:		.ds	1
+_g1206:		.ds	1
+_g1207:		.ds	1
+_g1208:		.ds	1
+_g1209:		.ds	1
+_g1210:		.ds	1
+_g1211:		.ds	1
+_g1212:		.ds	1
+_g1213:		.ds	1
+_g1214:		.ds	1
+_g1215:		.ds	1
+_g1216:		.ds	1
+_g1217:		.ds	1
+_g1218:		.ds	1
+_g1219:		.ds	1
+_g1220:		.ds	1
+_g1221:		.ds	1
+_g1222:		.ds	1
+_g1223:		.ds	1
+_g1224:		.ds	1
+_g1225:		.ds	1
+_g1226:		.ds	1
+_g1227:		.ds	1
+_g1228:		.ds	1
+_g1229:		.ds	1
+_g1230:		.ds	1
+_g1231:		.ds	1
+_g1232:		.ds	1
+_g1233:		.ds	1
+_g1234:		.ds	1
+_g1235:		.ds	1
+_g1236:		.ds	1
+_g1237:		.ds	1
+_g1238:		.ds	1
+_g1239:		.ds	1
+_g1240:		.ds	1
+_g1241:		.ds	1
+_g1242:		.ds	1
+_g1243:		.ds	1
+_g1244:		.ds	1
+_g1245:		.ds	1
+_g1246:		.ds	1
+_g1247:		.ds	1
+_g1248:		.ds	1
+_g1249:		.ds	1
+_g1250:		.ds	1
+_g1251:		.ds	1
+_g1252:		.ds	1
+_g1253:		.ds	1
+_g1254:		.ds	1
+_g1255:		.ds	1
+_g1256:		.ds	1
+_g1257:		.ds	1
+_g1258:		.ds	1
+_g1259:		.ds	1
+_g1260:		.ds	1
+_g1261:		.ds	1
+_g1262:		.ds	1
+_g1263:		.ds	1
+_g1264:		.ds	1
+_g1265:		.ds	1
+_g1266:		.ds	1
+_g1267:		.ds	1
+_g1268:		.ds	1
+_g1269:		.ds	1
+_g1270:		.ds	1
+_g1271:		.ds	1
+_g1272:		.ds	1
+_g1273:		.ds	1
+_g1274:		.ds	1
+_g1275:		.ds	1
+_g1276:		.ds	1
+_g1277:		.ds	1
+_g1278:		.ds	1
+_g1279:		.ds	1
+_g1280:		.ds	1
+_g1281:		.ds	1
+_g1282:		.ds	1
+_g1283:		.ds	1
+_g1284:		.ds	1
+_g1285:		.ds	1
+_g1286:		.ds	1
+_g1287:		.ds	1
+_g1288:		.ds	1
+_g1289:		.ds	1
+_g1290:		.ds	1
+_g1291:		.ds	1
+_g1292:		.ds	1
+_g1293:		.ds	1
+_g1294:		.ds	1
+_g1295:		.ds	1
+_g1296:		.ds	1
+_g1297:		.ds	1
+_g1298:		.ds	1
+_g1299:		.ds	1
+_g1300:		.ds	1
+_g1301:		.ds	1
+_g1302:		.ds	1
+_g1303:		.ds	1
+_g1304:		.ds	1
+_g1305:		.ds	1
+_g1306:		.ds	1
+_g1307:		.ds	1
+_g1308:		.ds	1
+_g1309:		.ds	1
+_g1310:		.ds	1
+_g1311:		.ds	1
+_g1312:		.ds	1
+_g1313:		.ds	1
+_g1314:		.ds	1
+_g1315:		.ds	1
+_g1316:		.ds	1
+_g1317:		.ds	1
+_g1318:		.ds	1
+_g1319:		.ds	1
+_g1320:		.ds	1
+_g1321:		.ds	1
+_g1322:		.ds	1
+_g1323:		.ds	1
+_g1324:		.ds	1
+_g1325:		.ds	1
+_g1326:		.ds	1
+_g1327:		.ds	1
+_g1328:		.ds	1
+_g1329:		.ds	1
+_g1330:		.ds	1
+_g1331:		.ds	1
+_g1332:		.ds	1
+_g1333:		.ds	1
+_g1334:		.ds	1
+_g1335:		.ds	1
+_g1336:		.ds	1
+_g1337:		.ds	1
+_g1338:		.ds	1
+_g1339:		.ds	1
+_g1340:		.ds	1
+_g1341:		.ds	1
+_g1342:		.ds	1
+_g1343:		.ds	1
+_g1344:		.ds	1
+_g1345:		.ds	1
+_g1346:		.ds	1
+_g1347:		.ds	1
+_g1348:		.ds	1
+_g1349:		.ds	1
+_g1350:		.ds	1
+_g1351:		.ds	1
+_g1352:		.ds	1
+_g1353:		.ds	1
+_g1354:		.ds	1
+_g1355:		.ds	1
+_g1356:		.ds	1
+_g1357:		.ds	1
+_g1358:		.ds	1
+_g1359:		.ds	1
+_g1360:		.ds	1
+_g1361:		.ds	1
+_g1362:		.ds	1
+_g1363:		.ds	1
+_g1364:		.ds	1
+_g1365:		.ds	1
+_g1366:		.ds	1
+_g1367:		.ds	1
+_g1368:		.ds	1
+_g1369:		.ds	1
+_g1370:		.ds	1
+_g1371:		.ds	1
+_g1372:		.ds	1
+_g1373:		.ds	1
+_g1374:		.ds	1
+_g1375:		.ds	1
+_g1376:		.ds	1
+_g1377:		.ds	1
+_g1378:		.ds	1
+_g1379:		.ds	1
+_g1380:		.ds	1
+_g1381:		.ds	1
+_g1382:		.ds	1
+_g1383:		.ds	1
+_g1384:		.ds	1
+_g1385:		.ds	1
+_g1386:		.ds	1
+_g1387:		.ds	1
+_g1388:		.ds	1
+_g1389:		.ds	1
+_g1390:		.ds	1
+_g1391:		.ds	1
+_g1392:		.ds	1
+_g1393:		.ds	1
+_g1394:		.ds	1
+_g1395:		.ds	1
+_g1396:		.ds	1
+_g1397:		.ds	1
+_g1398:		.ds	1
+_g1399:		.ds	1
+_g1400:		.ds	1
+_g1401:		.ds	1
+_g1402:		.ds	1
+_g1403:		.ds	1
+_g1404:		.ds	1
+_g1405:		.ds	1
+_g1406:		.ds	1
+_g1407:		.ds	1
+_g1408:		.ds	1
+_g1409:		.ds	1
+_g1410:		.ds	1
+_g1411:		.ds	1
+_g1412:		.ds	1
+_g1413:		.ds	1
+_g1414:		.ds	1
+_g1415:		.ds	1
+_g1416:		.ds	1
+_g1417:		.ds	1
+_g1418:		.ds	1
+_g1419:		.ds	1
+_g1420:		.ds	1
+_g1421:		.ds	1
+_g1422:		.ds	1
+_g1423:		.ds	1
+_g1424:		.ds	1
+_g1425:		.ds	1
+_g1426:		.ds	1
+_g1427:		.ds	1
+_g1428:		.ds	1
+_g1429:		.ds	1
+_g1430:		.ds	1
+_g1431:		.ds	1
+_g1432:		.ds	1
+_g1433:		.ds	1
+_g1434:		.ds	1
+_g1435:		.ds	1
+_g1436:		.ds	1
+_g1437:		.ds	1
+_g1438:		.ds	1
+_g1439:		.ds	1
+_g1440:		.ds	1
+_g1441:		.ds	1
+_g1442:		.ds	1
+_g1443:		.ds	1
+_g1444:		.ds	1
+_g1445:		.ds	1
+_g1446:		.ds	1
+_g1447:		.ds	1
+_g1448:		.ds	1
+_g1449:		.ds	1
+_g1450:		.ds	1
+_g1451:		.ds	1
+_g1452:		.ds	1
+_g1453:		.ds	1
+_g1454:		.ds	1
+_g1455:		.ds	1
+_g1456:		.ds	1
+_g1457:		.ds	1
+_g1458:		.ds	1
+_g1459:		.ds	1
+_g1460:		.ds	1
+_g1461:		.ds	1
+_g1462:		.ds	1
+_g1463:		.ds	1
+_g1464:		.ds	1
+_g1465:		.ds	1
+_g1466:		.ds	1
+_g1467:		.ds	1
+_g1468:		.ds	1
+_g1469:		.ds	1
+_g1470:		.ds	1
+_g1471:		.ds	1
+_g1472:		.ds	1
+_g1473:		.ds	1
+_g1474:		.ds	1
+_g1475:		.ds	1
+_g1476:		.ds	1
+_g1477:		.ds	1
+_g1478:		.ds	1
+_g1479:		.ds	1
+_g1480:		.ds	1
+_g1481:		.ds	1
+_g1482:		.ds	1
+_g1483:		.ds	1
+_g1484:		.ds	1
+_g1485:		.ds	1
+_g1486:		.ds	1
+_g1487:		.ds	1
+_g1488:		.ds	1
+_g1489:		.ds	1
+_g1490:		.ds	1
+_g1491:		.ds	1
+_g1492:		.ds	1
+_g1493:		.ds	1
+_g1494:		.ds	1
+_g1495:		.ds	1
+_g1496:		.ds	1
+_g1497:		.ds	1
+_g1498:		.ds	1
+_g1499:		.ds	1
+_g1500:		.ds	1
+_g1501:		.ds	1
+_g1502:		.ds	1
+_g1503:		.ds	1
+_g1504:		.ds	1
+_g1505:		.ds	1
+_g1506:		.ds	1
+_g1507:		.ds	1
+_g1508:		.ds	1
+_g1509:		.ds	1
+_g1510:		.ds	1
+_g1511:		.ds	1
+_g1512:		.ds	1
+_g1513:		.ds	1
+_g1514:		.ds	1
+_g1515:		.ds	1
+_g1516:		.ds	1
+_g1517:		.ds	1
+_g1518:		.ds	1
+_g1519:		.ds	1
+_g1520:		.ds	1
+_g1521:		.ds	1
+_g1522:		.ds	1
+_g1523:		.ds	1
+_g1524:		.ds	1
+_g1525:		.ds	1
+_g1526:		.ds	1
+_g1527:		.ds	1
+_g1528:		.ds	1
+_g1529:		.ds	1
+_g1530:		.ds	1
+_g1531:		.ds	1
+_g1532:		.ds	1
+_g1533:		.ds	1
+_g1534:		.ds	1
+_g1535:		.ds	1
+_g1536:		.ds	1
+_g1537:		.ds	1
+_g1538:		.ds	1
+_g1539:		.ds	1
+_g1540:		.ds	1
+_g1541:		.ds	1
+_g1542:		.ds	1
+_g1543:		.ds	1
+_g1544:		.ds	1
+_g1545:		.ds	1
+_g1546:		.ds	1
+_g1547:		.ds	1
+_g1548:		.ds	1
+_g1549:		.ds	1
+_g1550:		.ds	1
+_g1551:		.ds	1
+_g1552:		.ds	1
+_g1553:		.ds	1
+_g1554:		.ds	1
+_g1555:		.ds	1
+_g1556:		.ds	1
+_g1557:		.ds	1
+_g1558:		.ds	1
+_g1559:		.ds	1
+_g1560:		.ds	1
+_g1561:		.ds	1
+_g1562:		.ds	1
+_g1563:		.ds	1
+_g1564:		.ds	1
+_g1565:		.ds	1
+_g1566:		.ds	1
+_g1567:		.ds	1
+_g1568:		.ds	1
+_g1569:		.ds	1
+_g1570:		.ds	1
+_g1571:		.ds	1
+_g1572:		.ds	1
+_g1573:		.ds	1
+_g1574:		.ds	1
+_g1575:		.ds	1
+_g1576:		.ds	1
+_g1577:		.ds	1
+_g1578:		.ds	1
+_g1579:		.ds	1
+_g1580:		.ds	1
+_g1581:		.ds	1
+_g1582:		.ds	1
+_g1583:		.ds	1
+_g1584:		.ds	1
+_g1585:		.ds	1
+_g1586:		.ds	1
+_g1587:		.ds	1
+_g1588:		.ds	1
+_g1589:		.ds	1
+_g1590:		.ds	1
+_g1591:		.ds	1
+_g1592:		.ds	1
+_g1593:		.ds	1
+_g1594:		.ds	1
+_g1595:		.ds	1
+_g1596:		.ds	1
+_g1597:		.ds	1
+_g1598:		.ds	1
+_g1599:		.ds	1
+_g1600:		.ds	1
+_g1601:		.ds	1
+_g1602:		.ds	1
+_g1603:		.ds	1
+_g1604:		.ds	1
+_g1605:		.ds	1
+_g1606:		.ds	1
+_g1607:		.ds	1
+_g1608:		.ds	1
+_g1609:		.ds	1
+_g1610:		.ds	1
+_g1611:		.ds	1
+_g1612:		.ds	1
+_g1613:		.ds	1
+_g1614:		.ds	1
+_g1615:		.ds	1
+_g1616:		.ds	1
+_g1617:		.ds	1
+_g1618:		.ds	1
+_g1619:		.ds	1
+_g1620:		.ds	1
+_g1621:		.ds	1
+_g1622:		.ds	1
+_g1623:		.ds	1
+_g1624:		.ds	1
+_g1625:		.ds	1
+_g1626:		.ds	1
+_g1627:		.ds	1
+_g1628:		.ds	1
+_g1629:		.ds	1
+_g1630:		.ds	1
+_g1631:		.ds	1
+_g1632:		.ds	1
+_g1633:		.ds	1
+_g1634:		.ds	1
+_g1635:		.ds	1
+_g1636:		.ds	1
+_g1637:		.ds	1
+_g1638:		.ds	1
+_g1639:		.ds	1
+_g1640:		.ds	1
+_g1641:		.ds	1
+_g1642:		.ds	1
+_g1643:		.ds	1
+_g1644:		.ds	1
+_g1645:		.ds	1
+_g1646:		.ds	1
+_g1647:		.ds	1
+_g1648:		.ds	1
+_g1649:		.ds	1
+_g1650:		.ds	1
+_g1651:		.ds	1
+_g1652:		.ds	1
+_g1653:		.ds	1
+_g1654:		.ds	1
+_g1655:		.ds	1
+_g1656:		.ds	1
+_g1657:		.ds	1
+_g1658:		.ds	1
+_g1659:		.ds	1
+_g1660:		.ds	1
+_g1661:		.ds	1
+_g1662:		.ds	1
+_g1663:		.ds	1
+_g1664:		.ds	1
+_g1665:		.ds	1
+_g1666:		.ds	1
+_g1667:		.ds	1
+_g1668:		.ds	1
+_g1669:		.ds	1
+_g1670:		.ds	1
+_g1671:		.ds	1
+_g1672:		.ds	1
+_g1673:		.ds	1
+_g1674:		.ds	1
+_g1675:		.ds	1
+_g1676:		.ds	1
+_g1677:		.ds	1
+_g1678:		.ds	1
+_g1679:		.ds	1
+_g1680:		.ds	1
+_g1681:		.ds	1
+_g1682:		.ds	1
+_g1683:		.ds	1
+_g1684:		.ds	1
+_g1685:		.ds	1
+_g1686:		.ds	1
+_g1687:		.ds	1
+_g1688:		.ds	1
+_g1689:		.ds	1
+_g1690:		.ds	1
+_g1691:		.ds	1
+_g1692:		.ds	1
+_g1693:		.ds	1
+_g1694:		.ds	1
+_g1695:		.ds	1
+_g1696:		.ds	1
+_g1697:		.ds	1
+_g1698:		.ds	1
+_g1699:		.ds	1
+_g1700:		.ds	1
+_g1701:		.ds	1
+_g1702:		.ds	1
+_g1703:		.ds	1
+_g1704:		.ds	1
+_g1705:		.ds	1
+_g1706:		.ds	1
+_g1707:		.ds	1
+_g1708:		.ds	1
+_g1709:		.ds	1
+_g1710:		.ds	1
+_g1711:		.ds	1
+_g1712:		.ds	1
+_g1713:		.ds	1
+_g1714:		.ds	1
+_g1715:		.ds	1
+_g1716:		.ds	1
+_g1717:		.ds	1
+_g1718:		.ds	1
+_g1719:		.ds	1
+_g1720:		.ds	1
+_g1721:		.ds	1
+_g1722:		.ds	1
+_g1723:		.ds	1
+_g1724:		.ds	1
+_g1725:		.ds	1
+_g1726:		.ds	1
+_g1727:		.ds	1
+_g1728:		.ds	1
+_g1729:		.ds	1
+_g1730:		.ds	1
+_g1731:		.ds	1
+_g1732:		.ds	1
+_g1733:		.ds	1
+_g1734:		.ds	1
+_g1735:		.ds	1
+_g1736:		.ds	1
+_g1737:		.ds	1
+_g1738:		.ds	1
+_g1739:		.ds	1
+_g1740:		.ds	1
+_g1741:		.ds	1
+_g1742:		.ds	1
+_g1743:		.ds	1
+_g1744:		.ds	1
+_g1745:		.ds	1
+_g1746:		.ds	1
+_g1747:		.ds	1
+_g1748:		.ds	1
+_g1749:		.ds	1
+_g1750:		.ds	1
+_g1751:		.ds	1
+_g1752:		.ds	1
+_g1753:		.ds	1
+_g1754:		.ds	1
+_g1755:		.ds	1
+_g1756:		.ds	1
+_g1757:		.ds	1
+_g1758:		.ds	1
+_g1759:		.ds	1
+_g1760:		.ds	1
+_g1761:		.ds	1
+_g1762:		.ds	1
+_g1763:		.ds	1
+_g1764:		.ds	1
+_g1765:		.ds	1
+_g1766:		.ds	1
+_g1767:		.ds	1
+_g1768:		.ds	1
+_g1769:		.ds	1
+_g1770:		.ds	1
+_g1771:		.ds	1
+_g1772:		.ds	1
+_g1773:		.ds	1
+_g1774:		.ds	1
+_g1775:		.ds	1
+_g1776:		.ds	1
+_g1777:		.ds	1
+_g1778:		.ds	1
+_g1779:		.ds	1
+_g1780:		.ds	1
+_g1781:		.ds	1
+_g1782:		.ds	1
+_g1783:		.ds	1
+_g1784:		.ds	1
+_g1785:		.ds	1
+_g1786:		.ds	1
+_g1787:		.ds	1
+_g1788:		.ds	1
+_g1789:		.ds	1
+_g1790:		.ds	1
+_g1791:		.ds	1
+_g1792:		.ds	1
+_g1793:		.ds	1
+_g1794:		.ds	1
+_g1795:		.ds	1
+_g1796:		.ds	1
+_g1797:		.ds	1
+_g1798:		.ds	1
+_g1799:		.ds	1
+_g1800:		.ds	1
+_g1801:		.ds	1
+_g1802:		.ds	1
+_g1803:		.ds	1
+_g1804:		.ds	1
+_g1805:		.ds	1
+_g1806:		.ds	1
+_g1807:		.ds	1
+_g1808:		.ds	1
+_g1809:		.ds	1
+_g1810:		.ds	1
+_g1811:		.ds	1
+_g1812:		.ds	1
+_g1813:		.ds	1
+_g1814:		.ds	1
+_g1815:		.ds	1
+_g1816:		.ds	1
+_g1817:		.ds	1
+_g1818:		.ds	1
+_g1819:		.ds	1
+_g1820:		.ds	1
+_g1821:		.ds	1
+_g1822:		.ds	1
+_g1823:		.ds	1
+_g1824:		.ds	1
+_g1825:		.ds	1
+_g1826:		.ds	1
+_g1827:		.ds	1
+_g1828:		.ds	1
+_g1829:		.ds	1
+_g1830:		.ds	1
+_g1831:		.ds	1
+_g1832:		.ds	1
+_g1833:		.ds	1
+_g1834:		.ds	1
+_g1835:		.ds	1
+_g1836:		.ds	1
+_g1837:		.ds	1
+_g1838:		.ds	1
+_g1839:		.ds	1
+_g1840:		.ds	1
+_g1841:		.ds	1
+_g1842:		.ds	1
+_g1843:		.ds	1
+_g1844:		.ds	1
+_g1845:		.ds	1
+_g1846:		.ds	1
+_g1847:		.ds	1
+_g1848:		.ds	1
+_g1849:		.ds	1
+_g1850:		.ds	1
+_g1851:		.ds	1
+_g1852:		.ds	1
+_g1853:		.ds	1
+_g1854:		.ds	1
+_g1855:		.ds	1
+_g1856:		.ds	1
+_g1857:		.ds	1
+_g1858:		.ds	1
+_g1859:		.ds	1
+_g1860:		.ds	1
+_g1861:		.ds	1
+_g1862:		.ds	1
+_g1863:		.ds	1
+_g1864:		.ds	1
+_g1865:		.ds	1
+_g1866:		.ds	1
+_g1867:		.ds	1
+_g1868:		.ds	1
+_g1869:		.ds	1
+_g1870:		.ds	1
+_g1871:		.ds	1
+_g1872:		.ds	1
+_g1873:		.ds	1
+_g1874:		.ds	1
+_g1875:		.ds	1
+_g1876:		.ds	1
+_g1877:		.ds	1
+_g1878:		.ds	1
+_g1879:		.ds	1
+_g1880:		.ds	1
+_g1881:		.ds	1
+_g1882:		.ds	1
+_g1883:		.ds	1
+_g1884:		.ds	1
+_g1885:		.ds	1
+_g1886:		.ds	1
+_g1887:		.ds	1
+_g1888:		.ds	1
+_g1889:		.ds	1
+_g1890:		.ds	1
+_g1891:		.ds	1
+_g1892:		.ds	1
+_g1893:		.ds	1
+_g1894:		.ds	1
+_g1895:		.ds	1
+_g1896:		.ds	1
+_g1897:		.ds	1
+_g1898:		.ds	1
+_g1899:		.ds	1
+_g1900:		.ds	1
+_g1901:		.ds	1
+_g1902:		.ds	1
+_g1903:		.ds	1
+_g1904:		.ds	1
+_g1905:		.ds	1
+_g1906:		.ds	1
+_g1907:		.ds	1
+_g1908:		.ds	1
+_g1909:		.ds	1
+_g1910:		.ds	1
+_g1911:		.ds	1
+_g1912:		.ds	1
+_g1913:		.ds	1
+_g1914:		.ds	1
+_g1915:		.ds	1
+_g1916:		.ds	1
+_g1917:		.ds	1
+_g1918:		.ds	1
+_g1919:		.ds	1
+_g1920:		.ds	1
+_g1921:		.ds	1
+_g1922:		.ds	1
+_g1923:		.ds	1
+_g1924:		.ds	1
+_g1925:		.ds	1
+_g1926:		.ds	1
+_g1927:		.ds	1
+_g1928:		.ds	1
+_g1929:		.ds	1
+_g1930:		.ds	1
+_g1931:		.ds	1
+_g1932:		.ds	1
+_g1933:		.ds	1
+_g1934:		.ds	1
+_g1935:		.ds	1
+_g1936:		.ds	1
+_g1937:		.ds	1
+_g1938:		.ds	1
+_g1939:		.ds	1
+_g1940:		.ds	1
+_g1941:		.ds	1
+_g1942:		.ds	1
+_g1943:		.ds	1
+_g1944:		.ds	1
+_g1945:		.ds	1
+_g1946:		.ds	1
+_g1947:		.ds	1
+_g1948:		.ds	1
+_g1949:		.ds	1
+_g1950:		.ds	1
+_g1951:		.ds	1
+_g1952:		.ds	1
+_g1953:		.ds	1
+_g1954:		.ds	1
+_g1955:		.ds	1
+_g1956:		.ds	1
+_g1957:		.ds	1
+_g1958:		.ds	1
+_g1959:		.ds	1
+_g1960:		.ds	1
+_g1961:		.ds	1
+_g1962:		.ds	1
+_g1963:		.ds	1
+_g1964:		.ds	1
+_g1965:		.ds	1
+_g1966:		.ds	1
+_g1967:		.ds	1
+_g1968:		.ds	1
+_g1969:		.ds	1
+_g1970:		.ds	1
+_g1971:		.ds	1
+_g1972:		.ds	1
+_g1973:		.ds	1
+_g1974:		.ds	1
+_g1975:		.ds	1
+_g1976:		.ds	1
+_g1977:		.ds	1
+_g1978:		.ds	1
+_g1979:		.ds	1
+_g1980:		.ds	1
+_g1981:		.ds	1
+_g1982:		.ds	1
+_g1983:		.ds	1
+_g1984:		.ds	1
+_g1985:		.ds	1
+_g1986:		.ds	1
+_g1987:		.ds	1
+_g1988:		.ds	1
+_g1989:		.ds	1
+_g1990:		.ds	1
+_g1991:		.ds	1
+_g1992:		.ds	1
+_g1993:		.ds	1
+_g1994:		.ds	1
+_g1995:		.ds	1
+_g1996:		.ds	1
+_g1997:		.ds	1
+_g1998:		.ds	1
+_g1999:		.ds	1
+_g2000:		.ds	1
+_g2001:		.ds	1
+_g2002:		.ds	1
+_g2003:		.ds	1
+_g2004:		.ds	1
+_g2005:		.ds	1
+_g2006:		.ds	1
+_g2007:		.ds	1
+_g2008:		.ds	1
+_g2009:		.ds	1
+_g2010:		.ds	1
+_g2011:		.ds	1
+_g2012:		.ds	1
+_g2013:		.ds	1
+_g2014:		.ds	1
+_g2015:		.ds	1
+_g2016:		.ds	1
+_g2017:		.ds	1
+_g2018:		.ds	1
+_g2019:		.ds	1
+_g2020:		.ds	1
+_g2021:		.ds	1
+_g2022:		.ds	1
+_g2023:		.ds	1
+_g2024:		.ds	1
+_g2025:		.ds	1
+_g2026:		.ds	1
+_g2027:		.ds	1
+_g2028:		.ds	1
+_g2029:		.ds	1
+_g2030:		.ds	1
+_g2031:		.ds	1
+_g2032:		.ds	1
+_g2033:		.ds	1
+_g2034:		.ds	1
+_g2035:		.ds	1
+_g2036:		.ds	1
+_g2037:		.ds	1
+_g2038:		.ds	1
+_g2039:		.ds	1
+_g2040:		.ds	1
+_g2041:		.ds	1
+_g2042:		.ds	1
+_g2043:		.ds	1
+_g2044:		.ds	1
+_g2045:		.ds	1
+_g2046:		.ds	1
+_g2047:		.ds	1
+_g2048:		.ds	1
+_g2049:		.ds	1
+_g2050:		.ds	1
+_g2051:		.ds	1
+_g2052:		.ds	1
+_g2053:		.ds	1
+_g2054:		.ds	1
+_g2055:		.ds	1
+_g2056:		.ds	1
+_g2057:		.ds	1
+_g2058:		.ds	1
+_g2059:		.ds	1
+_g2060:		.ds	1
+_g2061:		.ds	1
+_g2062:		.ds	1
+_g2063:		.ds	1
+_g2064:		.ds	1
+_g2065:		.ds	1
+_g2066:		.ds	1
+_g2067:		.ds	1
+_g2068:		.ds	1
+_g2069:		.ds	1
+_g2070:		.ds	1
+_g2071:		.ds	1
+_g2072:		.ds	1
+_g2073:		.ds	1
+_g2074:		.ds	1
+_g2075:		.ds	1
+_g2076:		.ds	1
+_g2077:		.ds	1
+_g2078:		.ds	1
+_g2079:		.ds	1
+_g2080:		.ds	1
+_g2081:		.ds	1
+_g2082:		.ds	1
+_g2083:		.ds	1
+_g2084:		.ds	1
+_g2085:		.ds	1
+_g2086:		.ds	1
+_g2087:		.ds	1
+_g2088:		.ds	1
+_g2089:		.ds	1
+_g2090:		.ds	1
+_g2091:		.ds	1
+_g2092:		.ds	1
+_g2093:		.ds	1
+_g2094:		.ds	1
+_g2095:		.ds	1
+_g2096:		.ds	1
+_g2097:		.ds	1
+_g2098:		.ds	1
+_g2099:		.ds	1
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2107
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL7:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL8
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL9
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL10
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL11
+	__ldw_s	2
+	__lbra	LL6
+LL11:
+
+LL10:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL12
+LL9:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL12:
+
+	__lbra	LL7
+LL8:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL13
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL14
+	__ldw_s	2
+	__lbra	LL6
+LL14:
+
+LL13:
+
+	__ldwi	0
+LL6:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL16
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL16:
+
+LL15:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL18
+	__ldwi	0
+	__lbra	LL17
+LL18:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL20
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL20:
+
+	__tstw
+	__lbeq	LL19
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL21
+	__ldwi	0
+	__lbra	LL17
+LL21:
+
+LL19:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL22
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL23
+LL22:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL23:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL17:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL24:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL25:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL26:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL27:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,559 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-1,__stack
+	  call	_load_default_font
+	__ldwi	LL0+0
+	__stw	si
+	__ldwi	0
+	  stx	bl
+	__ldwi	0
+	  call	_put_string.3
+	__stbi_s	0,0
+LL2:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ltzp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL2
+LL4:
+
+	__ldub_s	0
+	  stx	dl
+	__ldub_s	0
+	  stx	cl
+	__ldwi	1
+	  call	_put_digit.3
+	__lbra	LL3
+LL5:
+
+	__stbi_s	0,0
+LL6:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ltzp
+	__lbne	LL8
+	__lbra	LL9
+LL7:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL6
+LL8:
+
+	__ldub_s	0
+	  stx	dl
+	__ldwi	130
+	__addub_s	0
+	  call	_put_digit.2
+	__lbra	LL7
+LL9:
+
+	__stbi_s	0,0
+LL10:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	26
+	  jsr	ltzp
+	__lbne	LL12
+	__lbra	LL13
+LL11:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL10
+LL12:
+
+	__ldub_s	0
+	__addwi	65
+	  stx	dl
+	__ldub_s	0
+	  stx	cl
+	__ldwi	3
+	  call	_put_char.3
+	__lbra	LL11
+LL13:
+
+	__stbi_s	0,0
+LL14:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	26
+	  jsr	ltzp
+	__lbne	LL16
+	__lbra	LL17
+LL15:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL14
+LL16:
+
+	__ldub_s	0
+	__addwi	65
+	  stx	dl
+	__ldwi	258
+	__addub_s	0
+	  call	_put_char.2
+	__lbra	LL15
+LL17:
+
+	__stbi_s	0,0
+LL18:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	26
+	  jsr	ltzp
+	__lbne	LL20
+	__lbra	LL21
+LL19:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL18
+LL20:
+
+	__ldub_s	0
+	__addwi	129
+	__stw	dx
+	__ldub_s	0
+	  stx	cl
+	__ldwi	6
+	  call	_put_raw.3
+	__lbra	LL19
+LL21:
+
+	__stbi_s	0,0
+LL22:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	26
+	  jsr	ltzp
+	__lbne	LL24
+	__lbra	LL25
+LL23:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL22
+LL24:
+
+	__ldub_s	0
+	__addwi	129
+	__stw	dx
+	__ldwi	450
+	__addub_s	0
+	  call	_put_raw.2
+	__lbra	LL23
+LL25:
+
+	__stbi_s	0,0
+LL26:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	15
+	  jsr	ltzp
+	__lbne	LL28
+	__lbra	LL29
+LL27:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL26
+LL28:
+
+	__ldub_s	0
+	__stw	dx
+	__ldwi	2
+	  stx	cl
+	__ldub_s	0
+	__aslwi	1
+	  stx	bl
+	__ldwi	8
+	  call	_put_number.4
+	__lbra	LL27
+LL29:
+
+	__stbi_s	0,0
+LL30:
+
+	__ldub_s	0
+	__stw	<__temp
+	__ldwi	15
+	  jsr	ltzp
+	__lbne	LL32
+	__lbra	LL33
+LL31:
+
+	__ldub_s	0
+	__incb_s	0
+	__lbra	LL30
+LL32:
+
+	__ldub_s	0
+	__stw	dx
+	__ldwi	2
+	  stx	cl
+	__ldub_s	0
+	__aslwi	1
+	__addwi	578
+	  call	_put_number.3
+	__lbra	LL31
+LL33:
+
+	__ldwi	LL0+3
+	__stw	si
+	__ldwi	1100
+	  call	_put_string.2
+	  ldy	#0
+	  call	_vsync
+	  ldy	#0
+	  call	_vsync
+	  call	_dump_screen
+LL34:
+
+LL35:
+
+LL36:
+
+	__lbra	LL36
+LL37:
+
+LL1:
+
+	__addmi	1,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	72,105,0,68,111,110,101,0
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:8
+;	constant pool:0
+;	global pool:14
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL40:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL41
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL42
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL43
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL44
+	__ldw_s	2
+	__lbra	LL39
+LL44:
+
+LL43:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL45
+LL42:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL45:
+
+	__lbra	LL40
+LL41:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL46
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL47
+	__ldw_s	2
+	__lbra	LL39
+LL47:
+
+LL46:
+
+	__ldwi	0
+LL39:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL49
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL49:
+
+LL48:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL51
+	__ldwi	0
+	__lbra	LL50
+LL51:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL53
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL53:
+
+	__tstw
+	__lbeq	LL52
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL54
+	__ldwi	0
+	__lbra	LL50
+LL54:
+
+LL52:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL55
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL56
+LL55:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL56:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL50:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL57:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL58:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL59:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL60:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
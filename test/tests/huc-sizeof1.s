@@ -0,0 +1,470 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+HAVE_INIT = 1
+                                                             
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-8,__stack
+	__ldwi	2
+	__stw	<__temp
+	__ldwi	1
+	  jsr	lezp
+	__lbne	LL8
+	__ldwi	2
+	__stw	<__temp
+	__ldwi	1
+	  jsr	lezp
+LL8:
+
+	__tstw
+	__lbeq	LL7
+	__ldwi	1
+	  call	_exit
+LL7:
+
+	__ldwi	1
+	__cmpwi_ne	1
+	__lbne	LL10
+	__ldwi	1
+	__cmpwi_ne	1
+LL10:
+
+	__tstw
+	__lbeq	LL9
+	__ldwi	2
+	  call	_exit
+LL9:
+
+	__ldwi	6
+	__cmpwi_ne	6
+	__lbeq	LL11
+	__ldwi	3
+	  call	_exit
+LL11:
+
+	__ldwi	6
+	__cmpwi_ne	6
+	__lbeq	LL12
+	__ldwi	4
+	  call	_exit
+LL12:
+
+	__ldwi	4
+	__pushw
+	__ldwi	2
+	__aslwi	1
+	  jsr	ne
+	__lbeq	LL13
+	__ldwi	5
+	  call	_exit
+LL13:
+
+	__ldwi	4
+	__pushw
+	__ldwi	2
+	__aslwi	1
+	  jsr	ne
+	__lbeq	LL14
+	__ldwi	6
+	  call	_exit
+LL14:
+
+	__ldwi	8
+	__pushw
+	__ldwi	2
+	__aslwi	2
+	  jsr	ne
+	__lbeq	LL15
+	__ldwi	7
+	  call	_exit
+LL15:
+
+	__ldwi	8
+	__pushw
+	__ldwi	2
+	__aslwi	2
+	  jsr	ne
+	__lbeq	LL16
+	__ldwi	8
+	  call	_exit
+LL16:
+
+	__ldwi	8
+	__pushw
+	__ldwi	2
+	__aslwi	2
+	  jsr	ne
+	__lbeq	LL17
+	__ldwi	9
+	  call	_exit
+LL17:
+
+	__ldwi	8
+	__pushw
+	__ldwi	2
+	__aslwi	2
+	  jsr	ne
+	__lbeq	LL18
+	__ldwi	10
+	  call	_exit
+LL18:
+
+	__ldwi	0
+LL1:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+
+	.bss
+_aaa:		.ds	8
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:18
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL21:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL22
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL23
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL24
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL25
+	__ldw_s	2
+	__lbra	LL20
+LL25:
+
+LL24:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL26
+LL23:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL26:
+
+	__lbra	LL21
+LL22:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL27
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL28
+	__ldw_s	2
+	__lbra	LL20
+LL28:
+
+LL27:
+
+	__ldwi	0
+LL20:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL30
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL30:
+
+LL29:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL32
+	__ldwi	0
+	__lbra	LL31
+LL32:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL34
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL34:
+
+	__tstw
+	__lbeq	LL33
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL35
+	__ldwi	0
+	__lbra	LL31
+LL35:
+
+LL33:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL36
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL37
+LL36:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL37:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL31:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL38:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL39:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL40:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL41:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+_x:		.ds	2
+_y:		.ds	1
+_z:		.ds	6
+_zz:		.ds	4
+_zzz:		.ds	8
+LL2:		.ds	2
+LL3:		.ds	1
+LL4:		.ds	6
+LL5:		.ds	4
+LL6:		.ds	8
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+
+	.dw	10
+
+	.db	11
+
+	.dw	3,2,1
+	.dw	2
+	.dw	1
+
+	.dw	7
+	.dw	6
+	.dw	5
+	.dw	4
+
+
+	.dw	5
+
+	.db	3
+
+	.dw	1,2,3
+	.dw	1
+	.dw	2
+
+	.dw	4
+	.dw	5
+	.dw	6
+	.dw	7
+
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,684 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _main
+	__addmi	-2,__stack
+	__stwi_s	0,0
+LL2:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	3
+	  jsr	ltzp
+	__lbne	LL4
+	__lbra	LL5
+LL3:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL2
+LL4:
+
+	__ldwi	_one
+	__addw_s	0
+	__stbip	41
+	__ldw_s	0
+	__aslw
+	__addwi_sym	_two
+	__stwip	42
+	__ldw_s	0
+	__mulwi	3
+	__addwi_sym	_three
+	__addwi	2
+	__stbip	43
+	__ldw_s	0
+	__mulwi	4
+	__addwi_sym	_four
+	__addwi	2
+	__stwip	44
+	__ldw_s	0
+	__mulwi	5
+	__addwi_sym	_five
+	__addwi	4
+	__stbip	45
+	__ldw_s	0
+	__mulwi	6
+	__addwi_sym	_six
+	__addwi	4
+	__stwip	46
+	__ldw_s	0
+	__mulwi	7
+	__addwi_sym	_seven
+	__addwi	6
+	__stbip	47
+	__ldw_s	0
+	__mulwi	8
+	__addwi_sym	_eight
+	__addwi	6
+	__stwip	48
+	__ldw_s	0
+	__mulwi	9
+	__addwi_sym	_nine
+	__addwi	8
+	__stbip	49
+	__lbra	LL3
+LL5:
+
+	__stwi_s	0,0
+LL6:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldwi	3
+	  jsr	ltzp
+	__lbne	LL8
+	__lbra	LL9
+LL7:
+
+	__ldw_s	0
+	__incw_s	0
+	__lbra	LL6
+LL8:
+
+	__ldwi	_one
+	__addw_s	0
+	__ldb_p
+	__cmpwi_ne	41
+	__lbeq	LL10
+	__ldwi	1
+	  call	_exit
+LL10:
+
+	__ldw_s	0
+	__aslw
+	__addwi_sym	_two
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	42
+	__lbeq	LL11
+	__ldwi	2
+	  call	_exit
+LL11:
+
+	__ldw_s	0
+	__mulwi	3
+	__addwi_sym	_three
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL13
+	__ldw_s	0
+	__mulwi	3
+	__addwi_sym	_three
+	__addwi	2
+	__ldb_p
+	__cmpwi_ne	43
+LL13:
+
+	__tstw
+	__lbeq	LL12
+	__ldwi	3
+	  call	_exit
+LL12:
+
+	__ldw_s	0
+	__mulwi	4
+	__addwi_sym	_four
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL15
+	__ldw_s	0
+	__mulwi	4
+	__addwi_sym	_four
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	44
+LL15:
+
+	__tstw
+	__lbeq	LL14
+	__ldwi	4
+	  call	_exit
+LL14:
+
+	__ldw_s	0
+	__mulwi	5
+	__addwi_sym	_five
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL17
+	__ldw_s	0
+	__mulwi	5
+	__addwi_sym	_five
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL17:
+
+	__tstw
+	__lbne	LL18
+	__ldw_s	0
+	__mulwi	5
+	__addwi_sym	_five
+	__addwi	4
+	__ldb_p
+	__cmpwi_ne	45
+LL18:
+
+	__tstw
+	__lbeq	LL16
+	__ldwi	5
+	  call	_exit
+LL16:
+
+	__ldw_s	0
+	__mulwi	6
+	__addwi_sym	_six
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL20
+	__ldw_s	0
+	__mulwi	6
+	__addwi_sym	_six
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL20:
+
+	__tstw
+	__lbne	LL21
+	__ldw_s	0
+	__mulwi	6
+	__addwi_sym	_six
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	46
+LL21:
+
+	__tstw
+	__lbeq	LL19
+	__ldwi	6
+	  call	_exit
+LL19:
+
+	__ldw_s	0
+	__mulwi	7
+	__addwi_sym	_seven
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL23
+	__ldw_s	0
+	__mulwi	7
+	__addwi_sym	_seven
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL23:
+
+	__tstw
+	__lbne	LL24
+	__ldw_s	0
+	__mulwi	7
+	__addwi_sym	_seven
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL24:
+
+	__tstw
+	__lbne	LL25
+	__ldw_s	0
+	__mulwi	7
+	__addwi_sym	_seven
+	__addwi	6
+	__ldb_p
+	__cmpwi_ne	47
+LL25:
+
+	__tstw
+	__lbeq	LL22
+	__ldwi	7
+	  call	_exit
+LL22:
+
+	__ldw_s	0
+	__mulwi	8
+	__addwi_sym	_eight
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL27
+	__ldw_s	0
+	__mulwi	8
+	__addwi_sym	_eight
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL27:
+
+	__tstw
+	__lbne	LL28
+	__ldw_s	0
+	__mulwi	8
+	__addwi_sym	_eight
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL28:
+
+	__tstw
+	__lbne	LL29
+	__ldw_s	0
+	__mulwi	8
+	__addwi_sym	_eight
+	__addwi	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	48
+LL29:
+
+	__tstw
+	__lbeq	LL26
+	__ldwi	8
+	  call	_exit
+LL26:
+
+	__ldw_s	0
+	__mulwi	9
+	__addwi_sym	_nine
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+	__lbne	LL31
+	__ldw_s	0
+	__mulwi	9
+	__addwi_sym	_nine
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL31:
+
+	__tstw
+	__lbne	LL32
+	__ldw_s	0
+	__mulwi	9
+	__addwi_sym	_nine
+	__addwi	4
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL32:
+
+	__tstw
+	__lbne	LL33
+	__ldw_s	0
+	__mulwi	9
+	__addwi_sym	_nine
+	__addwi	6
+	__stw	<__ptr
+	__ldwp	__ptr
+	__cmpwi_ne	0
+LL33:
+
+	__tstw
+	__lbne	LL34
+	__ldw_s	0
+	__mulwi	9
+	__addwi_sym	_nine
+	__addwi	8
+	__ldb_p
+	__cmpwi_ne	49
+LL34:
+
+	__tstw
+	__lbeq	LL30
+	__ldwi	9
+	  call	_exit
+LL30:
+
+	__lbra	LL7
+LL9:
+
+	__ldwi	0
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+
+	.bss
+_one:		.ds	3
+_two:		.ds	6
+_three:		.ds	9
+_four:		.ds	12
+_five:		.ds	15
+_six:		.ds	18
+_seven:		.ds	21
+_eight:		.ds	24
+_nine:		.ds	27
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:16
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL37:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL38
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL39
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL40
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL41
+	__ldw_s	2
+	__lbra	LL36
+LL41:
+
+LL40:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL42
+LL39:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL42:
+
+	__lbra	LL37
+LL38:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL43
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL44
+	__ldw_s	2
+	__lbra	LL36
+LL44:
+
+LL43:
+
+	__ldwi	0
+LL36:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL46
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL46:
+
+LL45:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL48
+	__ldwi	0
+	__lbra	LL47
+LL48:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL50
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL50:
+
+	__tstw
+	__lbeq	LL49
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL51
+	__ldwi	0
+	__lbra	LL47
+LL51:
+
+LL49:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL52
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL53
+LL52:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL53:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL47:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL54:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL55:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL56:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL57:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,87 @@
+/* Each switch lowering: compare chain, jump table, binary search. */
+int chain(int x)
+{
+  switch (x) {
+  case 3: return 1;
+  case 300: return 2;
+  case -2: return 3;
+  }
+  return 0;
+}
+
+int dense(int x)
+{
+  switch (x) {
+  case -2: return 10;
+  case -1: return 11;
+  case 0: return 12;
+  case 1: return 13;
+  case 3: return 15;
+  case 4: return 16;
+  case 6: return 18;
+  default: return 99;
+  }
+}
+
+int dense_hi(unsigned char x)
+{
+  switch (x) {
+  case 250: return 1;
+  case 251: return 2;
+  case 252: return 3;
+  case 253: return 4;
+  case 255: return 5;
+  }
+  return 0;
+}
+
+int sparse(int x)
+{
+  int r;
+  r = 0;
+  switch (x) {
+  case 1000: r = 1; break;
+  case -1000: r = 2; break;
+  case 7: r = 3; break;
+  case 0x7fff: r = 4; break;
+  case -32768: r = 5; break;
+  case 0: r = 6;
+  case 512: r += 7; break;
+  case 100: r = 8; break;
+  default: r = 9; break;
+  }
+  return r;
+}
+
+int main()
+{
+  int i, n;
+  if (chain(3) != 1 || chain(300) != 2 || chain(-2) != 3)
+    abort();
+  if (chain(0) != 0 || chain(3 + 256) != 0 || chain(44) != 0)
+    abort();
+  for (i = -4; i < 9; i++) {
+    n = dense(i);
+    if (i < -2 || i > 6 || i == 2 || i == 5) {
+      if (n != 99)
+        abort();
+    }
+    else if (n != i + 12)
+      abort();
+  }
+  if (dense(256) != 99 || dense(-256) != 99 || dense(254) != 99)
+    abort();
+  if (dense_hi(250) != 1 || dense_hi(253) != 4 || dense_hi(255) != 5)
+    abort();
+  if (dense_hi(254) != 0 || dense_hi(0) != 0 || dense_hi(249) != 0)
+    abort();
+  if (sparse(1000) != 1 || sparse(-1000) != 2 || sparse(7) != 3)
+    abort();
+  if (sparse(0x7fff) != 4 || sparse(-32768) != 5 || sparse(0) != 13)
+    abort();
+  if (sparse(512) != 7 || sparse(100) != 8 || sparse(1) != 9)
+    abort();
+  if (sparse(-1) != 9 || sparse(8) != 9 || sparse(999) != 9 || sparse(1001) != 9)
+    abort();
+  return 0;
+}
@@ -0,0 +1,846 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:53 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _chain
+	__pushw
+	__ldw_s	0
+	__lbra	LL2
+LL4:
+
+	__ldwi	1
+	__lbra	LL1
+LL5:
+
+	__ldwi	2
+	__lbra	LL1
+LL6:
+
+	__ldwi	3
+	__lbra	LL1
+	__lbra	LL3
+LL2:
+
+	  cpx	#3
+	  bne	LL7
+	  cmp	#0
+	  bne	LL7
+	  jmp	LL4
+LL7:
+
+	  cpx	#44
+	  bne	LL8
+	  cmp	#1
+	  bne	LL8
+	  jmp	LL5
+LL8:
+
+	  cpx	#254
+	  bne	LL9
+	  cmp	#255
+	  bne	LL9
+	  jmp	LL6
+LL9:
+
+	  jmp	LL3
+LL3:
+
+	__ldwi	0
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _dense
+	__pushw
+	__ldw_s	0
+	__lbra	LL11
+LL13:
+
+	__ldwi	10
+	__lbra	LL10
+LL14:
+
+	__ldwi	11
+	__lbra	LL10
+LL15:
+
+	__ldwi	12
+	__lbra	LL10
+LL16:
+
+	__ldwi	13
+	__lbra	LL10
+LL17:
+
+	__ldwi	15
+	__lbra	LL10
+LL18:
+
+	__ldwi	16
+	__lbra	LL10
+LL19:
+
+	__ldwi	18
+	__lbra	LL10
+LL20:
+
+	__ldwi	99
+	__lbra	LL10
+	__lbra	LL12
+LL11:
+
+	  tay
+	  txa
+	  sec
+	  sbc	#254
+	  tax
+	  tya
+	  sbc	#255
+	  bne	LL21
+	  cpx	#9
+	  bcs	LL21
+	  txa
+	  asl	a
+	  tax
+	  jmp	[LL22,x]
+LL21:
+
+	  jmp	LL20
+LL22:
+
+	.dw	LL13
+	.dw	LL14
+	.dw	LL15
+	.dw	LL16
+	.dw	LL20
+	.dw	LL17
+	.dw	LL18
+	.dw	LL20
+	.dw	LL19
+LL12:
+
+LL10:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _dense_hi
+	__pushw
+	__ldub_s	0
+	__lbra	LL24
+LL26:
+
+	__ldwi	1
+	__lbra	LL23
+LL27:
+
+	__ldwi	2
+	__lbra	LL23
+LL28:
+
+	__ldwi	3
+	__lbra	LL23
+LL29:
+
+	__ldwi	4
+	__lbra	LL23
+LL30:
+
+	__ldwi	5
+	__lbra	LL23
+	__lbra	LL25
+LL24:
+
+	  tay
+	  txa
+	  sec
+	  sbc	#250
+	  tax
+	  tya
+	  sbc	#0
+	  bne	LL31
+	  cpx	#6
+	  bcs	LL31
+	  txa
+	  asl	a
+	  tax
+	  jmp	[LL32,x]
+LL31:
+
+	  jmp	LL25
+LL32:
+
+	.dw	LL26
+	.dw	LL27
+	.dw	LL28
+	.dw	LL29
+	.dw	LL25
+	.dw	LL30
+LL25:
+
+	__ldwi	0
+LL23:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _sparse
+	__pushw
+	__addmi	-2,__stack
+	__stwi_s	0,0
+	__ldw_s	2
+	__lbra	LL34
+LL36:
+
+	__stwi_s	1,0
+	__lbra	LL35
+LL37:
+
+	__stwi_s	2,0
+	__lbra	LL35
+LL38:
+
+	__stwi_s	3,0
+	__lbra	LL35
+LL39:
+
+	__stwi_s	4,0
+	__lbra	LL35
+LL40:
+
+	__stwi_s	5,0
+	__lbra	LL35
+LL41:
+
+	__stwi_s	6,0
+LL42:
+
+	__ldw_s	0
+	__addwi	7
+	__stw_s	0
+	__lbra	LL35
+LL43:
+
+	__stwi_s	8,0
+	__lbra	LL35
+LL44:
+
+	__stwi_s	9,0
+	__lbra	LL35
+	__lbra	LL35
+LL34:
+
+	  ldy	#low(LL46)
+	  sty	<__ptr
+	  ldy	#high(LL46)
+	  sty	<__ptr+1
+	  ldy	#7
+	  jmp	___case
+LL46:
+
+	.dw	LL44
+	.dw	0,LL41
+	.dw	7,LL38
+	.dw	100,LL43
+	.dw	512,LL42
+	.dw	1000,LL36
+	.dw	32767,LL39
+	.dw	32768,LL40
+	.dw	64536,LL37
+LL35:
+
+	__ldw_s	0
+LL33:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-4,__stack
+	__ldwi	3
+	  call	_chain
+	__cmpwi_ne	1
+	__lbne	LL49
+	__ldwi	300
+	  call	_chain
+	__cmpwi_ne	2
+LL49:
+
+	__tstw
+	__lbne	LL50
+	__ldwi	-2
+	  call	_chain
+	__cmpwi_ne	3
+LL50:
+
+	__tstw
+	__lbeq	LL48
+	  call	_abort
+LL48:
+
+	__ldwi	0
+	  call	_chain
+	__cmpwi_ne	0
+	__lbne	LL52
+	__ldwi	259
+	  call	_chain
+	__cmpwi_ne	0
+LL52:
+
+	__tstw
+	__lbne	LL53
+	__ldwi	44
+	  call	_chain
+	__cmpwi_ne	0
+LL53:
+
+	__tstw
+	__lbeq	LL51
+	  call	_abort
+LL51:
+
+	__stwi_s	-4,2
+LL54:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	9
+	  jsr	ltzp
+	__lbne	LL56
+	__lbra	LL57
+LL55:
+
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL54
+LL56:
+
+	__ldw_s	2
+	  call	_dense
+	__stw_s	0
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	-2
+	  jsr	ltzp
+	__lbne	LL59
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	6
+	  jsr	gtzp
+LL59:
+
+	__tstw
+	__lbne	LL60
+	__ldw_s	2
+	__cmpwi_eq	2
+LL60:
+
+	__tstw
+	__lbne	LL61
+	__ldw_s	2
+	__cmpwi_eq	5
+LL61:
+
+	__tstw
+	__lbeq	LL58
+	__ldw_s	0
+	__cmpwi_ne	99
+	__lbeq	LL62
+	  call	_abort
+LL62:
+
+	__lbra	LL63
+LL58:
+
+	__ldw_s	0
+	__pushw
+	__ldw_s	4
+	__addwi	12
+	  jsr	ne
+	__lbeq	LL64
+	  call	_abort
+LL64:
+
+LL63:
+
+	__lbra	LL55
+LL57:
+
+	__ldwi	256
+	  call	_dense
+	__cmpwi_ne	99
+	__lbne	LL66
+	__ldwi	-256
+	  call	_dense
+	__cmpwi_ne	99
+LL66:
+
+	__tstw
+	__lbne	LL67
+	__ldwi	254
+	  call	_dense
+	__cmpwi_ne	99
+LL67:
+
+	__tstw
+	__lbeq	LL65
+	  call	_abort
+LL65:
+
+	__ldwi	250
+	  call	_dense_hi
+	__cmpwi_ne	1
+	__lbne	LL69
+	__ldwi	253
+	  call	_dense_hi
+	__cmpwi_ne	4
+LL69:
+
+	__tstw
+	__lbne	LL70
+	__ldwi	255
+	  call	_dense_hi
+	__cmpwi_ne	5
+LL70:
+
+	__tstw
+	__lbeq	LL68
+	  call	_abort
+LL68:
+
+	__ldwi	254
+	  call	_dense_hi
+	__cmpwi_ne	0
+	__lbne	LL72
+	__ldwi	0
+	  call	_dense_hi
+	__cmpwi_ne	0
+LL72:
+
+	__tstw
+	__lbne	LL73
+	__ldwi	249
+	  call	_dense_hi
+	__cmpwi_ne	0
+LL73:
+
+	__tstw
+	__lbeq	LL71
+	  call	_abort
+LL71:
+
+	__ldwi	1000
+	  call	_sparse
+	__cmpwi_ne	1
+	__lbne	LL75
+	__ldwi	-1000
+	  call	_sparse
+	__cmpwi_ne	2
+LL75:
+
+	__tstw
+	__lbne	LL76
+	__ldwi	7
+	  call	_sparse
+	__cmpwi_ne	3
+LL76:
+
+	__tstw
+	__lbeq	LL74
+	  call	_abort
+LL74:
+
+	__ldwi	32767
+	  call	_sparse
+	__cmpwi_ne	4
+	__lbne	LL78
+	__ldwi	-32768
+	  call	_sparse
+	__cmpwi_ne	5
+LL78:
+
+	__tstw
+	__lbne	LL79
+	__ldwi	0
+	  call	_sparse
+	__cmpwi_ne	13
+LL79:
+
+	__tstw
+	__lbeq	LL77
+	  call	_abort
+LL77:
+
+	__ldwi	512
+	  call	_sparse
+	__cmpwi_ne	7
+	__lbne	LL81
+	__ldwi	100
+	  call	_sparse
+	__cmpwi_ne	8
+LL81:
+
+	__tstw
+	__lbne	LL82
+	__ldwi	1
+	  call	_sparse
+	__cmpwi_ne	9
+LL82:
+
+	__tstw
+	__lbeq	LL80
+	  call	_abort
+LL80:
+
+	__ldwi	-1
+	  call	_sparse
+	__cmpwi_ne	9
+	__lbne	LL84
+	__ldwi	8
+	  call	_sparse
+	__cmpwi_ne	9
+LL84:
+
+	__tstw
+	__lbne	LL85
+	__ldwi	999
+	  call	_sparse
+	__cmpwi_ne	9
+LL85:
+
+	__tstw
+	__lbne	LL86
+	__ldwi	1001
+	  call	_sparse
+	__cmpwi_ne	9
+LL86:
+
+	__tstw
+	__lbeq	LL83
+	  call	_abort
+LL83:
+
+	__ldwi	0
+LL47:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:11
+;	Macro pool:5
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL89:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL90
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL91
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL92
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL93
+	__ldw_s	2
+	__lbra	LL88
+LL93:
+
+LL92:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL94
+LL91:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL94:
+
+	__lbra	LL89
+LL90:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL95
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL96
+	__ldw_s	2
+	__lbra	LL88
+LL96:
+
+LL95:
+
+	__ldwi	0
+LL88:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL98
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL98:
+
+LL97:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL100
+	__ldwi	0
+	__lbra	LL99
+LL100:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL102
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL102:
+
+	__tstw
+	__lbeq	LL101
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL103
+	__ldwi	0
+	__lbra	LL99
+LL103:
+
+LL101:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL104
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL105
+LL104:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL105:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL99:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL106:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL107:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL108:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL109:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:6
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,620 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _copy
+	__pushw
+	__ldw_s	4
+	__stw	di
+	__ldw_s	2
+	__stw	si
+	__ldw_s	0
+	  call	_memcpy.3
+LL1:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-1026,__stack
+	__stwi_s	0,1024
+LL3:
+
+	__ldw_s	1024
+	__stw	<__temp
+	__ldwi	512
+	  jsr	ultzp
+	__lbne	LL5
+	__lbra	LL6
+LL4:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL3
+LL5:
+
+	__pea_s	512
+	__ldw_s	1026
+	__addws
+	__pushw
+	__ldw_s	1026
+	cla
+	__stbps
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__stbip	0
+	__lbra	LL4
+LL6:
+
+	__lea_s	0
+	__stw	di
+	__lea_s	512
+	__stw	si
+	__ldwi	512
+	__pushw
+	__ldwi	128
+	  jsr	sdiv
+	  call	_memcpy.3
+	__stwi_s	0,1024
+LL7:
+
+	__ldw_s	1024
+	__pushw
+	__ldwi	512
+	__pushw
+	__ldwi	128
+	  jsr	sdiv
+	  jsr	ult
+	__lbne	LL9
+	__lbra	LL10
+LL8:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL7
+LL9:
+
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__ldub_p
+	__pushw
+	__ldw_s	1026
+	cla
+	  jsr	ne
+	__lbeq	LL11
+	  call	_abort
+LL11:
+
+	__lbra	LL8
+LL10:
+
+	__lea_s	0
+	__stw	di
+	__ldwi	1
+	__stw	bx
+	__ldwi	512
+	__pushw
+	__ldwi	128
+	  jsr	sdiv
+	  call	_memset.3
+	__stwi_s	0,1024
+LL12:
+
+	__ldw_s	1024
+	__pushw
+	__ldwi	512
+	__pushw
+	__ldwi	128
+	  jsr	sdiv
+	  jsr	ult
+	__lbne	LL14
+	__lbra	LL15
+LL13:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL12
+LL14:
+
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__ldub_p
+	__cmpwi_ne	1
+	__lbeq	LL16
+	  call	_abort
+LL16:
+
+	__lbra	LL13
+LL15:
+
+	__lea_s	0
+	__stw	di
+	__lea_s	512
+	__stw	si
+	__ldwi	512
+	  call	_memcpy.3
+	__stwi_s	0,1024
+LL17:
+
+	__ldw_s	1024
+	__stw	<__temp
+	__ldwi	512
+	  jsr	ultzp
+	__lbne	LL19
+	__lbra	LL20
+LL18:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL17
+LL19:
+
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__ldub_p
+	__pushw
+	__ldw_s	1026
+	cla
+	  jsr	ne
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__lbra	LL18
+LL20:
+
+	__lea_s	0
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	512
+	  call	_memset.3
+	__stwi_s	0,1024
+LL22:
+
+	__ldw_s	1024
+	__stw	<__temp
+	__ldwi	512
+	  jsr	ultzp
+	__lbne	LL24
+	__lbra	LL25
+LL23:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL22
+LL24:
+
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__ldub_p
+	__cmpwi_ne	0
+	__lbeq	LL26
+	  call	_abort
+LL26:
+
+	__lbra	LL23
+LL25:
+
+	__pea_s	0
+	__pea_s	514
+	__ldwi	512
+	__pushw
+	__ldwi	128
+	  jsr	sdiv
+	  call	_copy
+	__stwi_s	0,1024
+LL27:
+
+	__ldw_s	1024
+	__pushw
+	__ldwi	512
+	__pushw
+	__ldwi	128
+	  jsr	sdiv
+	  jsr	ult
+	__lbne	LL29
+	__lbra	LL30
+LL28:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL27
+LL29:
+
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__ldub_p
+	__pushw
+	__ldw_s	1026
+	cla
+	  jsr	ne
+	__lbeq	LL31
+	  call	_abort
+LL31:
+
+	__lbra	LL28
+LL30:
+
+	__lea_s	0
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	512
+	  call	_memset.3
+	__pea_s	0
+	__pea_s	514
+	__ldwi	512
+	  call	_copy
+	__stwi_s	0,1024
+LL32:
+
+	__ldw_s	1024
+	__stw	<__temp
+	__ldwi	512
+	  jsr	ultzp
+	__lbne	LL34
+	__lbra	LL35
+LL33:
+
+	__ldw_s	1024
+	__addwi	1
+	__stw_s	1024
+	__subwi	1
+	__lbra	LL32
+LL34:
+
+	__pea_s	0
+	__ldw_s	1026
+	__addws
+	__ldub_p
+	__pushw
+	__ldw_s	1026
+	cla
+	  jsr	ne
+	__lbeq	LL36
+	  call	_abort
+LL36:
+
+	__lbra	LL33
+LL35:
+
+	__ldwi	0
+	  call	_exit
+LL2:
+
+	__addmi	1026,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:11
+;	Macro pool:7
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL39:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL40
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL41
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL42
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL43
+	__ldw_s	2
+	__lbra	LL38
+LL43:
+
+LL42:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL44
+LL41:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL44:
+
+	__lbra	LL39
+LL40:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL45
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL46
+	__ldw_s	2
+	__lbra	LL38
+LL46:
+
+LL45:
+
+	__ldwi	0
+LL38:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL48
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL48:
+
+LL47:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL50
+	__ldwi	0
+	__lbra	LL49
+LL50:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL52
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL52:
+
+	__tstw
+	__lbeq	LL51
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL53
+	__ldwi	0
+	__lbra	LL49
+LL53:
+
+LL51:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL54
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL55
+LL54:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL55:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL49:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL56:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL57:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL58:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL59:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
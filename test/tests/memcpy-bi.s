@@ -0,0 +1,1823 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _check
+	__pushw
+	__ldw_s	4
+	__stw	di
+	__ldw_s	2
+	__stw	si
+	__ldw_s	0
+	  call	_memcmp.3
+	__tstw
+	__lbeq	LL2
+	  call	_abort
+LL2:
+
+LL1:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+	.proc _main2
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	40
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	40
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	40
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	41
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	41
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	41
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	42
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	42
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	42
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	43
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	43
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	43
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	44
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	44
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	44
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	45
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	45
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	45
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	46
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	46
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	46
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	47
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	47
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	47
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	48
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	48
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	48
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	49
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	49
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	49
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	50
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	50
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	50
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	51
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	51
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	51
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	52
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	52
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	52
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	53
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	53
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	53
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	54
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	54
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	54
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	55
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	55
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	55
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	56
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	56
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	56
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	57
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	57
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	57
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	58
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	58
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	58
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	59
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	59
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	59
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	60
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	60
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	60
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	61
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	61
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	61
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	62
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	62
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	62
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	63
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	63
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	63
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	64
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	64
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	64
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	65
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	65
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	65
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	66
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	66
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	66
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	67
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	67
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	67
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	68
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	68
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	68
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	69
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	69
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	69
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	70
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	70
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	70
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	71
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	71
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	71
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	72
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	72
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	72
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	73
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	73
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	73
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	74
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	74
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	74
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	75
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	75
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	75
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	76
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	76
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	76
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	77
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	77
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	77
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	78
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	78
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	78
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	79
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	79
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	79
+	  call	_check
+LL3:
+
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-4,__stack
+	__stwi_s	0,2
+LL5:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	80
+	  jsr	ltzp
+	__lbne	LL7
+	__lbra	LL8
+LL6:
+
+	__ldw_s	2
+	__addwi	1
+	__stw_s	2
+	__lbra	LL5
+LL7:
+
+	__ldwi	_src
+	__addw_s	2
+	__pushw
+	__ldw_s	4
+	__pushw
+	__ldwi	26
+	  jsr	smod
+	__addwi	97
+	__stbps
+	__lbra	LL6
+LL8:
+
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	0
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	0
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	0
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	1
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	1
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	1
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	2
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	2
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	2
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	3
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	3
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	3
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	4
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	4
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	4
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	5
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	5
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	5
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	6
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	6
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	6
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	7
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	7
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	7
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	8
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	8
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	8
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	9
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	9
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	9
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	10
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	10
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	10
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	11
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	11
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	11
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	12
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	12
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	12
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	13
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	13
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	13
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	14
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	14
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	14
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	15
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	15
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	15
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	16
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	16
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	16
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	17
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	17
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	17
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	18
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	18
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	18
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	19
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	19
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	19
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	20
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	20
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	20
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	21
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	21
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	21
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	22
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	22
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	22
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	23
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	23
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	23
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	24
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	24
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	24
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	25
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	25
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	25
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	26
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	26
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	26
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	27
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	27
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	27
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	28
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	28
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	28
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	29
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	29
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	29
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	30
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	30
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	30
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	31
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	31
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	31
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	32
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	32
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	32
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	33
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	33
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	33
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	34
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	34
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	34
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	35
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	35
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	35
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	36
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	36
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	36
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	37
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	37
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	37
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	38
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	38
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	38
+	  call	_check
+	__ldwi	_dst
+	__stw	di
+	__ldwi	0
+	__stw	bx
+	__ldwi	39
+	  call	_memset.3
+	__ldwi	_dst
+	__stw	di
+	__ldwi	_src
+	__stw	si
+	__ldwi	39
+	  call	_memcpy.3
+	__ldwi	_dst
+	__pushw
+	__ldwi	_src
+	__pushw
+	__ldwi	39
+	  call	_check
+	  call	_main2
+	__ldwi	0
+LL4:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+
+	.bss
+_src:		.ds	80
+_dst:		.ds	80
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:14
+;	Macro pool:9
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL11:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL12
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL13
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL14
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL15
+	__ldw_s	2
+	__lbra	LL10
+LL15:
+
+LL14:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL16
+LL13:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL16:
+
+	__lbra	LL11
+LL12:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL17
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL18
+	__ldw_s	2
+	__lbra	LL10
+LL18:
+
+LL17:
+
+	__ldwi	0
+LL10:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL20
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL20:
+
+LL19:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL22
+	__ldwi	0
+	__lbra	LL21
+LL22:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL24
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL24:
+
+	__tstw
+	__lbeq	LL23
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL25
+	__ldwi	0
+	__lbra	LL21
+LL25:
+
+LL23:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL26
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL27
+LL26:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL27:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL21:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL28:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL29:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL30:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL31:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
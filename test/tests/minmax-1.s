@@ -0,0 +1,731 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:49 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _f1
+	__pushw
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL2
+	__ldw_s	2
+	__lbra	LL3
+LL2:
+
+	__ldw_s	0
+LL3:
+
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL4
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL5
+	__ldw_s	2
+	__lbra	LL6
+LL5:
+
+	__ldw_s	0
+LL6:
+
+	__lbra	LL7
+LL4:
+
+	__ldw_s	0
+LL7:
+
+LL1:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _f2
+	__pushw
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL9
+	__ldw_s	2
+	__lbra	LL10
+LL9:
+
+	__ldw_s	0
+LL10:
+
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL11
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL12
+	__ldw_s	2
+	__lbra	LL13
+LL12:
+
+	__ldw_s	0
+LL13:
+
+	__lbra	LL14
+LL11:
+
+	__ldw_s	0
+LL14:
+
+LL8:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _f3
+	__pushw
+	__ldw_s	0
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+	__lbeq	LL16
+	__ldw_s	0
+	__lbra	LL17
+LL16:
+
+	__ldw_s	2
+LL17:
+
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL18
+	__ldw_s	0
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+	__lbeq	LL19
+	__ldw_s	0
+	__lbra	LL20
+LL19:
+
+	__ldw_s	2
+LL20:
+
+	__lbra	LL21
+LL18:
+
+	__ldw_s	0
+LL21:
+
+LL15:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _f4
+	__pushw
+	__ldw_s	0
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbeq	LL23
+	__ldw_s	0
+	__lbra	LL24
+LL23:
+
+	__ldw_s	2
+LL24:
+
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL25
+	__ldw_s	0
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbeq	LL26
+	__ldw_s	0
+	__lbra	LL27
+LL26:
+
+	__ldw_s	2
+LL27:
+
+	__lbra	LL28
+LL25:
+
+	__ldw_s	0
+LL28:
+
+LL22:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _g1
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+	__lbeq	LL30
+	__ldw_s	4
+	__lbra	LL31
+LL30:
+
+	__ldw_s	2
+LL31:
+
+	  jsr	lt
+	__lbeq	LL32
+	__ldw_s	2
+	__lbra	LL33
+LL32:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	gtzp
+	__lbeq	LL34
+	__ldw_s	2
+	__lbra	LL35
+LL34:
+
+	__ldw_s	0
+LL35:
+
+LL33:
+
+LL29:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _g2
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbeq	LL37
+	__ldw_s	4
+	__lbra	LL38
+LL37:
+
+	__ldw_s	2
+LL38:
+
+	  jsr	gt
+	__lbeq	LL39
+	__ldw_s	2
+	__lbra	LL40
+LL39:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	0
+	  jsr	ltzp
+	__lbeq	LL41
+	__ldw_s	2
+	__lbra	LL42
+LL41:
+
+	__ldw_s	0
+LL42:
+
+LL40:
+
+LL36:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _g3
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	4
+	  jsr	gtzp
+	__lbeq	LL44
+	__ldw_s	2
+	__lbra	LL45
+LL44:
+
+	__ldw_s	4
+LL45:
+
+	  jsr	lt
+	__lbeq	LL46
+	__ldw_s	2
+	__lbra	LL47
+LL46:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	gtzp
+	__lbeq	LL48
+	__ldw_s	0
+	__lbra	LL49
+LL48:
+
+	__ldw_s	2
+LL49:
+
+LL47:
+
+LL43:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _g4
+	__pushw
+	__ldw_s	2
+	__pushw
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	4
+	  jsr	ltzp
+	__lbeq	LL51
+	__ldw_s	2
+	__lbra	LL52
+LL51:
+
+	__ldw_s	4
+LL52:
+
+	  jsr	gt
+	__lbeq	LL53
+	__ldw_s	2
+	__lbra	LL54
+LL53:
+
+	__ldw_s	0
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbeq	LL55
+	__ldw_s	0
+	__lbra	LL56
+LL55:
+
+	__ldw_s	2
+LL56:
+
+LL54:
+
+LL50:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_f1
+	__cmpwi_ne	2
+	__lbeq	LL58
+	  call	_abort
+LL58:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_f2
+	__cmpwi_ne	2
+	__lbeq	LL59
+	  call	_abort
+LL59:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_f3
+	__cmpwi_ne	2
+	__lbeq	LL60
+	  call	_abort
+LL60:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_f4
+	__cmpwi_ne	2
+	__lbeq	LL61
+	  call	_abort
+LL61:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_g1
+	__cmpwi_ne	1
+	__lbeq	LL62
+	  call	_abort
+LL62:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_g2
+	__cmpwi_ne	1
+	__lbeq	LL63
+	  call	_abort
+LL63:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_g3
+	__cmpwi_ne	1
+	__lbeq	LL64
+	  call	_abort
+LL64:
+
+	__ldwi	1
+	__pushw
+	__ldwi	2
+	  call	_g4
+	__cmpwi_ne	1
+	__lbeq	LL65
+	  call	_abort
+LL65:
+
+	__ldwi	0
+LL57:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:8
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL68:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL69
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL70
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL71
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL72
+	__ldw_s	2
+	__lbra	LL67
+LL72:
+
+LL71:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL73
+LL70:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL73:
+
+	__lbra	LL68
+LL69:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL74
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL75
+	__ldw_s	2
+	__lbra	LL67
+LL75:
+
+LL74:
+
+	__ldwi	0
+LL67:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL77
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL77:
+
+LL76:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL79
+	__ldwi	0
+	__lbra	LL78
+LL79:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL81
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL81:
+
+	__tstw
+	__lbeq	LL80
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL82
+	__ldwi	0
+	__lbra	LL78
+LL82:
+
+LL80:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL83
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL84
+LL83:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL84:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL78:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL85:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL86:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL87:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL88:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,471 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:50 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _next_g
+	__ldw	_g
+	__pushw
+	__ldub	_e
+	__subwi	1
+	  jsr	eq
+	__lbeq	LL2
+	__ldwi	0
+	__lbra	LL3
+LL2:
+
+	__ldw	_g
+	__addwi	1
+LL3:
+
+LL1:
+
+	  rts
+	.endp
+
+	.proc _curr_p
+	__ldw	_p
+LL4:
+
+	  rts
+	.endp
+
+	.proc _inc_g
+	  call	_next_g
+	__stw	_g
+LL5:
+
+	  rts
+	.endp
+
+	.proc _curr_g
+	__ldw	_g
+LL6:
+
+	  rts
+	.endp
+
+	.proc _ring_empty
+	  call	_curr_p
+	__pushw
+	  call	_curr_g
+	  jsr	eq
+	__lbeq	LL8
+	__ldwi	1
+	__lbra	LL7
+	__lbra	LL9
+LL8:
+
+	__ldwi	0
+	__lbra	LL7
+LL9:
+
+LL7:
+
+	  rts
+	.endp
+
+	.proc _frob
+	__pushw
+	__ldw_s	2
+	__stw	_g
+	__ldw_s	0
+	__stw	_p
+	  call	_inc_g
+	  call	_ring_empty
+LL10:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _get_n
+	__addmi	-2,__stack
+	__stwi_s	0,0
+	__addmi	-2,__stack
+	  call	_curr_g
+	__stw_s	0
+LL12:
+
+	  call	_ring_empty
+	__notw
+	__lbeq	LL14
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	5
+	  jsr	ultzp
+LL14:
+
+	__tstw
+	__lbeq	LL13
+	  call	_inc_g
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL12
+LL13:
+
+	__ldw_s	2
+LL11:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	3
+	  stx	_e
+	__ldwi	0
+	__pushw
+	__ldwi	2
+	  call	_frob
+	__cmpwi_ne	0
+	__lbne	LL17
+	__ldw	_g
+	__cmpwi_ne	1
+LL17:
+
+	__tstw
+	__lbne	LL18
+	__ldw	_p
+	__cmpwi_ne	2
+LL18:
+
+	__tstw
+	__lbne	LL19
+	__ldub	_e
+	__cmpwi_ne	3
+LL19:
+
+	__tstw
+	__lbne	LL20
+	  call	_get_n
+	__cmpwi_ne	1
+LL20:
+
+	__tstw
+	__lbeq	LL16
+	  call	_abort
+LL16:
+
+	__ldwi	0
+	  call	_exit
+LL15:
+
+	  rts
+	.endp
+
+
+	.bss
+_g:		.ds	2
+_p:		.ds	2
+_e:		.ds	1
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:18
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL23:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL24
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL25
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL26
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL27
+	__ldw_s	2
+	__lbra	LL22
+LL27:
+
+LL26:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL28
+LL25:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL28:
+
+	__lbra	LL23
+LL24:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL29
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL30
+	__ldw_s	2
+	__lbra	LL22
+LL30:
+
+LL29:
+
+	__ldwi	0
+LL22:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL32
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL32:
+
+LL31:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL34
+	__ldwi	0
+	__lbra	LL33
+LL34:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL36
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL36:
+
+	__tstw
+	__lbeq	LL35
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL37
+	__ldwi	0
+	__lbra	LL33
+LL37:
+
+LL35:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL38
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL39
+LL38:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL39:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL33:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL40:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL41:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL42:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL43:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,483 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:50 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _f
+	__pushw
+	__addmi	-6,__stack
+	__stwi_s	0,2
+	__stwi_s	0,4
+LL2:
+
+LL3:
+
+LL4:
+
+	__ldw_s	4
+	__stw	<__temp
+	__ldwi	2
+	  jsr	gtzp
+	__lbeq	LL6
+LL7:
+
+	__ldw_s	2
+	__subwi	1
+	__stw_s	2
+	__ldw_s	4
+	__incw_s	4
+LL8:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	2
+	  jsr	gtzp
+	__lbne	LL7
+LL9:
+
+LL6:
+
+	__ldw_s	2
+	__cmpwi_eq	1
+	__lbeq	LL10
+	__lbra	LL5
+LL10:
+
+LL11:
+
+	__ldw_s	4
+	__stw	<__temp
+	__ldw_s	6
+	  jsr	gtzp
+	__lbeq	LL12
+	__ldw_s	2
+	__stw	<__temp
+	__ldw_s	6
+	  jsr	eqzp
+	__lbeq	LL13
+	__ldw_s	4
+	__incw_s	4
+LL13:
+
+	__lbra	LL11
+LL12:
+
+LL14:
+
+	__ldw_s	8
+	__aslw
+	__addwi_sym	_W
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	0
+LL17:
+
+	__ldw_s	0
+	__cmpwi_ne	0
+	__lbeq	LL20
+	__stwi_s	1,4
+	__ldw_s	8
+	__aslw
+	__addwi_sym	_W
+	__pushw
+	__stwi_s	0,2
+	__stwps
+LL20:
+
+LL18:
+
+	__ldw_s	6
+	__stw	<__temp
+	__ldwi	1
+	  jsr	ltzp
+	__lbne	LL17
+LL19:
+
+LL15:
+
+	__ldw_s	8
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+	__lbne	LL14
+LL16:
+
+LL21:
+
+	__stwi_s	0,6
+	__ldw_s	8
+	__aslw
+	__addwi_sym	_Link
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	8
+LL24:
+
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	2
+	  jsr	ltzp
+	__lbeq	LL25
+	__ldw_s	8
+	__cmpwi_ne	-1
+	__lbeq	LL26
+	__ldw_s	4
+	__incw_s	4
+	__ldw_s	6
+	__incw_s	6
+LL26:
+
+	__lbra	LL24
+LL25:
+
+LL22:
+
+	__ldw_s	8
+	__cmpwi_ne	-1
+	__lbne	LL21
+LL23:
+
+	__stwi_s	1,2
+	__lbra	LL4
+LL5:
+
+	__ldw_s	4
+LL1:
+
+	__addmi	10,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__ldwi	0
+	__pushw
+	__ldwi	2
+	  call	_f
+	__notw
+	__lbeq	LL28
+	  call	_abort
+LL28:
+
+	__ldwi	0
+LL27:
+
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+_Link:
+	.dw	-1
+_W:
+	.dw	2
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:10
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL31:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL32
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL33
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL34
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL35
+	__ldw_s	2
+	__lbra	LL30
+LL35:
+
+LL34:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL36
+LL33:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL36:
+
+	__lbra	LL31
+LL32:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL37
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL38
+	__ldw_s	2
+	__lbra	LL30
+LL38:
+
+LL37:
+
+	__ldwi	0
+LL30:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL40
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL40:
+
+LL39:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL42
+	__ldwi	0
+	__lbra	LL41
+LL42:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL44
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL44:
+
+	__tstw
+	__lbeq	LL43
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL45
+	__ldwi	0
+	__lbra	LL41
+LL45:
+
+LL43:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL46
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL47
+LL46:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL47:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL41:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL48:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL49:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL50:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL51:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
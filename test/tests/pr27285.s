@@ -0,0 +1,469 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:50 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _foo
+	__pushw
+	__addmi	-9,__stack
+	__ldw_s	11
+	__addwi	1
+	__ldub_p
+	__stw_s	5
+	__ldw_s	11
+	__addwi	3
+	__stw_s	2
+	__ldw_s	9
+	__addwi	3
+	__stw_s	0
+	__stwi_s	0,7
+LL2:
+
+	__ldw_s	5
+	__tstw
+	__lbeq	LL3
+	__ldw_s	5
+	__stw	<__temp
+	__ldwi	8
+	  jsr	gezp
+	__lbeq	LL4
+	__stbi_s	255,4
+	__ldw_s	5
+	__subwi	8
+	__stw_s	5
+	__lbra	LL5
+LL4:
+
+	__ldwi	255
+	__pushw
+	__ldwi	8
+	__pushw
+	__ldw_s	9
+	__subws
+	  jsr	asl
+	__stb_s	4
+	__stwi_s	0,5
+LL5:
+
+	__ldw_s	0
+	__addw_s	7
+	__pushw
+	__ldw_s	4
+	__addw_s	9
+	__ldub_p
+	__pushw
+	__ldub_s	8
+	__andws
+	__stbps
+	__ldw_s	7
+	__incw_s	7
+	__lbra	LL2
+LL3:
+
+LL1:
+
+	__addmi	13,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-38,__stack
+	__stbi_s	0,19
+	__lea_s	19
+	__addwi	1
+	__stbip	25
+	__lea_s	19
+	__addwi	2
+	__stbip	0
+	__lea_s	19
+	__addwi	3
+	__stbip	170
+	__lea_s	19
+	__addwi	4
+	__stbip	187
+	__lea_s	19
+	__addwi	5
+	__stbip	204
+	__lea_s	19
+	__addwi	6
+	__stbip	221
+	__stbi_s	0,0
+	__lea_s	0
+	__addwi	1
+	__stbip	0
+	__lea_s	0
+	__addwi	2
+	__stbip	0
+	__lea_s	0
+	__addwi	3
+	__stbip	0
+	__pea_s	19
+	__lea_s	2
+	  call	_foo
+	__lea_s	19
+	__addwi	3
+	__ldub_p
+	__pushw
+	__lea_s	2
+	__addwi	3
+	__ldub_p
+	  jsr	ne
+	__lbne	LL8
+	__lea_s	19
+	__addwi	4
+	__ldub_p
+	__pushw
+	__lea_s	2
+	__addwi	4
+	__ldub_p
+	  jsr	ne
+LL8:
+
+	__tstw
+	__lbne	LL9
+	__lea_s	19
+	__addwi	5
+	__ldub_p
+	__pushw
+	__lea_s	2
+	__addwi	5
+	__ldub_p
+	  jsr	ne
+LL9:
+
+	__tstw
+	__lbne	LL10
+	__lea_s	19
+	__addwi	6
+	__ldub_p
+	__andwi	128
+	__pushw
+	__lea_s	2
+	__addwi	6
+	__ldub_p
+	  jsr	ne
+LL10:
+
+	__tstw
+	__lbeq	LL7
+	  call	_abort
+LL7:
+
+	__ldwi	0
+LL6:
+
+	__addmi	38,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL13:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL14
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL15
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL16
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL17
+	__ldw_s	2
+	__lbra	LL12
+LL17:
+
+LL16:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL18
+LL15:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL18:
+
+	__lbra	LL13
+LL14:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL19
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL20
+	__ldw_s	2
+	__lbra	LL12
+LL20:
+
+LL19:
+
+	__ldwi	0
+LL12:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL22
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL22:
+
+LL21:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL24
+	__ldwi	0
+	__lbra	LL23
+LL24:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL26
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL26:
+
+	__tstw
+	__lbeq	LL25
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL27
+	__ldwi	0
+	__lbra	LL23
+LL27:
+
+LL25:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL28
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL29
+LL28:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL29:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL23:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL30:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL31:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL32:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL33:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,547 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:50 2026
+;
+
+HUC	= 1
+HAVE_INIT = 1
+                                                             
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _func2
+	__pushw
+	__ldw	_i
+	__addw_s	0
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _func3
+	__pushw
+	__ldw_s	0
+	__mulwi	3
+LL2:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _func4
+	__pushw
+	__ldw_s	0
+	  call	_func0
+	__addw_s	0
+LL3:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _func5
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldw_s	2
+	  call	_func1
+	__addws
+LL4:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _func6
+	__pushw
+	__ldw_s	0
+	  call	_func2
+	__addw_s	0
+LL5:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _func7
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldw_s	2
+	  call	_func3
+	__addws
+LL6:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__addmi	-22,__stack
+	__stwi_s	0,2
+	__ldwi	0
+	  call	_func0
+	__stw_s	0
+	__ldw_s	2
+	__tstw
+	__lbeq	LL8
+	  call	_link_error0
+LL8:
+
+	__stwi_s	0,4
+	__ldwi	0
+	  call	_func1
+	__stw_s	0
+	__ldw_s	4
+	__tstw
+	__lbeq	LL9
+	  call	_link_error1
+LL9:
+
+	__stwi_s	0,6
+	__ldwi	0
+	  call	_func2
+	__stw_s	0
+	__ldw_s	6
+	__tstw
+	__lbeq	LL10
+	  call	_link_error2
+LL10:
+
+	__stwi_s	0,8
+	__ldwi	0
+	  call	_func3
+	__stw_s	0
+	__ldw_s	8
+	__tstw
+	__lbeq	LL11
+	  call	_link_error3
+LL11:
+
+	__stwi_s	0,10
+	__ldwi	0
+	  call	_func4
+	__stw_s	0
+	__ldw_s	10
+	__tstw
+	__lbeq	LL12
+	  call	_link_error4
+LL12:
+
+	__stwi_s	0,12
+	__ldwi	0
+	  call	_func5
+	__stw_s	0
+	__ldw_s	12
+	__tstw
+	__lbeq	LL13
+	  call	_link_error5
+LL13:
+
+	__stwi_s	0,14
+	__ldwi	0
+	  call	_func6
+	__stw_s	0
+	__ldw_s	14
+	__tstw
+	__lbeq	LL14
+	  call	_link_error6
+LL14:
+
+	__stwi_s	0,16
+	__ldwi	0
+	  call	_func7
+	__stw_s	0
+	__ldw_s	16
+	__tstw
+	__lbeq	LL15
+	  call	_link_error7
+LL15:
+
+	__ldw_s	0
+LL7:
+
+	__addmi	22,__stack
+	  rts
+	.endp
+
+	.proc _func0
+	__pushw
+	__ldw_s	0
+	__subw	_i
+LL16:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _func1
+	__pushw
+	__ldw_s	0
+	__pushw
+	__ldw_s	2
+	__subws
+LL17:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _link_error0
+LL18:
+
+	  rts
+	.endp
+
+	.proc _link_error1
+LL19:
+
+	  rts
+	.endp
+
+	.proc _link_error2
+LL20:
+
+	  rts
+	.endp
+
+	.proc _link_error3
+LL21:
+
+	  rts
+	.endp
+
+	.proc _link_error4
+LL22:
+
+	  rts
+	.endp
+
+	.proc _link_error5
+LL23:
+
+	  rts
+	.endp
+
+	.proc _link_error6
+LL24:
+
+	  rts
+	.endp
+
+	.proc _link_error7
+LL25:
+
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:23
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL28:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL29
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL30
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL31
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL32
+	__ldw_s	2
+	__lbra	LL27
+LL32:
+
+LL31:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL33
+LL30:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL33:
+
+	__lbra	LL28
+LL29:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL34
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL35
+	__ldw_s	2
+	__lbra	LL27
+LL35:
+
+LL34:
+
+	__ldwi	0
+LL27:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL37
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL37:
+
+LL36:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL39
+	__ldwi	0
+	__lbra	LL38
+LL39:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL41
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL41:
+
+	__tstw
+	__lbeq	LL40
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL42
+	__ldwi	0
+	__lbra	LL38
+LL42:
+
+LL40:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL43
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL44
+LL43:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL44:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL38:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL45:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL46:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL47:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL48:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+_i:		.ds	2
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+
+	.dw	2
+huc_rodata_end:
+___huc_rodata_end:
@@ -0,0 +1,465 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (v3.98-gate, gate)
+; on Sun Oct 18 05:08:50 2026
+;
+
+HUC	= 1
+                                                                           
+LINK_malloc	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.proc _foo
+	__pushw
+	__ldw_s	0
+	__lbra	LL2
+LL4:
+
+LL5:
+
+LL6:
+
+LL7:
+
+	__ldwi	30
+	__lbra	LL1
+	__lbra	LL3
+LL2:
+
+	  cpx	#4
+	  bne	LL8
+	  cmp	#0
+	  bne	LL8
+	  jmp	LL4
+LL8:
+
+	  cpx	#6
+	  bne	LL9
+	  cmp	#0
+	  bne	LL9
+	  jmp	LL5
+LL9:
+
+	  cpx	#9
+	  bne	LL10
+	  cmp	#0
+	  bne	LL10
+	  jmp	LL6
+LL10:
+
+	  cpx	#11
+	  bne	LL11
+	  cmp	#0
+	  bne	LL11
+	  jmp	LL7
+LL11:
+
+	  jmp	LL3
+LL3:
+
+	__ldwi	31
+LL1:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _main
+	__pushw
+	__addmi	-4,__stack
+	__stwi_s	-1,2
+LL13:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	66
+	  jsr	ltzp
+	__lbne	LL15
+	__lbra	LL16
+LL14:
+
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL13
+LL15:
+
+	__ldw_s	2
+	  call	_foo
+	__stw_s	0
+	__ldw_s	2
+	__cmpwi_eq	4
+	__lbeq	LL17
+	__ldw_s	0
+	__cmpwi_ne	30
+	__lbeq	LL18
+	  call	_abort
+LL18:
+
+	__lbra	LL19
+LL17:
+
+	__ldw_s	2
+	__cmpwi_eq	6
+	__lbeq	LL20
+	__ldw_s	0
+	__cmpwi_ne	30
+	__lbeq	LL21
+	  call	_abort
+LL21:
+
+	__lbra	LL22
+LL20:
+
+	__ldw_s	2
+	__cmpwi_eq	9
+	__lbeq	LL23
+	__ldw_s	0
+	__cmpwi_ne	30
+	__lbeq	LL24
+	  call	_abort
+LL24:
+
+	__lbra	LL25
+LL23:
+
+	__ldw_s	2
+	__cmpwi_eq	11
+	__lbeq	LL26
+	__ldw_s	0
+	__cmpwi_ne	30
+	__lbeq	LL27
+	  call	_abort
+LL27:
+
+	__lbra	LL28
+LL26:
+
+	__ldw_s	0
+	__cmpwi_ne	31
+	__lbeq	LL29
+	  call	_abort
+LL29:
+
+LL28:
+
+LL25:
+
+LL22:
+
+LL19:
+
+	__lbra	LL14
+LL16:
+
+	__ldwi	0
+LL12:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+LINK_malloc	= 1
+	.code
+	.proc ___compact
+	__pushw
+	__addmi	-8,__stack
+	__ldw_s	10
+	__stw_s	2
+	__stwi_s	0,6
+LL32:
+
+	__ldw_s	10
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__tstw
+	__lbeq	LL33
+	__ldw_s	4
+	__andwi	1
+	__tstw
+	__lbeq	LL34
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL35
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL36
+	__ldw_s	2
+	__lbra	LL31
+LL36:
+
+LL35:
+
+	__stwi_s	0,6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__andwi	65534
+	__aslw
+	__addws
+	__stw_s	10
+	__stw_s	2
+	__lbra	LL37
+LL34:
+
+	__ldw_s	6
+	__addw_s	4
+	__stw_s	6
+	__ldw_s	10
+	__stw_s	0
+	__pushw
+	__ldw_s	6
+	__aslw
+	__addws
+	__stw_s	10
+LL37:
+
+	__lbra	LL32
+LL33:
+
+	__ldw_s	6
+	__cmpwi_ne	0
+	__lbeq	LL38
+	__ldw_s	2
+	__stw	<__ptr
+	__ldw_s	6
+	__stwp	__ptr
+	__ldw_s	6
+	__stw	<__temp
+	__ldw_s	8
+	  jsr	ugezp
+	__lbeq	LL39
+	__ldw_s	2
+	__lbra	LL31
+LL39:
+
+LL38:
+
+	__ldwi	0
+LL31:
+
+	__addmi	12,__stack
+	  rts
+	.endp
+
+	.proc _free
+	__pushw
+	__ldw_s	0
+	__tstw
+	__lbeq	LL41
+	__addmi	-2,__stack
+	__ldw_s	2
+	__subwi	4
+	__stw_s	0
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__andwi	65534
+	__stwps
+	__addmi	2,__stack
+LL41:
+
+LL40:
+
+	__addmi	2,__stack
+	  rts
+	.endp
+
+	.proc _malloc
+	__pushw
+	__addmi	-6,__stack
+	__ldw_s	6
+	__cmpwi_eq	0
+	__lbeq	LL43
+	__ldwi	0
+	__lbra	LL42
+LL43:
+
+	__ldw_s	6
+	__addwi	5
+	__stw_s	6
+	__lsrwi	2
+	__stw_s	6
+	__aslwi	2
+	__stw_s	6
+	__ldw	_msys
+	__cmpwi_eq	0
+	__lbne	LL45
+	__ldw_s	6
+	__pushw
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	  jsr	ugt
+LL45:
+
+	__tstw
+	__lbeq	LL44
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	8
+	  call	___compact
+	__stw	_msys
+	__cmpwi_eq	0
+	__lbeq	LL46
+	__ldwi	0
+	__lbra	LL42
+LL46:
+
+LL44:
+
+	__ldw	_msys
+	__stw_s	2
+	__ldw	_msys
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw_s	4
+	__pushw
+	__ldw_s	8
+	__addwi	2
+	  jsr	uge
+	__lbeq	LL47
+	__ldw_s	2
+	__stw_s	0
+	__pushw
+	__ldw_s	8
+	__aslw
+	__addws
+	__stw	_msys
+	__pushw
+	__ldw_s	6
+	__pushw
+	__ldw_s	10
+	__subws
+	__stwps
+	__lbra	LL48
+LL47:
+
+	__stwz	_msys
+	__ldw_s	4
+	__stw_s	6
+LL48:
+
+	__ldw_s	2
+	__pushw
+	__ldw_s	8
+	__orwi	1
+	__stwps
+	__ldw_s	2
+	__stw_s	0
+	__addwi	4
+LL42:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init
+	__pushw
+	__ldw_s	0
+	__lsrwi	2
+	__stw_s	0
+	__aslwi	2
+	__stw_s	0
+	__ldw_s	2
+	__stw	_msys+2
+	__stw	_msys
+	__pushw
+	__ldw	_msys+2
+	__pushw
+	__ldw_s	4
+	__subwi	2
+	__stwps
+	__stwps
+LL49:
+
+	__addmi	4,__stack
+	  rts
+	.endp
+
+	.proc ___malloc_init2
+	__ldwi	__heap_start
+	__pushw
+	__ldwi	1024
+	  call	___malloc_init
+LL50:
+
+	  rts
+	.endp
+
+	.proc _compact
+	__ldw	_msys+2
+	__pushw
+	__ldwi	65535
+	  call	___compact
+	__stw	_msys
+LL51:
+
+	  rts
+	.endp
+
+	.proc _realloc
+	__pushw
+	__addmi	-2,__stack
+	__ldw_s	2
+	  call	_malloc
+	__stw_s	0
+	__ldw_s	0
+	__stw	di
+	__ldw_s	4
+	__stw	si
+	__ldw_s	2
+	  call	_memcpy.3
+	__ldw_s	4
+	  call	_free
+	__ldw_s	0
+LL52:
+
+	__addmi	6,__stack
+	  rts
+	.endp
+
+
+	.bss
+_msys:		.ds	4
+
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:15
+;	Macro pool:7
+huc_data:
+___huc_data:
+huc_data_end:
+___huc_data_end:
+__heap_start:
+	.data
+	.bank CONST_BANK
+huc_rodata:
+___huc_rodata:
+huc_rodata_end:
+___huc_rodata_end:
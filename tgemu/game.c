@@ -3,13 +3,435 @@
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "shared.h"
 #define SCR_W 320
 #define SCR_H 240
 
-unsigned char *pixels;
-char *rom_name;
+/* exit status when a run limit is hit, as timeout(1) */
+#define EXIT_LIMIT 124
+
+/* run limits, 0 = none */
+unsigned long max_frames;
+unsigned long long max_cycles;
+double max_seconds;
+
+/* cycle profile output, NULL = don't profile */
+char *prof_name;
+
+/* snapshots to start from and to leave at the end, NULL = none */
+char *snap_in, *snap_out;
+
+/* per-machine host state, hung off the context */
+typedef struct {
+	unsigned char *pixels;
+	char *rom_name;
+
+	/* exit state */
+	const char *exit_reason;
+	int exit_code;
+	unsigned long frames;
+	struct timespec start_time;
+} t_run;
+
+/* the calling thread's run */
+static t_run *cur_run(void)
+{
+	return pce_ctx->user;
+}
+
+/* batch mode: workers share the manifest and stdout */
+FILE *manifest_fp;
+pthread_mutex_t batch_lock = PTHREAD_MUTEX_INITIALIZER;
+int batch_fails;
+
+/* stop the emulation; called by the test opcodes and the limits */
+void emu_exit(const char *reason, int code)
+{
+	t_run *r = cur_run();
+
+	if (r->exit_reason)
+		return;
+	r->exit_reason = reason;
+	r->exit_code = code;
+	pce_ctx->h6280_halt = 1;
+	pce_ctx->h6280_ICount = 0;
+}
+
+double elapsed(void)
+{
+	t_run *r = cur_run();
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - r->start_time.tv_sec) +
+	       (now.tv_nsec - r->start_time.tv_nsec) / 1e9;
+}
+
+/* one-line JSON report, for unattended runs */
+void exit_report(FILE *fp)
+{
+	t_run *r = cur_run();
+	char *p;
+
+	fprintf(fp, "{\"rom\":\"");
+	for (p = r->rom_name; *p; p++) {
+		if (*p == '"' || *p == '\\')
+			fputc('\\', fp);
+		fputc(*p, fp);
+	}
+	fprintf(fp, "\",\"reason\":\"%s\",\"code\":%d,"
+		"\"frames\":%lu,\"cycles\":%llu,\"seconds\":%.3f,"
+		"\"pc\":%u,\"a\":%u,\"x\":%u,\"y\":%u,\"s\":%u,\"p\":%u}\n",
+		r->exit_reason, r->exit_code,
+		r->frames, (unsigned long long)pce_ctx->h6280_cycles, elapsed(),
+		h6280_get_reg(H6280_PC) & 0xFFFF, h6280_get_reg(H6280_A),
+		h6280_get_reg(H6280_X), h6280_get_reg(H6280_Y),
+		h6280_get_reg(H6280_S) & 0xFF, h6280_get_reg(H6280_P));
+}
+
+/* name of a file next to the ROM, with another extension */
+char *rom_file(char *name, const char *ext)
+{
+	char *s = malloc(strlen(name) + strlen(ext) + 1);
+	char *dot;
+
+	strcpy(s, name);
+	dot = strrchr(s, '.');
+	if (dot && !strchr(dot, '/'))
+		*dot = 0;
+	strcat(s, ext);
+	return s;
+}
+
+/* load the symbols of a ROM for profiling, 0 if there are none */
+int profile_start(char *name)
+{
+	char *sym = rom_file(name, ".sym");
+	char *lst = rom_file(name, ".lst");
+
+	pce_ctx->profile = profile_load(sym, lst);
+	if (pce_ctx->profile == NULL)
+		fprintf(stderr, "can't read symbols from %s\n", sym);
+	free(sym);
+	free(lst);
+	return pce_ctx->profile != NULL;
+}
+
+int profile_end(void)
+{
+	char *folded = malloc(strlen(prof_name) + 8);
+	int res;
+
+	sprintf(folded, "%s.folded", prof_name);
+	res = profile_write(pce_ctx->profile, prof_name, folded);
+	if (!res)
+		perror(prof_name);
+	profile_free(pce_ctx->profile);
+	pce_ctx->profile = NULL;
+	free(folded);
+	return res;
+}
+
+void usage(void)
+{
+	fprintf(stderr, "usage: tgemu [-e] [-f frames] [-c cycles] [-t seconds] [-p file | -l cycles]\n"
+		"             [-r snapshot] [-s snapshot] rom.pce\n"
+		"       tgemu [options] [-j threads] -b manifest\n"
+		"  -b manifest run each ROM listed in the file (- for stdin), one\n"
+		"              result line per ROM on stdout\n"
+		"  -j threads  run that many ROMs of the manifest at once\n"
+		"  -p file     profile cycles per function and line, using the ROM's\n"
+		"              .sym and .lst files; writes file and file.folded\n"
+		"  -l cycles   run the ROM on both CPU cores in lockstep, comparing\n"
+		"              registers after every instruction and RAM every that\n"
+		"              many cycles (0: every frame); show the instructions\n"
+		"              around the first difference\n"
+		"  -r snapshot start from a snapshot of the ROM instead of a reset\n"
+		"  -s snapshot save the machine to a snapshot when a limit stops it\n"
+		"  -e          render every line as it is displayed\n"
+		"  -f frames   stop after this many frames\n"
+		"  -c cycles   stop after this many CPU cycles\n"
+		"  -t seconds  stop after this much wall-clock time\n"
+		"limits are checked once per frame and exit with status %d; -f\n"
+		"counts the frames run, -c the cycles since the reset\n",
+		EXIT_LIMIT);
+}
+
+/* make a machine for the calling thread, NULL if out of memory */
+t_context *new_machine(int lazy)
+{
+	t_context *ctx;
+	t_run *r;
+
+	/* no audio output, leave sound emulation off; the machine is
+	   reset for each ROM */
+	ctx = context_create(0);
+	if (ctx == NULL)
+		return NULL;
+	ctx->user = r = calloc(1, sizeof(t_run));
+	if (r)
+		r->pixels = calloc(SCR_W * SCR_H * 2, 1);
+	if (r == NULL || r->pixels == NULL) {
+		free(r);
+		context_destroy(ctx);
+		return NULL;
+	}
+	pce_ctx->bitmap.width = SCR_W;
+	pce_ctx->bitmap.height = SCR_H;
+	pce_ctx->bitmap.depth = 16;
+	pce_ctx->bitmap.granularity = (pce_ctx->bitmap.depth >> 3);
+	pce_ctx->bitmap.data = r->pixels;
+	pce_ctx->bitmap.pitch = (pce_ctx->bitmap.width * pce_ctx->bitmap.granularity);
+	pce_ctx->bitmap.viewport.w = 256;
+	pce_ctx->bitmap.viewport.h = 240;
+	pce_ctx->bitmap.viewport.x = 0x20;
+	pce_ctx->bitmap.viewport.y = 0x00;
+	pce_ctx->render_lazy = lazy;
+	return ctx;
+}
+
+void free_machine(t_context *ctx)
+{
+	t_run *r = ctx->user;
+
+	context_bind(ctx);
+	free(r->pixels);
+	free(r);
+	context_destroy(ctx);
+}
+
+/* load a ROM into the calling thread's machine and reset it, -1 if it
+   can't be loaded */
+int start_rom(char *name)
+{
+	t_run *r = cur_run();
+	int res;
+
+	r->rom_name = name;
+	r->exit_reason = NULL;
+	r->exit_code = 0;
+	r->frames = 0;
+	clock_gettime(CLOCK_MONOTONIC, &r->start_time);
+
+	res = load_rom(name, 0, 0);
+	if (res != 1) {
+		fprintf(stderr, "failed to load ROM: %d\n", res);
+		return -1;
+	}
+	memset(r->pixels, 0, SCR_W * SCR_H * 2);
+	system_reset();
+	if (snap_in && !state_load_file(snap_in)) {
+		fprintf(stderr, "can't restore a snapshot of this ROM from %s\n", snap_in);
+		return -1;
+	}
+	return 0;
+}
+
+/* run one frame of the calling thread's machine */
+void run_frame(void)
+{
+	t_run *r = cur_run();
+
+	pce_ctx->bitmap.data = r->pixels;
+	system_frame(0);
+	r->frames++;
+
+	/* run limits */
+	if (max_frames && r->frames >= max_frames)
+		emu_exit("frames", EXIT_LIMIT);
+	else if (max_cycles && pce_ctx->h6280_cycles >= max_cycles)
+		emu_exit("cycles", EXIT_LIMIT);
+	else if (max_seconds > 0 && elapsed() >= max_seconds)
+		emu_exit("timeout", EXIT_LIMIT);
+}
+
+/* run one ROM on the calling thread's machine until it exits or hits a
+   limit, -1 if it can't be loaded */
+int run_rom(char *name)
+{
+	t_run *r = cur_run();
+
+	if (start_rom(name) < 0)
+		return -1;
+	while (!r->exit_reason)
+		run_frame();
+	return r->exit_code;
+}
+
+/* name the first difference between two machines, NULL if none; leaves
+   the second one bound */
+const char *machine_diff(t_context *a, t_context *b)
+{
+	h6280_Regs regs;
+	unsigned long long cycles;
+	uint8 *ram_a, *vram_a, *objram_a;
+	uint16 *reg_a;
+
+	context_bind(a);
+	h6280_get_context(&regs);
+	cycles = pce_ctx->h6280_cycles;
+	ram_a = pce_ctx->ram;
+	vram_a = pce_ctx->vram;
+	objram_a = pce_ctx->objram;
+	reg_a = pce_ctx->reg;
+
+	context_bind(b);
+	if (memcmp(&regs, &pce_ctx->h6280, sizeof(regs)))
+		return "CPU registers";
+	if (cycles != pce_ctx->h6280_cycles)
+		return "cycle counts";
+	if (memcmp(ram_a, pce_ctx->ram, sizeof(pce_ctx->ram)))
+		return "RAM contents";
+	if (memcmp(vram_a, pce_ctx->vram, sizeof(pce_ctx->vram)) ||
+	    memcmp(objram_a, pce_ctx->objram, sizeof(pce_ctx->objram)))
+		return "VRAM contents";
+	if (memcmp(reg_a, pce_ctx->reg, sizeof(pce_ctx->reg)))
+		return "VDC registers";
+	return NULL;
+}
+
+/* run a ROM on the calling thread's machine and on a second one with the
+   table CPU core, a frame at a time; compare their instruction traces,
+   with a RAM hash every <hash_every> cycles, and the whole machines at
+   the end of each frame.  Stop at the first difference and show the
+   instructions around it */
+int run_lockstep(char *name, int lazy, int hash_every)
+{
+	t_context *ctx = pce_ctx, *ref;
+	t_run *r = ctx->user, *r_ref;
+	const char *diff = NULL;
+	int res;
+
+	ref = new_machine(lazy);
+	if (ref == NULL) {
+		fprintf(stderr, "out of memory\n");
+		return -1;
+	}
+	r_ref = ref->user;
+	pce_ctx->h6280_core = H6280_CORE_TABLE;
+	ref->trace = trace_new(hash_every);
+	ctx->trace = trace_new(hash_every);
+	if (ref->trace == NULL || ctx->trace == NULL) {
+		fprintf(stderr, "out of memory\n");
+		res = -1;
+	} else if ((res = start_rom(name)) == 0) {
+		context_bind(ctx);
+		res = start_rom(name);
+	}
+
+	while (res == 0 && !diff && !r->exit_reason && !r_ref->exit_reason) {
+		context_bind(ctx);
+		trace_frame(ctx->trace);
+		run_frame();
+		context_bind(ref);
+		trace_frame(ref->trace);
+		run_frame();
+		if (trace_failed(ctx->trace) || trace_failed(ref->trace)) {
+			fprintf(stderr, "lockstep: out of memory for the trace in frame %lu\n", r->frames);
+			res = -1;
+			break;
+		}
+		diff = trace_compare(ctx->trace, ref->trace);
+		if (!diff)
+			diff = machine_diff(ctx, ref);
+	}
+	/* the wall-clock limit can hit the machines on different frames */
+	if (res == 0 && !diff && (r->exit_reason != r_ref->exit_reason || r->exit_code != r_ref->exit_code) &&
+	    strcmp(r->exit_reason ? r->exit_reason : "", "timeout") &&
+	    strcmp(r_ref->exit_reason ? r_ref->exit_reason : "", "timeout"))
+		diff = "exit states";
+
+	if (diff) {
+		fprintf(stderr, "lockstep: %s differ in frame %lu\n", diff, r->frames);
+		trace_window(ctx->trace, "goto core", stderr);
+		trace_window(ref->trace, "table core", stderr);
+	}
+	trace_free(ref->trace);
+	free_machine(ref);
+	context_bind(ctx);
+	trace_free(ctx->trace);
+	ctx->trace = NULL;
+
+	if (res < 0)
+		return -1;
+	if (diff) {
+		r->exit_reason = NULL;
+		emu_exit("lockstep", 1);
+	}
+	return r->exit_code;
+}
+
+/* batch worker: take ROMs off the manifest, one path per line, until
+   it is exhausted */
+void *run_batch_worker(void *arg)
+{
+	t_context *ctx;
+	t_run *r;
+	char line[1024];
+	char *p;
+
+	ctx = new_machine(*(int *)arg);
+	if (ctx == NULL) {
+		fprintf(stderr, "out of memory\n");
+		return NULL;
+	}
+	r = ctx->user;
+	for (;;) {
+		pthread_mutex_lock(&batch_lock);
+		p = fgets(line, sizeof(line), manifest_fp);
+		pthread_mutex_unlock(&batch_lock);
+		if (p == NULL)
+			break;
+
+		line[strcspn(line, "\r\n")] = 0;
+		for (p = line; *p == ' ' || *p == '\t'; p++)
+			;
+		if (*p == 0 || *p == '#')
+			continue;
+
+		if (run_rom(p) < 0) {
+			r->exit_reason = "load";
+			r->exit_code = -1;
+		}
+		pthread_mutex_lock(&batch_lock);
+		if (r->exit_code)
+			batch_fails++;
+		exit_report(stdout);
+		fflush(stdout);
+		pthread_mutex_unlock(&batch_lock);
+	}
+	free_machine(ctx);
+	return NULL;
+}
+
+/* run the ROMs listed in a manifest on <threads> machines; with more
+   than one, the result lines come in completion order */
+int run_batch(char *manifest, int threads, int lazy)
+{
+	pthread_t *tid;
+	int i;
+
+	manifest_fp = strcmp(manifest, "-") ? fopen(manifest, "r") : stdin;
+	if (manifest_fp == NULL) {
+		perror(manifest);
+		return -1;
+	}
+	tid = calloc(threads, sizeof(pthread_t));
+	for (i = 0; i < threads; i++)
+		if (pthread_create(&tid[i], NULL, run_batch_worker, &lazy)) {
+			perror("pthread_create");
+			break;
+		}
+	while (i--)
+		pthread_join(tid[i], NULL);
+	free(tid);
+	if (manifest_fp != stdin)
+		fclose(manifest_fp);
+	return batch_fails ? 1 : 0;
+}
 
 void fint(FILE *fp, int v)
 {
@@ -24,6 +446,7 @@ void fshort(FILE *fp, short v)
 
 void dump_screen(void)
 {
+	t_run *r = cur_run();
 	FILE *fp;
 	int i;
 	/* Random BMP header bits, extracted from a file created by GIMP. */
@@ -37,14 +460,16 @@ void dump_screen(void)
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 , 0x00, 0x00,
 	};
 
-	char *scrname = strdup(rom_name);
-	*strrchr(scrname, '.') = 0;
-	strcat(scrname, ".bmp");
+	/* draw the frame the lazy renderer has only logged */
+	if (pce_ctx->render_lazy)
+		render_flush();
+
+	char *scrname = rom_file(r->rom_name, ".bmp");
 
 #ifndef LSB_FIRST
 	/* XXX: Is this guaranteed to work? man page doesn't say anything about
 	   overlapping source and destination. */
-	swab(pixels, pixels, SCR_W * SCR_H * 2);
+	swab(r->pixels, r->pixels, SCR_W * SCR_H * 2);
 #endif
 	fp = fopen(scrname, "r");
 	if (!fp) {
@@ -65,56 +490,114 @@ void dump_screen(void)
 		fwrite(hdr, sizeof(hdr), 1, fp);	/* random crap */
 		/* lines have to be written backwards... */
 		for (i = SCR_H - 1; i >= 0; i--)
-			fwrite(pixels + i * SCR_W * 2, SCR_W * 2, 1, fp);
+			fwrite(r->pixels + i * SCR_W * 2, SCR_W * 2, 1, fp);
 		fclose(fp);
-		exit(2);
+		free(scrname);
+		emu_exit("screen", 2);
+		return;
 	}
 	unsigned char *refpixels = malloc(SCR_W * SCR_H * 2);
 	fseek(fp, 0x8a, SEEK_SET);	/* skip to pixel data */
 	fread(refpixels, SCR_W * SCR_H * 2, 1, fp);
 	fclose(fp);
+	free(scrname);
 	/* Lines in BMP file are reversed. */
 	for (i = 0; i < SCR_H; i++) {
-		if (memcmp(pixels + i * SCR_W * 2, refpixels + (SCR_H - i - 1) * SCR_W * 2, SCR_W * 2)) {
+		if (memcmp(r->pixels + i * SCR_W * 2, refpixels + (SCR_H - i - 1) * SCR_W * 2, SCR_W * 2)) {
 			fprintf(stderr, "screen differs from reference\n");
-			exit(1);
+			free(refpixels);
+			emu_exit("screen", 1);
+			return;
 		}
 	}
-	exit(0);
+	free(refpixels);
+	emu_exit("screen", 0);
 }
 
 int main(int argc, char **argv)
 {
     int res;
-    if (argc != 2)
-	abort();
-	fprintf(stderr, "loading ROM\n");
-	rom_name = argv[1];
-	res = load_rom(rom_name, 0, 0);
-	if (res != 1) {
-		fprintf(stderr, "failed to load ROM: %d\n", res);
+    int c;
+    char *manifest = NULL;
+    int threads = 1;
+    /* nothing is displayed, so only render the screens that get dumped */
+    int lazy = 1;
+    int lockstep = -1;
+
+	while ((c = getopt(argc, argv, "b:ef:c:j:l:p:r:s:t:")) != -1) {
+		switch (c) {
+		case 'b':
+			manifest = optarg;
+			break;
+		case 'e':
+			lazy = 0;
+			break;
+		case 'f':
+			max_frames = strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			max_cycles = strtoull(optarg, NULL, 0);
+			break;
+		case 'j':
+			threads = atoi(optarg);
+			break;
+		case 'l':
+			lockstep = atoi(optarg);
+			break;
+		case 'p':
+			prof_name = optarg;
+			break;
+		case 'r':
+			snap_in = optarg;
+			break;
+		case 's':
+			snap_out = optarg;
+			break;
+		case 't':
+			max_seconds = strtod(optarg, NULL);
+			break;
+		default:
+			usage();
+			return -1;
+		}
+	}
+	if (optind != argc - (manifest ? 0 : 1) || threads < 1 ||
+	    (manifest && (prof_name || lockstep >= 0 || snap_in || snap_out)) || (prof_name && lockstep >= 0)) {
+		usage();
+		return -1;
+	}
+	if (lockstep >= 0 && H6280_CORE_DEFAULT == H6280_CORE_TABLE) {
+		fprintf(stderr, "only the table CPU core is built in (CPU_CORE=table)\n");
 		return -1;
 	}
-    pixels = calloc(SCR_W * SCR_H * 2, 1);
-    bitmap.width = SCR_W;
-    bitmap.height = SCR_H;
-    bitmap.depth = 16;
-    bitmap.granularity = (bitmap.depth >> 3);
-    bitmap.data = pixels;
-    bitmap.pitch = (bitmap.width * bitmap.granularity);
-    bitmap.viewport.w = 256;
-    bitmap.viewport.h = 240;
-    bitmap.viewport.x = 0x20;
-    bitmap.viewport.y = 0x00;
-	
+
+	if (manifest)
+		return run_batch(manifest, threads, lazy);
+
     fprintf(stderr, "system_init\n");
-    system_init(44100);
-    fprintf(stderr, "system_reset\n");
-    system_reset();
-	
-	while (1) {
-			bitmap.data = pixels;
-			system_frame(0);
+    if (new_machine(lazy) == NULL) {
+	fprintf(stderr, "out of memory\n");
+	return -1;
+    }
+
+	if (prof_name && !profile_start(argv[optind]))
+		return -1;
+
+	fprintf(stderr, "loading ROM\n");
+	res = lockstep >= 0 ? run_lockstep(argv[optind], lazy, lockstep) :
+			      run_rom(argv[optind]);
+	if (res < 0)
+		return -1;
+	if (prof_name && !profile_end())
+		return -1;
+	/* the limits stop the machine between frames, where a snapshot
+	   can be taken */
+	if (snap_out && cur_run()->exit_code != EXIT_LIMIT)
+		fprintf(stderr, "not saving %s: the program stopped itself\n", snap_out);
+	else if (snap_out && !state_save_file(snap_out)) {
+		perror(snap_out);
+		return -1;
 	}
-	return 0;
+	exit_report(stderr);
+	return cur_run()->exit_code;
 }
@@ -0,0 +1,57 @@
+
+#include <stdlib.h>
+#include "shared.h"
+
+/* Context of the calling thread */
+__thread t_context *pce_ctx = NULL;
+
+
+/*--------------------------------------------------------------------------*/
+/* Context management                                                       */
+/*--------------------------------------------------------------------------*/
+
+/* Make a new machine and bind it to the calling thread; the host sets up
+   the bitmap before resetting it.  Returns NULL if out of memory. */
+t_context *context_create(int sample_rate)
+{
+    t_context *ctx = calloc(1, sizeof(t_context));
+    if(!ctx) return (NULL);
+
+    context_bind(ctx);
+    pce_ctx->h6280_core = H6280_CORE_DEFAULT;
+    system_init(sample_rate);
+    return (ctx);
+}
+
+
+/* Select the machine the calling thread runs */
+void context_bind(t_context *ctx)
+{
+    pce_ctx = ctx;
+}
+
+
+void context_reset(t_context *ctx)
+{
+    context_bind(ctx);
+    system_reset();
+}
+
+
+void context_frame(t_context *ctx, int skip)
+{
+    context_bind(ctx);
+    system_frame(skip);
+}
+
+
+void context_destroy(t_context *ctx)
+{
+    if(!ctx) return;
+
+    context_bind(ctx);
+    if(pce_ctx->snd.buffer[0]) free(pce_ctx->snd.buffer[0]);
+    if(pce_ctx->snd.buffer[1]) free(pce_ctx->snd.buffer[1]);
+    free(ctx);
+    pce_ctx = NULL;
+}
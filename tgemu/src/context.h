@@ -0,0 +1,101 @@
+
+#ifndef _CONTEXT_H_
+#define _CONTEXT_H_
+
+/*
+    All mutable state of one emulated machine.  The emulator core uses the
+    context bound to the calling thread with context_bind(), so separate
+    threads can run separate machines.  Read-only lookup tables (bp_lut,
+    pixel_lut, ...) are shared by all contexts.
+*/
+typedef struct pce_context
+{
+    /* CPU */
+    h6280_Regs h6280;
+    int h6280_speed;        /* HuC6280 clock (1=7.16MHz, 0=3.58MHz) */
+    int h6280_ICount;       /* Cycle count */
+    int h6280_halt;         /* Set to stop execution */
+    UINT64 h6280_cycles;    /* Cycles run since reset */
+    int h6280_core;         /* Core to run (H6280_CORE_xxx) */
+
+    /* System memory */
+    uint8 ram[0x8000];      /* Work RAM */
+    uint8 cdram[0x10000];   /* CD unit RAM (64k) */
+    uint8 bram[0x2000];     /* Backup RAM (8K) */
+    uint8 rom[0x100000];    /* HuCard ROM (1MB) */
+    uint8 save_bram;        /* 1= BRAM registers were accessed */
+    uint8 dummy[0x2000];    /* Dummy block for unknown access */
+    uint8 *read_ptr[8];     /* Memory read pointers */
+    uint8 *write_ptr[8];    /* Memory write pointers */
+
+    /* I/O port data */
+    uint8 joy_sel;
+    uint8 joy_clr;
+    uint8 joy_cnt;
+
+    /* VDC */
+    uint32 y_offset;
+    uint32 byr;
+    uint8 vram[0x10000];
+    uint16 reg[0x20];
+    uint8 objram[0x200];
+    uint8 status;
+    uint8 latch;
+    uint8 addr_inc;
+    uint8 vram_data_latch;
+    uint8 dvssr_trigger;
+    int playfield_shift;
+    uint32 playfield_col_mask;
+    uint32 playfield_row_mask;
+    int disp_width;
+    int disp_height;
+    uint32 disp_nt_width;
+    int old_width;
+    int old_height;
+    uint8 bg_name_dirty[0x800];
+    uint16 bg_name_list[0x800];
+    uint16 bg_list_index;
+    uint8 bg_pattern_cache[0x20000];
+    uint16 obj_name_dirty[0x200];
+    uint16 obj_name_list[0x200];
+    uint16 obj_list_index;
+    uint8 obj_pattern_cache[0x80000];
+
+    /* VCE, PSG */
+    t_vce vce;
+    t_psg psg;
+
+    /* Renderer */
+    uint8 xlat[2][0x100];   /* VCE color data to 8-bit pixel */
+    uint16 pixel[2][0x100]; /* VCE color data to 16-bit pixel */
+    void (*render_line)(int line);  /* 8 or 16-bit version */
+    t_sprite sprite_list[0x40];     /* Precalculated sprite data */
+    uint8 used_sprite_list[0x40];
+    uint8 used_sprite_index;
+    int render_lazy;        /* 1= only log the display state */
+    int render_frame;       /* Frame number, counted in lazy mode */
+    t_line_state line_log[2][LOG_LINES];    /* Last two frames */
+    t_sprite_state sprite_log[LOG_SPRITES];
+    int sprite_gen;
+
+    /* Host interface */
+    t_bitmap bitmap;
+    t_input input;
+    t_snd snd;
+    char game_name[0x100];
+    t_profile *profile;     /* Cycle profile, NULL= off */
+    t_trace *trace;         /* Instruction trace, NULL= off */
+    void *user;             /* Free for the host's own use */
+} t_context;
+
+/* Context of the calling thread */
+extern __thread t_context *pce_ctx;
+
+/* Function prototypes */
+t_context *context_create(int sample_rate);
+void context_bind(t_context *ctx);
+void context_reset(t_context *ctx);
+void context_frame(t_context *ctx, int skip);
+void context_destroy(t_context *ctx);
+
+#endif /* _CONTEXT_H_ */
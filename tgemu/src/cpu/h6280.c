@@ -64,20 +64,24 @@
 
 ******************************************************************************/
 
-#include "cpuintrf.h"
-#include "h6280.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
 
-/* Default state of HuC6280 clock (1=7.16MHz, 0=3.58MHz) */
-int h6280_speed = 1;
-int h6280_ICount = 0;
-static  h6280_Regs  h6280;
+/* The registers, cycle count and halt flag (h6280_halt) live in the
+   context bound to the calling thread, see context.h */
+#include "shared.h"
 
 #include "h6280ops.h"
 #include "tblh6280.c"
 
+static int h6280_execute_table(int cycles);
+#ifdef H6280_GOTO
+static int h6280_execute_goto(int cycles);
+static int h6280_execute_goto_trace(int cycles);
+#endif
+
 /*****************************************************************************/
 
 void h6280_reset(void *param)
@@ -85,27 +89,31 @@ void h6280_reset(void *param)
 	int i;
 
 	/* wipe out the h6280 structure */
-	memset(&h6280, 0, sizeof(h6280_Regs));
+	memset(&pce_ctx->h6280, 0, sizeof(h6280_Regs));
 
 	/* set I and Z flags */
 	P = _fI | _fZ;
 
     /* stack starts at 0x01ff */
-	h6280.sp.d = 0x1ff;
+	pce_ctx->h6280.sp.d = 0x1ff;
 
     /* read the reset vector into PC */
 	PCL = RDMEM(H6280_RESET_VEC);
 	PCH = RDMEM((H6280_RESET_VEC+1));
 
 	/* timer off by default */
-	h6280.timer_status=0;
-	h6280.timer_ack=1;
+	pce_ctx->h6280.timer_status=0;
+	pce_ctx->h6280.timer_ack=1;
 
     /* clear pending interrupts */
 	for (i = 0; i < 3; i++)
-		h6280.irq_state[i] = CLEAR_LINE;
+		pce_ctx->h6280.irq_state[i] = CLEAR_LINE;
+
+    pce_ctx->h6280_speed = 1; /* default = 7.16MHz (?) */
 
-    h6280_speed = 1; /* default = 7.16MHz (?) */
+	/* clear the run state */
+	pce_ctx->h6280_halt = 0;
+	pce_ctx->h6280_cycles = 0;
 }
 
 void h6280_exit(void)
@@ -114,66 +122,92 @@ void h6280_exit(void)
 }
 
 int h6280_execute(int cycles)
+{
+#ifdef H6280_GOTO
+	if (pce_ctx->h6280_core == H6280_CORE_GOTO)
+		return pce_ctx->trace ? h6280_execute_goto_trace(cycles) :
+			h6280_execute_goto(cycles);
+#endif
+	return h6280_execute_table(cycles);
+}
+
+/* The original core, dispatching through insnh6280[] */
+static int h6280_execute_table(int cycles)
 {
 	int in,lastcycle,deltacycle;
-	h6280_ICount = cycles;
+
+	/* Stopped by the host, nothing to do */
+	if (pce_ctx->h6280_halt)
+		return 0;
+
+	pce_ctx->h6280_ICount = cycles;
 
     /* Subtract cycles used for taking an interrupt */
-    h6280_ICount -= h6280.extra_cycles;
-	h6280.extra_cycles = 0;
-	lastcycle = h6280_ICount;
+    pce_ctx->h6280_ICount -= pce_ctx->h6280.extra_cycles;
+	pce_ctx->h6280.extra_cycles = 0;
+	lastcycle = pce_ctx->h6280_ICount;
 
 	/* Execute instructions */
 	do
     {
-		h6280.ppc = h6280.pc;
+		pce_ctx->h6280.ppc = pce_ctx->h6280.pc;
 
 		/* Execute 1 instruction */
 		in=RDOP();
 		PCW++;
 		insnh6280[in]();
 
+		/* Charge it to the profile */
+		if(pce_ctx->profile)
+			profile_insn(pce_ctx->h6280.ppc.w.l, in, pce_ctx->h6280_cycles + cycles - pce_ctx->h6280_ICount);
+
+		/* Record it for a lockstep run */
+		if(pce_ctx->trace)
+			trace_insn(pce_ctx->h6280.ppc.w.l, pce_ctx->h6280_cycles + cycles - pce_ctx->h6280_ICount);
+
 		/* Check internal timer */
-		if(h6280.timer_status)
+		if(pce_ctx->h6280.timer_status)
 		{
-			deltacycle = lastcycle - h6280_ICount;
-			h6280.timer_value -= deltacycle;
-			if(h6280.timer_value<=0 && h6280.timer_ack==1)
+			deltacycle = lastcycle - pce_ctx->h6280_ICount;
+			pce_ctx->h6280.timer_value -= deltacycle;
+			if(pce_ctx->h6280.timer_value<=0 && pce_ctx->h6280.timer_ack==1)
 			{
-				h6280.timer_ack=h6280.timer_status=0;
+				pce_ctx->h6280.timer_ack=pce_ctx->h6280.timer_status=0;
 				h6280_set_irq_line(2,ASSERT_LINE);
 			}
 		}
-		lastcycle = h6280_ICount;
+		lastcycle = pce_ctx->h6280_ICount;
 
 		/* If PC has not changed we are stuck in a tight loop, may as well finish */
-		if( h6280.pc.d == h6280.ppc.d )
+		if( pce_ctx->h6280.pc.d == pce_ctx->h6280.ppc.d )
 		{
-			if (h6280_ICount > 0) h6280_ICount=0;
-			h6280.extra_cycles = 0;
+			if (pce_ctx->h6280_ICount > 0) pce_ctx->h6280_ICount=0;
+			pce_ctx->h6280.extra_cycles = 0;
+			pce_ctx->h6280_cycles += cycles;
 			return cycles;
 		}
 
-	} while (h6280_ICount > 0);
+	} while (pce_ctx->h6280_ICount > 0);
 
 	/* Subtract cycles used for taking an interrupt */
-    h6280_ICount -= h6280.extra_cycles;
-    h6280.extra_cycles = 0;
+    pce_ctx->h6280_ICount -= pce_ctx->h6280.extra_cycles;
+    pce_ctx->h6280.extra_cycles = 0;
 
-    return cycles - h6280_ICount;
+    pce_ctx->h6280_cycles += cycles - pce_ctx->h6280_ICount;
+    return cycles - pce_ctx->h6280_ICount;
 }
 
 unsigned h6280_get_context (void *dst)
 {
 	if( dst )
-		*(h6280_Regs*)dst = h6280;
+		*(h6280_Regs*)dst = pce_ctx->h6280;
 	return sizeof(h6280_Regs);
 }
 
 void h6280_set_context (void *src)
 {
 	if( src )
-		h6280 = *(h6280_Regs*)src;
+		pce_ctx->h6280 = *(h6280_Regs*)src;
 }
 
 unsigned h6280_get_pc (void)
@@ -206,13 +240,13 @@ unsigned h6280_get_reg (int regnum)
 		case H6280_A: return A;
 		case H6280_X: return X;
 		case H6280_Y: return Y;
-		case H6280_IRQ_MASK: return h6280.irq_mask;
-		case H6280_TIMER_STATE: return h6280.timer_status;
-		case H6280_NMI_STATE: return h6280.nmi_state;
-		case H6280_IRQ1_STATE: return h6280.irq_state[0];
-		case H6280_IRQ2_STATE: return h6280.irq_state[1];
-		case H6280_IRQT_STATE: return h6280.irq_state[2];
-		case REG_PREVIOUSPC: return h6280.ppc.d;
+		case H6280_IRQ_MASK: return pce_ctx->h6280.irq_mask;
+		case H6280_TIMER_STATE: return pce_ctx->h6280.timer_status;
+		case H6280_NMI_STATE: return pce_ctx->h6280.nmi_state;
+		case H6280_IRQ1_STATE: return pce_ctx->h6280.irq_state[0];
+		case H6280_IRQ2_STATE: return pce_ctx->h6280.irq_state[1];
+		case H6280_IRQT_STATE: return pce_ctx->h6280.irq_state[2];
+		case REG_PREVIOUSPC: return pce_ctx->h6280.ppc.d;
 		default:
 			if( regnum <= REG_SP_CONTENTS )
 			{
@@ -234,8 +268,8 @@ void h6280_set_reg (int regnum, unsigned val)
 		case H6280_A: A = val; break;
 		case H6280_X: X = val; break;
 		case H6280_Y: Y = val; break;
-		case H6280_IRQ_MASK: h6280.irq_mask = val; CHECK_IRQ_LINES; break;
-		case H6280_TIMER_STATE: h6280.timer_status = val; break;
+		case H6280_IRQ_MASK: pce_ctx->h6280.irq_mask = val; CHECK_IRQ_LINES; break;
+		case H6280_TIMER_STATE: pce_ctx->h6280.timer_status = val; break;
 		case H6280_NMI_STATE: h6280_set_nmi_line( val ); break;
 		case H6280_IRQ1_STATE: h6280_set_irq_line( 0, val ); break;
 		case H6280_IRQ2_STATE: h6280_set_irq_line( 1, val ); break;
@@ -257,8 +291,8 @@ void h6280_set_reg (int regnum, unsigned val)
 
 void h6280_set_nmi_line(int state)
 {
-	if (h6280.nmi_state == state) return;
-	h6280.nmi_state = state;
+	if (pce_ctx->h6280.nmi_state == state) return;
+	pce_ctx->h6280.nmi_state = state;
 	if (state != CLEAR_LINE)
     {
 		DO_INTERRUPT(H6280_NMI_VEC);
@@ -267,7 +301,7 @@ void h6280_set_nmi_line(int state)
 
 void h6280_set_irq_line(int irqline, int state)
 {
-    h6280.irq_state[irqline] = state;
+    pce_ctx->h6280.irq_state[irqline] = state;
 
 	/* If line is cleared, just exit */
 	if (state == CLEAR_LINE) return;
@@ -278,24 +312,24 @@ void h6280_set_irq_line(int irqline, int state)
 
 void h6280_set_irq_callback(int (*callback)(int irqline))
 {
-	h6280.irq_callback = callback;
+	pce_ctx->h6280.irq_callback = callback;
 }
 
 int H6280_irq_status_r (int offset)
 {
-	int status;
+	int res;
 
 	switch (offset)
 	{
 		case 0: /* Read irq mask */
-			return h6280.irq_mask;
+			return pce_ctx->h6280.irq_mask;
 
 		case 1: /* Read irq status */
-			status=0;
-			if(h6280.irq_state[1]!=CLEAR_LINE) status|=1; /* IRQ 2 */
-			if(h6280.irq_state[0]!=CLEAR_LINE) status|=2; /* IRQ 1 */
-			if(h6280.irq_state[2]!=CLEAR_LINE) status|=4; /* TIMER */
-			return status;
+			res=0;
+			if(pce_ctx->h6280.irq_state[1]!=CLEAR_LINE) res|=1; /* IRQ 2 */
+			if(pce_ctx->h6280.irq_state[0]!=CLEAR_LINE) res|=2; /* IRQ 1 */
+			if(pce_ctx->h6280.irq_state[2]!=CLEAR_LINE) res|=4; /* TIMER */
+			return res;
 	}
 
 	return 0;
@@ -306,13 +340,13 @@ void H6280_irq_status_w (int offset, int data)
 	switch (offset)
 	{
 		case 0: /* Write irq mask */
-			h6280.irq_mask=data&0x7;
+			pce_ctx->h6280.irq_mask=data&0x7;
 			CHECK_IRQ_LINES;
 			break;
 
 		case 1: /* Timer irq ack - timer is reloaded here */
-			h6280.timer_value = h6280.timer_load;
-			h6280.timer_ack=1; /* Timer can't refire until ack'd */
+			pce_ctx->h6280.timer_value = pce_ctx->h6280.timer_load;
+			pce_ctx->h6280.timer_ack=1; /* Timer can't refire until ack'd */
 			break;
 	}
 }
@@ -321,10 +355,10 @@ int H6280_timer_r (int offset)
 {
 	switch (offset) {
 		case 0: /* Counter value */
-			return (h6280.timer_value/1024)&127;
+			return (pce_ctx->h6280.timer_value/1024)&127;
 
 		case 1: /* Read counter status */
-			return h6280.timer_status;
+			return pce_ctx->h6280.timer_status;
 	}
 
 	return 0;
@@ -334,17 +368,28 @@ void H6280_timer_w (int offset, int data)
 {
 	switch (offset) {
 		case 0: /* Counter preload */
-			h6280.timer_load=h6280.timer_value=((data&127)+1)*1024;
+			pce_ctx->h6280.timer_load=pce_ctx->h6280.timer_value=((data&127)+1)*1024;
 			return;
 
 		case 1: /* Counter enable */
 			if(data&1)
 			{	/* stop -> start causes reload */
-				if(h6280.timer_status==0) h6280.timer_value=h6280.timer_load;
+				if(pce_ctx->h6280.timer_status==0) pce_ctx->h6280.timer_value=pce_ctx->h6280.timer_load;
 			}
-			h6280.timer_status=data&1;
+			pce_ctx->h6280.timer_status=data&1;
 			return;
 	}
 }
 
 /*****************************************************************************/
+
+#ifdef H6280_GOTO
+/* Redefines the memory access macros, so it comes last; built once
+   as is and once recording the trace */
+#define H6280_GOTO_NAME		h6280_execute_goto
+#define H6280_GOTO_TRACE	0
+#include "h6280goto.c"
+#define H6280_GOTO_NAME		h6280_execute_goto_trace
+#define H6280_GOTO_TRACE	1
+#include "h6280goto.c"
+#endif
@@ -21,8 +21,6 @@ enum {
 	H6280_NMI_STATE, H6280_IRQ1_STATE, H6280_IRQ2_STATE, H6280_IRQT_STATE
 };
 
-extern int h6280_speed;
-
 //#define LAZY_FLAGS  1
 
 #define H6280_INT_NONE	0
@@ -37,7 +35,20 @@ extern int h6280_speed;
 #define H6280_IRQ1_VEC	0xfff8
 #define H6280_IRQ2_VEC	0xfff6			/* Aka BRK vector */
 
-extern int h6280_ICount;				/* cycle count */
+/* The computed-goto core (h6280goto.c) needs GCC extensions and FAST_MEM */
+#if defined(H6280_GOTO) && !(defined(__GNUC__) && defined(FAST_MEM))
+#undef H6280_GOTO
+#endif
+
+/* Cores h6280_execute() can run, see h6280_core */
+#define H6280_CORE_TABLE	0			/* Function table dispatch */
+#define H6280_CORE_GOTO		1			/* Computed goto, if built in */
+
+#ifdef H6280_GOTO
+#define H6280_CORE_DEFAULT	H6280_CORE_GOTO
+#else
+#define H6280_CORE_DEFAULT	H6280_CORE_TABLE
+#endif
 
 extern void h6280_reset(void *param);			/* Reset registers to the initial values */
 extern void h6280_exit(void);					/* Shut down CPU */
@@ -53,6 +64,8 @@ extern void h6280_set_reg (int regnum, unsigned val);
 extern void h6280_set_nmi_line(int state);
 extern void h6280_set_irq_line(int irqline, int state);
 extern void h6280_set_irq_callback(int (*callback)(int irqline));
+extern int h6280_dasm(char *buf, int pc, const UINT8 *op);	/* Disassemble, return length */
+extern int h6280_dasm_length(int op);
 
 int H6280_irq_status_r(int offset);
 void H6280_irq_status_w(int offset, int data);
@@ -0,0 +1,118 @@
+/*****************************************************************************
+
+	h6280dasm.c - HuC6280 disassembler
+
+	Prints one instruction the way pceas reads it: zero page operands
+	as <$nn, branch targets resolved to absolute addresses.  Used for
+	the trace window of lockstep runs.
+
+******************************************************************************/
+
+#include <stdio.h>
+#include "shared.h"
+
+/* Addressing modes */
+enum {
+	IMP, ACC, IMM, ZPG, ZPX, ZPY, ABS, ABX, ABY, IDX, IDY, ZPI,
+	IND, IAX, REL, ZRL, TZP, TZX, TAB, TAX, XFR
+};
+
+static const char *const mnemonic[0x100] = {
+/*	 x0     x1     x2     x3     x4     x5     x6     x7     x8     x9     xA     xB     xC     xD     xE     xF */
+	"brk", "ora", "sxy", "st0", "tsb", "ora", "asl", "rmb0","php", "ora", "asl", "???", "tsb", "ora", "asl", "bbr0",	/* 0x */
+	"bpl", "ora", "ora", "st1", "trb", "ora", "asl", "rmb1","clc", "ora", "inc", "???", "trb", "ora", "asl", "bbr1",	/* 1x */
+	"jsr", "and", "sax", "st2", "bit", "and", "rol", "rmb2","plp", "and", "rol", "???", "bit", "and", "rol", "bbr2",	/* 2x */
+	"bmi", "and", "and", "???", "bit", "and", "rol", "rmb3","sec", "and", "dec", "???", "bit", "and", "rol", "bbr3",	/* 3x */
+	"rti", "eor", "say", "tma", "bsr", "eor", "lsr", "rmb4","pha", "eor", "lsr", "???", "jmp", "eor", "lsr", "bbr4",	/* 4x */
+	"bvc", "eor", "eor", "tam", "csl", "eor", "lsr", "rmb5","cli", "eor", "phy", "???", "???", "eor", "lsr", "bbr5",	/* 5x */
+	"rts", "adc", "cla", "???", "stz", "adc", "ror", "rmb6","pla", "adc", "ror", "???", "jmp", "adc", "ror", "bbr6",	/* 6x */
+	"bvs", "adc", "adc", "tii", "stz", "adc", "ror", "rmb7","sei", "adc", "ply", "???", "jmp", "adc", "ror", "bbr7",	/* 7x */
+	"bra", "sta", "clx", "tst", "sty", "sta", "stx", "smb0","dey", "bit", "txa", "???", "sty", "sta", "stx", "bbs0",	/* 8x */
+	"bcc", "sta", "sta", "tst", "sty", "sta", "stx", "smb1","tya", "sta", "txs", "???", "stz", "sta", "stz", "bbs1",	/* 9x */
+	"ldy", "lda", "ldx", "tst", "ldy", "lda", "ldx", "smb2","tay", "lda", "tax", "???", "ldy", "lda", "ldx", "bbs2",	/* Ax */
+	"bcs", "lda", "lda", "tst", "ldy", "lda", "ldx", "smb3","clv", "lda", "tsx", "???", "ldy", "lda", "ldx", "bbs3",	/* Bx */
+	"cpy", "cmp", "cly", "tdd", "cpy", "cmp", "dec", "smb4","iny", "cmp", "dex", "???", "cpy", "cmp", "dec", "bbs4",	/* Cx */
+	"bne", "cmp", "cmp", "tin", "csh", "cmp", "dec", "smb5","cld", "cmp", "phx", "???", "???", "cmp", "dec", "bbs5",	/* Dx */
+	"cpx", "sbc", "???", "tia", "cpx", "sbc", "inc", "smb6","inx", "sbc", "nop", "???", "cpx", "sbc", "inc", "bbs6",	/* Ex */
+	"beq", "sbc", "sbc", "tai", "set", "sbc", "inc", "smb7","sed", "sbc", "plx", "???", "???", "sbc", "inc", "bbs7"	/* Fx */
+};
+
+static const unsigned char mode[0x100] = {
+/*	x0   x1   x2   x3   x4   x5   x6   x7   x8   x9   xA   xB   xC   xD   xE   xF */
+	IMP, IDX, IMP, IMM, ZPG, ZPG, ZPG, ZPG, IMP, IMM, ACC, IMP, ABS, ABS, ABS, ZRL,	/* 0x */
+	REL, IDY, ZPI, IMM, ZPG, ZPX, ZPX, ZPG, IMP, ABY, ACC, IMP, ABS, ABX, ABX, ZRL,	/* 1x */
+	ABS, IDX, IMP, IMM, ZPG, ZPG, ZPG, ZPG, IMP, IMM, ACC, IMP, ABS, ABS, ABS, ZRL,	/* 2x */
+	REL, IDY, ZPI, IMP, ZPX, ZPX, ZPX, ZPG, IMP, ABY, ACC, IMP, ABX, ABX, ABX, ZRL,	/* 3x */
+	IMP, IDX, IMP, IMM, REL, ZPG, ZPG, ZPG, IMP, IMM, ACC, IMP, ABS, ABS, ABS, ZRL,	/* 4x */
+	REL, IDY, ZPI, IMM, IMP, ZPX, ZPX, ZPG, IMP, ABY, IMP, IMP, IMP, ABX, ABX, ZRL,	/* 5x */
+	IMP, IDX, IMP, IMP, ZPG, ZPG, ZPG, ZPG, IMP, IMM, ACC, IMP, IND, ABS, ABS, ZRL,	/* 6x */
+	REL, IDY, ZPI, XFR, ZPX, ZPX, ZPX, ZPG, IMP, ABY, IMP, IMP, IAX, ABX, ABX, ZRL,	/* 7x */
+	REL, IDX, IMP, TZP, ZPG, ZPG, ZPG, ZPG, IMP, IMM, IMP, IMP, ABS, ABS, ABS, ZRL,	/* 8x */
+	REL, IDY, ZPI, TAB, ZPX, ZPX, ZPY, ZPG, IMP, ABY, IMP, IMP, ABS, ABX, ABX, ZRL,	/* 9x */
+	IMM, IDX, IMM, TZX, ZPG, ZPG, ZPG, ZPG, IMP, IMM, IMP, IMP, ABS, ABS, ABS, ZRL,	/* Ax */
+	REL, IDY, ZPI, TAX, ZPX, ZPX, ZPY, ZPG, IMP, ABY, IMP, IMP, ABX, ABX, ABY, ZRL,	/* Bx */
+	IMM, IDX, IMP, XFR, ZPG, ZPG, ZPG, ZPG, IMP, IMM, IMP, IMP, ABS, ABS, ABS, ZRL,	/* Cx */
+	REL, IDY, ZPI, XFR, IMP, ZPX, ZPX, ZPG, IMP, ABY, IMP, IMP, IMP, ABX, ABX, ZRL,	/* Dx */
+	IMM, IDX, IMP, XFR, ZPG, ZPG, ZPG, ZPG, IMP, IMM, IMP, IMP, ABS, ABS, ABS, ZRL,	/* Ex */
+	REL, IDY, ZPI, XFR, IMP, ZPX, ZPX, ZPG, IMP, ABY, IMP, IMP, IMP, ABX, ABX, ZRL	/* Fx */
+};
+
+/* Length of the instruction that starts with opcode <op> */
+int h6280_dasm_length(int op)
+{
+	switch (mode[op])
+	{
+		case IMP: case ACC:
+			return 1;
+		case ABS: case ABX: case ABY: case IND: case IAX: case ZRL: case TZP: case TZX:
+			return 3;
+		case TAB: case TAX:
+			return 4;
+		case XFR:
+			return 7;
+		default:
+			return 2;
+	}
+}
+
+/* Write the instruction at <pc>, bytes <op>, into <buf> and return its
+   length */
+int h6280_dasm(char *buf, int pc, const UINT8 *op)
+{
+	const char *m = mnemonic[op[0]];
+	int w = op[1] | (op[2] << 8);
+	int len = h6280_dasm_length(op[0]);
+
+	switch (mode[op[0]])
+	{
+		case IMP: sprintf(buf, "%s", m); break;
+		case ACC: sprintf(buf, "%s a", m); break;
+		case IMM: sprintf(buf, "%s #$%02X", m, op[1]); break;
+		case ZPG: sprintf(buf, "%s <$%02X", m, op[1]); break;
+		case ZPX: sprintf(buf, "%s <$%02X,x", m, op[1]); break;
+		case ZPY: sprintf(buf, "%s <$%02X,y", m, op[1]); break;
+		case ABS: sprintf(buf, "%s $%04X", m, w); break;
+		case ABX: sprintf(buf, "%s $%04X,x", m, w); break;
+		case ABY: sprintf(buf, "%s $%04X,y", m, w); break;
+		case IDX: sprintf(buf, "%s [$%02X,x]", m, op[1]); break;
+		case IDY: sprintf(buf, "%s [$%02X],y", m, op[1]); break;
+		case ZPI: sprintf(buf, "%s [$%02X]", m, op[1]); break;
+		case IND: sprintf(buf, "%s [$%04X]", m, w); break;
+		case IAX: sprintf(buf, "%s [$%04X,x]", m, w); break;
+		case REL:
+			sprintf(buf, "%s $%04X", m, (pc + 2 + (signed char)op[1]) & 0xFFFF);
+			break;
+		case ZRL:
+			sprintf(buf, "%s <$%02X,$%04X", m, op[1], (pc + 3 + (signed char)op[2]) & 0xFFFF);
+			break;
+		case TZP: sprintf(buf, "%s #$%02X,<$%02X", m, op[1], op[2]); break;
+		case TZX: sprintf(buf, "%s #$%02X,<$%02X,x", m, op[1], op[2]); break;
+		case TAB: sprintf(buf, "%s #$%02X,$%04X", m, op[1], op[2] | (op[3] << 8)); break;
+		case TAX: sprintf(buf, "%s #$%02X,$%04X,x", m, op[1], op[2] | (op[3] << 8)); break;
+		case XFR:
+			sprintf(buf, "%s $%04X,$%04X,$%04X", m, w,
+				op[3] | (op[4] << 8), op[5] | (op[6] << 8));
+			break;
+	}
+	return (len);
+}
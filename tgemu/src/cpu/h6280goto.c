@@ -0,0 +1,168 @@
+/*****************************************************************************
+
+	h6280goto.c - HuC6280 core with computed-goto dispatch
+
+	The opcode bodies of tblh6280.c are included a second time as labels
+	of a single function, and every instruction jumps straight to the
+	next one through a table of label addresses (a GCC extension, also
+	supported by clang).  Build with -DH6280_GOTO (make CPU_CORE=goto).
+
+	The table core in h6280.c looks at the timer, the profiler, the trace
+	and the stuck-PC test after every instruction.  Here they only run when an
+	event is due: the cycle count reaching the point where the timer
+	fires or the time slice ends, an access to the I/O page (which may
+	read or reprogram the timer), or the PC not moving.  The timer is
+	counted down lazily from the cycle count of its last update, which
+	gives the same values at every point they can be seen, so both cores
+	run a program identically; tgemu -l checks this.
+
+	h6280.c builds this file twice, naming the function H6280_GOTO_NAME.
+	With H6280_GOTO_TRACE set, every instruction is recorded on its way
+	to the next one rather than as an event, so a lockstep run goes
+	through the same paths as any other.
+
+******************************************************************************/
+
+/* Memory accesses reach the I/O page only through these: bring the
+   timer up to the start of the instruction, as the table core has it,
+   and look at it again once the instruction is done */
+#define IO_SYNC 												\
+	if(pce_ctx->h6280.timer_status)								\
+		pce_ctx->h6280.timer_value -= lastcycle - start;		\
+	lastcycle = start;											\
+	stop = INT_MAX
+
+#undef RDMEM
+#undef WRMEM
+#undef RDMEMW
+
+#define RDMEM(addr) 											\
+	(pce_ctx->read_ptr[(addr) >> 13] ? pce_ctx->read_ptr[(addr) >> 13][(addr) & 0x1FFF] : \
+		({ IO_SYNC; io_page_r((addr) & 0x1FFF); }))
+
+#define WRMEM(addr,data)										\
+	if(pce_ctx->write_ptr[(addr) >> 13])						\
+		pce_ctx->write_ptr[(addr) >> 13][(addr) & 0x1FFF] = data;	\
+	else { IO_SYNC; io_page_w((addr) & 0x1FFF, data); }
+
+#define RDMEMW(addr)											\
+	(RDMEM(addr) | (RDMEM((addr) + 1) << 8))
+
+/* Start the next instruction */
+#define FETCH													\
+	pce_ctx->h6280.ppc = pce_ctx->h6280.pc;						\
+	start = pce_ctx->h6280_ICount;								\
+	in = RDOP();												\
+	PCW++;														\
+	goto *label[in]
+
+/* End of an instruction: record it for a lockstep run, handle the
+   events that are due */
+#define NEXT													\
+	if(H6280_GOTO_TRACE)										\
+		trace_insn(pce_ctx->h6280.ppc.w.l,						\
+			pce_ctx->h6280_cycles + cycles - pce_ctx->h6280_ICount);	\
+	if(pce_ctx->h6280_ICount <= stop || pce_ctx->h6280.pc.d == pce_ctx->h6280.ppc.d)	\
+		goto event; 											\
+	FETCH
+
+/* Cycle count at which the event code must run next */
+#define NEXT_STOP												\
+	if(pce_ctx->profile)										\
+		stop = INT_MAX; 										\
+	else if(pce_ctx->h6280.timer_status && pce_ctx->h6280.timer_ack == 1)	\
+		stop = lastcycle - pce_ctx->h6280.timer_value > 0 ?		\
+			lastcycle - pce_ctx->h6280.timer_value : 0;			\
+	else														\
+		stop = 0
+
+#define LABELS(h)												\
+	&&h6280_0##h##0, &&h6280_0##h##1, &&h6280_0##h##2, &&h6280_0##h##3, \
+	&&h6280_0##h##4, &&h6280_0##h##5, &&h6280_0##h##6, &&h6280_0##h##7, \
+	&&h6280_0##h##8, &&h6280_0##h##9, &&h6280_0##h##a, &&h6280_0##h##b, \
+	&&h6280_0##h##c, &&h6280_0##h##d, &&h6280_0##h##e, &&h6280_0##h##f
+
+static int H6280_GOTO_NAME(int cycles)
+{
+	static const void *const label[0x100] = {
+		LABELS(0), LABELS(1), LABELS(2), LABELS(3),
+		LABELS(4), LABELS(5), LABELS(6), LABELS(7),
+		LABELS(8), LABELS(9), LABELS(a), LABELS(b),
+		LABELS(c), LABELS(d), LABELS(e), LABELS(f)
+	};
+	t_context *ctx = pce_ctx;
+	int in = 0, lastcycle, start, stop;
+
+	/* Stopped by the host, nothing to do */
+	if (pce_ctx->h6280_halt)
+		return 0;
+
+	{
+	/* Keep the context in a register rather than reloading the
+	   thread-local pointer after every call */
+	t_context *const pce_ctx = ctx;
+
+	pce_ctx->h6280_ICount = cycles;
+
+	/* Subtract cycles used for taking an interrupt */
+	pce_ctx->h6280_ICount -= pce_ctx->h6280.extra_cycles;
+	pce_ctx->h6280.extra_cycles = 0;
+	lastcycle = start = pce_ctx->h6280_ICount;
+	NEXT_STOP;
+
+	FETCH;
+
+#define H6280_OP_LABELS
+#undef	OP
+#define OP(nnn) NEXT; h6280_##nnn:
+#include "tblh6280.c"
+#undef	H6280_OP_LABELS
+	NEXT;
+
+event:
+	/* Charge it to the profile */
+	if(pce_ctx->profile)
+		profile_insn(pce_ctx->h6280.ppc.w.l, in, pce_ctx->h6280_cycles + cycles - pce_ctx->h6280_ICount);
+
+	/* Check internal timer */
+	if(pce_ctx->h6280.timer_status)
+	{
+		pce_ctx->h6280.timer_value -= lastcycle - pce_ctx->h6280_ICount;
+		if(pce_ctx->h6280.timer_value<=0 && pce_ctx->h6280.timer_ack==1)
+		{
+			pce_ctx->h6280.timer_ack=pce_ctx->h6280.timer_status=0;
+			h6280_set_irq_line(2,ASSERT_LINE);
+		}
+	}
+	lastcycle = pce_ctx->h6280_ICount;
+
+	/* If PC has not changed we are stuck in a tight loop, may as well finish */
+	if( pce_ctx->h6280.pc.d == pce_ctx->h6280.ppc.d )
+	{
+		if (pce_ctx->h6280_ICount > 0) pce_ctx->h6280_ICount=0;
+		pce_ctx->h6280.extra_cycles = 0;
+		pce_ctx->h6280_cycles += cycles;
+		return cycles;
+	}
+
+	if (pce_ctx->h6280_ICount > 0)
+	{
+		NEXT_STOP;
+		FETCH;
+	}
+
+	/* Subtract cycles used for taking an interrupt */
+	pce_ctx->h6280_ICount -= pce_ctx->h6280.extra_cycles;
+	pce_ctx->h6280.extra_cycles = 0;
+
+	pce_ctx->h6280_cycles += cycles - pce_ctx->h6280_ICount;
+	return cycles - pce_ctx->h6280_ICount;
+	}
+}
+
+#undef H6280_GOTO_NAME
+#undef H6280_GOTO_TRACE
+#undef LABELS
+#undef NEXT_STOP
+#undef NEXT
+#undef FETCH
@@ -22,15 +22,15 @@
 #define _fN 0x80
 
 /* some shortcuts for improved readability */
-#define A	h6280.a
-#define X	h6280.x
-#define Y	h6280.y
-#define P	h6280.p
-#define S	h6280.sp.b.l
+#define A	pce_ctx->h6280.a
+#define X	pce_ctx->h6280.x
+#define Y	pce_ctx->h6280.y
+#define P	pce_ctx->h6280.p
+#define S	pce_ctx->h6280.sp.b.l
 
 #if LAZY_FLAGS
 
-#define NZ	h6280.NZ
+#define NZ	pce_ctx->h6280.NZ
 #define SET_NZ(n)				\
 	P &= ~_fT;					\
     NZ = ((n & _fN) << 8) | n
@@ -44,24 +44,24 @@
 
 #endif
 
-#define EAL h6280.ea.b.l
-#define EAH h6280.ea.b.h
-#define EAW h6280.ea.w.l
-#define EAD h6280.ea.d
+#define EAL pce_ctx->h6280.ea.b.l
+#define EAH pce_ctx->h6280.ea.b.h
+#define EAW pce_ctx->h6280.ea.w.l
+#define EAD pce_ctx->h6280.ea.d
 
-#define ZPL h6280.zp.b.l
-#define ZPH h6280.zp.b.h
-#define ZPW h6280.zp.w.l
-#define ZPD h6280.zp.d
+#define ZPL pce_ctx->h6280.zp.b.l
+#define ZPH pce_ctx->h6280.zp.b.h
+#define ZPW pce_ctx->h6280.zp.w.l
+#define ZPD pce_ctx->h6280.zp.d
 
-#define PCL h6280.pc.b.l
-#define PCH h6280.pc.b.h
-#define PCW h6280.pc.w.l
-#define PCD h6280.pc.d
+#define PCL pce_ctx->h6280.pc.b.l
+#define PCH pce_ctx->h6280.pc.b.h
+#define PCW pce_ctx->h6280.pc.w.l
+#define PCD pce_ctx->h6280.pc.d
 
 #define DO_INTERRUPT(vector)									\
 {																\
-	h6280.extra_cycles += 7;	/* 7 cycles for an int */		\
+	pce_ctx->h6280.extra_cycles += 7;	/* 7 cycles for an int */	\
 	PUSH(PCH);													\
 	PUSH(PCL);													\
 	COMPOSE_P(0,_fB);											\
@@ -74,24 +74,24 @@
 #define CHECK_IRQ_LINES 										\
 	if( !(P & _fI) )											\
 	{															\
-		if ( h6280.irq_state[0] != CLEAR_LINE &&				\
-			 !(h6280.irq_mask & 0x2) )							\
+		if ( pce_ctx->h6280.irq_state[0] != CLEAR_LINE &&		\
+			 !(pce_ctx->h6280.irq_mask & 0x2) )					\
 		{														\
 			DO_INTERRUPT(H6280_IRQ1_VEC);						\
-			(*h6280.irq_callback)(0);							\
+			(*pce_ctx->h6280.irq_callback)(0);					\
 		}														\
 		else													\
-		if ( h6280.irq_state[1] != CLEAR_LINE &&				\
-			 !(h6280.irq_mask & 0x1) )							\
+		if ( pce_ctx->h6280.irq_state[1] != CLEAR_LINE &&		\
+			 !(pce_ctx->h6280.irq_mask & 0x1) )					\
 		{														\
 			DO_INTERRUPT(H6280_IRQ2_VEC);						\
-			(*h6280.irq_callback)(1);							\
+			(*pce_ctx->h6280.irq_callback)(1);					\
         }                                                       \
 		else													\
-        if ( h6280.irq_state[2] != CLEAR_LINE &&                \
-			 !(h6280.irq_mask & 0x4) )							\
+        if ( pce_ctx->h6280.irq_state[2] != CLEAR_LINE &&       \
+			 !(pce_ctx->h6280.irq_mask & 0x4) )					\
 		{														\
-			h6280.irq_state[2] = CLEAR_LINE;					\
+			pce_ctx->h6280.irq_state[2] = CLEAR_LINE;			\
  			DO_INTERRUPT(H6280_TIMER_VEC);						\
        }                                                       	\
     }
@@ -102,27 +102,24 @@
    something other than RAM to MMR #1, and fetches opcodes/operands
    out of the I/O space. */
 
-extern unsigned char ram[0x8000];
-extern unsigned char *read_ptr[8];
-extern unsigned char *write_ptr[8];
 extern void io_page_w(int address, int value);
 extern int io_page_r(int address);
 
-#define cpu_readop21_fast(addr)         read_ptr[(addr) >> 13][(addr) & 0x1FFF]
-#define cpu_readmem21_fast(addr)        (read_ptr[(addr) >> 13] == 0) ? io_page_r((addr) & 0x1FFF) : read_ptr[(addr) >> 13][(addr) & 0x1FFF]
-#define cpu_writemem21_fast(addr,value) if(write_ptr[(addr) >> 13] == 0) io_page_w((addr) & 0x1FFF, value); else (write_ptr[(addr) >> 13][(addr) & 0x1FFF] = value)
+#define cpu_readop21_fast(addr)         pce_ctx->read_ptr[(addr) >> 13][(addr) & 0x1FFF]
+#define cpu_readmem21_fast(addr)        (pce_ctx->read_ptr[(addr) >> 13] == 0) ? io_page_r((addr) & 0x1FFF) : pce_ctx->read_ptr[(addr) >> 13][(addr) & 0x1FFF]
+#define cpu_writemem21_fast(addr,value) if(pce_ctx->write_ptr[(addr) >> 13] == 0) io_page_w((addr) & 0x1FFF, value); else (pce_ctx->write_ptr[(addr) >> 13][(addr) & 0x1FFF] = value)
 
-#define RDMEMZ(addr)        ram[addr & 0x1FFF];
-#define WRMEMZ(addr,data)   ram[addr & 0x1FFF] = data;
-#define PUSH(Rg)            ram[h6280.sp.d] = Rg; S--
-#define PULL(Rg)            S++; Rg = ram[h6280.sp.d]
+#define RDMEMZ(addr)        pce_ctx->ram[addr & 0x1FFF];
+#define WRMEMZ(addr,data)   pce_ctx->ram[addr & 0x1FFF] = data;
+#define PUSH(Rg)            pce_ctx->ram[pce_ctx->h6280.sp.d] = Rg; S--
+#define PULL(Rg)            S++; Rg = pce_ctx->ram[pce_ctx->h6280.sp.d]
 
 #define RDZPWORD(addr)                              \
     ((addr&0xff)==0xff) ?                           \
-        ram[(addr)&0x1fff]                          \
-        +( ram[ ((addr-0xff)&0x1fff) ]    <<8) :    \
-        ram[(addr)&0x1fff]                          \
-        +( ram[ ((addr+1)&0x1fff)] <<8)
+        pce_ctx->ram[(addr)&0x1fff]                 \
+        +( pce_ctx->ram[ ((addr-0xff)&0x1fff) ]    <<8) : \
+        pce_ctx->ram[(addr)&0x1fff]                 \
+        +( pce_ctx->ram[ ((addr+1)&0x1fff)] <<8)
 
 #define RDOP()													\
     cpu_readop21_fast(PCW)
@@ -146,64 +143,64 @@ extern int io_page_r(int address);
  *  RDMEM   read memory
  ***************************************************************/
 #define RDMEM(addr) 											\
-	cpu_readmem21( (h6280.mmr[(addr)>>13] << 13) | ((addr)&0x1fff))
+	cpu_readmem21( (pce_ctx->h6280.mmr[(addr)>>13] << 13) | ((addr)&0x1fff))
 
 /***************************************************************
  *  WRMEM   write memory
  ***************************************************************/
 #define WRMEM(addr,data)										\
-	cpu_writemem21( (h6280.mmr[(addr)>>13] << 13) | ((addr)&0x1fff),data);
+	cpu_writemem21( (pce_ctx->h6280.mmr[(addr)>>13] << 13) | ((addr)&0x1fff),data);
 
 /***************************************************************
  *  RDMEMW   read word from memory
  ***************************************************************/
 #define RDMEMW(addr)											\
-    cpu_readmem21( (h6280.mmr[(addr)  >>13] << 13) | ((addr  )&0x1fff)) \
-| ( cpu_readmem21( (h6280.mmr[(addr+1)>>13] << 13) | ((addr+1)&0x1fff)) << 8 )
+    cpu_readmem21( (pce_ctx->h6280.mmr[(addr)  >>13] << 13) | ((addr  )&0x1fff)) \
+| ( cpu_readmem21( (pce_ctx->h6280.mmr[(addr+1)>>13] << 13) | ((addr+1)&0x1fff)) << 8 )
 
 /***************************************************************
  *  RDMEMZ   read memory - zero page
  ***************************************************************/
 #define RDMEMZ(addr) 											\
-    cpu_readmem21( (h6280.mmr[1] << 13) | ((addr)&0x1fff));
+    cpu_readmem21( (pce_ctx->h6280.mmr[1] << 13) | ((addr)&0x1fff));
 
 /***************************************************************
  *  WRMEMZ   write memory - zero page
  ***************************************************************/
 #define WRMEMZ(addr,data) 										\
-    cpu_writemem21( (h6280.mmr[1] << 13) | ((addr)&0x1fff),data);
+    cpu_writemem21( (pce_ctx->h6280.mmr[1] << 13) | ((addr)&0x1fff),data);
 
 /***************************************************************
  *  RDZPWORD    read a word from a zero page address
  ***************************************************************/
 #define RDZPWORD(addr)											\
 	((addr&0xff)==0xff) ?										\
-		cpu_readmem21( (h6280.mmr[1] << 13) | ((addr)&0x1fff))				\
-		+(cpu_readmem21( (h6280.mmr[1] << 13) | ((addr-0xff)&0x1fff))<<8) : \
-		cpu_readmem21( (h6280.mmr[1] << 13) | ((addr)&0x1fff))				\
-		+(cpu_readmem21( (h6280.mmr[1] << 13) | ((addr+1)&0x1fff))<<8)
+		cpu_readmem21( (pce_ctx->h6280.mmr[1] << 13) | ((addr)&0x1fff))		\
+		+(cpu_readmem21( (pce_ctx->h6280.mmr[1] << 13) | ((addr-0xff)&0x1fff))<<8) : \
+		cpu_readmem21( (pce_ctx->h6280.mmr[1] << 13) | ((addr)&0x1fff))		\
+		+(cpu_readmem21( (pce_ctx->h6280.mmr[1] << 13) | ((addr+1)&0x1fff))<<8)
 
 /***************************************************************
  * push a register onto the stack
  ***************************************************************/
-#define PUSH(Rg) cpu_writemem21( (h6280.mmr[1] << 13) | h6280.sp.d,Rg); S--
+#define PUSH(Rg) cpu_writemem21( (pce_ctx->h6280.mmr[1] << 13) | pce_ctx->h6280.sp.d,Rg); S--
 
 /***************************************************************
  * pull a register from the stack
  ***************************************************************/
-#define PULL(Rg) S++; Rg = cpu_readmem21( (h6280.mmr[1] << 13) | h6280.sp.d)
+#define PULL(Rg) S++; Rg = cpu_readmem21( (pce_ctx->h6280.mmr[1] << 13) | pce_ctx->h6280.sp.d)
 
 /***************************************************************
  *  RDOP    read an opcode
  ***************************************************************/
 #define RDOP()													\
-    cpu_readmem21((h6280.mmr[PCW>>13] << 13) | (PCW&0x1fff))
+    cpu_readmem21((pce_ctx->h6280.mmr[PCW>>13] << 13) | (PCW&0x1fff))
 
 /***************************************************************
  *  RDOPARG read an opcode argument
  ***************************************************************/
 #define RDOPARG()												\
-    cpu_readmem21((h6280.mmr[PCW>>13] << 13) | (PCW&0x1fff))
+    cpu_readmem21((pce_ctx->h6280.mmr[PCW>>13] << 13) | (PCW&0x1fff))
 
 #endif /* FAST_MEM */
 
@@ -213,7 +210,7 @@ extern int io_page_r(int address);
 #define BRA(cond)												\
 	if (cond)													\
 	{															\
-		h6280_ICount -= 4;										\
+		pce_ctx->h6280_ICount -= 4;								\
 		tmp = RDOPARG();										\
 		PCW++;													\
 		EAW = PCW + (signed char)tmp;							\
@@ -222,7 +219,7 @@ extern int io_page_r(int address);
 	else														\
 	{															\
 		PCW++;													\
-		h6280_ICount -= 2;										\
+		pce_ctx->h6280_ICount -= 2;								\
 	}
 
 /***************************************************************
@@ -518,7 +515,7 @@ extern int io_page_r(int address);
 #define BSR 													\
 	PUSH(PCH);													\
 	PUSH(PCL);													\
-	h6280_ICount -= 4; /* 4 cycles here, 4 in BRA */			\
+	pce_ctx->h6280_ICount -= 4; /* 4 cycles here, 4 in BRA */	\
 	BRA(1)
 
 /* 6280 ********************************************************
@@ -644,7 +641,7 @@ extern int io_page_r(int address);
  *	ILL Illegal opcode
  ***************************************************************/
 #define ILL 													\
-    h6280_ICount -= 2; /* (assumed) */                          
+    pce_ctx->h6280_ICount -= 2; /* (assumed) */                          
 
 /* 6280 ********************************************************
  *  INA Increment accumulator
@@ -986,7 +983,7 @@ extern int io_page_r(int address);
                                                                 \
         SET_NZ(acc);        /* Update flags */                  \
         WRMEMZ(X, acc);     /* Write result back */             \
-        h6280_ICount -= 6;  /* Unsure of actual cycles used */  \
+        pce_ctx->h6280_ICount -= 6;  /* Unsure of actual cycles used */ \
     }                                                           \
     P &= ~_fT;                                                  \
 }                                                               
@@ -998,13 +995,13 @@ extern int io_page_r(int address);
  *  CSL Clock select low
  ***************************************************************/
 #define CSL             \
-    h6280_speed = 0
+    pce_ctx->h6280_speed = 0
 
 /* 6280 ********************************************************
  *  CSL Clock select high
  ***************************************************************/
 #define CSH             \
-    h6280_speed = 1    
+    pce_ctx->h6280_speed = 1    
 
 /* 6280 ********************************************************
  *  SMB Set memory bit
@@ -1088,7 +1085,7 @@ extern void vdc_w(int address, int data);
 		to++; 													\
 		alternate ^= 1; 										\
 	}		 													\
-	h6280_ICount-=(6 * length) + 17;
+	pce_ctx->h6280_ICount-=(6 * length) + 17;
 
 /* H6280 *******************************************************
  *  TAM Transfer accumulator to memory mapper register(s)
@@ -1104,7 +1101,7 @@ extern void bank_set(int bank, int value);
         {                                                       \
             if(tmp & (1 << shift))                              \
             {                                                   \
-                h6280.mmr[shift] = A;                           \
+                pce_ctx->h6280.mmr[shift] = A;                  \
                 bank_set(shift, A);                             \
             }                                                   \
             if(tmp & (1 << shift)) break;                       \
@@ -1114,14 +1111,14 @@ extern void bank_set(int bank, int value);
 #else
 
 #define TAM                                                     \
-    if (tmp&0x01) h6280.mmr[0] = A;                             \
-    if (tmp&0x02) h6280.mmr[1] = A;                             \
-    if (tmp&0x04) h6280.mmr[2] = A;                             \
-    if (tmp&0x08) h6280.mmr[3] = A;                             \
-    if (tmp&0x10) h6280.mmr[4] = A;                             \
-    if (tmp&0x20) h6280.mmr[5] = A;                             \
-    if (tmp&0x40) h6280.mmr[6] = A;                             \
-    if (tmp&0x80) h6280.mmr[7] = A
+    if (tmp&0x01) pce_ctx->h6280.mmr[0] = A;                    \
+    if (tmp&0x02) pce_ctx->h6280.mmr[1] = A;                    \
+    if (tmp&0x04) pce_ctx->h6280.mmr[2] = A;                    \
+    if (tmp&0x08) pce_ctx->h6280.mmr[3] = A;                    \
+    if (tmp&0x10) pce_ctx->h6280.mmr[4] = A;                    \
+    if (tmp&0x20) pce_ctx->h6280.mmr[5] = A;                    \
+    if (tmp&0x40) pce_ctx->h6280.mmr[6] = A;                    \
+    if (tmp&0x80) pce_ctx->h6280.mmr[7] = A
 
 #endif /* FAST_MEM */
 
@@ -1152,7 +1149,7 @@ extern void bank_set(int bank, int value);
 		to--; 													\
 		from--;													\
 	}		 													\
-	h6280_ICount-=(6 * length) + 17;
+	pce_ctx->h6280_ICount-=(6 * length) + 17;
 
 /* 6280 ********************************************************
  *  TIA
@@ -1168,7 +1165,7 @@ extern void bank_set(int bank, int value);
 		from++; 												\
 		alternate ^= 1; 										\
 	}		 													\
-	h6280_ICount-=(6 * length) + 17;
+	pce_ctx->h6280_ICount-=(6 * length) + 17;
 
 /* 6280 ********************************************************
  *  TII
@@ -1183,7 +1180,7 @@ extern void bank_set(int bank, int value);
 		to++; 													\
 		from++;													\
 	}		 													\
-	h6280_ICount-=(6 * length) + 17;
+	pce_ctx->h6280_ICount-=(6 * length) + 17;
 
 /* 6280 ********************************************************
  *  TIN Transfer block, source increments every loop
@@ -1197,28 +1194,28 @@ extern void bank_set(int bank, int value);
 		WRMEM(to,RDMEM(from)); 									\
 		from++;													\
 	}		 													\
-	h6280_ICount-=(6 * length) + 17;
+	pce_ctx->h6280_ICount-=(6 * length) + 17;
 
 /* 6280 ********************************************************
  *  TMA Transfer memory mapper register(s) to accumulator
  *  the highest bit set in tmp is the one that counts
  ***************************************************************/
 #define TMA                                                     \
-    if (tmp&0x01) A = h6280.mmr[0];                             \
+    if (tmp&0x01) A = pce_ctx->h6280.mmr[0];                    \
     else                                                        \
-    if (tmp&0x02) A = h6280.mmr[1];                             \
+    if (tmp&0x02) A = pce_ctx->h6280.mmr[1];                    \
     else                                                        \
-    if (tmp&0x04) A = h6280.mmr[2];                             \
+    if (tmp&0x04) A = pce_ctx->h6280.mmr[2];                    \
     else                                                        \
-    if (tmp&0x08) A = h6280.mmr[3];                             \
+    if (tmp&0x08) A = pce_ctx->h6280.mmr[3];                    \
     else                                                        \
-    if (tmp&0x10) A = h6280.mmr[4];                             \
+    if (tmp&0x10) A = pce_ctx->h6280.mmr[4];                    \
     else                                                        \
-    if (tmp&0x20) A = h6280.mmr[5];                             \
+    if (tmp&0x20) A = pce_ctx->h6280.mmr[5];                    \
     else                                                        \
-    if (tmp&0x40) A = h6280.mmr[6];                             \
+    if (tmp&0x40) A = pce_ctx->h6280.mmr[6];                    \
     else                                                        \
-    if (tmp&0x80) A = h6280.mmr[7]
+    if (tmp&0x80) A = pce_ctx->h6280.mmr[7]
 
 /* 6280 ********************************************************
  * TRB  Test and reset bits
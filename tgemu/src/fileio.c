@@ -6,7 +6,6 @@
 #include <sys/stat.h>
 
 /* Name of the loaded file */
-char game_name[0x100];
 
 /* split : 1= Split image (only needed for 512k versions of 384k images)
    flip  : 1= Bit-flip image (only for some TurboGrafx-16 images) */
@@ -19,7 +18,7 @@ int load_rom(char *filename, int split, int flip)
     int size, n;
 
     /* Default */
-    strcpy(game_name, filename);
+    strcpy(pce_ctx->game_name, filename);
 
 #if 0
     if(check_zip(filename))
@@ -40,7 +39,7 @@ int load_rom(char *filename, int split, int flip)
         }
 
         /* Get information on the file */
-        ret = unzGetCurrentFileInfo(fd, &info, game_name, 0x100, NULL, 0, NULL, 0);
+        ret = unzGetCurrentFileInfo(fd, &info, pce_ctx->game_name, 0x100, NULL, 0, NULL, 0);
         if(ret != UNZ_OK) {
             unzClose(fd);
             return (0);
@@ -167,21 +166,24 @@ int load_rom(char *filename, int split, int flip)
         }
     }
 
+    /* Clear what a previous image left behind */
+    memset(pce_ctx->rom, 0, sizeof(pce_ctx->rom));
+
     /* Always split 384K images */
     if(size == 0x60000)
     {
-        memcpy(rom + 0x00000, buf + 0x00000, 0x40000);
-        memcpy(rom + 0x80000, buf + 0x40000, 0x20000);
+        memcpy(pce_ctx->rom + 0x00000, buf + 0x00000, 0x40000);
+        memcpy(pce_ctx->rom + 0x80000, buf + 0x40000, 0x20000);
     }
     else /* Split 512K images if requested */
     if(split && (size == 0x80000))
     {
-        memcpy(rom + 0x00000, buf + 0x00000, 0x40000);
-        memcpy(rom + 0x80000, buf + 0x40000, 0x40000);
+        memcpy(pce_ctx->rom + 0x00000, buf + 0x00000, 0x40000);
+        memcpy(pce_ctx->rom + 0x80000, buf + 0x40000, 0x40000);
     }
     else
     {
-        memcpy(rom, buf, (size > 0x100000) ? 0x100000 : size);
+        memcpy(pce_ctx->rom, buf, (size > 0x100000) ? 0x100000 : size);
     }
 
     /* Free allocated memory and exit */
@@ -189,7 +191,7 @@ int load_rom(char *filename, int split, int flip)
 
 #ifdef DOS
     /* I need Allegro to handle this... */
-    strcpy(game_name, get_filename(game_name));
+    strcpy(pce_ctx->game_name, get_filename(pce_ctx->game_name));
 #endif
 
     return (1);
@@ -2,9 +2,6 @@
 #ifndef _FILEIO_H_
 #define _FILEIO_H_
 
-/* Global data */
-extern char game_name[0x100];
-
 /* Function prototypes */
 int load_rom(char *filename, int split, int flip);
 int file_exist(char *filename);
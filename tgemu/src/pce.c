@@ -1,23 +1,6 @@
 
 #include "shared.h"
 
-/* System memory */
-uint8 ram[0x8000];      /* Work RAM */
-uint8 cdram[0x10000];   /* CD unit RAM (64k) */
-uint8 bram[0x2000];     /* Backup RAM (8K) */
-uint8 rom[0x100000];    /* HuCard ROM (1MB) */
-uint8 save_bram;        /* 1= BRAM registers were accessed */
-#ifdef FAST_MEM
-uint8 dummy[0x2000];    /* Dummy block for unknown access */
-uint8 *read_ptr[8];     /* Memory read pointers */
-uint8 *write_ptr[8];    /* Memory write pointers */
-#endif
-
-/* I/O port data */
-uint8 joy_sel = 0;
-uint8 joy_clr = 0;
-uint8 joy_cnt = 0;
-
 
 /*--------------------------------------------------------------------------*/
 /* Init, reset, shutdown functions                                          */
@@ -35,21 +18,23 @@ int pce_init(void)
 
 void pce_reset(void)
 {
-    joy_sel = joy_clr = joy_cnt = 0;
-    memset(ram, 0, 0x8000);
-    memset(cdram, 0, 0x10000);
+    pce_ctx->joy_sel = pce_ctx->joy_clr = pce_ctx->joy_cnt = 0;
+    memset(pce_ctx->ram, 0, 0x8000);
+    memset(pce_ctx->cdram, 0, 0x10000);
 #ifdef FAST_MEM
-    memset(dummy, 0, 0x2000);
+    memset(pce_ctx->dummy, 0, 0x2000);
     bank_reset();
 #endif
-    load_file("pce.brm", bram, 0x2000);
+    memset(pce_ctx->bram, 0, 0x2000);
+    pce_ctx->save_bram = 0;
+    load_file("pce.brm", pce_ctx->bram, 0x2000);
     h6280_reset(0);
     h6280_set_irq_callback(&pce_irq_callback);
 }
 
 void pce_shutdown(void)
 {
-    if(save_bram) save_file("pce.brm", bram, 0x2000);
+    if(pce_ctx->save_bram) save_file("pce.brm", pce_ctx->bram, 0x2000);
 #ifdef DEBUG
     error("PC:%04X\n", h6280_get_pc());
 #endif    
@@ -72,7 +57,7 @@ void cpu_writemem21(int address, int data)
 
     /* RAM (F8) */
     if(page == 0xF8 || page == 0xF9 || page == 0xFA || page == 0xFB) {
-        ram[(address & 0x7FFF)] = data;
+        pce_ctx->ram[(address & 0x7FFF)] = data;
         return;
     }
 
@@ -84,13 +69,13 @@ void cpu_writemem21(int address, int data)
 
     /* CD RAM */
     if((page >= 0x80) && (page <= 0x87)) {
-        cdram[(address & 0xFFFF)] = data;
+        pce_ctx->cdram[(address & 0xFFFF)] = data;
         return;
     }
 
     /* Backup RAM (F7) */
     if(page == 0xF7) {
-        bram[(address & 0x1FFF)] = data;
+        pce_ctx->bram[(address & 0x1FFF)] = data;
         return;
     }
 
@@ -103,24 +88,24 @@ int cpu_readmem21(int address)
 {
     uint8 page;
 
-    if(address <= 0x0FFFFF) return (rom[(address)]);
+    if(address <= 0x0FFFFF) return (pce_ctx->rom[(address)]);
 
     page = (address >> 13) & 0xFF;
 
     /* ROM (00-7F) */
-    if(page <= 0x7F) return (rom[(address)]);
+    if(page <= 0x7F) return (pce_ctx->rom[(address)]);
 
     /* RAM (F8) */
-    if(page == 0xF8 || page == 0xF9 || page == 0xFA || page == 0xFB) return (ram[(address & 0x7FFF)]);
+    if(page == 0xF8 || page == 0xF9 || page == 0xFA || page == 0xFB) return (pce_ctx->ram[(address & 0x7FFF)]);
 
     /* I/O (FF) */
     if(page == 0xFF) return (io_page_r(address & 0x1FFF));
 
     /* CD RAM */
-    if((page >= 0x80) && (page <= 0x87)) return (cdram[(address & 0xFFFF)]);
+    if((page >= 0x80) && (page <= 0x87)) return (pce_ctx->cdram[(address & 0xFFFF)]);
 
     /* Backup RAM (F7) */
-    if(page == 0xF7) return (bram[(address & 0x1FFF)]);
+    if(page == 0xF7) return (pce_ctx->bram[(address & 0x1FFF)]);
 
 #ifdef DEBUG
     error("read %02X:%04X (%08X)\n", page, address & 0x1fff, h6280_get_reg(H6280_PC));
@@ -171,7 +156,7 @@ void io_page_w(int address, int data)
 #ifdef DEBUG
             error("cdrom %04X = %02X\n", address, data);
 #endif
-            if(address == 0x1807) save_bram = 1;
+            if(address == 0x1807) pce_ctx->save_bram = 1;
             break;
 
         case 0x1C00: /* Expansion */
@@ -233,28 +218,28 @@ int io_page_r(int address)
 
 void input_w(uint8 data)
 {
-    joy_sel = (data & 1);
-    joy_clr = (data >> 1) & 1;
+    pce_ctx->joy_sel = (data & 1);
+    pce_ctx->joy_clr = (data >> 1) & 1;
 }
 
 uint8 input_r(void)
 {
     uint8 temp = 0xFF;
 
-    if(input.pad[joy_cnt] & INPUT_LEFT)   temp &= ~0x80;
-    if(input.pad[joy_cnt] & INPUT_DOWN)   temp &= ~0x40;
-    if(input.pad[joy_cnt] & INPUT_RIGHT)  temp &= ~0x20;
-    if(input.pad[joy_cnt] & INPUT_UP)     temp &= ~0x10;
-    if(input.pad[joy_cnt] & INPUT_RUN)    temp &= ~0x08;
-    if(input.pad[joy_cnt] & INPUT_SELECT) temp &= ~0x04;
-    if(input.pad[joy_cnt] & INPUT_B2)     temp &= ~0x02;
-    if(input.pad[joy_cnt] & INPUT_B1)     temp &= ~0x01;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_LEFT)   temp &= ~0x80;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_DOWN)   temp &= ~0x40;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_RIGHT)  temp &= ~0x20;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_UP)     temp &= ~0x10;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_RUN)    temp &= ~0x08;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_SELECT) temp &= ~0x04;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_B2)     temp &= ~0x02;
+    if(pce_ctx->input.pad[pce_ctx->joy_cnt] & INPUT_B1)     temp &= ~0x01;
 
-    if(joy_sel & 1) temp >>= 4;
+    if(pce_ctx->joy_sel & 1) temp >>= 4;
     temp &= 0x0F;
 
     /* Set D6 for TurboGrafx-16, clear for PC-Engine */
-    if(input.system & SYSTEM_TGX) temp |= 0x40;
+    if(pce_ctx->input.system & SYSTEM_TGX) temp |= 0x40;
 
     return (temp);
 }
@@ -266,8 +251,8 @@ void bank_reset(void)
     int i;
     for(i = 0; i < 8; i += 1)
     {
-        read_ptr[i] = &rom[0x0000];
-        write_ptr[i] = &dummy[0x0000];
+        pce_ctx->read_ptr[i] = &pce_ctx->rom[0x0000];
+        pce_ctx->write_ptr[i] = &pce_ctx->dummy[0x0000];
     }
 }
 
@@ -275,32 +260,32 @@ void bank_set(int bank, int value)
 {
     /* ROM */
     if(value <= 0x7F) {
-        read_ptr[bank] = &rom[(value << 13)];
-        write_ptr[bank] = &dummy[0x0000];
+        pce_ctx->read_ptr[bank] = &pce_ctx->rom[(value << 13)];
+        pce_ctx->write_ptr[bank] = &pce_ctx->dummy[0x0000];
         return;
     }
 
     /* CD RAM */
     if((value >= 0x80) && (value <= 0x87)) {
-        read_ptr[bank] = write_ptr[bank] = &cdram[(value & 0x07) << 13];
+        pce_ctx->read_ptr[bank] = pce_ctx->write_ptr[bank] = &pce_ctx->cdram[(value & 0x07) << 13];
         return;
     }
 
     /* RAM */
     if((value >= 0xF8) && (value <= 0xFB)) {
-        read_ptr[bank] = write_ptr[bank] = &ram[(value & 0x03) << 13];
+        pce_ctx->read_ptr[bank] = pce_ctx->write_ptr[bank] = &pce_ctx->ram[(value & 0x03) << 13];
         return;
     }
 
     /* Backup RAM */
     if(value == 0xF7) {
-        read_ptr[bank] = write_ptr[bank] = &bram[0x0000];
+        pce_ctx->read_ptr[bank] = pce_ctx->write_ptr[bank] = &pce_ctx->bram[0x0000];
         return;
     }
 
     /* I/O page */
     if(value == 0xFF) {
-        read_ptr[bank] = write_ptr[bank] = NULL;
+        pce_ctx->read_ptr[bank] = pce_ctx->write_ptr[bank] = NULL;
         return;
     }
 
@@ -308,7 +293,7 @@ void bank_set(int bank, int value)
 #ifdef DEBUG
     error("Map unknown page %02X to MMR #%d\n", value, bank);
 #endif
-    read_ptr[bank] = write_ptr[bank] = &dummy[0x0000];
+    pce_ctx->read_ptr[bank] = pce_ctx->write_ptr[bank] = &pce_ctx->dummy[0x0000];
 }
 
 #endif
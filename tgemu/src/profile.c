@@ -0,0 +1,536 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <pthread.h>
+#include "shared.h"
+
+/*
+    Cycle profiler.  Every executed instruction is charged to the function
+    (top-level label of the .sym file) and, when the pceas listing is
+    available, to the source line its physical address belongs to.  Calls
+    are followed on the hardware stack: JSR/BSR and interrupts push a
+    frame, which is dropped once the stack pointer moves back above it, so
+    RTS, RTI and code that discards its return address all unwind.
+*/
+
+#define NODE_HASH       (0x1000)    /* Call path hash table size */
+#define MAX_DEPTH       (0x100)     /* Frames, one per stack byte at most */
+
+typedef struct
+{
+    uint32 addr;            /* Physical address, bank << 13 | offset */
+    char *name;
+    UINT64 cycles;          /* Spent in the function itself */
+    UINT64 total;           /* Including callees, made by profile_write() */
+    uint32 calls;
+    int mark;
+} t_prof_func;
+
+typedef struct
+{
+    uint32 addr;            /* Physical address of the instruction */
+    int file;
+    int line;
+    UINT64 cycles;
+} t_prof_line;
+
+typedef struct
+{
+    int parent;             /* Call path node of the caller, 0= root */
+    int func;
+    int next;               /* Hash chain */
+    UINT64 cycles;
+} t_prof_node;
+
+typedef struct
+{
+    int node;               /* Call path up to and including the caller */
+    uint8 sp;               /* Stack pointer after the call */
+} t_prof_frame;
+
+struct t_profile
+{
+    t_prof_func *func;      /* Sorted by address, 0= unknown code */
+    int nfunc;
+    t_prof_line *line;      /* Sorted by address */
+    int nline;
+    char *file[0x100];      /* Listing file names */
+    int nfile;
+    t_prof_node *node;      /* Call path tree, 0= root */
+    int nnode;
+    int node_max;
+    int node_hash[NODE_HASH];
+    t_prof_frame frame[MAX_DEPTH];
+    int depth;
+    UINT64 cycles;          /* Cycle count after the last instruction */
+    uint8 sp;               /* Stack pointer after the last instruction */
+    int leaf;               /* Last (path node, function) looked up */
+    int leaf_parent;
+    int leaf_func;
+};
+
+
+/*--------------------------------------------------------------------------*/
+/* Lookup                                                                   */
+/*--------------------------------------------------------------------------*/
+
+/* Function an address belongs to, 0 if it isn't in any */
+static int find_func(t_profile *p, uint32 addr)
+{
+    int lo = 1, hi = p->nfunc - 1;
+
+    while(lo <= hi)
+    {
+        int mid = (lo + hi) >> 1;
+        if(p->func[mid].addr <= addr) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    if(hi < 1 || (p->func[hi].addr >> 13) != (addr >> 13)) return (0);
+    return (hi);
+}
+
+
+/* Listing line of an address, -1 if it has none */
+static int find_line(t_profile *p, uint32 addr)
+{
+    int lo = 0, hi = p->nline - 1;
+
+    while(lo <= hi)
+    {
+        int mid = (lo + hi) >> 1;
+        if(p->line[mid].addr <= addr) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    if(hi < 0 || (p->line[hi].addr >> 13) != (addr >> 13)) return (-1);
+    return (hi);
+}
+
+
+/* Call path node for <func> called from <parent> */
+static int find_node(t_profile *p, int parent, int func)
+{
+    int h = (parent * 31 + func) & (NODE_HASH - 1);
+    int i;
+
+    for(i = p->node_hash[h]; i; i = p->node[i].next)
+        if(p->node[i].parent == parent && p->node[i].func == func)
+            return (i);
+
+    if(p->nnode == p->node_max)
+    {
+        t_prof_node *n = realloc(p->node, 2 * p->node_max * sizeof(t_prof_node));
+        if(!n) return (parent);
+        p->node = n;
+        p->node_max *= 2;
+    }
+    i = p->nnode++;
+    p->node[i].parent = parent;
+    p->node[i].func = func;
+    p->node[i].cycles = 0;
+    p->node[i].next = p->node_hash[h];
+    p->node_hash[h] = i;
+    return (i);
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Execution hook                                                           */
+/*--------------------------------------------------------------------------*/
+
+/* Called after each instruction with its address, opcode, and the cycle
+   count it finished at */
+void profile_insn(int pc, int op, UINT64 cycles)
+{
+    t_profile *p = pce_ctx->profile;
+    uint32 addr = (pce_ctx->h6280.mmr[(pc >> 13) & 7] << 13) | (pc & 0x1FFF);
+    UINT64 delta = cycles - p->cycles;
+    int func = find_func(p, addr);
+    int parent = p->depth ? p->frame[p->depth - 1].node : 0;
+    int sp = pce_ctx->h6280.sp.b.l;
+    int drop = p->sp - sp;
+    int i;
+
+    /* Charge the instruction */
+    p->cycles = cycles;
+    p->func[func].cycles += delta;
+    if((i = find_line(p, addr)) >= 0) p->line[i].cycles += delta;
+    if(parent != p->leaf_parent || func != p->leaf_func)
+    {
+        p->leaf = find_node(p, parent, func);
+        p->leaf_parent = parent;
+        p->leaf_func = func;
+    }
+    p->node[p->leaf].cycles += delta;
+
+    /* Drop the frames the stack has been unwound past */
+    while(p->depth && p->frame[p->depth - 1].sp < sp)
+        p->depth -= 1;
+
+    /* Subroutine calls push two bytes, pushes one; three more are an
+       interrupt taken meanwhile */
+    p->sp = sp;
+    switch(op)
+    {
+        case 0x20:  /* JSR */
+        case 0x44:  /* BSR */
+            drop -= 2;
+            break;
+        case 0x08:  /* PHP */
+        case 0x48:  /* PHA */
+        case 0x5A:  /* PHY */
+        case 0xDA:  /* PHX */
+            drop -= 1;
+            op = 0;
+            break;
+        default:
+            op = 0;
+            break;
+    }
+    if(op || drop >= 3)
+    {
+        pc = pce_ctx->h6280.pc.w.l;
+        addr = (pce_ctx->h6280.mmr[pc >> 13] << 13) | (pc & 0x1FFF);
+        if(p->depth < MAX_DEPTH)
+        {
+            p->frame[p->depth].node = p->leaf;
+            p->frame[p->depth].sp = sp;
+            p->depth += 1;
+        }
+        p->func[find_func(p, addr)].calls += 1;
+    }
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Loading                                                                  */
+/*--------------------------------------------------------------------------*/
+
+/* Compiler-made labels within functions (HuC's LLnn) are not functions */
+static int is_func_name(char *name)
+{
+    char *s;
+
+    if(name[0] != 'L' || name[1] != 'L' || !name[2]) return (1);
+    for(s = &name[2]; *s; s++)
+        if(!isdigit((unsigned char)*s)) return (1);
+    return (0);
+}
+
+
+/* Among labels at the same address, prefer plain names over the
+   numbered aliases HuC makes (load_vram over _load_vram.3) */
+static int name_rank(char *name)
+{
+    return ((strchr(name, '.') ? 0x1000 : 0) + (name[0] == '_' ? 0x100 : 0) + strlen(name));
+}
+
+
+static int cmp_func(const void *a, const void *b)
+{
+    const t_prof_func *x = a, *y = b;
+
+    if(x->addr != y->addr) return (x->addr < y->addr ? -1 : 1);
+    return (name_rank(x->name) - name_rank(y->name));
+}
+
+
+static int cmp_line(const void *a, const void *b)
+{
+    const t_prof_line *x = a, *y = b;
+
+    if(x->addr != y->addr) return (x->addr < y->addr ? -1 : 1);
+    return (0);
+}
+
+
+/* Read the top-level code labels of a .sym file */
+static int load_sym(t_profile *p, char *name)
+{
+    FILE *fp;
+    char buf[0x200];
+    int max = 0x100, i, j;
+
+    fp = fopen(name, "r");
+    if(!fp) return (0);
+
+    p->func = malloc(max * sizeof(t_prof_func));
+    p->func[0].addr = 0;
+    p->func[0].name = strdup("[unknown]");
+    p->nfunc = 1;
+    while(fgets(buf, sizeof(buf), fp))
+    {
+        unsigned int bank, value;
+        char label[0x100];
+
+        /* "bank <tab> addr <tab> label", local labels have an extra tab */
+        if(sscanf(buf, "%x\t%x\t%255s", &bank, &value, label) != 3) continue;
+        if(buf[8] == '\t' || bank == 0xF0) continue;
+        if(!is_func_name(label)) continue;
+
+        if(p->nfunc == max)
+        {
+            max *= 2;
+            p->func = realloc(p->func, max * sizeof(t_prof_func));
+        }
+        p->func[p->nfunc].addr = (bank << 13) | (value & 0x1FFF);
+        p->func[p->nfunc].name = strdup(label);
+        p->nfunc += 1;
+    }
+    fclose(fp);
+
+    /* Sort, keep one name per address */
+    qsort(&p->func[1], p->nfunc - 1, sizeof(t_prof_func), cmp_func);
+    for(i = j = 1; i < p->nfunc; i += 1)
+    {
+        if(j > 1 && p->func[j - 1].addr == p->func[i].addr)
+            free(p->func[i].name);
+        else
+            p->func[j++] = p->func[i];
+    }
+    p->nfunc = j;
+    for(i = 0; i < p->nfunc; i += 1)
+    {
+        p->func[i].cycles = 0;
+        p->func[i].total = 0;
+        p->func[i].calls = 0;
+        p->func[i].mark = -1;
+    }
+    return (1);
+}
+
+
+/* Read the address of each instruction from a pceas listing ("-l 2"):
+   "#[n]   file" switches files, then "line  bb:addr  bytes  source";
+   the lines of a macro expansion belong to the line that invoked it */
+static void load_lst(t_profile *p, char *name)
+{
+    FILE *fp;
+    char buf[0x400];
+    int max = 0x1000;
+    int level = 0, line = 0;
+    int level_file[10] = {0};
+
+    fp = fopen(name, "r");
+    if(!fp) return;
+
+    p->line = malloc(max * sizeof(t_prof_line));
+    while(fgets(buf, sizeof(buf), fp))
+    {
+        unsigned int bank, value;
+
+        if(buf[0] == '#' && buf[1] == '[')
+        {
+            char file[0x100];
+            int i;
+
+            if(sscanf(buf, "#[%d] %255s", &level, file) != 2) continue;
+            if(level < 1 || level > 9) level = 1;
+            for(i = 0; i < p->nfile; i += 1)
+                if(!strcmp(p->file[i], file)) break;
+            if(i == p->nfile)
+            {
+                if(p->nfile == 0x100) i = 0;
+                else p->file[p->nfile++] = strdup(file);
+            }
+            level_file[level] = i;
+            line = 0;
+            continue;
+        }
+        if(strlen(buf) < 18 || buf[9] != ':' || !isxdigit((unsigned char)buf[16]))
+            continue;
+        if(isdigit((unsigned char)buf[4])) line = atoi(buf);
+        if(sscanf(&buf[7], "%2x:%4x", &bank, &value) != 2) continue;
+
+        if(p->nline == max)
+        {
+            max *= 2;
+            p->line = realloc(p->line, max * sizeof(t_prof_line));
+        }
+        p->line[p->nline].addr = (bank << 13) | (value & 0x1FFF);
+        p->line[p->nline].file = level_file[level];
+        p->line[p->nline].line = line;
+        p->line[p->nline].cycles = 0;
+        p->nline += 1;
+    }
+    fclose(fp);
+    qsort(p->line, p->nline, sizeof(t_prof_line), cmp_line);
+}
+
+
+/* Make a profile from the symbols of <sym_name> and, if it can be read,
+   the listing <lst_name>.  Returns NULL if there are no symbols. */
+t_profile *profile_load(char *sym_name, char *lst_name)
+{
+    t_profile *p = calloc(1, sizeof(t_profile));
+
+    if(!p) return (NULL);
+    if(!load_sym(p, sym_name))
+    {
+        free(p);
+        return (NULL);
+    }
+    if(lst_name) load_lst(p, lst_name);
+
+    p->node_max = 0x400;
+    p->node = malloc(p->node_max * sizeof(t_prof_node));
+    p->node[0].parent = 0;
+    p->node[0].func = -1;
+    p->node[0].cycles = 0;
+    p->nnode = 1;
+    p->sp = 0xFF;
+    p->leaf_func = -1;
+    return (p);
+}
+
+
+void profile_free(t_profile *p)
+{
+    int i;
+
+    if(!p) return;
+    for(i = 0; i < p->nfunc; i += 1) free(p->func[i].name);
+    for(i = 0; i < p->nfile; i += 1) free(p->file[i]);
+    free(p->func);
+    free(p->line);
+    free(p->node);
+    free(p);
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Output                                                                   */
+/*--------------------------------------------------------------------------*/
+
+static t_profile *sort_profile;
+
+static int cmp_self(const void *a, const void *b)
+{
+    const t_prof_func *x = &sort_profile->func[*(const int *)a];
+    const t_prof_func *y = &sort_profile->func[*(const int *)b];
+
+    if(x->cycles != y->cycles) return (x->cycles > y->cycles ? -1 : 1);
+    return (x->total > y->total ? -1 : x->total < y->total);
+}
+
+
+static int cmp_cycles(const void *a, const void *b)
+{
+    const t_prof_line *x = &sort_profile->line[*(const int *)a];
+    const t_prof_line *y = &sort_profile->line[*(const int *)b];
+
+    if(x->cycles != y->cycles) return (x->cycles > y->cycles ? -1 : 1);
+    return (x->addr < y->addr ? -1 : x->addr > y->addr);
+}
+
+
+static int cmp_source(const void *a, const void *b)
+{
+    const t_prof_line *x = &sort_profile->line[*(const int *)a];
+    const t_prof_line *y = &sort_profile->line[*(const int *)b];
+
+    if(x->file != y->file) return (x->file - y->file);
+    if(x->line != y->line) return (x->line - y->line);
+    return (x->addr < y->addr ? -1 : x->addr > y->addr);
+}
+
+
+static void write_path(t_profile *p, FILE *fp, int n)
+{
+    if(p->node[n].parent)
+    {
+        write_path(p, fp, p->node[n].parent);
+        fputc(';', fp);
+    }
+    fputs(p->func[p->node[n].func].name, fp);
+}
+
+
+/* Write the flat profile (per function and per line) to <flat_name> and
+   the call paths to <folded_name>, in the collapsed stack format that
+   flame graph tools read.  Returns 0 on error. */
+int profile_write(t_profile *p, char *flat_name, char *folded_name)
+{
+    static pthread_mutex_t sort_lock = PTHREAD_MUTEX_INITIALIZER;
+    FILE *fp;
+    UINT64 total = 0;
+    int *order;
+    int i, n, count;
+
+    /* Inclusive cycles: each path counts once for every function on it */
+    for(i = 1; i < p->nnode; i += 1)
+    {
+        total += p->node[i].cycles;
+        for(n = i; n; n = p->node[n].parent)
+        {
+            t_prof_func *f = &p->func[p->node[n].func];
+            if(f->mark == i) continue;
+            f->mark = i;
+            f->total += p->node[i].cycles;
+        }
+    }
+    if(!total) total = 1;
+
+    fp = fopen(flat_name, "w");
+    if(!fp) return (0);
+
+    order = malloc((p->nfunc > p->nline ? p->nfunc : p->nline) * sizeof(int) + 1);
+    pthread_mutex_lock(&sort_lock);
+    sort_profile = p;
+
+    fprintf(fp, "Flat profile: %llu cycles\n\n", (unsigned long long)total);
+    fprintf(fp, "  self%%  self cycles total cycles     calls  function\n");
+    for(i = count = 0; i < p->nfunc; i += 1)
+        if(p->func[i].cycles || p->func[i].calls) order[count++] = i;
+    qsort(order, count, sizeof(int), cmp_self);
+    for(i = 0; i < count; i += 1)
+    {
+        t_prof_func *f = &p->func[order[i]];
+        fprintf(fp, "%7.2f %12llu %12llu %9lu  %s\n",
+            100.0 * f->cycles / total, (unsigned long long)f->cycles,
+            (unsigned long long)f->total, (unsigned long)f->calls, f->name);
+    }
+
+    if(p->nline)
+    {
+        fprintf(fp, "\nLine profile:\n\n");
+        fprintf(fp, "  self%%       cycles  line\n");
+        for(i = count = 0; i < p->nline; i += 1)
+            if(p->line[i].cycles) order[count++] = i;
+
+        /* A line expanding to several instructions is listed once */
+        qsort(order, count, sizeof(int), cmp_source);
+        for(i = n = 0; i < count; i += 1)
+        {
+            t_prof_line *l = &p->line[order[i]];
+            t_prof_line *m = &p->line[order[n ? n - 1 : 0]];
+            if(n && l->file == m->file && l->line == m->line)
+                m->cycles += l->cycles;
+            else
+                order[n++] = order[i];
+        }
+        count = n;
+        qsort(order, count, sizeof(int), cmp_cycles);
+        for(i = 0; i < count; i += 1)
+        {
+            t_prof_line *l = &p->line[order[i]];
+            fprintf(fp, "%7.2f %12llu  %s:%d (%s)\n",
+                100.0 * l->cycles / total, (unsigned long long)l->cycles,
+                p->file[l->file], l->line, p->func[find_func(p, l->addr)].name);
+        }
+    }
+    pthread_mutex_unlock(&sort_lock);
+    free(order);
+    fclose(fp);
+
+    fp = fopen(folded_name, "w");
+    if(!fp) return (0);
+    for(i = 1; i < p->nnode; i += 1)
+    {
+        if(!p->node[i].cycles) continue;
+        write_path(p, fp, i);
+        fprintf(fp, " %llu\n", (unsigned long long)p->node[i].cycles);
+    }
+    fclose(fp);
+    return (1);
+}
@@ -0,0 +1,14 @@
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+/* Cycle profile of one machine, see profile.c */
+typedef struct t_profile t_profile;
+
+/* Function prototypes */
+t_profile *profile_load(char *sym_name, char *lst_name);
+void profile_insn(int pc, int op, UINT64 cycles);
+int profile_write(t_profile *p, char *flat_name, char *folded_name);
+void profile_free(t_profile *p);
+
+#endif /* _PROFILE_H_ */
@@ -1,7 +1,6 @@
 
 #include "shared.h"
 
-t_psg psg;
 
 /*--------------------------------------------------------------------------*/
 /* Init, reset, shutdown routines                                           */
@@ -9,13 +8,13 @@ t_psg psg;
 
 int psg_init(void)
 {
-    memset(&psg, 0, sizeof(psg));
+    memset(&pce_ctx->psg, 0, sizeof(pce_ctx->psg));
     return (0);
 }
 
 void psg_reset(void)
 {
-    memset(&psg, 0, sizeof(psg));
+    memset(&pce_ctx->psg, 0, sizeof(pce_ctx->psg));
 }
 
 void psg_shutdown(void)
@@ -31,11 +30,11 @@ void psg_w(uint16 address, uint8 data)
     switch(address)
     {
         case 0x0800: /* Channel select */
-            psg.select = (data & 7);
+            pce_ctx->psg.select = (data & 7);
             break;
 
         case 0x0801: /* Global sound balance */
-            psg.globalbalance = data;
+            pce_ctx->psg.globalbalance = data;
             break;
 
         case 0x0802: /* Channel frequency (LSB) */
@@ -61,15 +60,15 @@ void psg_w(uint16 address, uint8 data)
             break;
 
         case 0x0807: /* Noise enable and frequency */
-            psg.noisectrl = data;
+            pce_ctx->psg.noisectrl = data;
             break;
 
         case 0x0808: /* LFO frequency */
-            psg.lfofreq = data;
+            pce_ctx->psg.lfofreq = data;
             break;
 
         case 0x0809: /* LFO trigger and control */
-            psg.lfoctrl = data;
+            pce_ctx->psg.lfoctrl = data;
             break;
     }
 }
@@ -84,24 +83,24 @@ void psg_update(int16 *bufl, int16 *bufr, int length)
         int start;                 /* Skip channels 0, 1 if LFO is enabled */ 
         int stop;                  /* Skip channels 4, 5 if noise is enabled */
 
-        start = ((psg.lfoctrl & 3) == 0) ? 0 : 2;
-        stop = (psg.noisectrl & 0x80) ? 4 : 6;
+        start = ((pce_ctx->psg.lfoctrl & 3) == 0) ? 0 : 2;
+        stop = (pce_ctx->psg.noisectrl & 0x80) ? 4 : 6;
 
         for(ch = start; ch < stop; ch += 1)
         {
             /* If channel is ON and DDA is OFF, play waveform data */
-            if((psg.channel[ch].control & 0xC0) == 0x80)
+            if((pce_ctx->psg.channel[ch].control & 0xC0) == 0x80)
             {
                 /* Global sound balance (left and right, all channels) */
-                int lbal = (psg.globalbalance >> 4) & 0x0F;
-                int rbal = (psg.globalbalance >> 0) & 0x0F;
+                int lbal = (pce_ctx->psg.globalbalance >> 4) & 0x0F;
+                int rbal = (pce_ctx->psg.globalbalance >> 0) & 0x0F;
 
                 /* Balance (left and right, this channel) */
-                int lchb = (psg.channel[ch].balance >> 4) & 0x0F;
-                int rchb = (psg.channel[ch].balance >> 0) & 0x0F;
+                int lchb = (pce_ctx->psg.channel[ch].balance >> 4) & 0x0F;
+                int rchb = (pce_ctx->psg.channel[ch].balance >> 0) & 0x0F;
 
                 /* Volume level (this channel) */
-                int chvl = (psg.channel[ch].control & 0x1F);
+                int chvl = (pce_ctx->psg.channel[ch].control & 0x1F);
     
                 /* Total volume levels for left and right
                    (volume sounds too soft - not sure how to combine these) */
@@ -119,16 +118,16 @@ void psg_update(int16 *bufl, int16 *bufr, int length)
 
                 /* Calculate the value to add to the counter for each sample,
                    but don't divide by zero if the frequency is zero */
-                step = (psg.channel[ch].frequency) ? base / psg.channel[ch].frequency : 0;
+                step = (pce_ctx->psg.channel[ch].frequency) ? base / pce_ctx->psg.channel[ch].frequency : 0;
 
                 /* Use upper 5 bits of 12-bit frequency as wave index */
-                offset = (psg.channel[ch].counter >> 12) & 0x1F;
+                offset = (pce_ctx->psg.channel[ch].counter >> 12) & 0x1F;
 
                 /* Bump waveform index */
-                psg.channel[ch].counter += step;
+                pce_ctx->psg.channel[ch].counter += step;
 
                 /* Data is 5 bits */
-                data = (psg.channel[ch].waveform[offset] & 0x1F);
+                data = (pce_ctx->psg.channel[ch].waveform[offset] & 0x1F);
 
                 /* Add new sample to old one */
                 sample[0] = (sample[0] + (lvol * data));
@@ -3,7 +3,7 @@
 #define _PSG_H_
 
 /* Macro to access currently selected PSG channel */
-#define PSGCH   psg.channel[psg.select]
+#define PSGCH   pce_ctx->psg.channel[pce_ctx->psg.select]
 
 /* PSG structure */
 typedef struct {
@@ -22,9 +22,6 @@ typedef struct {
     } channel[8];
 }t_psg;
 
-/* Global variables */
-extern t_psg psg;
-
 /* Function prototypes */
 int psg_init(void);
 void psg_reset(void);
@@ -1,65 +1,48 @@
 
+#include <pthread.h>
 #include "shared.h"
 
+#if defined(__SSE2__) && defined(LSB_FIRST)
+#include <emmintrin.h>
+#define SSE2_DECODE
+#endif
+
 /* Bit 0 : BG enable, Bit 1 : OBJ enable */
 int plane_enable = -1;
 
-/* VCE color data to VGA 8-bit pixel table */
-uint8 *xlat[2];
-
-/* VCE color data to 16-bit pixel table */
-uint16 pixel[2][0x100];
-
 /* Precalculated 16-bit pixel values */
 uint16 pixel_lut[0x200];
 
-/* Pointer to 8 or 16-bit version of render_line() */
-void (*render_line)(int line) = NULL;
-
-/* List of precalculated sprite data */
-t_sprite sprite_list[0x40];
-
-/* Bitplane to packed pixel lookup table */
-uint32 bp_lut[0x10000];
+/* Bitplane byte to eight pixels of one bit, leftmost pixel first in
+   memory; bp_lut_flip has the pixels mirrored */
+uint64 bp_lut[0x100];
+uint64 bp_lut_flip[0x100];
 
-/* Used sprite data */
-uint8 used_sprite_list[0x40];
-uint8 used_sprite_index;
+/* The tables above are shared by all contexts and made once */
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
 
 /*--------------------------------------------------------------------------*/
 /* Init, reset, shutdown functions                                          */
 /*--------------------------------------------------------------------------*/
 
 
-int render_init(void)
+static void make_tables(void)
 {
-    int i, j, x;
-    uint8 *ptr;
+    int i, x;
 
-    /* Make bitplane to pixel lookup table */
+    /* Make bitplane to pixel lookup tables */
     for(i = 0; i < 0x100; i += 1)
-    for(j = 0; j < 0x100; j += 1)
     {
-        uint32 out = 0;
+        uint8 *out = (uint8 *)&bp_lut[i];
+        uint8 *flip = (uint8 *)&bp_lut_flip[i];
+
         for(x = 0; x < 8; x += 1)
         {
-            out |= (j & (0x80 >> x)) ? (uint32)(8 << (x << 2)) : 0;
-            out |= (i & (0x80 >> x)) ? (uint32)(4 << (x << 2)) : 0;
+            out[x] = (i >> (x ^ 7)) & 1;
+            flip[x] = (i >> x) & 1;
         }
-#ifdef LSB_FIRST
-        bp_lut[(j << 8) | (i)] = out;
-#else
-        bp_lut[(i << 8) | (j)] = out;
-#endif
     }
 
-    /* Set up pixel color remap tables, the alignment is DOS specific */
-    ptr = malloc(0x400);
-    if(!ptr) return (0);
-    memset(ptr, 0, 0x400);
-    xlat[0] = (uint8 *)(((unsigned long)ptr + 0x200) & ~0x1FF);
-    xlat[1] = xlat[0] + 0x100;
-
     /* Make VCE data to raw pixel look-up table */
     for(i = 0; i < 0x200; i += 1)
     {
@@ -68,8 +51,17 @@ int render_init(void)
         int b = (i >> 0) & 7;
         pixel_lut[i] = (r << 13 | g << 8 | b << 2) & 0xE71C;
     }
+}
 
-    render_line = (bitmap.depth == 8) ? render_line_8 : render_line_16;
+
+int render_init(void)
+{
+    pthread_once(&tables_once, make_tables);
+
+    /* Pixel color remap tables are part of the context */
+    memset(pce_ctx->xlat, 0, sizeof(pce_ctx->xlat));
+
+    pce_ctx->render_line = (pce_ctx->bitmap.depth == 8) ? render_line_8 : render_line_16;
 
     return (1);
 }
@@ -77,14 +69,32 @@ int render_init(void)
 
 void render_reset(void)
 {
+    int i;
+
     /* Hack for Mac port */
-    render_line = (bitmap.depth == 8) ? render_line_8 : render_line_16;
+    pce_ctx->render_line = (pce_ctx->bitmap.depth == 8) ? render_line_8 : render_line_16;
+
+    /* Clear the palettes and sprites of a previous run */
+    memset(pce_ctx->pixel, 0, sizeof(pce_ctx->pixel));
+    memset(pce_ctx->xlat, 0, sizeof(pce_ctx->xlat));
+    memset(pce_ctx->sprite_list, 0, sizeof(pce_ctx->sprite_list));
+    memset(pce_ctx->used_sprite_list, 0, sizeof(pce_ctx->used_sprite_list));
+    pce_ctx->used_sprite_index = 0;
+
+    /* Forget the logged lines */
+    for(i = 0; i < LOG_LINES; i += 1)
+    {
+        pce_ctx->line_log[0][i].frame = -1;
+        pce_ctx->line_log[1][i].frame = -1;
+    }
+    pce_ctx->render_frame = 0;
+    pce_ctx->sprite_gen = -1;
+    render_log_sprites();
 }
 
 
 void render_shutdown(void)
 {
-    /* todo: free xlat pointer */
 }
 
 
@@ -97,10 +107,10 @@ int make_sprite_list(void)
     int i;
     uint32 flip;
 
-    used_sprite_index = 0;
-    memset(&used_sprite_list, 0, sizeof(used_sprite_list));
+    pce_ctx->used_sprite_index = 0;
+    memset(&pce_ctx->used_sprite_list, 0, sizeof(pce_ctx->used_sprite_list));
 
-    memset(&sprite_list, 0, sizeof(sprite_list));
+    memset(&pce_ctx->sprite_list, 0, sizeof(pce_ctx->sprite_list));
 
     for(i = 0; i < 0x40; i += 1)
     {
@@ -136,29 +146,29 @@ int make_sprite_list(void)
             name |= flip;
             if(xflip && cgx) name ^= 1;
 
-            sprite_list[i].top = ypos;
-            sprite_list[i].bottom = ypos + height;
-            sprite_list[i].xpos = xpos;
-            sprite_list[i].name_left = name;
-            sprite_list[i].name_right = name ^ 1;
-            sprite_list[i].height = (height - 1);
-            sprite_list[i].palette = (attr & 0x0F) << 4;
+            pce_ctx->sprite_list[i].top = ypos;
+            pce_ctx->sprite_list[i].bottom = ypos + height;
+            pce_ctx->sprite_list[i].xpos = xpos;
+            pce_ctx->sprite_list[i].name_left = name;
+            pce_ctx->sprite_list[i].name_right = name ^ 1;
+            pce_ctx->sprite_list[i].height = (height - 1);
+            pce_ctx->sprite_list[i].palette = (attr & 0x0F) << 4;
 
             if(yflip)
-                sprite_list[i].flags |= FLAG_YFLIP;
+                pce_ctx->sprite_list[i].flags |= FLAG_YFLIP;
 
             if(cgx)
-                sprite_list[i].flags |= FLAG_CGX;
+                pce_ctx->sprite_list[i].flags |= FLAG_CGX;
 
             if(!(attr & 0x80))
-                sprite_list[i].flags |= FLAG_PRIORITY;
+                pce_ctx->sprite_list[i].flags |= FLAG_PRIORITY;
 
-            used_sprite_list[used_sprite_index] = (i);
-            used_sprite_index += 1;
+            pce_ctx->used_sprite_list[pce_ctx->used_sprite_index] = (i);
+            pce_ctx->used_sprite_index += 1;
         }
     }
 
-    return (used_sprite_index);
+    return (pce_ctx->used_sprite_index);
 }
 
 
@@ -166,89 +176,145 @@ int make_sprite_list(void)
 /* Pattern and object cache update routines                                 */
 /*--------------------------------------------------------------------------*/
 
+/* One row of pixels from the bytes of its four bitplanes */
+#define PLANES(lut, p0, p1, p2, p3) \
+    (lut[p0] | (lut[p1] << 1) | (lut[p2] << 2) | (lut[p3] << 3))
+
+#ifdef SSE2_DECODE
+/* Spread the bytes of rows 0-7 of a plane, each given twice, over eight
+   bytes: rows 0 and 1 in v[0], 2 and 3 in v[1], ... */
+#define SPREAD(p, v)                                            \
+    v[0] = _mm_unpacklo_epi16(p, p);                            \
+    v[2] = _mm_unpackhi_epi16(p, p);                            \
+    v[1] = _mm_unpackhi_epi32(v[0], v[0]);                      \
+    v[0] = _mm_unpacklo_epi32(v[0], v[0]);                      \
+    v[3] = _mm_unpackhi_epi32(v[2], v[2]);                      \
+    v[2] = _mm_unpacklo_epi32(v[2], v[2])
+
+/* Pixels of spread plane bytes that have their bit set, as <w> */
+#define TEST(v, w)                                              \
+    _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(v, bit), bit), _mm_set1_epi8(w))
+
+/* Decode a whole background pattern, two rows at a time */
+static void decode_bg_tile(int name)
+{
+    const __m128i bit = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                     1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i low = _mm_set1_epi16(0x00FF);
+    __m128i w01, w23, p, q, s0[4], s1[4], s2[4], s3[4];
+    int y;
+
+    /* Planes 0 and 1, then 2 and 3, of rows 0-7 */
+    w01 = _mm_loadu_si128((__m128i *)&vramw[(name << 4)]);
+    w23 = _mm_loadu_si128((__m128i *)&vramw[(name << 4) | (8)]);
+
+    /* A byte per row: planes 0 and 2, then 1 and 3 */
+    p = _mm_packus_epi16(_mm_and_si128(w01, low), _mm_and_si128(w23, low));
+    q = _mm_packus_epi16(_mm_srli_epi16(w01, 8), _mm_srli_epi16(w23, 8));
+
+    SPREAD(_mm_unpacklo_epi8(p, p), s0);
+    SPREAD(_mm_unpackhi_epi8(p, p), s2);
+    SPREAD(_mm_unpacklo_epi8(q, q), s1);
+    SPREAD(_mm_unpackhi_epi8(q, q), s3);
+
+    for(y = 0; y < 4; y += 1)
+    {
+        p = _mm_or_si128(_mm_or_si128(TEST(s0[y], 1), TEST(s1[y], 2)),
+                         _mm_or_si128(TEST(s2[y], 4), TEST(s3[y], 8)));
+        _mm_storeu_si128((__m128i *)&pce_ctx->bg_pattern_cache[(name << 6) | (y << 4)], p);
+    }
+}
+
+#undef SPREAD
+#undef TEST
+#endif
+
+
 void update_bg_pattern_cache(void)
 {
     int i;
-    uint8 x, y, c;
-    uint16 name, index1, index2;
-    uint32 temp;
+    uint8 y;
+    uint16 name, w0, w1;
+    uint64 row;
 
-    if(!bg_list_index) return;
+    if(!pce_ctx->bg_list_index) return;
 
-    for(i = 0; i < bg_list_index; i += 1)
+    for(i = 0; i < pce_ctx->bg_list_index; i += 1)
     {
-        name = bg_name_list[i];
-        bg_name_list[i] = 0;
+        name = pce_ctx->bg_name_list[i];
+        pce_ctx->bg_name_list[i] = 0;
+
+#ifdef SSE2_DECODE
+        /* Whole patterns, as left by a DMA transfer */
+        if(pce_ctx->bg_name_dirty[name] == 0xFF)
+        {
+            decode_bg_tile(name);
+            pce_ctx->bg_name_dirty[name] = 0;
+            continue;
+        }
+#endif
 
         for(y = 0; y < 8; y += 1)
         {
-            if(bg_name_dirty[name] & (1 << y))
+            if(pce_ctx->bg_name_dirty[name] & (1 << y))
             {
-                index1 = vramw[(name << 4) | (y)];
-                index2 = vramw[(name << 4) | (y) | (8)];
-
-                temp = (bp_lut[index1] >> 2) | bp_lut[index2];
+                w0 = swap16(vramw[(name << 4) | (y)]);
+                w1 = swap16(vramw[(name << 4) | (y) | (8)]);
 
-                for(x = 0; x < 8; x += 1)
-                {
-                    c = (temp >> (x << 2)) & 0x0F;
-                    bg_pattern_cache[(name << 6) | (y << 3) | (x)] = (c);
-                }
+                row = PLANES(bp_lut, w0 & 0xFF, w0 >> 8, w1 & 0xFF, w1 >> 8);
+                memcpy(&pce_ctx->bg_pattern_cache[(name << 6) | (y << 3)], &row, 8);
             }
         }
-        bg_name_dirty[name] = 0;
+        pce_ctx->bg_name_dirty[name] = 0;
     }
 
-    bg_list_index = 0;
+    pce_ctx->bg_list_index = 0;
 }
 
 
-
 void update_obj_pattern_cache(void)
 {
     int i;
     uint16 name;
     uint16 b0, b1, b2, b3;
-    uint8 i0, i1, i2, i3;           
-    uint8 x, y, c;
+    uint64 row[2], flip[2];
+    uint8 y;
 
-    if(!obj_list_index) return;
+    if(!pce_ctx->obj_list_index) return;
 
-    for(i = 0; i < obj_list_index; i += 1)
+    for(i = 0; i < pce_ctx->obj_list_index; i += 1)
     {
-        name = obj_name_list[i];
-        obj_name_list[i] = 0;
+        name = pce_ctx->obj_name_list[i];
+        pce_ctx->obj_name_list[i] = 0;
 
         for(y = 0; y < 0x10; y += 1)
         {
-            if(obj_name_dirty[name] & (1 << y))
+            if(pce_ctx->obj_name_dirty[name] & (1 << y))
             {
                 b0 = swap16(vramw[(name << 6) + (y) + (0x00)]);
                 b1 = swap16(vramw[(name << 6) + (y) + (0x10)]);
                 b2 = swap16(vramw[(name << 6) + (y) + (0x20)]);
                 b3 = swap16(vramw[(name << 6) + (y) + (0x30)]);
 
-                for(x = 0; x < 0x10; x += 1)
-                {
-                    i0 = (b0 >> (x ^ 0x0F)) & 1;
-                    i1 = (b1 >> (x ^ 0x0F)) & 1;
-                    i2 = (b2 >> (x ^ 0x0F)) & 1;
-                    i3 = (b3 >> (x ^ 0x0F)) & 1;
+                /* Left and right halves of the row, and of its mirror */
+                row[0] = PLANES(bp_lut, b0 >> 8, b1 >> 8, b2 >> 8, b3 >> 8);
+                row[1] = PLANES(bp_lut, b0 & 0xFF, b1 & 0xFF, b2 & 0xFF, b3 & 0xFF);
+                flip[0] = PLANES(bp_lut_flip, b0 & 0xFF, b1 & 0xFF, b2 & 0xFF, b3 & 0xFF);
+                flip[1] = PLANES(bp_lut_flip, b0 >> 8, b1 >> 8, b2 >> 8, b3 >> 8);
 
-                    c = (i3 << 3 | i2 << 2 | i1 << 1 | i0);
-
-                    obj_pattern_cache[(name << 8) | (y << 4) | (x)] = (c);
-                    obj_pattern_cache[0x20000 | (name << 8) | (y << 4) | (x ^ 0x0F)] = (c);
-                    obj_pattern_cache[0x40000 | (name << 8) | ((y ^ 0x0F) << 4) | (x)] = (c);
-                    obj_pattern_cache[0x60000 | (name << 8) | ((y ^ 0x0F) << 4) | (x ^ 0x0F)] = (c);
-                }
+                memcpy(&pce_ctx->obj_pattern_cache[(name << 8) | (y << 4)], row, 16);
+                memcpy(&pce_ctx->obj_pattern_cache[0x20000 | (name << 8) | (y << 4)], flip, 16);
+                memcpy(&pce_ctx->obj_pattern_cache[0x40000 | (name << 8) | ((y ^ 0x0F) << 4)], row, 16);
+                memcpy(&pce_ctx->obj_pattern_cache[0x60000 | (name << 8) | ((y ^ 0x0F) << 4)], flip, 16);
             }
         }
-        obj_name_dirty[name] = 0;
+        pce_ctx->obj_name_dirty[name] = 0;
     }
-    obj_list_index = 0;
+    pce_ctx->obj_list_index = 0;
 }
 
+#undef PLANES
+
 
 /*--------------------------------------------------------------------------*/
 /* Render functions                                                         */
@@ -257,17 +323,17 @@ void update_obj_pattern_cache(void)
 
 void render_line_8(int line)
 {
-    if((reg[0x05] & 0x80) && (plane_enable & 1))
+    if((pce_ctx->reg[0x05] & 0x80) && (plane_enable & 1))
     {
         update_bg_pattern_cache();
         render_bg_8(line);
     }
     else
     {
-        memset(&bitmap.data[(line * bitmap.pitch) + (bitmap.viewport.x * bitmap.granularity)], xlat[0][0], disp_width);
+        memset(&pce_ctx->bitmap.data[(line * pce_ctx->bitmap.pitch) + (pce_ctx->bitmap.viewport.x * pce_ctx->bitmap.granularity)], pce_ctx->xlat[0][0], pce_ctx->disp_width);
     }
 
-    if((reg[0x05] & 0x40) && (plane_enable & 2))
+    if((pce_ctx->reg[0x05] & 0x40) && (plane_enable & 2))
     {
         update_obj_pattern_cache();
         render_obj_8(line);
@@ -277,7 +343,7 @@ void render_line_8(int line)
 
 void render_line_16(int line)
 {
-    if((reg[0x05] & 0x80) && (plane_enable & 1))
+    if((pce_ctx->reg[0x05] & 0x80) && (plane_enable & 1))
     {
         update_bg_pattern_cache();
         render_bg_16(line);
@@ -285,11 +351,11 @@ void render_line_16(int line)
     else
     {
         int i;
-        uint16 *ptr = (uint16 *)&bitmap.data[(line * bitmap.pitch) + (bitmap.viewport.x * bitmap.granularity)];
-        for(i = 0; i < disp_width; i += 1) ptr[i] = pixel[0][0];            
+        uint16 *ptr = (uint16 *)&pce_ctx->bitmap.data[(line * pce_ctx->bitmap.pitch) + (pce_ctx->bitmap.viewport.x * pce_ctx->bitmap.granularity)];
+        for(i = 0; i < pce_ctx->disp_width; i += 1) ptr[i] = pce_ctx->pixel[0][0];            
     }
 
-    if((reg[0x05] & 0x40) && (plane_enable & 2))
+    if((pce_ctx->reg[0x05] & 0x40) && (plane_enable & 2))
     {
         update_obj_pattern_cache();
         render_obj_16(line);
@@ -302,11 +368,11 @@ void render_bg_8(int line)
     uint16 *nt;
     uint8 *src, *dst, palette;
     int column, name, attr, x, shift, v_line, nt_scroll;
-    int xscroll = (reg[7] & 0x03FF);
-    int end = disp_nt_width;
+    int xscroll = (pce_ctx->reg[7] & 0x03FF);
+    int end = pce_ctx->disp_nt_width;
 
     /* Offset in pattern, in lines */
-    v_line = (y_offset & 7);
+    v_line = (pce_ctx->y_offset & 7);
 
     /* Offset in name table, in columns */
     nt_scroll = (xscroll >> 3);
@@ -318,27 +384,27 @@ void render_bg_8(int line)
     if(shift) end += 1;
 
     /* Point to current offset within name table */
-    nt = (uint16 *)&vram[(y_offset >> 3) << playfield_shift];
+    nt = (uint16 *)&pce_ctx->vram[(pce_ctx->y_offset >> 3) << pce_ctx->playfield_shift];
 
     /* Point to start in line buffer */
-    dst = &bitmap.data[(line * bitmap.pitch) + 0x20 + (0 - shift)];
+    dst = &pce_ctx->bitmap.data[(line * pce_ctx->bitmap.pitch) + 0x20 + (0 - shift)];
 
     /* Draw columns */
     for(column = 0; column < end; column += 1)
     {
         /* Get attribute */
-        attr = swap16(nt[(column + nt_scroll) & playfield_row_mask]);
+        attr = swap16(nt[(column + nt_scroll) & pce_ctx->playfield_row_mask]);
 
         /* Extract name and palette bits */
         name = (attr & 0x07FF);
         palette = (attr >> 8) & 0xF0;
 
         /* Point to current pattern line */
-        src = &bg_pattern_cache[(name << 6) + (v_line << 3)];
+        src = &pce_ctx->bg_pattern_cache[(name << 6) + (v_line << 3)];
 
         for(x = 0; x < 8; x += 1)
         {
-            dst[(column << 3) | (x)] = xlat[0][(src[x] | palette)];
+            dst[(column << 3) | (x)] = pce_ctx->xlat[0][(src[x] | palette)];
         }
     }
 }
@@ -350,11 +416,11 @@ void render_bg_16(int line)
     uint8 *src, palette;
     uint16 *dst;
     int column, name, attr, x, shift, v_line, nt_scroll;
-    int xscroll = (reg[7] & 0x03FF);
-    int end = disp_nt_width;
+    int xscroll = (pce_ctx->reg[7] & 0x03FF);
+    int end = pce_ctx->disp_nt_width;
 
     /* Offset in pattern, in lines */
-    v_line = (y_offset & 7);
+    v_line = (pce_ctx->y_offset & 7);
 
     /* Offset in name table, in columns */
     nt_scroll = (xscroll >> 3);
@@ -366,28 +432,28 @@ void render_bg_16(int line)
     if(shift) end += 1;
 
     /* Point to current offset within name table */
-    nt = (uint16 *)&vram[(y_offset >> 3) << playfield_shift];
+    nt = (uint16 *)&pce_ctx->vram[(pce_ctx->y_offset >> 3) << pce_ctx->playfield_shift];
 
     /* Point to start in line buffer */
-    dst = (uint16 *)&bitmap.data[(line * bitmap.pitch) + ((0x20 + (0 - shift)) << 1)];
+    dst = (uint16 *)&pce_ctx->bitmap.data[(line * pce_ctx->bitmap.pitch) + ((0x20 + (0 - shift)) << 1)];
 
     /* Draw columns */
     for(column = 0; column < end; column += 1)
     {
         /* Get attribute */
-        attr = swap16(nt[(column + nt_scroll) & playfield_row_mask]);
+        attr = swap16(nt[(column + nt_scroll) & pce_ctx->playfield_row_mask]);
 
         /* Extract name and palette bits */
         name = (attr & 0x07FF);
         palette = (attr >> 8) & 0xF0;
 
         /* Point to current pattern line */
-        src = &bg_pattern_cache[(name << 6) + (v_line << 3)];
+        src = &pce_ctx->bg_pattern_cache[(name << 6) + (v_line << 3)];
 
         /* Draw column */
         for(x = 0; x < 8; x += 1)
         {
-            dst[(column << 3) | (x)] = pixel[0][(src[x] | palette)];
+            dst[(column << 3) | (x)] = pce_ctx->pixel[0][(src[x] | palette)];
         }
     }
 }
@@ -403,10 +469,10 @@ void render_obj_8(int line)
     int nt_line;
     uint8 *dst;
 
-    for(j = (used_sprite_index - 1); j >= 0; j -= 1)
+    for(j = (pce_ctx->used_sprite_index - 1); j >= 0; j -= 1)
     {
-        i = used_sprite_list[j];
-        p = &sprite_list[i];
+        i = pce_ctx->used_sprite_list[j];
+        p = &pce_ctx->sprite_list[i];
 
         if( (line >= p->top) && (line < p->bottom))
         {
@@ -417,25 +483,25 @@ void render_obj_8(int line)
             name = (p->name_left | name_mask);
             v_line &= 0x0F;
 
-            src = &obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
-            dst = &bitmap.data[(line * bitmap.pitch) + ((0x20+p->xpos) & 0x1ff)];
+            src = &pce_ctx->obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
+            dst = &pce_ctx->bitmap.data[(line * pce_ctx->bitmap.pitch) + ((0x20+p->xpos) & 0x1ff)];
 
             for(x = 0; x < 0x10; x += 1)
             {
                 c = src[x];
-                if(c) dst[x] = xlat[1][((c) | p->palette)];
+                if(c) dst[x] = pce_ctx->xlat[1][((c) | p->palette)];
             }
 
             if(p->flags & FLAG_CGX)
             {
                 name = (p->name_right | name_mask);
-                src = &obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
+                src = &pce_ctx->obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
                 dst += 0x10;
 
                 for(x = 0; x < 0x10; x += 1)
                 {
                     c = src[x];
-                    if(c) dst[x] = xlat[1][((c) | p->palette)];
+                    if(c) dst[x] = pce_ctx->xlat[1][((c) | p->palette)];
                 }
             }
         }
@@ -453,10 +519,10 @@ void render_obj_16(int line)
     int nt_line;
     uint16 *dst;
 
-    for(j = (used_sprite_index - 1); j >= 0; j -= 1)
+    for(j = (pce_ctx->used_sprite_index - 1); j >= 0; j -= 1)
     {
-        i = used_sprite_list[j];
-        p = &sprite_list[i];
+        i = pce_ctx->used_sprite_list[j];
+        p = &pce_ctx->sprite_list[i];
 
         if( (line >= p->top) && (line < p->bottom))
         {
@@ -467,28 +533,128 @@ void render_obj_16(int line)
             name = (p->name_left | name_mask);
             v_line &= 0x0F;
 
-            src = &obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
-            dst = (uint16 *)&bitmap.data[(line * bitmap.pitch) + (((0x20+p->xpos) & 0x1ff) * (bitmap.granularity))];
+            src = &pce_ctx->obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
+            dst = (uint16 *)&pce_ctx->bitmap.data[(line * pce_ctx->bitmap.pitch) + (((0x20+p->xpos) & 0x1ff) * (pce_ctx->bitmap.granularity))];
 
             for(x = 0; x < 0x10; x += 1)
             {
                 c = src[x];
-                if(c) dst[x] = pixel[1][((c) | p->palette)];
+                if(c) dst[x] = pce_ctx->pixel[1][((c) | p->palette)];
             }
 
             if(p->flags & FLAG_CGX)
             {
                 name = (p->name_right | name_mask);
-                src = &obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
+                src = &pce_ctx->obj_pattern_cache[(name << 8) | ((v_line & 0x0f) << 4)];
                 dst += 0x10;
 
                 for(x = 0; x < 0x10; x += 1)
                 {
                     c = src[x];
-                    if(c) dst[x] = pixel[1][((c) | p->palette)];
+                    if(c) dst[x] = pce_ctx->pixel[1][((c) | p->palette)];
                 }
             }
         }
     }
 }
 
+
+/*--------------------------------------------------------------------------*/
+/* Lazy rendering                                                           */
+/*--------------------------------------------------------------------------*/
+
+/* Copy the registers the renderer depends on */
+static void save_line_state(t_line_state *p)
+{
+    p->ctrl = pce_ctx->reg[0x05];
+    p->xscroll = pce_ctx->reg[0x07];
+    p->yofs = pce_ctx->y_offset;
+    p->shift = pce_ctx->playfield_shift;
+    p->row_mask = pce_ctx->playfield_row_mask;
+    p->width = pce_ctx->disp_width;
+    p->nt_width = pce_ctx->disp_nt_width;
+}
+
+
+static void load_line_state(t_line_state *p)
+{
+    pce_ctx->reg[0x05] = p->ctrl;
+    pce_ctx->reg[0x07] = p->xscroll;
+    pce_ctx->y_offset = p->yofs;
+    pce_ctx->playfield_shift = p->shift;
+    pce_ctx->playfield_row_mask = p->row_mask;
+    pce_ctx->disp_width = p->width;
+    pce_ctx->disp_nt_width = p->nt_width;
+}
+
+
+static void load_sprites(int gen)
+{
+    t_sprite_state *p = &pce_ctx->sprite_log[gen & (LOG_SPRITES - 1)];
+
+    memcpy(pce_ctx->sprite_list, p->list, sizeof(pce_ctx->sprite_list));
+    memcpy(pce_ctx->used_sprite_list, p->used, sizeof(pce_ctx->used_sprite_list));
+    pce_ctx->used_sprite_index = p->count;
+}
+
+
+/* Record the display state of a line instead of rendering it */
+void render_log_line(int line)
+{
+    t_line_state *p = &pce_ctx->line_log[pce_ctx->render_frame & 1][line];
+
+    p->frame = pce_ctx->render_frame;
+    p->sprites = pce_ctx->sprite_gen;
+    save_line_state(p);
+}
+
+
+/* Keep a copy of the sprite list built by make_sprite_list() */
+void render_log_sprites(void)
+{
+    t_sprite_state *p;
+
+    pce_ctx->sprite_gen += 1;
+    p = &pce_ctx->sprite_log[pce_ctx->sprite_gen & (LOG_SPRITES - 1)];
+    memcpy(p->list, pce_ctx->sprite_list, sizeof(pce_ctx->sprite_list));
+    memcpy(p->used, pce_ctx->used_sprite_list, sizeof(pce_ctx->used_sprite_list));
+    p->count = pce_ctx->used_sprite_index;
+}
+
+
+/*
+    Render the bitmap as the eager renderer would have left it: the
+    lines shown so far in this frame, then the rest of the last frame.
+    Lines use the registers and sprites they were shown with, but the
+    current VRAM and palette.
+*/
+void render_flush(void)
+{
+    t_line_state save, *p;
+    int line, gen = pce_ctx->sprite_gen;
+
+    save_line_state(&save);
+
+    for(line = 0; line < LOG_LINES; line += 1)
+    {
+        p = &pce_ctx->line_log[pce_ctx->render_frame & 1][line];
+        if(p->frame != pce_ctx->render_frame)
+        {
+            p = &pce_ctx->line_log[(pce_ctx->render_frame - 1) & 1][line];
+            if(p->frame != pce_ctx->render_frame - 1) continue;
+        }
+
+        load_line_state(p);
+        if(p->sprites != gen)
+        {
+            gen = p->sprites;
+            load_sprites(gen);
+        }
+
+        pce_ctx->render_line(line);
+    }
+
+    /* Back to the live state */
+    load_line_state(&save);
+    if(gen != pce_ctx->sprite_gen) load_sprites(pce_ctx->sprite_gen);
+}
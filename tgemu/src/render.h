@@ -20,16 +20,36 @@ typedef struct
     uint8 filler[6];        /* 0x1A */           
 } t_sprite;
 
+/* Display state a line was rendered with, for lazy rendering */
+typedef struct
+{
+    int frame;              /* Frame the line was shown in, -1= never */
+    int sprites;            /* Sprite list generation */
+    uint16 ctrl;            /* R05 (BG/OBJ enable) */
+    uint16 xscroll;         /* R07 */
+    uint32 yofs;            /* y_offset */
+    int shift;              /* playfield_shift */
+    uint32 row_mask;        /* playfield_row_mask */
+    int width;              /* disp_width */
+    uint32 nt_width;        /* disp_nt_width */
+} t_line_state;
+
+/* Saved sprite list */
+typedef struct
+{
+    t_sprite list[0x40];
+    uint8 used[0x40];
+    uint8 count;
+} t_sprite_state;
+
+#define LOG_LINES           (262)   /* Lines per frame */
+#define LOG_SPRITES         (4)     /* Sprite lists kept, power of 2 */
+
 /* Global data */
 extern int plane_enable;
-extern uint8 *xlat[2];
-extern uint16 pixel[2][0x100];
 extern uint16 pixel_lut[0x200];
-extern void (*render_line)(int line);
-extern t_sprite sprite_list[0x40];
-extern uint32 bp_lut[0x10000];
-extern uint8 used_sprite_list[0x40];
-extern uint8 used_sprite_index;
+extern uint64 bp_lut[0x100];
+extern uint64 bp_lut_flip[0x100];
 
 /* Function prototypes */
 int render_init(void);
@@ -44,6 +64,9 @@ void render_bg_8(int line);
 void render_bg_16(int line);
 void render_obj_8(int line);
 void render_obj_16(int line);
+void render_log_line(int line);
+void render_log_sprites(void);
+void render_flush(void);
 
 #endif /* _RENDER_H_ */
 
@@ -14,6 +14,10 @@
 #include "unzip.h"
 #include "fileio.h"
 #include "osd.h"
+#include "profile.h"
+#include "trace.h"
+#include "state.h"
+#include "context.h"
 
 #include <string.h>
 
@@ -0,0 +1,207 @@
+#include <stdlib.h>
+#include <zlib.h>
+#include "shared.h"
+
+/*
+    Snapshots of the bound machine, taken and restored between frames.
+    A snapshot holds what the program can change: the CPU registers with
+    the timer and interrupt state, RAM, CD RAM and backup RAM, the VDC
+    registers, VRAM and SAT, the VCE and PSG, and the sprite lists and
+    line logs of the renderer.  The ROM is only checked against a CRC;
+    the memory map, the pattern caches and the palettes are rebuilt from
+    the rest on loading.
+
+    The fields are stored as they are in memory, so a snapshot can only
+    be loaded by the same build of tgemu, for the same ROM.  Files are
+    compressed with zlib.
+*/
+
+#define STATE_MAGIC         "TGEMUSNP"
+#define STATE_VERSION       (1)
+
+typedef struct
+{
+    char magic[8];
+    uint32 version;
+    uint32 size;            /* Whole snapshot, header included */
+    uint32 rom_crc;
+    uint32 order;           /* 0x01020304 as stored by the host */
+} t_state_header;
+
+
+/* Copy every field to (save= 1) or from <p>; with <p> NULL only count
+   the bytes */
+static int transfer(uint8 *p, int save)
+{
+    int size = 0;
+
+#define FIELD(x)                                            \
+    if(p && save) memcpy(p + size, &(x), sizeof(x));        \
+    else if(p) memcpy(&(x), p + size, sizeof(x));           \
+    size += sizeof(x)
+
+    /* CPU, timer and interrupts */
+    FIELD(pce_ctx->h6280);
+    FIELD(pce_ctx->h6280_speed);
+    FIELD(pce_ctx->h6280_cycles);
+
+    /* Memory */
+    FIELD(pce_ctx->ram);
+    FIELD(pce_ctx->cdram);
+    FIELD(pce_ctx->bram);
+    FIELD(pce_ctx->save_bram);
+    FIELD(pce_ctx->joy_sel);
+    FIELD(pce_ctx->joy_clr);
+    FIELD(pce_ctx->joy_cnt);
+
+    /* VDC */
+    FIELD(pce_ctx->y_offset);
+    FIELD(pce_ctx->byr);
+    FIELD(pce_ctx->vram);
+    FIELD(pce_ctx->reg);
+    FIELD(pce_ctx->objram);
+    FIELD(pce_ctx->status);
+    FIELD(pce_ctx->latch);
+    FIELD(pce_ctx->addr_inc);
+    FIELD(pce_ctx->vram_data_latch);
+    FIELD(pce_ctx->dvssr_trigger);
+    FIELD(pce_ctx->playfield_shift);
+    FIELD(pce_ctx->playfield_col_mask);
+    FIELD(pce_ctx->playfield_row_mask);
+    FIELD(pce_ctx->disp_width);
+    FIELD(pce_ctx->disp_height);
+    FIELD(pce_ctx->disp_nt_width);
+    FIELD(pce_ctx->old_width);
+    FIELD(pce_ctx->old_height);
+
+    /* VCE, PSG */
+    FIELD(pce_ctx->vce);
+    FIELD(pce_ctx->psg);
+
+    /* Renderer */
+    FIELD(pce_ctx->sprite_list);
+    FIELD(pce_ctx->used_sprite_list);
+    FIELD(pce_ctx->used_sprite_index);
+    FIELD(pce_ctx->render_frame);
+    FIELD(pce_ctx->line_log);
+    FIELD(pce_ctx->sprite_log);
+    FIELD(pce_ctx->sprite_gen);
+
+#undef FIELD
+
+    return (size);
+}
+
+
+static void make_header(t_state_header *h)
+{
+    memset(h, 0, sizeof(t_state_header));
+    memcpy(h->magic, STATE_MAGIC, sizeof(h->magic));
+    h->version = STATE_VERSION;
+    h->size = sizeof(t_state_header) + transfer(NULL, 0);
+    h->rom_crc = crc32(0, pce_ctx->rom, sizeof(pce_ctx->rom));
+    h->order = 0x01020304;
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Memory                                                                   */
+/*--------------------------------------------------------------------------*/
+
+/* Bytes needed for a snapshot */
+int state_size(void)
+{
+    return (sizeof(t_state_header) + transfer(NULL, 0));
+}
+
+
+/* Write a snapshot of the machine to <buf>, which holds state_size()
+   bytes; returns its size */
+int state_save(uint8 *buf)
+{
+    t_state_header h;
+
+    make_header(&h);
+    memcpy(buf, &h, sizeof(h));
+    transfer(buf + sizeof(h), 1);
+    return (h.size);
+}
+
+
+/* Restore the machine from a snapshot; 0 if it was taken by another build
+   or of another ROM, and the machine is left as it was */
+int state_load(uint8 *buf, int size)
+{
+    t_state_header h;
+    int (*callback)(int irqline) = pce_ctx->h6280.irq_callback;
+    int i;
+
+    make_header(&h);
+    if(size != (int)h.size || memcmp(buf, &h, sizeof(h)))
+        return (0);
+
+    transfer(buf + sizeof(h), 0);
+
+    /* The callback is an address in this process */
+    pce_ctx->h6280.irq_callback = callback;
+    pce_ctx->h6280_halt = 0;
+
+    /* Memory map */
+    for(i = 0; i < 8; i += 1)
+        bank_set(i, pce_ctx->h6280.mmr[i]);
+
+    /* Decode every pattern again */
+    vdc_mark_range(0x0000, 0x7FFF);
+
+    vce_refresh();
+    return (1);
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Files                                                                    */
+/*--------------------------------------------------------------------------*/
+
+/* Write a compressed snapshot; 0 on error */
+int state_save_file(char *filename)
+{
+    int size = state_size();
+    uint8 *buf = malloc(size);
+    gzFile fd;
+    int res = 0;
+
+    if(!buf) return (0);
+    state_save(buf);
+
+    fd = gzopen(filename, "wb");
+    if(fd)
+    {
+        res = (gzwrite(fd, buf, size) == size);
+        if(gzclose(fd) != Z_OK) res = 0;
+    }
+    free(buf);
+    return (res);
+}
+
+
+/* Restore the machine from a snapshot file; 0 if it can't be read or
+   doesn't fit this build and ROM */
+int state_load_file(char *filename)
+{
+    int size = state_size();
+    uint8 *buf = malloc(size + 1);
+    gzFile fd;
+    int res = 0;
+
+    if(!buf) return (0);
+
+    fd = gzopen(filename, "rb");
+    if(fd)
+    {
+        /* Read one byte more to catch a longer file */
+        res = state_load(buf, gzread(fd, buf, size + 1));
+        gzclose(fd);
+    }
+    free(buf);
+    return (res);
+}
@@ -0,0 +1,12 @@
+
+#ifndef _STATE_H_
+#define _STATE_H_
+
+/* Function prototypes */
+int state_size(void);
+int state_save(uint8 *buf);
+int state_load(uint8 *buf, int size);
+int state_save_file(char *filename);
+int state_load_file(char *filename);
+
+#endif /* _STATE_H_ */
@@ -18,9 +18,6 @@
 
 #include "shared.h"
 
-t_bitmap bitmap;
-t_input input;
-t_snd snd;
 
 
 /* Pass 0 for no sound, or 8000-44100 for desired sample rate */
@@ -38,28 +35,28 @@ int system_init(int sample_rate)
 
 void audio_init(int rate)
 {
-    memset(&snd, 0, sizeof(snd));
+    memset(&pce_ctx->snd, 0, sizeof(pce_ctx->snd));
 
     /* Exit if no sound or invalid sample rate */
     if(!rate || ((rate < 8000) || (rate > 44100))) return;
     else
     {
         /* Buffer size = sample rate / frames per second */
-        snd.buffer_size = (rate / 60);
+        pce_ctx->snd.buffer_size = (rate / 60);
 
         /* Keep local copy of sample rate for sound emulation */
-        snd.sample_rate = rate;
+        pce_ctx->snd.sample_rate = rate;
 
         /* Allocate left channel buffer */
-        snd.buffer[0] = malloc(snd.buffer_size * sizeof(int16));
-        if(!snd.buffer[0]) return;
+        pce_ctx->snd.buffer[0] = malloc(pce_ctx->snd.buffer_size * sizeof(int16));
+        if(!pce_ctx->snd.buffer[0]) return;
 
         /* Allocate right channel buffer */
-        snd.buffer[1] = malloc(snd.buffer_size * sizeof(int16));
-        if(!snd.buffer[1]) return;
+        pce_ctx->snd.buffer[1] = malloc(pce_ctx->snd.buffer_size * sizeof(int16));
+        if(!pce_ctx->snd.buffer[1]) return;
 
         /* Set audio enable flag */
-        snd.enabled = 1;
+        pce_ctx->snd.enabled = 1;
     }
 }
 
@@ -68,13 +65,15 @@ void system_frame(int skip)
 {
     int line;
 
-    for(y_offset = byr, line = 0; line < 262; line += 1)
+    if(pce_ctx->render_lazy) pce_ctx->render_frame += 1;
+
+    for(pce_ctx->y_offset = pce_ctx->byr, line = 0; line < 262; line += 1)
     {
-        if((line + 64) == (reg[6] & 0x3FF))
+        if((line + 64) == (pce_ctx->reg[6] & 0x3FF))
         {
-            if(reg[5] & 0x04)
+            if(pce_ctx->reg[5] & 0x04)
             {
-                status |= STATUS_RR;
+                pce_ctx->status |= STATUS_RR;
                 h6280_set_irq_line(0, ASSERT_LINE);
             }
         }
@@ -82,29 +81,34 @@ void system_frame(int skip)
         /* VBlank */
         if(line == 240)
         {
-            if(dvssr_trigger || (reg[0x0F] & 0x10))
+            if(pce_ctx->dvssr_trigger || (pce_ctx->reg[0x0F] & 0x10))
             {
+                uint8 *sat = &pce_ctx->vram[(pce_ctx->reg[0x13] << 1) & 0xFFFE];
+
                 /* Clear DVSSR write trigger */
-                dvssr_trigger = 0;
+                pce_ctx->dvssr_trigger = 0;
 
-                /* Copy VRAM to object RAM */
-                memcpy(objram, &vram[(reg[0x13] << 1) & 0xFFFE], 0x200);
+                /* Copy VRAM to object RAM; the sprite data for the next
+                   frame only needs to be precalculated again if it changed */
+                if(memcmp(pce_ctx->objram, sat, 0x200))
+                {
+                    memcpy(pce_ctx->objram, sat, 0x200);
+                    make_sprite_list();
+                    if(pce_ctx->render_lazy) render_log_sprites();
+                }
 
                 /* Cause transfer complete interrupt if necessary */
-                if(reg[0x0F] & 0x01)
+                if(pce_ctx->reg[0x0F] & 0x01)
                 {
-                    status |= STATUS_DS;
+                    pce_ctx->status |= STATUS_DS;
                     h6280_set_irq_line(0, ASSERT_LINE);
                 }
-
-                /* Precalculate sprite data for the next frame */
-                make_sprite_list();
             }
 
             /* Cause VBlank interrupt if necessary */
-            if(reg[5] & 0x0008)
+            if(pce_ctx->reg[5] & 0x0008)
             {
-                status |= STATUS_VD;
+                pce_ctx->status |= STATUS_VD;
                 h6280_set_irq_line(0, ASSERT_LINE);
             }
         }
@@ -112,17 +116,22 @@ void system_frame(int skip)
         /* 7.16 MHz = 455 cycles per line */
         h6280_execute(455); 
 
-        /* Render a line of the display */
-        if((line < disp_height) && (!skip))
-            render_line(line);
+        /* Render a line of the display, or only note how to */
+        if((line < pce_ctx->disp_height) && (!skip))
+        {
+            if(pce_ctx->render_lazy)
+                render_log_line(line);
+            else
+                pce_ctx->render_line(line);
+        }
 
         /* Update internal line counter and wrap */
-        y_offset = (y_offset + 1) & playfield_col_mask;
+        pce_ctx->y_offset = (pce_ctx->y_offset + 1) & pce_ctx->playfield_col_mask;
 
     }
 
     /* Update audio */
-    if(snd.enabled) psg_update(snd.buffer[0], snd.buffer[1], snd.buffer_size);
+    if(pce_ctx->snd.enabled) psg_update(pce_ctx->snd.buffer[0], pce_ctx->snd.buffer[1], pce_ctx->snd.buffer_size);
 }
 
 
@@ -130,6 +139,7 @@ void system_reset(void)
 {
     pce_reset();
     vdc_reset();
+    vce_reset();
     psg_reset();
     render_reset();
 }
@@ -60,11 +60,6 @@ typedef struct
     int16 *buffer[2];   /* Signed 16-bit stereo sound data */
 }t_snd;
 
-/* Global variables */
-extern t_bitmap bitmap;
-extern t_input input;
-extern t_snd snd;
-
 /* Function prototypes */
 int system_init(int sample_rate);
 void audio_init(int rate);
@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "shared.h"
+
+/*
+    Instruction trace for lockstep runs.  Each machine records, after every
+    instruction, its address and bytes, the registers, the MPRs and the
+    cycle count, plus a hash of the RAM every <hash_every> cycles.  The
+    host runs two machines a frame at a time and compares their records
+    one by one; the last records of the previous frame are kept, so the
+    window printed around a divergence always has some history.
+*/
+
+#define WINDOW          (16)        /* Records shown before a divergence */
+#define WINDOW_AFTER    (4)         /* and after it */
+
+typedef struct
+{
+    UINT64 cycles;          /* Cycle count after the instruction */
+    uint32 ram_hash;        /* Hash of the RAM, if hashed is set */
+    uint16 pc;              /* Address of the instruction */
+    uint8 op[7];            /* Its bytes */
+    uint8 a, x, y, p, s;    /* Registers after it */
+    uint8 mmr[8];
+    uint8 hashed;
+} t_trace_rec;
+
+struct t_trace
+{
+    t_trace_rec *rec;
+    int count;
+    int max;
+    int start;              /* First record of the current frame */
+    int diff;               /* Record that differs, -1= none found */
+    int hash_every;         /* Cycles between RAM hashes, 0= none */
+    UINT64 next_hash;
+    int failed;             /* 1= out of memory, records were lost */
+};
+
+
+/*--------------------------------------------------------------------------*/
+/* Recording                                                                */
+/*--------------------------------------------------------------------------*/
+
+/* FNV-1a */
+static uint32 hash_ram(void)
+{
+    uint32 h = 2166136261u;
+    int i;
+
+    for(i = 0; i < (int)sizeof(pce_ctx->ram); i += 1)
+        h = (h ^ pce_ctx->ram[i]) * 16777619u;
+    return (h);
+}
+
+
+/* Called after each instruction with its address and the cycle count it
+   finished at */
+void trace_insn(int pc, UINT64 cycles)
+{
+    t_trace *t = pce_ctx->trace;
+    t_trace_rec *r;
+    int i;
+
+    if(t->failed) return;
+    if(t->count == t->max)
+    {
+        r = realloc(t->rec, 2 * t->max * sizeof(t_trace_rec));
+        if(!r)
+        {
+            t->failed = 1;
+            return;
+        }
+        t->rec = r;
+        t->max *= 2;
+    }
+    r = &t->rec[t->count++];
+    memset(r, 0, sizeof(t_trace_rec));
+
+    r->cycles = cycles;
+    r->pc = pc;
+    for(i = 0; i < 7; i += 1)
+    {
+        int addr = (pc + i) & 0xFFFF;
+        uint8 *p = pce_ctx->read_ptr[addr >> 13];
+        r->op[i] = p ? p[addr & 0x1FFF] : 0xFF;
+    }
+    r->a = pce_ctx->h6280.a;
+    r->x = pce_ctx->h6280.x;
+    r->y = pce_ctx->h6280.y;
+    r->p = pce_ctx->h6280.p;
+    r->s = pce_ctx->h6280.sp.b.l;
+    memcpy(r->mmr, pce_ctx->h6280.mmr, 8);
+
+    if(t->hash_every && cycles >= t->next_hash)
+    {
+        r->ram_hash = hash_ram();
+        r->hashed = 1;
+        t->next_hash = cycles + t->hash_every;
+    }
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Comparison                                                               */
+/*--------------------------------------------------------------------------*/
+
+/* Begin a new frame, keeping the end of the last one as history */
+void trace_frame(t_trace *t)
+{
+    int keep = t->count < WINDOW ? t->count : WINDOW;
+
+    memmove(t->rec, &t->rec[t->count - keep], keep * sizeof(t_trace_rec));
+    t->count = t->start = keep;
+    t->diff = -1;
+}
+
+
+/* Compare the current frame of two traces; name what differs first and
+   mark the record in both, NULL if they agree */
+const char *trace_compare(t_trace *a, t_trace *b)
+{
+    int i;
+
+    for(i = a->start; i < a->count && i < b->count; i += 1)
+    {
+        t_trace_rec *x = &a->rec[i], *y = &b->rec[i];
+        const char *what = NULL;
+
+        if(x->pc != y->pc) what = "PCs";
+        else if(x->a != y->a) what = "A registers";
+        else if(x->x != y->x) what = "X registers";
+        else if(x->y != y->y) what = "Y registers";
+        else if(x->p != y->p) what = "flags";
+        else if(x->s != y->s) what = "stack pointers";
+        else if(memcmp(x->mmr, y->mmr, 8)) what = "MPRs";
+        else if(x->cycles != y->cycles) what = "cycle counts";
+        else if(x->hashed != y->hashed || x->ram_hash != y->ram_hash) what = "RAM contents";
+
+        if(what)
+        {
+            a->diff = b->diff = i;
+            return (what);
+        }
+    }
+    if(a->count != b->count)
+    {
+        a->diff = b->diff = i;
+        return ("instruction counts");
+    }
+    return (NULL);
+}
+
+
+/* 1 if records were lost for lack of memory; the trace can't be
+   compared then */
+int trace_failed(t_trace *t)
+{
+    return (t->failed);
+}
+
+
+/* Print the records around the one that differs, or the last ones */
+void trace_window(t_trace *t, char *title, FILE *fp)
+{
+    int at = t->diff >= 0 ? t->diff : t->count;
+    int from = at > WINDOW ? at - WINDOW : 0;
+    int to = at + WINDOW_AFTER < t->count ? at + WINDOW_AFTER + 1 : t->count;
+    int i, j;
+
+    fprintf(fp, "%s:\n", title);
+    for(i = from; i < to; i += 1)
+    {
+        t_trace_rec *r = &t->rec[i];
+        char insn[0x40], bytes[0x20];
+        int len = h6280_dasm(insn, r->pc, r->op);
+
+        for(j = 0; j < len; j += 1)
+            sprintf(&bytes[j * 3], "%02X ", r->op[j]);
+        fprintf(fp, "%c %04X  %-21s %-21s A:%02X X:%02X Y:%02X P:%02X S:%02X MPR:",
+            i == t->diff ? '>' : ' ', r->pc, bytes, insn, r->a, r->x, r->y, r->p, r->s);
+        for(j = 0; j < 8; j += 1)
+            fprintf(fp, "%02X", r->mmr[j]);
+        fprintf(fp, " %llu", (unsigned long long)r->cycles);
+        if(r->hashed) fprintf(fp, " RAM:%08X", r->ram_hash);
+        fprintf(fp, "\n");
+    }
+    if(i == t->diff) fprintf(fp, ">   (no more instructions this frame)\n");
+}
+
+
+/*--------------------------------------------------------------------------*/
+/* Setup                                                                    */
+/*--------------------------------------------------------------------------*/
+
+/* New, empty trace; NULL if out of memory */
+t_trace *trace_new(int hash_every)
+{
+    t_trace *t = calloc(1, sizeof(t_trace));
+    if(!t) return (NULL);
+
+    t->max = 0x10000;
+    t->rec = malloc(t->max * sizeof(t_trace_rec));
+    if(!t->rec)
+    {
+        free(t);
+        return (NULL);
+    }
+    t->diff = -1;
+    t->hash_every = hash_every;
+    return (t);
+}
+
+
+void trace_free(t_trace *t)
+{
+    if(!t) return;
+    free(t->rec);
+    free(t);
+}
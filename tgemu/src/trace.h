@@ -0,0 +1,19 @@
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <stdio.h>
+
+/* Instruction trace of one machine, see trace.c */
+typedef struct t_trace t_trace;
+
+/* Function prototypes */
+t_trace *trace_new(int hash_every);
+void trace_insn(int pc, UINT64 cycles);
+void trace_frame(t_trace *t);
+const char *trace_compare(t_trace *a, t_trace *b);
+int trace_failed(t_trace *t);
+void trace_window(t_trace *t, char *title, FILE *fp);
+void trace_free(t_trace *t);
+
+#endif /* _TRACE_H_ */
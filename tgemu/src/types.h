@@ -5,6 +5,7 @@
 typedef unsigned char uint8;
 typedef unsigned short int uint16;
 typedef unsigned int uint32;
+typedef unsigned long long uint64;
 
 typedef signed char int8;
 typedef signed short int int16;
@@ -1,7 +1,11 @@
 
 #include "shared.h"
 
-t_vce vce;
+
+void vce_reset(void)
+{
+    memset(&pce_ctx->vce, 0, sizeof(pce_ctx->vce));
+}
 
 void vce_w(int address, int data)
 {
@@ -11,64 +15,99 @@ void vce_w(int address, int data)
     {
         case 0x404: /* Data */
             {
-                if(data != vce.data[((vce.addr & 0x1FF) << 1) | (msb)])
+                if(data != pce_ctx->vce.data[((pce_ctx->vce.addr & 0x1FF) << 1) | (msb)])
                 {
-                    vce.data[((vce.addr & 0x1FF) << 1) | (msb)] = data;
+                    pce_ctx->vce.data[((pce_ctx->vce.addr & 0x1FF) << 1) | (msb)] = data;
 
-                    if((vce.addr & 0x0F) != 0x00)
+                    if((pce_ctx->vce.addr & 0x0F) != 0x00)
                     {
-                        uint16 temp = *(uint16 *)&vce.data[(vce.addr << 1)];
+                        uint16 temp = *(uint16 *)&pce_ctx->vce.data[(pce_ctx->vce.addr << 1)];
 #ifndef LSB_FIRST
                         temp = (temp >> 8) | (temp << 8);
 #endif
-                        pixel[(vce.addr >> 8) & 1][(vce.addr & 0xFF)] = pixel_lut[temp];
+                        pce_ctx->pixel[(pce_ctx->vce.addr >> 8) & 1][(pce_ctx->vce.addr & 0xFF)] = pixel_lut[temp];
                         temp = (temp >> 1) & 0xFF;
-                        xlat[(vce.addr >> 8) & 1][(vce.addr & 0xFF)] = temp;
+                        pce_ctx->xlat[(pce_ctx->vce.addr >> 8) & 1][(pce_ctx->vce.addr & 0xFF)] = temp;
                     }
 
                     /* Update overscan color */
-                    if((vce.addr & 0x0F) == 0x00)
+                    if((pce_ctx->vce.addr & 0x0F) == 0x00)
                     {
                         int n;
-                        uint16 temp = *(uint16 *)&vce.data[0];
+                        uint16 temp = *(uint16 *)&pce_ctx->vce.data[0];
 #ifndef LSB_FIRST
                         temp = (temp >> 8) | (temp << 8);
 #endif
                         for(n = 0; n < 0x10; n += 1)
-                            pixel[0][(n << 4)] = pixel_lut[temp];
+                            pce_ctx->pixel[0][(n << 4)] = pixel_lut[temp];
                         temp = (temp >> 1) & 0xFF;
                         for(n = 0; n < 0x10; n += 1)
-                            xlat[0][(n << 4)] = temp;
+                            pce_ctx->xlat[0][(n << 4)] = temp;
                     }
                 }
             }
 
             /* Increment VCE address on access to the MSB data port */
-            if(msb) vce.addr += 1;
+            if(msb) pce_ctx->vce.addr += 1;
             break;
 
         case 0x402: /* Address */
             if(msb)
-                vce.addr = (vce.addr & 0x00FF) | ((data & 1) << 8);
+                pce_ctx->vce.addr = (pce_ctx->vce.addr & 0x00FF) | ((data & 1) << 8);
             else
-                vce.addr = (vce.addr & 0x0100) | (data);
+                pce_ctx->vce.addr = (pce_ctx->vce.addr & 0x0100) | (data);
             break;
 
         case 0x0400: /* Control */
-            if(!msb) vce.ctrl = (data & 1);
+            if(!msb) pce_ctx->vce.ctrl = (data & 1);
             break;
     }
 }
 
 
+
+/* Rebuild the pixel tables from the color data, as the writes that
+   stored it left them */
+void vce_refresh(void)
+{
+    int i, n;
+    uint16 temp;
+
+    memset(pce_ctx->pixel, 0, sizeof(pce_ctx->pixel));
+    memset(pce_ctx->xlat, 0, sizeof(pce_ctx->xlat));
+
+    for(i = 0; i < 0x200; i += 1)
+    {
+        if((i & 0x0F) == 0x00) continue;
+        temp = *(uint16 *)&pce_ctx->vce.data[(i << 1)];
+#ifndef LSB_FIRST
+        temp = (temp >> 8) | (temp << 8);
+#endif
+        pce_ctx->pixel[(i >> 8) & 1][(i & 0xFF)] = pixel_lut[temp];
+        pce_ctx->xlat[(i >> 8) & 1][(i & 0xFF)] = (temp >> 1) & 0xFF;
+    }
+
+    /* Overscan color */
+    temp = *(uint16 *)&pce_ctx->vce.data[0];
+#ifndef LSB_FIRST
+    temp = (temp >> 8) | (temp << 8);
+#endif
+    for(n = 0; n < 0x10; n += 1)
+    {
+        pce_ctx->pixel[0][(n << 4)] = pixel_lut[temp];
+        pce_ctx->xlat[0][(n << 4)] = (temp >> 1) & 0xFF;
+    }
+}
+
+
 int vce_r(int address)
 {
     int msb = (address & 1);
 
     if((address & ~1) == 0x0404)
     {
-        uint8 temp = vce.data[((vce.addr & 0x1FF) << 1) | (msb)];
-        if(msb) vce.addr += 1;
+        uint8 temp = pce_ctx->vce.data[((pce_ctx->vce.addr & 0x1FF) << 1) | (msb)];
+        if(msb) pce_ctx->vce.addr += 1;
         return (temp);
     }
 
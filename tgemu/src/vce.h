@@ -10,11 +10,10 @@ typedef struct
     uint16 addr;
 }t_vce;
 
-/* Global data */
-extern t_vce vce;
-
 /* Function prototypes */
+void vce_reset(void);
 void vce_w(int address, int data);
 int vce_r(int address);
+void vce_refresh(void);
 
 #endif /* _VCE_H_ */
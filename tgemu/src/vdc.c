@@ -3,60 +3,29 @@
 
 #define LOG_DMA     0
 
-uint32 y_offset=0;
-uint32 byr=0;
-uint8 vram[0x10000];
-uint16 reg[0x20];
-uint8 objram[0x200];
-uint8 status;
-uint8 latch;
-uint8 addr_inc;
-uint8 vram_data_latch = 0;
-uint8 dvssr_trigger = 0;
-int playfield_shift = 6;
-uint32 playfield_col_mask = 0xFF;
-uint32 playfield_row_mask = 0x1F;
-int disp_width;
-int disp_height;
-uint32 disp_nt_width;
-uint16 *vramw = (uint16 *)&vram[0];
-uint16 *objramw = (uint16 *)&objram[0];
-int old_width = 0;
-int old_height = 0;
 int playfield_shift_table[] = {6, 7, 8, 8};
 int playfield_row_mask_table[] = {0x1F, 0x3F, 0x7F, 0x7F};
 
-
-uint8 bg_name_dirty[0x800];
-uint16 bg_name_list[0x800];
-uint16 bg_list_index;
-uint8 bg_pattern_cache[0x20000];
-
-uint16 obj_name_dirty[0x200];
-uint16 obj_name_list[0x200];
-uint16 obj_list_index;
-uint8 obj_pattern_cache[0x80000]; 
-
 #define MARK_BG_DIRTY(addr)                                     \
 {                                                               \
     int name = (addr >> 4) & 0x7FF;                             \
-    if(bg_name_dirty[name] == 0)                                \
+    if(pce_ctx->bg_name_dirty[name] == 0)                       \
     {                                                           \
-        bg_name_list[bg_list_index] = name;                     \
-        bg_list_index += 1;                                     \
+        pce_ctx->bg_name_list[pce_ctx->bg_list_index] = name;   \
+        pce_ctx->bg_list_index += 1;                            \
     }                                                           \
-    bg_name_dirty[name] |= (1 << (addr & 0x07));                                 \
+    pce_ctx->bg_name_dirty[name] |= (1 << (addr & 0x07));                        \
 }
 
 #define MARK_OBJ_DIRTY(addr)                                    \
 {                                                               \
     int name = (addr >> 6) & 0x1FF;                             \
-    if(obj_name_dirty[name] == 0)                               \
+    if(pce_ctx->obj_name_dirty[name] == 0)                      \
     {                                                           \
-        obj_name_list[obj_list_index] = name;                   \
-        obj_list_index += 1;                                    \
+        pce_ctx->obj_name_list[pce_ctx->obj_list_index] = name; \
+        pce_ctx->obj_list_index += 1;                           \
     }                                                           \
-    obj_name_dirty[name] |= (1 << (addr & 0x0F));               \
+    pce_ctx->obj_name_dirty[name] |= (1 << (addr & 0x0F));      \
 }
 
 
@@ -73,17 +42,17 @@ int vdc_r(int offset)
     switch(offset)
     {
         case 0x0000: /* Register latch / status flags */
-            temp = status;
-            status = 0;
+            temp = pce_ctx->status;
+            pce_ctx->status = 0;
             h6280_set_irq_line(0, CLEAR_LINE);
             return (temp);
 
         case 0x0002: /* Data port (LSB) */
         case 0x0003: /* Data port (MSB) */
-            if(latch == 0x02)
+            if(pce_ctx->latch == 0x02)
             {
-                temp = (vram[((reg[1] << 1) | (msb)) & 0xFFFF]);
-                if(msb) reg[1] += addr_inc;
+                temp = (pce_ctx->vram[((pce_ctx->reg[1] << 1) | (msb)) & 0xFFFF]);
+                if(msb) pce_ctx->reg[1] += pce_ctx->addr_inc;
                 return (temp);
             }
             break;
@@ -99,83 +68,83 @@ void vdc_w(int offset, int data)
     switch(offset)
     {
         case 0x0000: /* Register latch / status flags */
-            latch = (data & 0x1F);
+            pce_ctx->latch = (data & 0x1F);
             break;
 
         case 0x0002: /* Data port (LSB) */
         case 0x0003: /* Data port (MSB) */
 
             if(msb)
-                reg[latch] = (reg[latch] & 0x00FF) | (data << 8);
+                pce_ctx->reg[pce_ctx->latch] = (pce_ctx->reg[pce_ctx->latch] & 0x00FF) | (data << 8);
             else
-                reg[latch] = (reg[latch] & 0xFF00) | (data);
+                pce_ctx->reg[pce_ctx->latch] = (pce_ctx->reg[pce_ctx->latch] & 0xFF00) | (data);
 
-            switch(latch)
+            switch(pce_ctx->latch)
             {
                 case 0x02: 
                     if(msb)
                     {
                         /* Form complete VRAM word */
-                        uint16 vram_word = (data << 8 | vram_data_latch);
+                        uint16 vram_word = (data << 8 | pce_ctx->vram_data_latch);
 
                         /* Check if data is new or not */
-                        if(vram_word != swap16(vramw[(reg[0] & 0x7FFF)]))
+                        if(vram_word != swap16(vramw[(pce_ctx->reg[0] & 0x7FFF)]))
                         {
                             /* Write data to VRAM */
-                            vramw[(reg[0] & 0x7FFF)] = swap16(vram_word);
+                            vramw[(pce_ctx->reg[0] & 0x7FFF)] = swap16(vram_word);
 
                             /* Mark pattern dirty tables */
-                            MARK_BG_DIRTY(reg[0]);
-                            MARK_OBJ_DIRTY(reg[0]);
+                            MARK_BG_DIRTY(pce_ctx->reg[0]);
+                            MARK_OBJ_DIRTY(pce_ctx->reg[0]);
                         }
 
-                        reg[0] += addr_inc;
+                        pce_ctx->reg[0] += pce_ctx->addr_inc;
                     }
                     else
                     {
-                        vram_data_latch = data;
+                        pce_ctx->vram_data_latch = data;
                     }
                     break;
 
                 case 0x08:
-                    y_offset = byr = (reg[0x08] & 0x1FF);
-                    y_offset &= playfield_col_mask;
+                    pce_ctx->y_offset = pce_ctx->byr = (pce_ctx->reg[0x08] & 0x1FF);
+                    pce_ctx->y_offset &= pce_ctx->playfield_col_mask;
                     break;
 
                 case 0x05:
                     if(msb) {
                         static uint8 add_tbl[] = {1, 32, 64, 128};
-                        addr_inc = add_tbl[(data >> 3) & 3];
+                        pce_ctx->addr_inc = add_tbl[(data >> 3) & 3];
                     }
                     break;
 
                 case 0x09:
                     if(!msb) {
-                        playfield_shift = playfield_shift_table[(data >> 4) & 3];
-                        playfield_row_mask = playfield_row_mask_table[(data >> 4) & 3];
-                        playfield_col_mask = ((data >> 6) & 1) ? 0x01FF : 0x00FF;
+                        pce_ctx->playfield_shift = playfield_shift_table[(data >> 4) & 3];
+                        pce_ctx->playfield_row_mask = playfield_row_mask_table[(data >> 4) & 3];
+                        pce_ctx->playfield_col_mask = ((data >> 6) & 1) ? 0x01FF : 0x00FF;
                     }
                     break;
 
                 case 0x0B:
-                    disp_width = (1+(reg[0x0B] & 0x3F)) << 3;
-                    disp_nt_width = (disp_width >> 3);
+                    pce_ctx->disp_width = (1+(pce_ctx->reg[0x0B] & 0x3F)) << 3;
+                    pce_ctx->disp_nt_width = (pce_ctx->disp_width >> 3);
 
-                    if(disp_width != old_width) {
-                        bitmap.viewport.ow = bitmap.viewport.w;
-                        bitmap.viewport.w = old_width = disp_width;
-                        bitmap.viewport.changed = 1;
+                    if(pce_ctx->disp_width != pce_ctx->old_width) {
+                        pce_ctx->bitmap.viewport.ow = pce_ctx->bitmap.viewport.w;
+                        pce_ctx->bitmap.viewport.w = pce_ctx->old_width = pce_ctx->disp_width;
+                        pce_ctx->bitmap.viewport.changed = 1;
                     }
 
                     break;
 
                 case 0x0D:
-                    disp_height = 1+(reg[0x0D] & 0x01FF);
+                    pce_ctx->disp_height = 1+(pce_ctx->reg[0x0D] & 0x01FF);
 
-                    if(disp_height != old_height) {
-                        bitmap.viewport.oh = bitmap.viewport.h;
-                        bitmap.viewport.h = old_height = disp_height;
-                        bitmap.viewport.changed = 1;
+                    if(pce_ctx->disp_height != pce_ctx->old_height) {
+                        pce_ctx->bitmap.viewport.oh = pce_ctx->bitmap.viewport.h;
+                        pce_ctx->bitmap.viewport.h = pce_ctx->old_height = pce_ctx->disp_height;
+                        pce_ctx->bitmap.viewport.changed = 1;
                     }
                     break;
 
@@ -184,7 +153,7 @@ void vdc_w(int offset, int data)
                     break;
 
                 case 0x13:
-                    if(msb) dvssr_trigger = 1;
+                    if(msb) pce_ctx->dvssr_trigger = 1;
                     break;
             }
     }
@@ -201,25 +170,32 @@ int vdc_init(void)
 
 void vdc_reset(void)
 {
-    memset(vram, 0, 0x10000);
-    memset(reg, 0, 0x20);
-    status = latch = 0;
-    addr_inc = 1;
-    dvssr_trigger = 0;
-
-    playfield_shift = 6;
-    playfield_row_mask = 0x1f;
-    playfield_col_mask = 0xff;
-
-    memset(bg_name_dirty, 0, sizeof(bg_name_dirty));
-    memset(bg_name_list, 0, sizeof(bg_name_list));
-    memset(bg_pattern_cache, 0, sizeof(bg_pattern_cache));
-    bg_list_index = 0;
-
-    memset(obj_name_dirty, 0, sizeof(obj_name_dirty));
-    memset(obj_name_list, 0, sizeof(obj_name_list));
-    memset(obj_pattern_cache, 0, sizeof(obj_pattern_cache));
-    obj_list_index = 0;
+    memset(pce_ctx->vram, 0, 0x10000);
+    memset(pce_ctx->reg, 0, sizeof(pce_ctx->reg));
+    memset(pce_ctx->objram, 0, sizeof(pce_ctx->objram));
+    pce_ctx->status = pce_ctx->latch = 0;
+    pce_ctx->addr_inc = 1;
+    pce_ctx->vram_data_latch = 0;
+    pce_ctx->dvssr_trigger = 0;
+    pce_ctx->y_offset = pce_ctx->byr = 0;
+
+    pce_ctx->disp_width = pce_ctx->disp_height = 0;
+    pce_ctx->disp_nt_width = 0;
+    pce_ctx->old_width = pce_ctx->old_height = 0;
+
+    pce_ctx->playfield_shift = 6;
+    pce_ctx->playfield_row_mask = 0x1f;
+    pce_ctx->playfield_col_mask = 0xff;
+
+    memset(pce_ctx->bg_name_dirty, 0, sizeof(pce_ctx->bg_name_dirty));
+    memset(pce_ctx->bg_name_list, 0, sizeof(pce_ctx->bg_name_list));
+    memset(pce_ctx->bg_pattern_cache, 0, sizeof(pce_ctx->bg_pattern_cache));
+    pce_ctx->bg_list_index = 0;
+
+    memset(pce_ctx->obj_name_dirty, 0, sizeof(pce_ctx->obj_name_dirty));
+    memset(pce_ctx->obj_name_list, 0, sizeof(pce_ctx->obj_name_list));
+    memset(pce_ctx->obj_pattern_cache, 0, sizeof(pce_ctx->obj_pattern_cache));
+    pce_ctx->obj_list_index = 0;
 }
 
 
@@ -228,36 +204,68 @@ void vdc_shutdown(void)
 }
 
 
+/* Mark every pattern holding a word of VRAM from <lo> to <hi> dirty as a
+   whole, for transfers too big to mark word by word */
+void vdc_mark_range(int lo, int hi)
+{
+    int name;
+
+    for(name = (lo >> 4); name <= (hi >> 4); name += 1)
+    {
+        if(pce_ctx->bg_name_dirty[name] == 0)
+        {
+            pce_ctx->bg_name_list[pce_ctx->bg_list_index] = name;
+            pce_ctx->bg_list_index += 1;
+        }
+        pce_ctx->bg_name_dirty[name] = 0xFF;
+    }
+
+    for(name = (lo >> 6); name <= (hi >> 6); name += 1)
+    {
+        if(pce_ctx->obj_name_dirty[name] == 0)
+        {
+            pce_ctx->obj_name_list[pce_ctx->obj_list_index] = name;
+            pce_ctx->obj_list_index += 1;
+        }
+        pce_ctx->obj_name_dirty[name] = 0xFFFF;
+    }
+}
+
+
 void vdc_do_dma(void)
 {
-    int did = (reg[0x0F] >> 3) & 1;
-    int sid = (reg[0x0F] >> 2) & 1;
-    int dvc = (reg[0x0F] >> 1) & 1;
-    int sour = (reg[0x10] & 0x7FFF);
-    int desr = (reg[0x11] & 0x7FFF);
-    int lenr = (reg[0x12] & 0x7FFF);
+    int did = (pce_ctx->reg[0x0F] >> 3) & 1;
+    int sid = (pce_ctx->reg[0x0F] >> 2) & 1;
+    int dvc = (pce_ctx->reg[0x0F] >> 1) & 1;
+    int sour = (pce_ctx->reg[0x10] & 0x7FFF);
+    int desr = (pce_ctx->reg[0x11] & 0x7FFF);
+    int lenr = (pce_ctx->reg[0x12] & 0x7FFF);
+    int lo = 0x8000, hi = -1;
 
 #if LOG_DMA
     error("DMA S:%04X%c D:%04X%c L:%04X\n", sour, (sid) ? '-' : '+', desr, (did) ? '-' : '+', lenr);
 #endif
 
-    /* Do VRAM -> VRAM transfer and update pattern caches */
+    /* Do VRAM -> VRAM transfer, noting the range of words it changed */
     do {
         uint16 temp = swap16(vramw[(sour & 0x7FFF)]);
 
         if(temp != swap16(vramw[(desr & 0x7FFF)]))
         {
             vramw[(desr & 0x7FFF)] = swap16(temp);
-            MARK_BG_DIRTY(desr);
-            MARK_OBJ_DIRTY(desr);
+            if((desr & 0x7FFF) < lo) lo = (desr & 0x7FFF);
+            if((desr & 0x7FFF) > hi) hi = (desr & 0x7FFF);
         }
 
         sour = (sid) ? (sour - 1) : (sour + 1);
         desr = (did) ? (desr - 1) : (desr + 1);
     } while (lenr--);
 
+    /* Update pattern caches */
+    if(hi >= lo) vdc_mark_range(lo, hi);
+
     /* Set VRAM -> VRAM transfer completed flag */
-    status |= STATUS_DV;
+    pce_ctx->status |= STATUS_DV;
 
     /* Cause IRQ1 if enabled */
     if(dvc)
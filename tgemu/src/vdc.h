@@ -12,36 +12,12 @@
 #define STATUS_CR       (0x01)  /* Sprite collision */
 
 /* Global data */
-extern uint32 y_offset;
-extern uint32 byr;
-extern uint8 vram[0x10000];
-extern uint16 reg[0x20];
-extern uint8 objram[0x200];
-extern uint8 status;
-extern uint8 latch;
-extern uint8 addr_inc;
-extern uint8 vram_data_latch;
-extern uint8 dvssr_trigger;
-extern int playfield_shift;
-extern uint32 playfield_col_mask;
-extern uint32 playfield_row_mask;
-extern int disp_width;
-extern int disp_height;
-extern uint32 disp_nt_width;
-extern uint16 *vramw;
-extern uint16 *objramw;
-extern int old_width;
-extern int old_height;
 extern int playfield_shift_table[];
 extern int playfield_row_mask_table[];
-extern uint8 bg_name_dirty[0x800];
-extern uint16 bg_name_list[0x800];
-extern uint16 bg_list_index;
-extern uint8 bg_pattern_cache[0x20000];
-extern uint16 obj_name_dirty[0x200];
-extern uint16 obj_name_list[0x200];
-extern uint16 obj_list_index;
-extern uint8 obj_pattern_cache[0x80000]; 
+
+/* VRAM and sprite RAM of the current context, as words */
+#define vramw           ((uint16 *)pce_ctx->vram)
+#define objramw         ((uint16 *)pce_ctx->objram)
 
 /* Function prototypes */
 int vdc_r(int offset);
@@ -50,6 +26,7 @@ int vdc_init(void);
 void vdc_reset(void);
 void vdc_shutdown(void);
 void vdc_do_dma(void);
+void vdc_mark_range(int lo, int hi);
 void vdc_ctrl_w(int data);
 int vdc_ctrl_r(void);
 void vdc_data_w(int offset, int data);